@@ -0,0 +1,51 @@
+// Live values of the device info page from /json, values without field on the page are skipped
+var xmlhttp = new XMLHttpRequest();
+function show(id, unitId, v) {
+var field = document.getElementById(id);
+if (field && v) {
+field.value = v.Value;
+document.getElementById(unitId).innerHTML = v.Unit;
+}
+}
+xmlhttp.onreadystatechange = function() {
+if (this.readyState == 4 && this.status == 200) {
+var myObj = JSON.parse(this.responseText);
+var net = myObj.Device.NetworkParameter;
+var mv = myObj.Device.MeasuringValues;
+document.getElementById('cssid').value = net.WLANClientSSID;
+document.getElementById('sssid').value = net.WLANServerSSID;
+show('heapsize', 'hunit', myObj.Device.Chip.FreeHeapSize);
+show('strength', 'sunit', net.FieldStrength);
+show('quality', 'qunit', net.ConnectionQuality);
+document.getElementById('quality2').innerHTML = net.ConnectionQuality.Value;
+show('temp', 'tunit', mv.DeviceTemperature);
+show('winddir', 'dirunit', mv.WindDirection);
+show('resolution', 'resunit', mv.Resolution);
+show('windspeed', 'speedunit', mv.WindSpeed);
+show('dwspeed', 'dwunit', mv.DownWindSpeed);
+show('sensor1', 's1unit', mv.Sensor1);
+show('sensor2', 's2unit', mv.Sensor2);
+show('pcounter', 'pcunit', mv.PulseCounter);
+show('time1', 't1unit', mv.Time1);
+show('time2', 't2unit', mv.Time2);
+show('magnitude', 'magnitudeunit', mv.MagFluxDensity);
+show('magsensor', 'magunit', mv.MagnetSensor);
+show('atemp', 'aunit', mv.AirTemperature);
+show('pres', 'punit', mv.AirPressure);
+show('hum', 'humunit', mv.AirHumidity);
+show('rotspeed', 'rotunit', mv.RotationSpeed);
+var info2 = document.getElementById('info2');
+if (net.ServerMode == 4) {
+document.getElementById('info').innerHTML = '(Demo Mode)';
+if (info2) {info2.innerHTML = '(Demo Mode)';}
+}
+else {
+document.getElementById('info').innerHTML = '';
+}
+}
+};
+function read_json() {
+xmlhttp.open('GET', '/json', true);
+xmlhttp.send();
+}
+setInterval(function(){read_json(); }, 1000);
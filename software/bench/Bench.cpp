@@ -0,0 +1,230 @@
+// Runner of the micro-benchmarks with allocation counting
+//
+// Usage: program [--filter=<text>] [--min_time=<s>] [--out=<file>]
+//   --filter    only benchmarks with <text> in the name
+//   --min_time  minimum run time per benchmark in [s] (default 0.5)
+//   --out       result file (default bench_results.json)
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <new>
+#include <string>
+#include <vector>
+#include <time.h>
+#include "Arduino.h"
+#include "Bench.h"
+
+// Allocation counting, all heap allocations of the firmware go through operator new (String, std::string)
+// Each block has a header with its size for the heap in use and its peak
+static std::atomic<uint64_t> allocCount(0);
+static std::atomic<uint64_t> allocBytes(0);
+static std::atomic<int64_t> heapUsed(0);
+static std::atomic<int64_t> heapPeak(0);
+
+static const size_t allocHeader = alignof(std::max_align_t);
+
+static void *countedAlloc(size_t size)
+{
+  allocCount.fetch_add(1, std::memory_order_relaxed);
+  allocBytes.fetch_add(size, std::memory_order_relaxed);
+  char *p = (char *)malloc(allocHeader + size);
+  if (!p)
+  {
+    return nullptr;
+  }
+  *(size_t *)p = size;
+  int64_t used = heapUsed.fetch_add(size, std::memory_order_relaxed) + size;
+  int64_t peak = heapPeak.load(std::memory_order_relaxed);
+  while (used > peak && !heapPeak.compare_exchange_weak(peak, used, std::memory_order_relaxed))
+  {
+  }
+  return p + allocHeader;
+}
+
+static void *checkedAlloc(size_t size)
+{
+  void *p = countedAlloc(size);
+  if (!p)
+  {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+static void countedFree(void *p)
+{
+  if (p)
+  {
+    char *block = (char *)p - allocHeader;
+    heapUsed.fetch_sub(*(size_t *)block, std::memory_order_relaxed);
+    free(block);
+  }
+}
+
+void *operator new(size_t size) { return checkedAlloc(size); }
+void *operator new[](size_t size) { return checkedAlloc(size); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept { return countedAlloc(size); }
+void *operator new[](size_t size, const std::nothrow_t &) noexcept { return countedAlloc(size); }
+void operator delete(void *p) noexcept { countedFree(p); }
+void operator delete[](void *p) noexcept { countedFree(p); }
+void operator delete(void *p, size_t) noexcept { countedFree(p); }
+void operator delete[](void *p, size_t) noexcept { countedFree(p); }
+
+namespace bench
+{
+  struct Entry
+  {
+    const char *name;
+    Function function;
+  };
+
+  struct Result
+  {
+    std::string name;
+    uint64_t iterations;
+    double realTime;        // [ns/op]
+    double cpuTime;         // [ns/op]
+    double allocs;          // [n/op]
+    double bytes;           // [Byte/op]
+    uint64_t peak;          // Max heap in use above the start in [Byte]
+  };
+
+  static std::vector<Entry> &entries()
+  {
+    static std::vector<Entry> list;
+    return list;
+  }
+
+  Registration::Registration(const char *name, Function function)
+  {
+    entries().push_back({name, function});
+  }
+
+  static double threadCpuNs()
+  {
+    timespec t;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+    return double(t.tv_sec) * 1e9 + double(t.tv_nsec);
+  }
+
+  // Runs the benchmark with increasing iterations until the minimum time is reached
+  static Result run(const Entry &entry, double minTime)
+  {
+    Result result = {entry.name, 0, 0, 0, 0, 0, 0};
+    uint64_t iterations = 1;
+    while (true)
+    {
+      uint64_t count = allocCount;
+      uint64_t bytes = allocBytes;
+      int64_t used = heapUsed;
+      heapPeak = used;
+      double cpuStart = threadCpuNs();
+      auto start = std::chrono::steady_clock::now();
+      State state(iterations);
+      entry.function(state);
+      double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+      double cpu = threadCpuNs() - cpuStart;
+      if (elapsed >= minTime * 1e9 || iterations >= (1ULL << 40))
+      {
+        result.iterations = iterations;
+        result.realTime = elapsed / iterations;
+        result.cpuTime = cpu / iterations;
+        result.allocs = double(allocCount - count) / iterations;
+        result.bytes = double(allocBytes - bytes) / iterations;
+        result.peak = uint64_t(heapPeak - used);
+        return result;
+      }
+      // Next try with the iterations for the minimum time (+40%), at least 2x, at most 100x
+      double factor = elapsed > 0 ? minTime * 1e9 * 1.4 / elapsed : 100;
+      factor = constrain(factor, 2.0, 100.0);
+      iterations = uint64_t(iterations * factor);
+    }
+  }
+
+  static std::string jsonEscape(const std::string &text)
+  {
+    std::string out;
+    for (char c : text)
+    {
+      if (c == '"' || c == '\\')
+      {
+        out += '\\';
+      }
+      out += c;
+    }
+    return out;
+  }
+
+  static bool writeJSON(const char *file, const char *executable, const std::vector<Result> &results)
+  {
+    FILE *f = fopen(file, "w");
+    if (!f)
+    {
+      return false;
+    }
+    char date[32];
+    time_t now = time(nullptr);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", localtime(&now));
+    fprintf(f, "{\n  \"context\": {\n    \"date\": \"%s\",\n    \"executable\": \"%s\",\n    \"library_build_type\": \"release\"\n  },\n", date, jsonEscape(executable).c_str());
+    fprintf(f, "  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); i++)
+    {
+      const Result &r = results[i];
+      fprintf(f, "    {\n      \"name\": \"%s\",\n      \"run_name\": \"%s\",\n      \"run_type\": \"iteration\",\n", r.name.c_str(), r.name.c_str());
+      fprintf(f, "      \"iterations\": %llu,\n      \"real_time\": %.3f,\n      \"cpu_time\": %.3f,\n      \"time_unit\": \"ns\",\n", (unsigned long long)r.iterations, r.realTime, r.cpuTime);
+      fprintf(f, "      \"allocs_per_iter\": %.3f,\n      \"bytes_per_iter\": %.3f,\n      \"peak_heap_bytes\": %llu\n    }%s\n", r.allocs, r.bytes, (unsigned long long)r.peak, i + 1 < results.size() ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    return fclose(f) == 0;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  std::string filter;
+  double minTime = 0.5;
+  const char *out = "bench_results.json";
+  for (int i = 1; i < argc; i++)
+  {
+    std::string arg = argv[i];
+    if (arg.rfind("--filter=", 0) == 0)
+    {
+      filter = arg.substr(9);
+    }
+    else if (arg.rfind("--min_time=", 0) == 0)
+    {
+      minTime = atof(arg.c_str() + 11);
+    }
+    else if (arg.rfind("--out=", 0) == 0)
+    {
+      out = argv[i] + 6;
+    }
+    else
+    {
+      fprintf(stderr, "Usage: %s [--filter=<text>] [--min_time=<s>] [--out=<file>]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  std::vector<bench::Result> results;
+  printf("%-28s %14s %14s %12s %12s %12s %12s\n", "Benchmark", "Time [ns]", "CPU [ns]", "Iterations", "Allocs/op", "Bytes/op", "Peak heap");
+  for (const auto &entry : bench::entries())
+  {
+    if (!filter.empty() && std::string(entry.name).find(filter) == std::string::npos)
+    {
+      continue;
+    }
+    bench::Result r = bench::run(entry, minTime);
+    printf("%-28s %14.1f %14.1f %12llu %12.2f %12.1f %12llu\n", r.name.c_str(), r.realTime, r.cpuTime, (unsigned long long)r.iterations, r.allocs, r.bytes, (unsigned long long)r.peak);
+    fflush(stdout);
+    results.push_back(r);
+  }
+  if (!bench::writeJSON(out, argv[0], results))
+  {
+    fprintf(stderr, "Can't write %s\n", out);
+    return 1;
+  }
+  printf("Results written to %s\n", out);
+  return 0;
+}
@@ -0,0 +1,62 @@
+#ifndef Bench_h
+#define Bench_h
+
+// Minimal micro-benchmark harness for the native environment (platformio.ini [env:native_bench])
+// Each benchmark runs until it has used the minimum time, then ns/op, allocations/op, bytes/op and the peak heap
+// are reported (the limits of the page heap are asserted in test/test_pageheap).
+// The results are written as Google Benchmark JSON, so the usual compare tools can diff two runs.
+//
+// Example:
+//   BENCHMARK(sendMWV)
+//   {
+//     while (state.keepRunning()) { ... }
+//   }
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace bench
+{
+  class State
+  {
+  public:
+    explicit State(uint64_t iterations) : _iterations(iterations) {}
+
+    // true while the benchmark has to do one more iteration
+    bool keepRunning()
+    {
+      if (_done < _iterations)
+      {
+        _done++;
+        return true;
+      }
+      return false;
+    }
+    uint64_t iterations() const { return _iterations; }
+
+  private:
+    uint64_t _iterations;
+    uint64_t _done = 0;
+  };
+
+  typedef void (*Function)(State &state);
+
+  // Registration of a benchmark by a static object
+  struct Registration
+  {
+    Registration(const char *name, Function function);
+  };
+
+  // Keeps the compiler from removing a result
+  template <typename T> inline void doNotOptimize(const T &value)
+  {
+    asm volatile("" : : "r,m"(value) : "memory");
+  }
+}
+
+#define BENCHMARK(name) \
+  static void bench_##name(bench::State &state); \
+  static bench::Registration bench_registration_##name(#name, bench_##name); \
+  static void bench_##name(bench::State &state)
+
+#endif
@@ -0,0 +1,331 @@
+// Micro-benchmarks of the measurement and output hot paths of the firmware
+// The firmware is linked without setup(), so no timers, servers or WiFi are running.
+// The sensors are absent (native shim), the data paths of the calculation are the same as on the target.
+
+#include "Arduino.h"
+#include <OneWire.h>
+#include <DallasTemperature.h>
+#include <ESP8266WebServer.h>
+#include "Configuration.h"
+#include "WindSnapshot.h"
+#include "NmeaWriter.h"
+#include "CircularMean.h"
+#include "WindowStats.h"
+#include "PageWriter.h"
+#include "Bench.h"
+#include "LegacyNMEA.h"
+
+// Firmware globals and functions (WiFi_Windsensor.cpp)
+extern configData actconf;
+extern OneWire *oneWire;
+extern DallasTemperature *DS18B20;
+extern int oneWire_Bus;
+extern SeqLock<WindSnapshot> windData;
+extern nmeaFrame nmeaframe;
+
+void interruptRoutine1();
+void interruptRoutine2();
+void buildaverage();
+void calculationData();
+void simulationData();
+size_t sendMWV(const WindSnapshot &wd, char *buffer, size_t size);
+size_t sendVWR(const WindSnapshot &wd, char *buffer, size_t size);
+size_t sendVPW(const WindSnapshot &wd, char *buffer, size_t size);
+size_t sendINF(const WindSnapshot &wd, char *buffer, size_t size);
+size_t sendGST(const WindSnapshot &wd, char *buffer, size_t size);
+size_t sendWST(const WindSnapshot &wd, char *buffer, size_t size);
+size_t sendWSE(const WindSnapshot &wd, char *buffer, size_t size);
+const nmeaFrame &NMEAFrame();
+String JSON();
+String JSON2();
+void Startpage(PageWriter &content, int num, String vname[20], String value[20]);
+void Settings(PageWriter &content, int num, String vname[30], String value[30]);
+void Devinfo(PageWriter &content);
+void Windv(PageWriter &content);
+void Windi(PageWriter &content);
+
+// Minimal part of setup() for the benchmarked functions, called by each benchmark
+static void prepare()
+{
+  static bool ready = false;
+  if (ready)
+  {
+    return;
+  }
+  actconf.debug = 0;                  // No serial output during the measurement
+  oneWire = new OneWire(oneWire_Bus);
+  DS18B20 = new DallasTemperature(oneWire);
+  DS18B20->begin();
+  calculationData();                  // Valid first epoch
+  ready = true;
+}
+
+// Measuring values of a typical calculation cycle
+static WindSnapshot sample()
+{
+  WindSnapshot wd = windData.read();
+  wd.windspeed_mps = 7.3;
+  wd.windspeed_kn = 14.2;
+  wd.windspeed_kph = 26.3;
+  wd.windspeed_hz = 3.9;
+  wd.windspeed_bft = 4;
+  wd.winddirection = 237.4;
+  wd.winddirection2 = 122.6;
+  wd.temperature = 18.6;
+  wd.airtemperature = 17.9;
+  wd.airpressure = 1013.4;
+  wd.airhumidity = 71.5;
+  wd.dewpoint = 12.5;
+  wd.altitude = 12.1;
+  return wd;
+}
+
+// One rotation of the Hall sensor anemometer: two speed edges and one direction edge
+static void rotation()
+{
+  interruptRoutine1();
+  native::advanceMicros(30000);
+  interruptRoutine2();
+  native::advanceMicros(90000);
+  interruptRoutine1();
+}
+
+BENCHMARK(interruptRoutine1)
+{
+  prepare();
+  uint64_t n = 0;
+  while (state.keepRunning())
+  {
+    interruptRoutine1();
+    // The ring buffer holds 64 events, empty it like the average building does
+    if ((++n & 31) == 0)
+    {
+      buildaverage();
+    }
+  }
+}
+
+BENCHMARK(buildaverage)
+{
+  prepare();
+  while (state.keepRunning())
+  {
+    rotation();
+    buildaverage();
+  }
+}
+
+BENCHMARK(calculationData)
+{
+  prepare();
+  while (state.keepRunning())
+  {
+    calculationData();
+  }
+}
+
+BENCHMARK(simulationData)
+{
+  prepare();
+  while (state.keepRunning())
+  {
+    simulationData();
+  }
+}
+
+// Vane sampler filter: one angle of an oscillating vane, the mean is taken every 50 angles (100 Hz, 500ms cycle)
+BENCHMARK(CircularMean)
+{
+  CircularMean mean;
+  float angle = 350;
+  float result = 0;
+  while (state.keepRunning())
+  {
+    angle = angle < 370 ? angle + 0.7f : 350;
+    mean.add(angle >= 360 ? angle - 360 : angle);
+    if (mean.count() == 50)
+    {
+      result += mean.direction();
+      mean.clear();
+    }
+  }
+  bench::doNotOptimize(result);
+}
+
+// Sliding window statistics: one sample into all four windows, the time steps 500ms like the calculation cycle
+BENCHMARK(WindowStats)
+{
+  static WindowStats stats;
+  uint32_t now = 0;
+  float speed = 6.5;
+  stats.begin(now);
+  while (state.keepRunning())
+  {
+    now += 500;
+    speed = speed < 9 ? speed + 0.3f : 6.5f;
+    stats.add(now, speed, speed * 40);
+  }
+  bench::doNotOptimize(stats.result(STATS_WINDOWS - 1, now).mean);
+}
+
+// One NMEA telegram into a stack buffer like NMEAFrame() does
+#define BENCHMARK_NMEA(send) \
+  BENCHMARK(send) \
+  { \
+    prepare(); \
+    WindSnapshot wd = sample(); \
+    char buffer[NMEA_MAX_LENGTH]; \
+    while (state.keepRunning()) \
+    { \
+      bench::doNotOptimize(send(wd, buffer, sizeof(buffer) - 2)); \
+      bench::doNotOptimize(buffer); \
+    } \
+  }
+
+BENCHMARK_NMEA(sendMWV)
+BENCHMARK_NMEA(sendVWR)
+BENCHMARK_NMEA(sendVPW)
+BENCHMARK_NMEA(sendINF)
+BENCHMARK_NMEA(sendGST)
+BENCHMARK_NMEA(sendWST)
+BENCHMARK_NMEA(sendWSE)
+
+// Reference rows: the old String based telegrams with the same measuring values
+#define BENCHMARK_LEGACY(send) \
+  BENCHMARK(legacy_##send) \
+  { \
+    prepare(); \
+    WindSnapshot wd = sample(); \
+    while (state.keepRunning()) \
+    { \
+      String telegram = legacy::send(wd); \
+      bench::doNotOptimize(telegram.length()); \
+    } \
+  }
+
+BENCHMARK_LEGACY(sendMWV)
+BENCHMARK_LEGACY(sendVWR)
+BENCHMARK_LEGACY(sendVPW)
+BENCHMARK_LEGACY(sendINF)
+BENCHMARK_LEGACY(sendWST)
+BENCHMARK_LEGACY(sendWSE)
+
+// Checksum of a full length sentence (the checksum is calculated by NmeaWriter while writing)
+BENCHMARK(NmeaWriterChecksum)
+{
+  char buffer[NMEA_MAX_LENGTH];
+  while (state.keepRunning())
+  {
+    NmeaWriter nmea(buffer, sizeof(buffer));
+    nmea.begin("PWINF");
+    for (int i = 0; i < 10; i++)
+    {
+      nmea.field(1234.56f);
+    }
+    nmea.end();
+    bench::doNotOptimize(nmea.checksum());
+  }
+}
+
+BENCHMARK(NMEAFrame)
+{
+  prepare();
+  while (state.keepRunning())
+  {
+    nmeaframe.epoch = 0;              // Render again, normally once per calculation cycle
+    bench::doNotOptimize(NMEAFrame().length);
+  }
+}
+
+BENCHMARK(JSON)
+{
+  prepare();
+  while (state.keepRunning())
+  {
+    String content = JSON();
+    bench::doNotOptimize(content.length());
+  }
+}
+
+BENCHMARK(JSON2)
+{
+  prepare();
+  while (state.keepRunning())
+  {
+    String content = JSON2();
+    bench::doNotOptimize(content.length());
+  }
+}
+
+// Web pages streamed into a counting sink, the peak heap is reported (limit asserted in test/test_pageheap)
+static void pageSink(void *context, const char *type, const char *data, size_t length)
+{
+  *static_cast<size_t *>(context) += length;
+}
+
+// Main page without arguments
+BENCHMARK(Startpage)
+{
+  prepare();
+  while (state.keepRunning())
+  {
+    size_t length = 0;
+    PageWriter content(pageSink, &length);
+    Startpage(content, 0, nullptr, nullptr);
+    content.end();
+    bench::doNotOptimize(length);
+  }
+}
+
+// Settings page without arguments (page view, no EEPROM write)
+BENCHMARK(Settings)
+{
+  prepare();
+  while (state.keepRunning())
+  {
+    size_t length = 0;
+    PageWriter content(pageSink, &length);
+    Settings(content, 0, nullptr, nullptr);
+    content.end();
+    bench::doNotOptimize(length);
+  }
+}
+
+BENCHMARK(Devinfo)
+{
+  prepare();
+  while (state.keepRunning())
+  {
+    size_t length = 0;
+    PageWriter content(pageSink, &length);
+    Devinfo(content);
+    content.end();
+    bench::doNotOptimize(length);
+  }
+}
+
+BENCHMARK(Windv)
+{
+  prepare();
+  while (state.keepRunning())
+  {
+    size_t length = 0;
+    PageWriter content(pageSink, &length);
+    Windv(content);
+    content.end();
+    bench::doNotOptimize(length);
+  }
+}
+
+BENCHMARK(Windi)
+{
+  prepare();
+  while (state.keepRunning())
+  {
+    size_t length = 0;
+    PageWriter content(pageSink, &length);
+    Windi(content);
+    content.end();
+    bench::doNotOptimize(length);
+  }
+}
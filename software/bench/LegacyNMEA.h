@@ -0,0 +1,226 @@
+#ifndef LegacyNMEA_h
+#define LegacyNMEA_h
+
+// Reference of the NMEA telegrams before NmeaWriter (String concatenation and CheckSum())
+// Same code as the old NMEATelegrams.h, the measuring values come from a snapshot instead of the globals and
+// nothing is printed. Used as reference row of the benchmarks and by test/test_nmea for the comparison of the output.
+// The old checksum is String(..., HEX): lowercase and without leading zero.
+
+#include "Arduino.h"
+#include "Configuration.h"
+#include "WindSnapshot.h"
+
+extern configData actconf;
+
+namespace legacy
+{
+  inline char CheckSum(String NMEAData) {
+    char checksum = 0;
+    // Iterate over the string, XOR each byte with the total sum
+    for (unsigned long c = 0; c < NMEAData.length(); c++) {
+      checksum = char(checksum ^ NMEAData.charAt(c));
+    }
+    // Return the result
+    return checksum;
+  }
+
+  inline String sendMWV(const WindSnapshot &wd){
+
+    String HexCheckSum;
+    String NMEAWindSpeed;
+    String SendWindSpeed;
+
+    // Create NMEA string for wind speed $WIMWV,x.x,a,x.x,a,A*hh<CR><LF>
+    NMEAWindSpeed = "WIMWV," + String(wd.winddirection);
+    if(String(actconf.windType) == "R"){
+      NMEAWindSpeed +=  ",R,";
+    }
+    else{
+      NMEAWindSpeed +=  ",T,";
+    }
+    if(String(actconf.speedUnit) == "kn"){
+      NMEAWindSpeed +=  String(wd.windspeed_kn);
+      NMEAWindSpeed +=  ",N,A";
+    }
+    if(String(actconf.speedUnit) == "m/s"){
+      NMEAWindSpeed +=  String(wd.windspeed_mps);
+      NMEAWindSpeed +=  ",M,A";
+    }
+    if(String(actconf.speedUnit) == "km/h"){
+      NMEAWindSpeed +=  String(wd.windspeed_kph);
+      NMEAWindSpeed +=  ",K,A";
+    }
+    // Build CheckSum
+    HexCheckSum = String(CheckSum(NMEAWindSpeed), HEX);
+    // Build complete NMEA string
+    SendWindSpeed = "$" + NMEAWindSpeed;
+    SendWindSpeed += "*";
+    SendWindSpeed += HexCheckSum;
+
+    return SendWindSpeed;
+  }
+
+  inline String sendVWR(const WindSnapshot &wd){
+
+    String HexCheckSum;
+    String NMEAWindSpeed;
+    String SendWindSpeed;
+
+    // Create NMEA string for wind speed $WIVWR,x.x,a,x.x,N,x.x,M,x.x,K*hh<CR><LF>
+    NMEAWindSpeed = "WIVWR," + String(wd.winddirection2);
+    if(wd.winddirection >= 0 && wd.winddirection < 180){
+      NMEAWindSpeed += ",R,";
+    }
+    else{
+      NMEAWindSpeed += ",L,";
+    }
+    NMEAWindSpeed += String(wd.windspeed_kn);
+    NMEAWindSpeed += ",N,";
+    NMEAWindSpeed += String(wd.windspeed_mps);
+    NMEAWindSpeed += ",M,";
+    NMEAWindSpeed += String(wd.windspeed_kph);
+    NMEAWindSpeed += ",K";
+    // Build CheckSum
+    HexCheckSum = String(CheckSum(NMEAWindSpeed), HEX);
+    // Build complete NMEA string
+    SendWindSpeed = "$" + NMEAWindSpeed;
+    SendWindSpeed += "*";
+    SendWindSpeed += HexCheckSum;
+
+    return SendWindSpeed;
+  }
+
+  inline String sendVPW(const WindSnapshot &wd){
+
+    String HexCheckSum;
+    String NMEAWindSpeed;
+    String SendWindSpeed;
+    float downwindspeed_kn;
+    float downwindspeed_mps;
+
+     if (wd.winddirection >= (180 - float(actconf.downWindRange)) && wd.winddirection <= (180 + float(actconf.downWindRange))){
+      downwindspeed_kn = wd.windspeed_kn;
+      downwindspeed_mps = wd.windspeed_mps;
+     }
+     else{
+      downwindspeed_kn = 0;
+      downwindspeed_mps = 0;
+     }
+
+    // Create NMEA string for wind speed $WIVPW,x.x,N,x.x,M*hh<CR><LF>
+    NMEAWindSpeed = "WIVPW," + String(downwindspeed_kn);
+    NMEAWindSpeed += ",N,";
+    NMEAWindSpeed += String(downwindspeed_mps);
+    NMEAWindSpeed += ",M";
+    // Build CheckSum
+    HexCheckSum = String(CheckSum(NMEAWindSpeed), HEX);
+    // Build complete NMEA string
+    SendWindSpeed = "$" + NMEAWindSpeed;
+    SendWindSpeed += "*";
+    SendWindSpeed += HexCheckSum;
+
+    return SendWindSpeed;
+  }
+
+  inline String sendINF(const WindSnapshot &wd){
+
+    String HexCheckSum;
+    String NMEAWindSpeed;
+    String SendWindSpeed;
+
+    // Create NMEA string for wind speed $PWINF,0,x.x,D,x.x,D,x.x,M,x.x,K,x.x,N,x.x,B,A*hh<CR><LF>
+    NMEAWindSpeed = "PWINF," + String(actconf.sensorID);
+    NMEAWindSpeed +=  ",";
+    NMEAWindSpeed +=  String(wd.winddirection);
+    NMEAWindSpeed +=  ",D,";
+    NMEAWindSpeed +=  String(wd.dirresolution);
+    NMEAWindSpeed +=  ",D,";
+    NMEAWindSpeed +=  String(wd.windspeed_mps);
+    NMEAWindSpeed +=  ",M,";
+    NMEAWindSpeed +=  String(wd.windspeed_kph);
+    NMEAWindSpeed +=  ",K,";
+    NMEAWindSpeed +=  String(wd.windspeed_kn);
+    NMEAWindSpeed +=  ",N,";
+    NMEAWindSpeed +=  String(wd.windspeed_bft);
+    NMEAWindSpeed +=  ",B,";
+    // Build CheckSum
+    HexCheckSum = String(CheckSum(NMEAWindSpeed), HEX);
+    // Build complete NMEA string
+    SendWindSpeed = "$" + NMEAWindSpeed;
+    SendWindSpeed += "*";
+    SendWindSpeed += HexCheckSum;
+
+    return SendWindSpeed;
+  }
+
+  // Send temperature data from DS18B20
+  inline String sendWST(const WindSnapshot &wd){
+
+    String HexCheckSum;
+    String NMEASensorTemp;
+    String SendSensorTemp;
+
+    // Create NMEA string for wind sensor temperature $PWWST,C,0,x.x,A*hh<CR><LF>
+    if(String(actconf.tempUnit) == "C"){
+      NMEASensorTemp = "PWWST,C," + String(actconf.sensorID);
+      NMEASensorTemp += ",";
+      NMEASensorTemp += String(wd.temperature);
+    }
+    else{
+      NMEASensorTemp = "PWWST,F," + String(actconf.sensorID);
+      NMEASensorTemp += ",";
+      NMEASensorTemp += String(wd.temperature);
+    }
+    NMEASensorTemp += ",A";
+    // Build CheckSum
+    HexCheckSum = String(CheckSum(NMEASensorTemp), HEX);
+    // Build complete NMEA string
+    SendSensorTemp = "$" + NMEASensorTemp;
+    SendSensorTemp += "*";
+    SendSensorTemp += HexCheckSum;
+
+    return SendSensorTemp;
+  }
+
+  // Send environment data from BME280
+  inline String sendWSE(const WindSnapshot &wd){
+
+    String HexCheckSum;
+    String NMEAWSE;
+    String SendWSE;
+
+    // Create NMEA string for wind speed $PWWSE,0,x.x,C,x.x,B,x.x,P,x.x,C,x.x,M,A*hh<CR><LF>
+    NMEAWSE = "PWWSE," + String(actconf.sensorID);
+    NMEAWSE +=  ",";
+    NMEAWSE +=  String(wd.airtemperature);
+    if(String(actconf.tempUnit) == "C"){
+      NMEAWSE +=  ",C,";
+    }
+    else{
+      NMEAWSE +=  ",K,";
+    }
+    NMEAWSE +=  String(wd.airpressure);
+    NMEAWSE +=  ",B,";
+    NMEAWSE +=  String(wd.airhumidity);
+    NMEAWSE +=  ",P,";
+    NMEAWSE +=  String(wd.dewpoint);
+    if(String(actconf.tempUnit) == "C"){
+      NMEAWSE +=  ",C,";
+    }
+    else{
+      NMEAWSE +=  ",K,";
+    }
+    NMEAWSE +=  String(wd.altitude);
+    NMEAWSE +=  ",M,";
+    // Build CheckSum
+    HexCheckSum = String(CheckSum(NMEAWSE), HEX);
+    // Build complete NMEA string
+    SendWSE = "$" + NMEAWSE;
+    SendWSE += "*";
+    SendWSE += HexCheckSum;
+
+    return SendWSE;
+  }
+}
+
+#endif
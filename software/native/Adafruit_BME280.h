@@ -0,0 +1,52 @@
+#ifndef Adafruit_BME280_h
+#define Adafruit_BME280_h
+
+// Host shim of the BME280 library without a device, all values are NaN
+
+#include "Adafruit_Sensor.h"
+#include "Wire.h"
+
+typedef struct {
+  uint16_t dig_T1;
+  int16_t dig_T2;
+  int16_t dig_T3;
+  uint16_t dig_P1;
+  int16_t dig_P2;
+  int16_t dig_P3;
+  int16_t dig_P4;
+  int16_t dig_P5;
+  int16_t dig_P6;
+  int16_t dig_P7;
+  int16_t dig_P8;
+  int16_t dig_P9;
+  uint8_t dig_H1;
+  int16_t dig_H2;
+  uint8_t dig_H3;
+  int16_t dig_H4;
+  int16_t dig_H5;
+  int8_t dig_H6;
+} bme280_calib_data;
+
+class Adafruit_BME280
+{
+public:
+  enum sensor_sampling { SAMPLING_NONE, SAMPLING_X1, SAMPLING_X2, SAMPLING_X4, SAMPLING_X8, SAMPLING_X16 };
+  enum sensor_mode { MODE_SLEEP = 0b00, MODE_FORCED = 0b01, MODE_NORMAL = 0b11 };
+  enum sensor_filter { FILTER_OFF, FILTER_X2, FILTER_X4, FILTER_X8, FILTER_X16 };
+  enum standby_duration { STANDBY_MS_0_5, STANDBY_MS_62_5, STANDBY_MS_125, STANDBY_MS_250, STANDBY_MS_500, STANDBY_MS_1000, STANDBY_MS_10, STANDBY_MS_20 };
+
+  bool begin(uint8_t address = 0x77, TwoWire *wire = &Wire) { return false; }
+  void setSampling(sensor_mode mode = MODE_NORMAL, sensor_sampling tempSampling = SAMPLING_X16,
+                   sensor_sampling pressSampling = SAMPLING_X16, sensor_sampling humSampling = SAMPLING_X16,
+                   sensor_filter filter = FILTER_OFF, standby_duration duration = STANDBY_MS_0_5) {}
+  float readTemperature() { return NAN; }
+  float readPressure() { return NAN; }
+  float readHumidity() { return NAN; }
+  float readAltitude(float seaLevel) { return NAN; }
+  bool takeForcedMeasurement() { return false; }
+
+protected:
+  bme280_calib_data _bme280_calib = {};
+};
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef Adafruit_Sensor_h
+#define Adafruit_Sensor_h
+
+// Host shim of the Adafruit unified sensor base (not used directly)
+
+#include "Arduino.h"
+
+#endif
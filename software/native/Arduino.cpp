@@ -0,0 +1,498 @@
+// Host shim of the Arduino core: time, GPIO, interrupts, timer1, String, Print, IPAddress, Serial, ESP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unistd.h>
+#include "Arduino.h"
+
+// Time
+
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+static std::atomic<unsigned long> offsetMicros(0);
+static std::atomic<bool> clockStopped(false);
+static std::atomic<uint64_t> stoppedMicros(0);        // Clock time with stopped host clock, 64 bit like the host
+
+unsigned long micros()
+{
+  if (clockStopped)
+  {
+    return (unsigned long)(uint32_t)stoppedMicros;
+  }
+  auto elapsed = std::chrono::steady_clock::now() - startTime;
+  return (unsigned long)(uint32_t)(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() + offsetMicros);
+}
+
+unsigned long millis()
+{
+  if (clockStopped)
+  {
+    return (unsigned long)(uint32_t)(stoppedMicros / 1000);
+  }
+  auto elapsed = std::chrono::steady_clock::now() - startTime;
+  return (unsigned long)(uint32_t)(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() + offsetMicros / 1000);
+}
+
+void delay(unsigned long ms)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield()
+{
+  std::this_thread::yield();
+}
+
+// Interrupts
+
+static std::recursive_mutex interruptLock;
+static thread_local int interruptDepth = 0;
+
+void noInterrupts()
+{
+  interruptLock.lock();
+  interruptDepth++;
+}
+
+void interrupts()
+{
+  if (interruptDepth > 0)
+  {
+    interruptDepth--;
+    interruptLock.unlock();
+  }
+}
+
+// GPIO
+
+#define NATIVE_PINS 48
+
+static std::atomic<int> pinLevel[NATIVE_PINS];
+static void (*pinHandler[NATIVE_PINS])() = {};
+static int pinInterruptMode[NATIVE_PINS] = {};
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  if (pin < NATIVE_PINS && mode == INPUT_PULLUP)
+  {
+    pinLevel[pin] = HIGH;
+  }
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+  if (pin < NATIVE_PINS)
+  {
+    pinLevel[pin] = value ? HIGH : LOW;
+  }
+}
+
+int digitalRead(uint8_t pin)
+{
+  return pin < NATIVE_PINS ? int(pinLevel[pin]) : LOW;
+}
+
+int analogRead(uint8_t pin)
+{
+  return 0;
+}
+
+void attachInterrupt(uint8_t interrupt, void (*handler)(), int mode)
+{
+  if (interrupt < NATIVE_PINS)
+  {
+    noInterrupts();
+    pinHandler[interrupt] = handler;
+    pinInterruptMode[interrupt] = mode;
+    interrupts();
+  }
+}
+
+void detachInterrupt(uint8_t interrupt)
+{
+  if (interrupt < NATIVE_PINS)
+  {
+    noInterrupts();
+    pinHandler[interrupt] = nullptr;
+    interrupts();
+  }
+}
+
+// Random numbers
+
+static std::mt19937 randomGenerator(1);
+
+long random(long howbig)
+{
+  if (howbig <= 0)
+  {
+    return 0;
+  }
+  return long(randomGenerator() % (unsigned long)howbig);
+}
+
+long random(long howsmall, long howbig)
+{
+  if (howsmall >= howbig)
+  {
+    return howsmall;
+  }
+  return random(howbig - howsmall) + howsmall;
+}
+
+void randomSeed(unsigned long seed)
+{
+  if (seed != 0)
+  {
+    randomGenerator.seed(seed);
+  }
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max)
+{
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+// Timer1 (80MHz base clock, one thread while enabled)
+
+static void (*timer1Handler)() = nullptr;
+static uint8_t timer1Divider = TIM_DIV1;
+static uint8_t timer1Reload = TIM_SINGLE;
+static std::thread timer1Thread;
+static std::mutex timer1Mutex;
+static std::condition_variable timer1Stop;
+static bool timer1Stopping = false;
+
+void timer1_attachInterrupt(void (*handler)())
+{
+  timer1Handler = handler;
+}
+
+void timer1_detachInterrupt()
+{
+  timer1Handler = nullptr;
+}
+
+void timer1_enable(uint8_t divider, uint8_t type, uint8_t reload)
+{
+  timer1Divider = divider;
+  timer1Reload = reload;
+}
+
+void timer1_disable()
+{
+  if (timer1Thread.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(timer1Mutex);
+      timer1Stopping = true;
+    }
+    timer1Stop.notify_all();
+    timer1Thread.join();
+    timer1Stopping = false;
+  }
+}
+
+void timer1_write(uint32_t ticks)
+{
+  timer1_disable();
+  static const unsigned long prescaler[] = {1, 16, 16, 256};
+  auto period = std::chrono::nanoseconds((unsigned long long)ticks * prescaler[timer1Divider & 3] * 1000 / 80);
+  bool repeat = timer1Reload == TIM_LOOP;
+  timer1Thread = std::thread([period, repeat]() {
+    std::unique_lock<std::mutex> lock(timer1Mutex);
+    auto next = std::chrono::steady_clock::now() + period;
+    while (!timer1Stop.wait_until(lock, next, []() { return timer1Stopping; }))
+    {
+      lock.unlock();
+      noInterrupts();
+      if (timer1Handler)
+      {
+        timer1Handler();
+      }
+      interrupts();
+      lock.lock();
+      if (!repeat)
+      {
+        break;
+      }
+      next += period;
+    }
+  });
+}
+
+// Simulated hardware
+
+namespace native
+{
+  void setPin(uint8_t pin, int level)
+  {
+    if (pin >= NATIVE_PINS)
+    {
+      return;
+    }
+    int previous = pinLevel[pin].exchange(level ? HIGH : LOW);
+    noInterrupts();
+    void (*handler)() = pinHandler[pin];
+    int mode = pinInterruptMode[pin];
+    bool rising = previous == LOW && level;
+    bool falling = previous == HIGH && !level;
+    // A LOW level interrupt is fired once on the falling edge
+    if (handler && ((mode == RISING && rising) || ((mode == FALLING || mode == LOW) && falling) || (mode == CHANGE && (rising || falling))))
+    {
+      handler();
+    }
+    interrupts();
+  }
+
+  void advanceMicros(unsigned long us)
+  {
+    if (clockStopped)
+    {
+      stoppedMicros += us;
+    }
+    else
+    {
+      offsetMicros += us;
+    }
+  }
+
+  void setMicros(uint64_t us)
+  {
+    stoppedMicros = us;
+    clockStopped = true;
+  }
+}
+
+// String
+
+bool String::equalsIgnoreCase(const String &s) const
+{
+  return _s.length() == s._s.length() && strcasecmp(_s.c_str(), s._s.c_str()) == 0;
+}
+
+bool String::endsWith(const String &s) const
+{
+  return _s.length() >= s._s.length() && _s.compare(_s.length() - s._s.length(), s._s.length(), s._s) == 0;
+}
+
+void String::getBytes(unsigned char *buffer, unsigned int size, unsigned int index) const
+{
+  if (!buffer || size == 0)
+  {
+    return;
+  }
+  unsigned int n = 0;
+  if (index < _s.length())
+  {
+    n = std::min(size - 1, (unsigned int)_s.length() - index);
+    memcpy(buffer, _s.data() + index, n);
+  }
+  buffer[n] = 0;
+}
+
+String String::substring(unsigned int from, unsigned int to) const
+{
+  if (from > to)
+  {
+    std::swap(from, to);
+  }
+  if (from >= _s.length())
+  {
+    return String();
+  }
+  to = std::min(to, (unsigned int)_s.length());
+  return String(_s.substr(from, to - from));
+}
+
+void String::replace(char find, char replace)
+{
+  std::replace(_s.begin(), _s.end(), find, replace);
+}
+
+void String::replace(const String &find, const String &replace)
+{
+  if (find._s.empty())
+  {
+    return;
+  }
+  size_t pos = 0;
+  while ((pos = _s.find(find._s, pos)) != std::string::npos)
+  {
+    _s.replace(pos, find._s.length(), replace._s);
+    pos += replace._s.length();
+  }
+}
+
+void String::remove(unsigned int index, unsigned int count)
+{
+  if (index < _s.length())
+  {
+    _s.erase(index, count);
+  }
+}
+
+void String::toLowerCase()
+{
+  for (auto &c : _s)
+  {
+    c = tolower((unsigned char)c);
+  }
+}
+
+void String::toUpperCase()
+{
+  for (auto &c : _s)
+  {
+    c = toupper((unsigned char)c);
+  }
+}
+
+void String::trim()
+{
+  size_t begin = _s.find_first_not_of(" \t\r\n\f\v");
+  if (begin == std::string::npos)
+  {
+    _s.clear();
+    return;
+  }
+  size_t end = _s.find_last_not_of(" \t\r\n\f\v");
+  _s = _s.substr(begin, end - begin + 1);
+}
+
+std::string String::number(unsigned long value, unsigned char base)
+{
+  if (base < 2 || base > 36)
+  {
+    base = 10;
+  }
+  char buffer[8 * sizeof(value) + 1];
+  char *p = buffer + sizeof(buffer);
+  *--p = 0;
+  do
+  {
+    int digit = value % base;
+    *--p = digit < 10 ? '0' + digit : 'a' + digit - 10;
+    value /= base;
+  } while (value);
+  return std::string(p);
+}
+
+std::string String::number(long value, unsigned char base)
+{
+  if (value < 0 && base == 10)
+  {
+    return "-" + number((unsigned long)(-value), base);
+  }
+  return number((unsigned long)value, base);
+}
+
+std::string String::number(double value, unsigned char decimals)
+{
+  if (isnan(value))
+  {
+    return "nan";
+  }
+  if (isinf(value))
+  {
+    return "inf";
+  }
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+  return std::string(buffer);
+}
+
+// Print
+
+size_t Print::printf(const char *format, ...)
+{
+  char buffer[256];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (length < 0)
+  {
+    return 0;
+  }
+  if (size_t(length) < sizeof(buffer))
+  {
+    return write((const uint8_t *)buffer, length);
+  }
+  std::string text(length + 1, 0);
+  va_start(args, format);
+  vsnprintf(&text[0], text.size(), format, args);
+  va_end(args);
+  return write((const uint8_t *)text.data(), length);
+}
+
+// IPAddress
+
+bool IPAddress::fromString(const char *address)
+{
+  unsigned int b[4];
+  char end;
+  if (!address || sscanf(address, "%u.%u.%u.%u%c", &b[0], &b[1], &b[2], &b[3], &end) != 4)
+  {
+    return false;
+  }
+  for (int i = 0; i < 4; i++)
+  {
+    if (b[i] > 255)
+    {
+      return false;
+    }
+    _bytes[i] = b[i];
+  }
+  return true;
+}
+
+String IPAddress::toString() const
+{
+  char buffer[16];
+  snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u", _bytes[0], _bytes[1], _bytes[2], _bytes[3]);
+  return String(buffer);
+}
+
+// Serial
+
+HardwareSerial Serial;
+
+size_t HardwareSerial::write(uint8_t c)
+{
+  return fwrite(&c, 1, 1, stdout);
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+  return fwrite(buffer, 1, size, stdout);
+}
+
+void HardwareSerial::flush()
+{
+  fflush(stdout);
+}
+
+// ESP
+
+EspClass ESP;
+
+uint32_t EspClass::getCycleCount()
+{
+  auto elapsed = std::chrono::steady_clock::now() - startTime;
+  return uint32_t(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() * getCpuFreqMHz() / 1000);
+}
+
+void EspClass::restart()
+{
+  fflush(stdout);
+  exit(0);
+}
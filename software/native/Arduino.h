@@ -0,0 +1,123 @@
+#ifndef Arduino_h
+#define Arduino_h
+
+// Host shim of the Arduino core for the native environment (platformio.ini [env:native])
+// The firmware is built as ESP8266 firmware, the shim replaces the hardware:
+// time = host clock, GPIO = pin array, interrupts = global lock, timers = threads
+// Test and benchmark code can set pins and fire interrupts with the functions in namespace native.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <functional>
+
+typedef uint8_t byte;
+typedef bool boolean;
+typedef uint16_t word;
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x00
+#define OUTPUT 0x01
+#define INPUT_PULLUP 0x02
+#define OUTPUT_OPEN_DRAIN 0x03
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#define IRAM_ATTR
+#define ICACHE_RAM_ATTR
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#define PI 3.1415926535897932384626433832795
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#define radians(deg) ((deg) * DEG_TO_RAD)
+#define degrees(rad) ((rad) * RAD_TO_DEG)
+#define sq(x) ((x) * (x))
+#define lowByte(w) ((uint8_t)((w) & 0xff))
+#define highByte(w) ((uint8_t)((w) >> 8))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+using std::min;
+using std::max;
+
+// Pins of the D1 mini
+static const uint8_t SDA = 4;
+static const uint8_t SCL = 5;
+
+// Time
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+// GPIO
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+#define digitalPinToInterrupt(pin) (pin)
+void attachInterrupt(uint8_t interrupt, void (*handler)(), int mode);
+void detachInterrupt(uint8_t interrupt);
+
+// Interrupt lock, nested calls are allowed
+void noInterrupts();
+void interrupts();
+
+// Random numbers
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+// ESP8266 timer1 (only the 100us trace timer uses it)
+#define TIM_DIV1 0
+#define TIM_DIV16 1
+#define TIM_DIV256 3
+#define TIM_EDGE 0
+#define TIM_LEVEL 1
+#define TIM_SINGLE 0
+#define TIM_LOOP 1
+void timer1_attachInterrupt(void (*handler)());
+void timer1_detachInterrupt();
+void timer1_enable(uint8_t divider, uint8_t type, uint8_t reload);
+void timer1_write(uint32_t ticks);
+void timer1_disable();
+
+#include "WString.h"
+#include "Print.h"
+#include "IPAddress.h"
+#include "HardwareSerial.h"
+#include "Esp.h"
+#include "MD5Builder.h"
+
+// Control of the simulated hardware for host tests and benchmarks
+namespace native
+{
+  void setPin(uint8_t pin, int level);      // Set an input, fires the attached interrupt on a matching edge
+  void advanceMicros(unsigned long us);     // Move the clock forward (for pulse sequences without waiting)
+  void setMicros(uint64_t us);              // Stop the host clock at us, then only advanceMicros() moves it
+                                            // micros() wraps after 2^32 us, millis() = us / 1000 (test of the wrap)
+  unsigned long loops();                    // Number of loop() calls in main()
+}
+
+// Sketch functions
+void setup();
+void loop();
+
+#endif
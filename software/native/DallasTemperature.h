@@ -0,0 +1,38 @@
+#ifndef DallasTemperature_h
+#define DallasTemperature_h
+
+// Host shim of the DS18B20 library without devices, all values are "disconnected"
+
+#include "OneWire.h"
+
+#define DEVICE_DISCONNECTED_C -127
+#define DEVICE_DISCONNECTED_F -196.6
+
+typedef uint8_t DeviceAddress[8];
+
+class DallasTemperature
+{
+public:
+  DallasTemperature(OneWire *oneWire) : _oneWire(oneWire) {}
+  void begin() {}
+  uint8_t getDeviceCount() { return 0; }
+  void setResolution(uint8_t resolution) {}
+  bool setResolution(const uint8_t *address, uint8_t resolution) { return false; }
+  bool getAddress(uint8_t *address, uint8_t index) { return false; }
+  void setWaitForConversion(bool wait) { _wait = wait; }
+  bool getWaitForConversion() const { return _wait; }
+  bool isConversionComplete() { return true; }
+  int16_t millisToWaitForConversion(uint8_t resolution) { return 750; }
+  bool requestTemperatures() { return true; }
+  bool requestTemperaturesByIndex(uint8_t index) { return false; }
+  bool requestTemperaturesByAddress(const uint8_t *address) { return false; }
+  float getTempC(const uint8_t *address) { return DEVICE_DISCONNECTED_C; }
+  float getTempCByIndex(uint8_t index) { return DEVICE_DISCONNECTED_C; }
+  float getTempFByIndex(uint8_t index) { return DEVICE_DISCONNECTED_F; }
+
+private:
+  OneWire *_oneWire;
+  bool _wait = true;
+};
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef EEPROM_h
+#define EEPROM_h
+
+// Host shim of the ESP8266 EEPROM emulation
+// The data are kept in a file (environment NATIVE_EEPROM, default native_eeprom.bin), a new file reads 0xFF
+
+#include <vector>
+#include "Arduino.h"
+
+class EEPROMClass
+{
+public:
+  void begin(size_t size);
+  uint8_t read(int address) const { return (address >= 0 && size_t(address) < _data.size()) ? _data[address] : 0; }
+  void write(int address, uint8_t value)
+  {
+    if (address >= 0 && size_t(address) < _data.size())
+    {
+      _data[address] = value;
+      _dirty = true;
+    }
+  }
+  bool commit();
+  bool end();
+  size_t length() const { return _data.size(); }
+  uint8_t *getDataPtr() { _dirty = true; return _data.data(); }
+
+  template <typename T> T &get(int address, T &t)
+  {
+    if (address >= 0 && address + sizeof(T) <= _data.size())
+    {
+      memcpy((uint8_t *)&t, _data.data() + address, sizeof(T));
+    }
+    return t;
+  }
+
+  template <typename T> const T &put(int address, const T &t)
+  {
+    if (address >= 0 && address + sizeof(T) <= _data.size())
+    {
+      memcpy(_data.data() + address, (const uint8_t *)&t, sizeof(T));
+      _dirty = true;
+    }
+    return t;
+  }
+
+private:
+  std::vector<uint8_t> _data;
+  bool _dirty = false;
+};
+
+extern EEPROMClass EEPROM;
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef ESP8266HTTPUpdateServer_h
+#define ESP8266HTTPUpdateServer_h
+
+// Host shim of the firmware update server (no update on the host)
+
+#include "ESP8266WebServer.h"
+
+class ESP8266HTTPUpdateServer
+{
+public:
+  void setup(ESP8266WebServer *server) {}
+};
+
+#endif
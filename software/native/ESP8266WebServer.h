@@ -0,0 +1,74 @@
+#ifndef ESP8266WebServer_h
+#define ESP8266WebServer_h
+
+// Host shim of the ESP8266 web server: one request per connection, handled in handleClient()
+// Like on the target the connection is released after the handler, a handler can keep a copy of client()
+// With setContentLength(CONTENT_LENGTH_UNKNOWN) the response is sent chunked, sendContent("") ends it
+// Like on the target only the request headers named in collectHeaders() are kept
+
+#include <vector>
+#include "ESP8266WiFi.h"
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t) -1)
+#define CONTENT_LENGTH_NOT_SET ((size_t) -2)
+
+class ESP8266WebServer
+{
+public:
+  typedef std::function<void(void)> THandlerFunction;
+
+  ESP8266WebServer(int port = 80) : _server(port) {}
+
+  void begin() { _server.begin(); }
+  void close() { _server.stop(); }
+  void handleClient();
+
+  void on(const String &uri, THandlerFunction handler) { on(uri, HTTP_ANY, handler); }
+  void on(const String &uri, HTTPMethod method, THandlerFunction handler);
+  void onNotFound(THandlerFunction handler) { _notFound = handler; }
+
+  const String &uri() const { return _uri; }
+  HTTPMethod method() const { return _method; }
+  int args() const { return int(_args.size()); }
+  const String &arg(int i) const { return _args[i].value; }
+  const String &argName(int i) const { return _args[i].name; }
+  const String &arg(const String &name) const;
+  bool hasArg(const String &name) const;
+  WiFiClient &client() { return _client; }
+  void collectHeaders(const char *keys[], size_t count);
+  const String &header(const String &name) const;
+  bool hasHeader(const String &name) const;
+
+  void sendHeader(const String &name, const String &value, bool first = false);
+  void setContentLength(size_t length) { _contentLength = length; }
+  void send(int code, const char *type = nullptr, const String &content = String());
+  void send(int code, const String &type, const String &content) { send(code, type.c_str(), content); }
+  void send_P(int code, PGM_P type, PGM_P content);
+  void send_P(int code, PGM_P type, PGM_P content, size_t length);
+  void sendContent(const String &content) { sendContent(content.c_str(), content.length()); }
+  void sendContent(const char *content, size_t length);
+  void sendContent_P(PGM_P content, size_t length);
+
+private:
+  struct Route { String uri; HTTPMethod method; THandlerFunction handler; };
+  struct Argument { String name; String value; };
+
+  bool readRequest();
+  void sendHeader(int code, const char *type, size_t length);
+
+  WiFiServer _server;
+  WiFiClient _client;
+  std::vector<Route> _routes;
+  THandlerFunction _notFound;
+  String _uri;
+  HTTPMethod _method = HTTP_GET;
+  std::vector<Argument> _args;
+  std::vector<Argument> _requestHeaders;    // Collected headers, value of the last request
+  String _headers;
+  size_t _contentLength = CONTENT_LENGTH_NOT_SET;
+  bool _chunked = false;
+};
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef ESP8266WiFi_h
+#define ESP8266WiFi_h
+
+// Host shim of the ESP8266 WiFi class: the host network is always "connected", all addresses are loopback
+
+#include "Arduino.h"
+#include "WiFiClient.h"
+#include "WiFiServer.h"
+#include "WiFiUdp.h"
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_SCAN_COMPLETED = 2,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum {
+  WIFI_OFF = 0,
+  WIFI_STA = 1,
+  WIFI_AP = 2,
+  WIFI_AP_STA = 3
+} WiFiMode_t;
+
+class ESP8266WiFiClass
+{
+public:
+  bool mode(WiFiMode_t mode) { _mode = mode; return true; }
+  WiFiMode_t getMode() const { return _mode; }
+  wl_status_t begin(const char *ssid, const char *passphrase = nullptr) { _status = WL_CONNECTED; return _status; }
+  wl_status_t status() const { return _status; }
+  bool disconnect(bool wifioff = false) { _status = WL_DISCONNECTED; return true; }
+  IPAddress localIP() const { return IPAddress(127, 0, 0, 1); }
+  IPAddress subnetMask() const { return IPAddress(255, 0, 0, 0); }
+  IPAddress gatewayIP() const { return IPAddress(127, 0, 0, 1); }
+  int32_t RSSI() const { return -60; }
+  int32_t channel() const { return _channel; }
+  String SSID() const { return "native"; }
+  String macAddress() const { return "02:00:00:00:00:01"; }
+  bool hostname(const String &name) { _hostname = name; return true; }
+  String hostname() const { return _hostname; }
+  int hostByName(const char *host, IPAddress &result);
+
+  bool softAP(const char *ssid, const char *passphrase = nullptr, int channel = 1, int hidden = 0, int max_connection = 4)
+  {
+    _channel = channel;
+    return true;
+  }
+  bool softAPConfig(IPAddress local_ip, IPAddress gateway, IPAddress subnet) { return true; }
+  IPAddress softAPIP() const { return IPAddress(127, 0, 0, 1); }
+  uint8_t softAPgetStationNum() const { return 0; }
+
+private:
+  WiFiMode_t _mode = WIFI_OFF;
+  wl_status_t _status = WL_IDLE_STATUS;
+  int32_t _channel = 1;
+  String _hostname = "native";
+};
+
+extern ESP8266WiFiClass WiFi;
+
+#endif
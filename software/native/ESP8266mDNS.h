@@ -0,0 +1,22 @@
+#ifndef ESP8266mDNS_h
+#define ESP8266mDNS_h
+
+// Host shim of the mDNS responder (no announcement on the host)
+
+#include "Arduino.h"
+
+class MDNSResponder
+{
+public:
+  bool begin(const String &hostname) { _hostname = hostname; return true; }
+  bool begin(const char *hostname) { return begin(String(hostname)); }
+  bool addService(const char *service, const char *protocol, uint16_t port) { return true; }
+  void update() {}
+
+private:
+  String _hostname;
+};
+
+extern MDNSResponder MDNS;
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef Esp_h
+#define Esp_h
+
+// Host shim of the ESP8266 system class
+
+#include <stdint.h>
+#include "WString.h"
+
+class EspClass
+{
+public:
+  uint32_t getChipId() { return 0x00C0FFEE; }
+  const char *getSdkVersion() { return "native"; }
+  uint8_t getCpuFreqMHz() { return 160; }
+  uint32_t getFreeHeap() { return 40000; }
+  uint32_t getMaxFreeBlockSize() { return 32000; }
+  uint32_t getCycleCount();                 // Host clock with 160 cycles per us (ns resolution)
+  String getResetReason() { return "Power On"; }
+  void restart();
+};
+
+extern EspClass ESP;
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef HardwareSerial_h
+#define HardwareSerial_h
+
+// Host shim of the serial port, output goes to stdout, input comes from nowhere
+
+#include "Print.h"
+
+class HardwareSerial : public Stream
+{
+public:
+  void begin(unsigned long baud) { _baud = baud; }
+  void end() {}
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  int availableForWrite() override { return 4096; }
+  void flush() override;
+  operator bool() const { return true; }
+
+private:
+  unsigned long _baud = 115200;
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,189 @@
+#ifndef LittleFS_h
+#define LittleFS_h
+
+// Host shim of the ESP8266 LittleFS file system
+// The files are kept in RAM (environment NATIVE_FS_SIZE = size in [Byte], default 2 MB), they are lost at exit.
+// Only the part of the API used by the firmware: files, no directory listing.
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Arduino.h"
+
+struct FSInfo
+{
+  size_t totalBytes;
+  size_t usedBytes;
+  size_t blockSize;
+  size_t pageSize;
+  size_t maxOpenFiles;
+  size_t maxPathLength;
+};
+
+class FS;
+
+class File
+{
+public:
+  File() {}
+
+  explicit operator bool() const { return _data != nullptr; }
+
+  size_t write(const uint8_t *buffer, size_t size);
+  size_t write(uint8_t value) { return write(&value, 1); }
+
+  int read(uint8_t *buffer, size_t size)
+  {
+    if (!_data || !_read)
+    {
+      return -1;
+    }
+    size_t n = _position < _data->size() ? min(size, _data->size() - _position) : 0;
+    memcpy(buffer, _data->data() + _position, n);
+    _position += n;
+    return int(n);
+  }
+
+  int read()
+  {
+    uint8_t value;
+    return read(&value, 1) == 1 ? value : -1;
+  }
+
+  bool seek(uint32_t position)
+  {
+    if (!_data || position > _data->size())
+    {
+      return false;
+    }
+    _position = position;
+    return true;
+  }
+
+  size_t position() const { return _position; }
+  size_t size() const { return _data ? _data->size() : 0; }
+  int available() const { return _data && _read ? int(_data->size() - _position) : 0; }
+  void flush() {}
+  void close() { _data.reset(); }
+
+private:
+  friend class FS;
+  std::shared_ptr<std::vector<uint8_t>> _data;
+  FS *_fs = nullptr;
+  size_t _position = 0;
+  bool _read = false;
+  bool _write = false;
+  bool _append = false;
+};
+
+class FS
+{
+public:
+  bool begin()
+  {
+    const char *size = getenv("NATIVE_FS_SIZE");
+    _total = size ? strtoul(size, nullptr, 10) : 2 * 1024 * 1024;
+    _mounted = true;
+    return true;
+  }
+
+  void end() { _mounted = false; }
+
+  bool format()
+  {
+    _files.clear();
+    return true;
+  }
+
+  bool info(FSInfo &info) const
+  {
+    info.totalBytes = _total;
+    info.usedBytes = used();
+    info.blockSize = 4096;
+    info.pageSize = 256;
+    info.maxOpenFiles = 5;
+    info.maxPathLength = 32;
+    return _mounted;
+  }
+
+  // Modes "r", "r+", "w", "w+", "a", "a+"
+  File open(const char *path, const char *mode)
+  {
+    File file;
+    if (!_mounted)
+    {
+      return file;
+    }
+    auto it = _files.find(path);
+    if (mode[0] == 'r' && it == _files.end())
+    {
+      return file;
+    }
+    if (it == _files.end() || mode[0] == 'w')
+    {
+      _files[path] = std::make_shared<std::vector<uint8_t>>();
+      it = _files.find(path);
+    }
+    file._data = it->second;
+    file._fs = this;
+    file._read = mode[0] == 'r' || mode[1] == '+';
+    file._write = mode[0] != 'r' || mode[1] == '+';
+    file._append = mode[0] == 'a';
+    file._position = file._append ? file._data->size() : 0;
+    return file;
+  }
+
+  File open(const String &path, const char *mode) { return open(path.c_str(), mode); }
+  bool exists(const char *path) const { return _mounted && _files.count(path) > 0; }
+  bool exists(const String &path) const { return exists(path.c_str()); }
+  bool remove(const char *path) { return _files.erase(path) > 0; }
+  bool remove(const String &path) { return remove(path.c_str()); }
+  bool mkdir(const char *) { return _mounted; }
+
+  size_t used() const
+  {
+    size_t bytes = 0;
+    for (auto &f : _files)
+    {
+      bytes += f.second->size();
+    }
+    return bytes;
+  }
+
+  size_t total() const { return _total; }
+
+private:
+  std::map<std::string, std::shared_ptr<std::vector<uint8_t>>> _files;
+  size_t _total = 0;
+  bool _mounted = false;
+};
+
+// Write with the capacity of the file system
+inline size_t File::write(const uint8_t *buffer, size_t size)
+{
+  if (!_data || !_write)
+  {
+    return 0;
+  }
+  if (_append)
+  {
+    _position = _data->size();
+  }
+  size_t end = _position + size;
+  if (end > _data->size() && _fs->used() + (end - _data->size()) > _fs->total())
+  {
+    return 0;                               // File system full
+  }
+  if (end > _data->size())
+  {
+    _data->resize(end);
+  }
+  memcpy(_data->data() + _position, buffer, size);
+  _position = end;
+  return size;
+}
+
+extern FS LittleFS;
+
+#endif
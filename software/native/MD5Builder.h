@@ -0,0 +1,31 @@
+#ifndef MD5Builder_h
+#define MD5Builder_h
+
+// Host shim of the ESP8266 MD5 builder (RFC 1321)
+
+#include <stdint.h>
+#include <string.h>
+#include "WString.h"
+
+class MD5Builder
+{
+public:
+  void begin();
+  void add(const uint8_t *data, uint16_t length);
+  void add(const char *data) { add((const uint8_t *)data, strlen(data)); }
+  void add(const String &data) { add((const uint8_t *)data.c_str(), data.length()); }
+  void calculate();
+  void getBytes(uint8_t *output) const { memcpy(output, _digest, 16); }
+  void getChars(char *output) const;
+  String toString() const;
+
+private:
+  void transform(const uint8_t block[64]);
+
+  uint32_t _state[4];
+  uint64_t _count;
+  uint8_t _buffer[64];
+  uint8_t _digest[16];
+};
+
+#endif
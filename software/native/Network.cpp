@@ -0,0 +1,416 @@
+// Host shim of the network classes with POSIX sockets: WiFiClient, WiFiServer, WiFiUDP, WiFi
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "ESP8266WiFi.h"
+
+ESP8266WiFiClass WiFi;
+
+static void setNonBlocking(int fd)
+{
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+}
+
+static sockaddr_in socketAddress(IPAddress ip, uint16_t port)
+{
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = uint32_t(ip);
+  return address;
+}
+
+// WiFi
+
+int ESP8266WiFiClass::hostByName(const char *host, IPAddress &result)
+{
+  if (result.fromString(host))
+  {
+    return 1;
+  }
+  addrinfo hints = {};
+  addrinfo *info = nullptr;
+  hints.ai_family = AF_INET;
+  if (getaddrinfo(host, nullptr, &hints, &info) != 0 || !info)
+  {
+    return 0;
+  }
+  result = IPAddress(uint32_t(((sockaddr_in *)info->ai_addr)->sin_addr.s_addr));
+  freeaddrinfo(info);
+  return 1;
+}
+
+// WiFiClient
+
+WiFiClient::Socket::~Socket()
+{
+  if (fd >= 0)
+  {
+    close(fd);
+  }
+}
+
+WiFiClient::WiFiClient(int fd) : _socket(std::make_shared<Socket>())
+{
+  _socket->fd = fd;
+  setNonBlocking(fd);
+}
+
+int WiFiClient::fd() const
+{
+  return _socket ? _socket->fd : -1;
+}
+
+int WiFiClient::connect(IPAddress ip, uint16_t port)
+{
+  stop();
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0)
+  {
+    return 0;
+  }
+  sockaddr_in address = socketAddress(ip, port);
+  // Blocking connect with the stream timeout like on the target
+  timeval timeout = {long(_timeout / 1000), long(_timeout % 1000) * 1000};
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+  if (::connect(fd, (sockaddr *)&address, sizeof(address)) != 0)
+  {
+    close(fd);
+    return 0;
+  }
+  *this = WiFiClient(fd);
+  return 1;
+}
+
+int WiFiClient::connect(const char *host, uint16_t port)
+{
+  IPAddress ip;
+  if (!WiFi.hostByName(host, ip))
+  {
+    return 0;
+  }
+  return connect(ip, port);
+}
+
+uint8_t WiFiClient::connected()
+{
+  int fd = this->fd();
+  if (fd < 0)
+  {
+    return 0;
+  }
+  char c;
+  ssize_t n = recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+  if (n > 0 || (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)))
+  {
+    return 1;
+  }
+  return 0;
+}
+
+int WiFiClient::available()
+{
+  int fd = this->fd();
+  int n = 0;
+  if (fd < 0 || ioctl(fd, FIONREAD, &n) != 0)
+  {
+    return 0;
+  }
+  return n;
+}
+
+int WiFiClient::read()
+{
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::read(uint8_t *buffer, size_t size)
+{
+  int fd = this->fd();
+  if (fd < 0)
+  {
+    return -1;
+  }
+  ssize_t n = recv(fd, buffer, size, MSG_DONTWAIT);
+  return n > 0 ? int(n) : -1;
+}
+
+int WiFiClient::peek()
+{
+  int fd = this->fd();
+  uint8_t c;
+  if (fd < 0 || recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) != 1)
+  {
+    return -1;
+  }
+  return c;
+}
+
+size_t WiFiClient::write(const uint8_t *buffer, size_t size)
+{
+  int fd = this->fd();
+  size_t sent = 0;
+  unsigned long start = millis();
+  // Blocking write with timeout like the lwIP client
+  while (fd >= 0 && sent < size && millis() - start < _timeout)
+  {
+    ssize_t n = send(fd, buffer + sent, size - sent, MSG_NOSIGNAL);
+    if (n > 0)
+    {
+      sent += n;
+    }
+    else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+      pollfd p = {fd, POLLOUT, 0};
+      poll(&p, 1, 10);
+    }
+    else
+    {
+      break;
+    }
+  }
+  return sent;
+}
+
+int WiFiClient::availableForWrite()
+{
+  int fd = this->fd();
+  if (fd < 0)
+  {
+    return 0;
+  }
+  // Free space of the send buffer, the kernel reports twice the size set and keeps half for its bookkeeping
+  int size = 0;
+  int queued = 0;
+  socklen_t length = sizeof(size);
+  if (getsockopt(fd, SOL_SOCKET, SO_SNDBUF, &size, &length) != 0 || ioctl(fd, TIOCOUTQ, &queued) != 0)
+  {
+    return 0;
+  }
+  size /= 2;
+  return size > queued ? size - queued : 0;
+}
+
+void WiFiClient::stop()
+{
+  if (_socket && _socket->fd >= 0)
+  {
+    close(_socket->fd);
+    _socket->fd = -1;
+  }
+  _socket.reset();
+}
+
+void WiFiClient::setNoDelay(bool nodelay)
+{
+  int fd = this->fd();
+  int value = nodelay ? 1 : 0;
+  if (fd >= 0)
+  {
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &value, sizeof(value));
+  }
+}
+
+IPAddress WiFiClient::remoteIP() const
+{
+  sockaddr_in address = {};
+  socklen_t length = sizeof(address);
+  if (fd() < 0 || getpeername(fd(), (sockaddr *)&address, &length) != 0)
+  {
+    return IPAddress();
+  }
+  return IPAddress(uint32_t(address.sin_addr.s_addr));
+}
+
+uint16_t WiFiClient::remotePort() const
+{
+  sockaddr_in address = {};
+  socklen_t length = sizeof(address);
+  if (fd() < 0 || getpeername(fd(), (sockaddr *)&address, &length) != 0)
+  {
+    return 0;
+  }
+  return ntohs(address.sin_port);
+}
+
+// WiFiServer
+
+void WiFiServer::begin()
+{
+  stop();
+  _fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (_fd < 0)
+  {
+    return;
+  }
+  int reuse = 1;
+  setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  sockaddr_in address = socketAddress(IPAddress(), _port);
+  if (bind(_fd, (sockaddr *)&address, sizeof(address)) != 0 && errno == EACCES && _port < 1024)
+  {
+    _port += 8000;
+    address = socketAddress(IPAddress(), _port);
+    bind(_fd, (sockaddr *)&address, sizeof(address));
+  }
+  if (listen(_fd, 8) != 0)
+  {
+    fprintf(stderr, "native: can't listen on port %u\n", _port);
+    close(_fd);
+    _fd = -1;
+    return;
+  }
+  setNonBlocking(_fd);
+}
+
+WiFiClient WiFiServer::accept()
+{
+  if (_fd < 0)
+  {
+    return WiFiClient();
+  }
+  int fd = ::accept(_fd, nullptr, nullptr);
+  if (fd < 0)
+  {
+    return WiFiClient();
+  }
+  WiFiClient client(fd);
+  client.setNoDelay(_nodelay);
+  return client;
+}
+
+bool WiFiServer::hasClient()
+{
+  pollfd p = {_fd, POLLIN, 0};
+  return _fd >= 0 && poll(&p, 1, 0) > 0;
+}
+
+void WiFiServer::stop()
+{
+  if (_fd >= 0)
+  {
+    close(_fd);
+    _fd = -1;
+  }
+}
+
+// WiFiUDP
+
+bool WiFiUDP::open()
+{
+  if (_fd >= 0)
+  {
+    return true;
+  }
+  _fd = socket(AF_INET, SOCK_DGRAM, 0);
+  if (_fd < 0)
+  {
+    return false;
+  }
+  int broadcast = 1;
+  setsockopt(_fd, SOL_SOCKET, SO_BROADCAST, &broadcast, sizeof(broadcast));
+  setNonBlocking(_fd);
+  return true;
+}
+
+uint8_t WiFiUDP::begin(uint16_t port)
+{
+  if (!open())
+  {
+    return 0;
+  }
+  int reuse = 1;
+  setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  sockaddr_in address = socketAddress(IPAddress(), port);
+  return bind(_fd, (sockaddr *)&address, sizeof(address)) == 0 ? 1 : 0;
+}
+
+void WiFiUDP::stop()
+{
+  if (_fd >= 0)
+  {
+    close(_fd);
+    _fd = -1;
+  }
+}
+
+int WiFiUDP::beginPacket(IPAddress ip, uint16_t port)
+{
+  _ip = ip;
+  _port = port;
+  _packet.clear();
+  return open() ? 1 : 0;
+}
+
+int WiFiUDP::beginPacket(const char *host, uint16_t port)
+{
+  IPAddress ip;
+  if (!WiFi.hostByName(host, ip))
+  {
+    return 0;
+  }
+  return beginPacket(ip, port);
+}
+
+int WiFiUDP::beginPacketMulticast(IPAddress multicastAddress, uint16_t port, IPAddress interfaceAddress, int ttl)
+{
+  if (!beginPacket(multicastAddress, port))
+  {
+    return 0;
+  }
+  unsigned char value = ttl;
+  setsockopt(_fd, IPPROTO_IP, IP_MULTICAST_TTL, &value, sizeof(value));
+  in_addr interface = {uint32_t(interfaceAddress)};        // Sent over the interface of the address like on the target
+  setsockopt(_fd, IPPROTO_IP, IP_MULTICAST_IF, &interface, sizeof(interface));
+  return 1;
+}
+
+int WiFiUDP::endPacket()
+{
+  if (_fd < 0)
+  {
+    return 0;
+  }
+  sockaddr_in address = socketAddress(_ip, _port);
+  ssize_t n = sendto(_fd, _packet.data(), _packet.size(), 0, (sockaddr *)&address, sizeof(address));
+  _packet.clear();
+  return n >= 0 ? 1 : 0;
+}
+
+int WiFiUDP::parsePacket()
+{
+  _received.clear();
+  _position = 0;
+  if (_fd < 0)
+  {
+    return 0;
+  }
+  uint8_t buffer[1500];
+  sockaddr_in address = {};
+  socklen_t length = sizeof(address);
+  ssize_t n = recvfrom(_fd, buffer, sizeof(buffer), MSG_DONTWAIT, (sockaddr *)&address, &length);
+  if (n <= 0)
+  {
+    return 0;
+  }
+  _received.assign(buffer, buffer + n);
+  _remoteIP = IPAddress(uint32_t(address.sin_addr.s_addr));
+  _remotePort = ntohs(address.sin_port);
+  return int(n);
+}
+
+int WiFiUDP::read(uint8_t *buffer, size_t size)
+{
+  size_t n = std::min(size, _received.size() - _position);
+  memcpy(buffer, _received.data() + _position, n);
+  _position += n;
+  return int(n);
+}
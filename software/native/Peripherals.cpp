@@ -0,0 +1,102 @@
+// Host shim of the peripherals: EEPROM file, LittleFS in RAM, I2C bus, Ticker threads
+
+#include "EEPROM.h"
+#include "LittleFS.h"
+#include "Ticker.h"
+#include "Wire.h"
+
+EEPROMClass EEPROM;
+FS LittleFS;
+TwoWire Wire;
+
+// EEPROM
+
+static const char *eepromFile()
+{
+  const char *file = getenv("NATIVE_EEPROM");
+  return file ? file : "native_eeprom.bin";
+}
+
+void EEPROMClass::begin(size_t size)
+{
+  _data.assign(size, 0xFF);
+  _dirty = false;
+  FILE *file = fopen(eepromFile(), "rb");
+  if (file)
+  {
+    size_t n = fread(_data.data(), 1, size, file);
+    (void)n;
+    fclose(file);
+  }
+}
+
+bool EEPROMClass::commit()
+{
+  if (!_dirty)
+  {
+    return true;
+  }
+  FILE *file = fopen(eepromFile(), "wb");
+  if (!file)
+  {
+    return false;
+  }
+  bool ok = fwrite(_data.data(), 1, _data.size(), file) == _data.size();
+  fclose(file);
+  _dirty = !ok;
+  return ok;
+}
+
+bool EEPROMClass::end()
+{
+  bool ok = commit();
+  _data.clear();
+  return ok;
+}
+
+// Ticker
+
+void Ticker::start(uint32_t milliseconds, callback_function_t callback, bool repeat)
+{
+  detach();
+  _stopping = false;
+  _thread = std::thread([this, milliseconds, callback, repeat]() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    auto period = std::chrono::milliseconds(milliseconds);
+    auto next = std::chrono::steady_clock::now() + period;
+    while (!_stop.wait_until(lock, next, [this]() { return _stopping; }))
+    {
+      lock.unlock();
+      noInterrupts();
+      callback();
+      interrupts();
+      lock.lock();
+      if (!repeat)
+      {
+        break;
+      }
+      next += period;
+    }
+  });
+}
+
+void Ticker::detach()
+{
+  if (!_thread.joinable())
+  {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopping = true;
+  }
+  _stop.notify_all();
+  if (_thread.get_id() == std::this_thread::get_id())
+  {
+    _thread.detach();               // Detached from its own callback
+  }
+  else
+  {
+    _thread.join();
+  }
+}
@@ -0,0 +1,80 @@
+#ifndef Print_h
+#define Print_h
+
+// Host shim of the Arduino Print / Printable / Stream classes
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "WString.h"
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print;
+
+class Printable
+{
+public:
+  virtual ~Printable() {}
+  virtual size_t printTo(Print &p) const = 0;
+};
+
+class Print
+{
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size)
+  {
+    size_t n = 0;
+    while (size--)
+    {
+      n += write(*buffer++);
+    }
+    return n;
+  }
+  size_t write(const char *str) { return str ? write((const uint8_t *)str, strlen(str)) : 0; }
+  size_t write(const char *buffer, size_t size) { return write((const uint8_t *)buffer, size); }
+  virtual int availableForWrite() { return 0; }
+  virtual void flush() {}
+
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+  size_t print(const __FlashStringHelper *str) { return write(reinterpret_cast<const char *>(str)); }
+  size_t print(const String &s) { return write((const uint8_t *)s.c_str(), s.length()); }
+  size_t print(const char *str) { return write(str); }
+  size_t print(char c) { return write(uint8_t(c)); }
+  size_t print(unsigned char value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(int value, int base = DEC) { return print((long)value, base); }
+  size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(long value, int base = DEC) { return print(String(value, (unsigned char)base)); }
+  size_t print(unsigned long value, int base = DEC) { return print(String(value, (unsigned char)base)); }
+  size_t print(long long value) { return print(String(value)); }
+  size_t print(unsigned long long value) { return print(String(value)); }
+  size_t print(double value, int decimals = 2) { return print(String(value, (unsigned char)decimals)); }
+  size_t print(bool value) { return print(value ? 1 : 0); }
+  size_t print(const Printable &p) { return p.printTo(*this); }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(const T &value) { size_t n = print(value); return n + println(); }
+  template <typename T> size_t println(const T &value, int format) { size_t n = print(value, format); return n + println(); }
+};
+
+class Stream : public Print
+{
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  void setTimeout(unsigned long timeout) { _timeout = timeout; }
+  unsigned long getTimeout() const { return _timeout; }
+
+protected:
+  unsigned long _timeout = 1000;
+};
+
+#endif
@@ -0,0 +1,175 @@
+// Host shim of the PubSubClient MQTT library
+
+#include "PubSubClient.h"
+
+void PubSubClient::appendString(std::vector<uint8_t> &body, const char *text)
+{
+  size_t length = text ? strlen(text) : 0;
+  body.push_back(uint8_t(length >> 8));
+  body.push_back(uint8_t(length));
+  body.insert(body.end(), text, text + length);
+}
+
+bool PubSubClient::sendPacket(uint8_t type, const std::vector<uint8_t> &body)
+{
+  if (!_client || body.size() + 5 > _bufferSize)
+  {
+    return false;
+  }
+  std::vector<uint8_t> packet;
+  packet.push_back(type);
+  size_t length = body.size();
+  do
+  {
+    uint8_t digit = length % 128;
+    length /= 128;
+    packet.push_back(length > 0 ? digit | 0x80 : digit);
+  } while (length > 0);
+  packet.insert(packet.end(), body.begin(), body.end());
+  if (_client->write(packet.data(), packet.size()) != packet.size())
+  {
+    return false;
+  }
+  _lastOut = millis();
+  return true;
+}
+
+bool PubSubClient::connect(const char *id, const char *willTopic, uint8_t willQos, bool willRetain, const char *willMessage)
+{
+  if (connected())
+  {
+    return true;
+  }
+  if (!_client || !_client->connect(_domain.c_str(), _port))
+  {
+    _state = MQTT_CONNECT_FAILED;
+    return false;
+  }
+  std::vector<uint8_t> body;
+  appendString(body, "MQTT");
+  body.push_back(4);                                // Protocol level 3.1.1
+  uint8_t flags = 0x02;                             // Clean session
+  if (willTopic)
+  {
+    flags |= 0x04 | ((willQos & 3) << 3) | (willRetain ? 0x20 : 0);
+  }
+  body.push_back(flags);
+  body.push_back(uint8_t(_keepAlive >> 8));
+  body.push_back(uint8_t(_keepAlive));
+  appendString(body, id);
+  if (willTopic)
+  {
+    appendString(body, willTopic);
+    appendString(body, willMessage);
+  }
+  if (!sendPacket(0x10, body))
+  {
+    _client->stop();
+    _state = MQTT_CONNECT_FAILED;
+    return false;
+  }
+
+  // Wait for CONNACK
+  uint8_t ack[4];
+  size_t received = 0;
+  unsigned long start = millis();
+  while (received < sizeof(ack))
+  {
+    if (millis() - start > _socketTimeout * 1000UL)
+    {
+      _client->stop();
+      _state = MQTT_CONNECTION_TIMEOUT;
+      return false;
+    }
+    int n = _client->read(ack + received, sizeof(ack) - received);
+    if (n > 0)
+    {
+      received += n;
+    }
+    else
+    {
+      delay(1);
+    }
+  }
+  if (ack[0] != 0x20 || ack[3] != 0)
+  {
+    _client->stop();
+    _state = ack[0] == 0x20 ? ack[3] : MQTT_CONNECT_FAILED;
+    return false;
+  }
+  _lastIn = millis();
+  _pingOutstanding = false;
+  _state = MQTT_CONNECTED;
+  return true;
+}
+
+void PubSubClient::disconnect()
+{
+  if (connected())
+  {
+    sendPacket(0xE0, std::vector<uint8_t>());
+  }
+  if (_client)
+  {
+    _client->stop();
+  }
+  _state = MQTT_DISCONNECTED;
+}
+
+bool PubSubClient::publish(const char *topic, const uint8_t *payload, unsigned int length, bool retained)
+{
+  if (!connected())
+  {
+    return false;
+  }
+  std::vector<uint8_t> body;
+  appendString(body, topic);
+  body.insert(body.end(), payload, payload + length);
+  return sendPacket(0x30 | (retained ? 1 : 0), body);
+}
+
+bool PubSubClient::loop()
+{
+  if (!connected())
+  {
+    return false;
+  }
+  // Incoming packets are only PINGRESP (no subscriptions), so they are just consumed
+  uint8_t buffer[64];
+  while (_client->read(buffer, sizeof(buffer)) > 0)
+  {
+    _lastIn = millis();
+    _pingOutstanding = false;
+  }
+  unsigned long now = millis();
+  unsigned long keepAlive = _keepAlive * 1000UL;
+  if (now - _lastIn > keepAlive + keepAlive / 2 && _pingOutstanding)
+  {
+    _client->stop();
+    _state = MQTT_CONNECTION_TIMEOUT;
+    return false;
+  }
+  if (now - _lastOut > keepAlive && !_pingOutstanding)
+  {
+    _pingOutstanding = sendPacket(0xC0, std::vector<uint8_t>());
+  }
+  return true;
+}
+
+bool PubSubClient::connected()
+{
+  if (!_client)
+  {
+    return false;
+  }
+  if (!_client->connected())
+  {
+    if (_state == MQTT_CONNECTED)
+    {
+      _state = MQTT_CONNECTION_LOST;
+      _client->stop();
+    }
+    return false;
+  }
+  return _state == MQTT_CONNECTED;
+}
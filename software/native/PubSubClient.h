@@ -0,0 +1,64 @@
+#ifndef PubSubClient_h
+#define PubSubClient_h
+
+// Host shim of the PubSubClient MQTT library: MQTT 3.1.1 with QoS 0 publish and last will, no subscribe
+
+#include <vector>
+#include "WiFiClient.h"
+
+#define MQTT_KEEPALIVE 15
+
+#define MQTT_CONNECTION_TIMEOUT     -4
+#define MQTT_CONNECTION_LOST        -3
+#define MQTT_CONNECT_FAILED         -2
+#define MQTT_DISCONNECTED           -1
+#define MQTT_CONNECTED               0
+#define MQTT_CONNECT_BAD_PROTOCOL    1
+#define MQTT_CONNECT_BAD_CLIENT_ID   2
+#define MQTT_CONNECT_UNAVAILABLE     3
+#define MQTT_CONNECT_BAD_CREDENTIALS 4
+#define MQTT_CONNECT_UNAUTHORIZED    5
+
+class PubSubClient
+{
+public:
+  PubSubClient() {}
+  PubSubClient(WiFiClient &client) : _client(&client) {}
+
+  PubSubClient &setClient(WiFiClient &client) { _client = &client; return *this; }
+  PubSubClient &setServer(const char *domain, uint16_t port) { _domain = domain; _port = port; return *this; }
+  PubSubClient &setServer(IPAddress ip, uint16_t port) { _domain = ip.toString(); _port = port; return *this; }
+  PubSubClient &setKeepAlive(uint16_t keepAlive) { _keepAlive = keepAlive; return *this; }
+  PubSubClient &setSocketTimeout(uint16_t timeout) { _socketTimeout = timeout; return *this; }
+  bool setBufferSize(uint16_t size) { _bufferSize = size; return true; }
+  uint16_t getBufferSize() const { return _bufferSize; }
+
+  bool connect(const char *id) { return connect(id, nullptr, 0, false, nullptr); }
+  bool connect(const char *id, const char *willTopic, uint8_t willQos, bool willRetain, const char *willMessage);
+  void disconnect();
+  bool publish(const char *topic, const char *payload, bool retained = false)
+  {
+    return publish(topic, (const uint8_t *)payload, payload ? strlen(payload) : 0, retained);
+  }
+  bool publish(const char *topic, const uint8_t *payload, unsigned int length, bool retained = false);
+  bool loop();
+  bool connected();
+  int state() const { return _state; }
+
+private:
+  bool sendPacket(uint8_t type, const std::vector<uint8_t> &body);
+  static void appendString(std::vector<uint8_t> &body, const char *text);
+
+  WiFiClient *_client = nullptr;
+  String _domain;
+  uint16_t _port = 1883;
+  uint16_t _keepAlive = MQTT_KEEPALIVE;
+  uint16_t _socketTimeout = 15;
+  uint16_t _bufferSize = 256;
+  unsigned long _lastOut = 0;
+  unsigned long _lastIn = 0;
+  bool _pingOutstanding = false;
+  int _state = MQTT_DISCONNECTED;
+};
+
+#endif
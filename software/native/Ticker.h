@@ -0,0 +1,36 @@
+#ifndef Ticker_h
+#define Ticker_h
+
+// Host shim of the Ticker timer: each active ticker is a thread
+// The callback runs with the interrupt lock like an interrupt, so it can't run inside noInterrupts() of the loop
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "Arduino.h"
+
+class Ticker
+{
+public:
+  typedef std::function<void(void)> callback_function_t;
+
+  ~Ticker() { detach(); }
+
+  void attach(float seconds, callback_function_t callback) { attach_ms(uint32_t(seconds * 1000), callback); }
+  void attach_ms(uint32_t milliseconds, callback_function_t callback) { start(milliseconds, callback, true); }
+  void once(float seconds, callback_function_t callback) { once_ms(uint32_t(seconds * 1000), callback); }
+  void once_ms(uint32_t milliseconds, callback_function_t callback) { start(milliseconds, callback, false); }
+  void detach();
+  bool active() const { return _thread.joinable(); }
+
+private:
+  void start(uint32_t milliseconds, callback_function_t callback, bool repeat);
+
+  std::thread _thread;
+  std::mutex _mutex;
+  std::condition_variable _stop;
+  bool _stopping = false;
+};
+
+#endif
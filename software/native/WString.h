@@ -0,0 +1,106 @@
+#ifndef WString_h
+#define WString_h
+
+// Host shim of the Arduino String class (heap string like on the target)
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string>
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+
+class String
+{
+public:
+  String() {}
+  String(const char *cstr) : _s(cstr ? cstr : "") {}
+  String(const std::string &s) : _s(s) {}
+  String(const __FlashStringHelper *str) : _s(reinterpret_cast<const char *>(str)) {}
+  explicit String(char c) : _s(1, c) {}
+  explicit String(unsigned char value, unsigned char base = 10) { _s = number((unsigned long)value, base); }
+  explicit String(int value, unsigned char base = 10) { _s = number((long)value, base); }
+  explicit String(unsigned int value, unsigned char base = 10) { _s = number((unsigned long)value, base); }
+  explicit String(long value, unsigned char base = 10) { _s = number(value, base); }
+  explicit String(unsigned long value, unsigned char base = 10) { _s = number(value, base); }
+  explicit String(long long value) : _s(std::to_string(value)) {}
+  explicit String(unsigned long long value) : _s(std::to_string(value)) {}
+  explicit String(float value, unsigned char decimals = 2) { _s = number((double)value, decimals); }
+  explicit String(double value, unsigned char decimals = 2) { _s = number(value, decimals); }
+
+  unsigned int length() const { return _s.length(); }
+  bool isEmpty() const { return _s.empty(); }
+  const char *c_str() const { return _s.c_str(); }
+  bool reserve(unsigned int size) { _s.reserve(size); return true; }
+
+  bool concat(const String &s) { _s += s._s; return true; }
+  bool concat(const char *cstr) { if (cstr) _s += cstr; return true; }
+  bool concat(const char *cstr, unsigned int length) { _s.append(cstr, length); return true; }
+  bool concat(char c) { _s += c; return true; }
+  template <typename T> bool concat(T value) { return concat(String(value)); }
+
+  String &operator+=(const String &s) { concat(s); return *this; }
+  String &operator+=(const char *cstr) { concat(cstr); return *this; }
+  String &operator+=(const __FlashStringHelper *str) { concat(reinterpret_cast<const char *>(str)); return *this; }
+  String &operator+=(char c) { concat(c); return *this; }
+  template <typename T> String &operator+=(T value) { concat(String(value)); return *this; }
+
+  friend String operator+(const String &a, const String &b) { String r(a); r += b; return r; }
+  friend String operator+(const String &a, const char *b) { String r(a); r += b; return r; }
+  friend String operator+(const char *a, const String &b) { String r(a); r += b; return r; }
+  friend String operator+(const String &a, char b) { String r(a); r += b; return r; }
+  friend String operator+(const String &a, const __FlashStringHelper *b) { String r(a); r += b; return r; }
+  template <typename T> friend String operator+(const String &a, T b) { String r(a); r += String(b); return r; }
+
+  bool operator==(const String &s) const { return _s == s._s; }
+  bool operator==(const char *cstr) const { return _s == (cstr ? cstr : ""); }
+  bool operator!=(const String &s) const { return !(*this == s); }
+  bool operator!=(const char *cstr) const { return !(*this == cstr); }
+  bool operator<(const String &s) const { return _s < s._s; }
+  bool operator>(const String &s) const { return _s > s._s; }
+  bool equals(const String &s) const { return *this == s; }
+  bool equalsIgnoreCase(const String &s) const;
+  int compareTo(const String &s) const { return _s.compare(s._s); }
+  bool startsWith(const String &s) const { return _s.compare(0, s._s.length(), s._s) == 0; }
+  bool endsWith(const String &s) const;
+
+  char charAt(unsigned int index) const { return index < _s.length() ? _s[index] : 0; }
+  void setCharAt(unsigned int index, char c) { if (index < _s.length()) _s[index] = c; }
+  char operator[](unsigned int index) const { return charAt(index); }
+  char &operator[](unsigned int index) { return _s[index]; }
+
+  void getBytes(unsigned char *buffer, unsigned int size, unsigned int index = 0) const;
+  void toCharArray(char *buffer, unsigned int size, unsigned int index = 0) const
+  {
+    getBytes((unsigned char *)buffer, size, index);
+  }
+
+  int indexOf(char c, unsigned int from = 0) const { return position(_s.find(c, from)); }
+  int indexOf(const String &s, unsigned int from = 0) const { return position(_s.find(s._s, from)); }
+  int lastIndexOf(char c) const { return position(_s.rfind(c)); }
+  int lastIndexOf(const String &s) const { return position(_s.rfind(s._s)); }
+  String substring(unsigned int from) const { return substring(from, _s.length()); }
+  String substring(unsigned int from, unsigned int to) const;
+
+  void replace(char find, char replace);
+  void replace(const String &find, const String &replace);
+  void remove(unsigned int index) { remove(index, _s.length()); }
+  void remove(unsigned int index, unsigned int count);
+  void toLowerCase();
+  void toUpperCase();
+  void trim();
+
+  long toInt() const { return atol(_s.c_str()); }
+  float toFloat() const { return float(atof(_s.c_str())); }
+  double toDouble() const { return atof(_s.c_str()); }
+
+private:
+  static int position(size_t pos) { return pos == std::string::npos ? -1 : int(pos); }
+  static std::string number(long value, unsigned char base);
+  static std::string number(unsigned long value, unsigned char base);
+  static std::string number(double value, unsigned char decimals);
+
+  std::string _s;
+};
+
+#endif
@@ -0,0 +1,329 @@
+// Host shim of the ESP8266 web server and the mDNS responder
+
+#include <poll.h>
+#include "ESP8266WebServer.h"
+#include "ESP8266mDNS.h"
+
+MDNSResponder MDNS;
+
+static const String emptyString;
+
+static String urlDecode(const String &text)
+{
+  String decoded;
+  for (unsigned int i = 0; i < text.length(); i++)
+  {
+    char c = text[i];
+    if (c == '+')
+    {
+      decoded += ' ';
+    }
+    else if (c == '%' && i + 2 < text.length())
+    {
+      char hex[3] = {text[i + 1], text[i + 2], 0};
+      decoded += char(strtol(hex, nullptr, 16));
+      i += 2;
+    }
+    else
+    {
+      decoded += c;
+    }
+  }
+  return decoded;
+}
+
+static const char *statusText(int code)
+{
+  switch (code)
+  {
+    case 200: return "OK";
+    case 204: return "No Content";
+    case 206: return "Partial Content";
+    case 301: return "Moved Permanently";
+    case 302: return "Found";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 401: return "Unauthorized";
+    case 404: return "Not Found";
+    case 416: return "Range Not Satisfiable";
+    case 500: return "Internal Server Error";
+    case 503: return "Service Unavailable";
+    default: return "";
+  }
+}
+
+void ESP8266WebServer::on(const String &uri, HTTPMethod method, THandlerFunction handler)
+{
+  _routes.push_back({uri, method, handler});
+}
+
+const String &ESP8266WebServer::arg(const String &name) const
+{
+  for (const auto &argument : _args)
+  {
+    if (argument.name == name)
+    {
+      return argument.value;
+    }
+  }
+  return emptyString;
+}
+
+void ESP8266WebServer::collectHeaders(const char *keys[], size_t count)
+{
+  _requestHeaders.clear();
+  for (size_t i = 0; i < count; i++)
+  {
+    _requestHeaders.push_back({String(keys[i]), String()});
+  }
+}
+
+const String &ESP8266WebServer::header(const String &name) const
+{
+  static const String empty;
+  for (const auto &header : _requestHeaders)
+  {
+    if (header.name.equalsIgnoreCase(name))
+    {
+      return header.value;
+    }
+  }
+  return empty;
+}
+
+bool ESP8266WebServer::hasHeader(const String &name) const
+{
+  return header(name).length() > 0;
+}
+
+bool ESP8266WebServer::hasArg(const String &name) const
+{
+  for (const auto &argument : _args)
+  {
+    if (argument.name == name)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Reads the request head (and a form body) with a timeout of 1s
+bool ESP8266WebServer::readRequest()
+{
+  String head;
+  unsigned long start = millis();
+  int end = -1;
+  while ((end = head.indexOf("\r\n\r\n")) < 0)
+  {
+    if (millis() - start > 1000 || !_client.connected())
+    {
+      return false;
+    }
+    uint8_t buffer[512];
+    int n = _client.read(buffer, sizeof(buffer));
+    if (n > 0)
+    {
+      head.concat((const char *)buffer, n);
+    }
+    else
+    {
+      pollfd p = {_client.fd(), POLLIN, 0};
+      poll(&p, 1, 10);
+    }
+  }
+  String body = head.substring(end + 4);
+  head = head.substring(0, end);
+
+  int lineEnd = head.indexOf("\r\n");
+  String requestLine = lineEnd < 0 ? head : head.substring(0, lineEnd);
+  int space1 = requestLine.indexOf(' ');
+  int space2 = requestLine.indexOf(' ', space1 + 1);
+  if (space1 < 0 || space2 < 0)
+  {
+    return false;
+  }
+  String method = requestLine.substring(0, space1);
+  String url = requestLine.substring(space1 + 1, space2);
+  _method = method == "POST" ? HTTP_POST : method == "HEAD" ? HTTP_HEAD : method == "PUT" ? HTTP_PUT : HTTP_GET;
+
+  int question = url.indexOf('?');
+  String query = question < 0 ? String() : url.substring(question + 1);
+  _uri = urlDecode(question < 0 ? url : url.substring(0, question));
+
+  // A form body is read up to Content-Length and parsed like the query
+  String lowerHead = head;
+  lowerHead.toLowerCase();
+  int lengthPos = lowerHead.indexOf("content-length:");
+  if (lengthPos >= 0)
+  {
+    unsigned int length = head.substring(lengthPos + 15).toInt();
+    while (body.length() < length && millis() - start < 1000 && _client.connected())
+    {
+      uint8_t buffer[512];
+      int n = _client.read(buffer, sizeof(buffer));
+      if (n > 0)
+      {
+        body.concat((const char *)buffer, n);
+      }
+      else
+      {
+        pollfd p = {_client.fd(), POLLIN, 0};
+        poll(&p, 1, 10);
+      }
+    }
+    if (lowerHead.indexOf("application/x-www-form-urlencoded") >= 0)
+    {
+      query += (query.length() > 0 ? "&" : "") + body;
+    }
+  }
+
+  // Collected headers, names are case insensitive
+  for (auto &header : _requestHeaders)
+  {
+    String key = String("\r\n") + header.name + ":";
+    key.toLowerCase();
+    int start = lowerHead.indexOf(key);
+    header.value = String();
+    if (start >= 0)
+    {
+      start += key.length();
+      int stop = head.indexOf("\r\n", start);
+      header.value = head.substring(start, stop < 0 ? head.length() : stop);
+      header.value.trim();
+    }
+  }
+
+  _args.clear();
+  unsigned int pos = 0;
+  while (pos < query.length())
+  {
+    int amp = query.indexOf('&', pos);
+    String pair = query.substring(pos, amp < 0 ? query.length() : amp);
+    int equal = pair.indexOf('=');
+    if (pair.length() > 0)
+    {
+      _args.push_back({urlDecode(equal < 0 ? pair : pair.substring(0, equal)), urlDecode(equal < 0 ? String() : pair.substring(equal + 1))});
+    }
+    if (amp < 0)
+    {
+      break;
+    }
+    pos = amp + 1;
+  }
+  return true;
+}
+
+void ESP8266WebServer::handleClient()
+{
+  _client = _server.accept();
+  if (!_client)
+  {
+    return;
+  }
+  _headers = String();
+  _contentLength = CONTENT_LENGTH_NOT_SET;
+  _chunked = false;
+  if (readRequest())
+  {
+    THandlerFunction handler = _notFound;
+    for (const auto &route : _routes)
+    {
+      if (route.uri == _uri && (route.method == HTTP_ANY || route.method == _method))
+      {
+        handler = route.handler;
+        break;
+      }
+    }
+    if (handler)
+    {
+      handler();
+    }
+    else
+    {
+      send(404, "text/plain", String("Not found: ") + _uri);
+    }
+  }
+  if (_chunked)
+  {
+    sendContent("", 0);
+  }
+  // Release the connection, a copy held by the handler keeps it open
+  _client = WiFiClient();
+}
+
+void ESP8266WebServer::sendHeader(const String &name, const String &value, bool first)
+{
+  String header = name + ": " + value + "\r\n";
+  _headers = first ? header + _headers : _headers + header;
+}
+
+void ESP8266WebServer::sendHeader(int code, const char *type, size_t length)
+{
+  String head = String("HTTP/1.1 ") + String(code) + " " + statusText(code) + "\r\n";
+  if (type)
+  {
+    head += String("Content-Type: ") + type + "\r\n";
+  }
+  if (_contentLength != CONTENT_LENGTH_NOT_SET)
+  {
+    length = _contentLength;
+  }
+  if (length == CONTENT_LENGTH_UNKNOWN)
+  {
+    head += "Transfer-Encoding: chunked\r\n";
+  }
+  else
+  {
+    head += String("Content-Length: ") + String((unsigned long)length) + "\r\n";
+  }
+  head += _headers;
+  head += "Connection: close\r\n\r\n";
+  _client.write((const uint8_t *)head.c_str(), head.length());
+  _headers = String();
+  _chunked = (length == CONTENT_LENGTH_UNKNOWN);
+}
+
+void ESP8266WebServer::send(int code, const char *type, const String &content)
+{
+  sendHeader(code, type, content.length());
+  if (content.length() > 0)
+  {
+    sendContent(content);
+  }
+}
+
+void ESP8266WebServer::send_P(int code, PGM_P type, PGM_P content)
+{
+  send_P(code, type, content, strlen(content));
+}
+
+void ESP8266WebServer::send_P(int code, PGM_P type, PGM_P content, size_t length)
+{
+  sendHeader(code, type, length);
+  if (length > 0)
+  {
+    sendContent_P(content, length);
+  }
+}
+
+void ESP8266WebServer::sendContent(const char *content, size_t length)
+{
+  if (!_chunked)
+  {
+    _client.write((const uint8_t *)content, length);
+    return;
+  }
+  char size[12];
+  int n = snprintf(size, sizeof(size), "%zx\r\n", length);
+  _client.write((const uint8_t *)size, n);
+  _client.write((const uint8_t *)content, length);
+  _client.write((const uint8_t *)"\r\n", 2);
+  // The empty chunk ends the response
+  _chunked = length > 0;
+}
+
+void ESP8266WebServer::sendContent_P(PGM_P content, size_t length)
+{
+  sendContent(content, length);
+}
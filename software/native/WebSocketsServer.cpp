@@ -0,0 +1,314 @@
+// Host shim of the arduinoWebSockets server
+
+#include "WebSocketsServer.h"
+
+// SHA-1 of the handshake key (RFC 3174)
+static void sha1(const uint8_t *data, size_t length, uint8_t digest[20])
+{
+  uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+  std::vector<uint8_t> message(data, data + length);
+  message.push_back(0x80);
+  while (message.size() % 64 != 56)
+  {
+    message.push_back(0);
+  }
+  uint64_t bits = uint64_t(length) * 8;
+  for (int i = 7; i >= 0; i--)
+  {
+    message.push_back(uint8_t(bits >> (i * 8)));
+  }
+  auto rotate = [](uint32_t x, int n) { return (x << n) | (x >> (32 - n)); };
+  for (size_t chunk = 0; chunk < message.size(); chunk += 64)
+  {
+    uint32_t w[80];
+    for (int i = 0; i < 16; i++)
+    {
+      const uint8_t *p = &message[chunk + i * 4];
+      w[i] = (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | p[3];
+    }
+    for (int i = 16; i < 80; i++)
+    {
+      w[i] = rotate(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    }
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+    for (int i = 0; i < 80; i++)
+    {
+      uint32_t f, k;
+      if (i < 20) { f = (b & c) | (~b & d); k = 0x5A827999; }
+      else if (i < 40) { f = b ^ c ^ d; k = 0x6ED9EBA1; }
+      else if (i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8F1BBCDC; }
+      else { f = b ^ c ^ d; k = 0xCA62C1D6; }
+      uint32_t t = rotate(a, 5) + f + e + k + w[i];
+      e = d;
+      d = c;
+      c = rotate(b, 30);
+      b = a;
+      a = t;
+    }
+    h[0] += a;
+    h[1] += b;
+    h[2] += c;
+    h[3] += d;
+    h[4] += e;
+  }
+  for (int i = 0; i < 5; i++)
+  {
+    digest[i * 4] = uint8_t(h[i] >> 24);
+    digest[i * 4 + 1] = uint8_t(h[i] >> 16);
+    digest[i * 4 + 2] = uint8_t(h[i] >> 8);
+    digest[i * 4 + 3] = uint8_t(h[i]);
+  }
+}
+
+static String base64(const uint8_t *data, size_t length)
+{
+  static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  String encoded;
+  for (size_t i = 0; i < length; i += 3)
+  {
+    uint32_t n = uint32_t(data[i]) << 16;
+    if (i + 1 < length) n |= uint32_t(data[i + 1]) << 8;
+    if (i + 2 < length) n |= data[i + 2];
+    encoded += table[(n >> 18) & 63];
+    encoded += table[(n >> 12) & 63];
+    encoded += i + 1 < length ? table[(n >> 6) & 63] : '=';
+    encoded += i + 2 < length ? table[n & 63] : '=';
+  }
+  return encoded;
+}
+
+void WebSocketsServer::close()
+{
+  for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++)
+  {
+    disconnect(i);
+  }
+  _server.stop();
+}
+
+void WebSocketsServer::disconnect(uint8_t num)
+{
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX || _clients[num].client.fd() < 0)
+  {
+    return;
+  }
+  bool open = _clients[num].open;
+  _clients[num].client.stop();
+  _clients[num] = Client();
+  if (open)
+  {
+    fire(num, WStype_DISCONNECTED, nullptr, 0);
+  }
+}
+
+int WebSocketsServer::connectedClients()
+{
+  int n = 0;
+  for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++)
+  {
+    n += _clients[i].open ? 1 : 0;
+  }
+  return n;
+}
+
+void WebSocketsServer::loop()
+{
+  while (_server.hasClient())
+  {
+    WiFiClient client = _server.accept();
+    // A slot is free after disconnect(), a closed socket keeps it until the loop below has reported it
+    uint8_t num = 0;
+    while (num < WEBSOCKETS_SERVER_CLIENT_MAX && _clients[num].client.fd() >= 0)
+    {
+      num++;
+    }
+    if (num < WEBSOCKETS_SERVER_CLIENT_MAX)
+    {
+      client.setNoDelay(true);              // Like the library, each message is sent at once
+      _clients[num].client = client;
+    }
+    else
+    {
+      client.write("HTTP/1.1 503 Service Unavailable\r\nConnection: close\r\n\r\n");
+      client.stop();
+    }
+  }
+  for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++)
+  {
+    Client &c = _clients[i];
+    if (c.client.fd() < 0)
+    {
+      continue;
+    }
+    if (!c.client.connected())
+    {
+      disconnect(i);
+      continue;
+    }
+    uint8_t buffer[512];
+    int n;
+    while ((n = c.client.read(buffer, sizeof(buffer))) > 0)
+    {
+      c.buffer.concat((const char *)buffer, n);
+    }
+    if (c.open)
+    {
+      frames(i);
+    }
+    else
+    {
+      handshake(i);
+    }
+  }
+}
+
+void WebSocketsServer::handshake(uint8_t num)
+{
+  Client &c = _clients[num];
+  int end = c.buffer.indexOf("\r\n\r\n");
+  if (end < 0)
+  {
+    return;
+  }
+  String head = c.buffer.substring(0, end);
+  c.buffer = c.buffer.substring(end + 4);
+  int space1 = head.indexOf(' ');
+  int space2 = head.indexOf(' ', space1 + 1);
+  String url = (space1 < 0 || space2 < 0) ? String("/") : head.substring(space1 + 1, space2);
+  String lower = head;
+  lower.toLowerCase();
+  int keyPos = lower.indexOf("sec-websocket-key:");
+  if (keyPos < 0)
+  {
+    c.client.write("HTTP/1.1 400 Bad Request\r\nConnection: close\r\n\r\n");
+    disconnect(num);
+    return;
+  }
+  int keyEnd = head.indexOf("\r\n", keyPos);
+  String key = head.substring(keyPos + 18, keyEnd < 0 ? head.length() : keyEnd);
+  key.trim();
+  key += "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+  uint8_t digest[20];
+  sha1((const uint8_t *)key.c_str(), key.length(), digest);
+  String response = "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Accept: ";
+  response += base64(digest, sizeof(digest));
+  response += "\r\n\r\n";
+  c.client.write((const uint8_t *)response.c_str(), response.length());
+  c.open = true;
+  fire(num, WStype_CONNECTED, (uint8_t *)url.c_str(), url.length());
+  frames(num);
+}
+
+void WebSocketsServer::frames(uint8_t num)
+{
+  Client &c = _clients[num];
+  while (c.open && c.buffer.length() >= 2)
+  {
+    const uint8_t *p = (const uint8_t *)c.buffer.c_str();
+    uint8_t opcode = p[0] & 0x0F;
+    bool masked = p[1] & 0x80;
+    uint64_t length = p[1] & 0x7F;
+    size_t header = 2;
+    if (length == 126)
+    {
+      if (c.buffer.length() < 4) return;
+      length = (uint64_t(p[2]) << 8) | p[3];
+      header = 4;
+    }
+    else if (length == 127)
+    {
+      if (c.buffer.length() < 10) return;
+      length = 0;
+      for (int i = 0; i < 8; i++)
+      {
+        length = (length << 8) | p[2 + i];
+      }
+      header = 10;
+    }
+    size_t maskPos = header;
+    header += masked ? 4 : 0;
+    if (c.buffer.length() < header + length)
+    {
+      return;
+    }
+    std::string payload(c.buffer.c_str() + header, size_t(length));
+    if (masked)
+    {
+      for (size_t i = 0; i < payload.size(); i++)
+      {
+        payload[i] ^= p[maskPos + (i & 3)];
+      }
+    }
+    c.buffer = c.buffer.substring(header + length);
+    switch (opcode)
+    {
+      case 0x1:
+        fire(num, WStype_TEXT, (uint8_t *)&payload[0], payload.size());
+        break;
+      case 0x2:
+        fire(num, WStype_BIN, (uint8_t *)&payload[0], payload.size());
+        break;
+      case 0x8:
+        sendFrame(num, 0x8, payload.data(), std::min(payload.size(), size_t(2)));
+        disconnect(num);
+        return;
+      case 0x9:
+        sendFrame(num, 0xA, payload.data(), payload.size());
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+bool WebSocketsServer::sendFrame(uint8_t num, uint8_t opcode, const char *payload, size_t length)
+{
+  if (num >= WEBSOCKETS_SERVER_CLIENT_MAX || !_clients[num].open)
+  {
+    return false;
+  }
+  std::string frame;
+  frame += char(0x80 | opcode);
+  if (length < 126)
+  {
+    frame += char(length);
+  }
+  else if (length < 65536)
+  {
+    frame += char(126);
+    frame += char(length >> 8);
+    frame += char(length);
+  }
+  else
+  {
+    frame += char(127);
+    for (int i = 7; i >= 0; i--)
+    {
+      frame += char(uint64_t(length) >> (i * 8));
+    }
+  }
+  frame.append(payload, length);
+  return _clients[num].client.write((const uint8_t *)frame.data(), frame.size()) == frame.size();
+}
+
+bool WebSocketsServer::sendTXT(uint8_t num, const char *payload, size_t length)
+{
+  if (length == 0 && payload)
+  {
+    length = strlen(payload);
+  }
+  return sendFrame(num, 0x1, payload, length);
+}
+
+bool WebSocketsServer::broadcastTXT(const char *payload, size_t length)
+{
+  bool ok = true;
+  for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++)
+  {
+    if (_clients[i].open)
+    {
+      ok &= sendTXT(i, payload, length);
+    }
+  }
+  return ok;
+}
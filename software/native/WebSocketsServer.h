@@ -0,0 +1,68 @@
+#ifndef WebSocketsServer_h
+#define WebSocketsServer_h
+
+// Host shim of the arduinoWebSockets server: RFC 6455 handshake, unfragmented text frames, ping and close
+
+#include "ESP8266WiFi.h"
+
+#define WEBSOCKETS_SERVER_CLIENT_MAX 5
+
+typedef enum {
+  WStype_ERROR,
+  WStype_DISCONNECTED,
+  WStype_CONNECTED,
+  WStype_TEXT,
+  WStype_BIN,
+  WStype_FRAGMENT_TEXT_START,
+  WStype_FRAGMENT_BIN_START,
+  WStype_FRAGMENT,
+  WStype_FRAGMENT_FIN,
+  WStype_PING,
+  WStype_PONG,
+} WStype_t;
+
+class WebSocketsServer
+{
+public:
+  typedef std::function<void(uint8_t num, WStype_t type, uint8_t *payload, size_t length)> WebSocketServerEvent;
+
+  WebSocketsServer(uint16_t port, const String &origin = "", const String &protocol = "arduino") : _server(port) {}
+
+  void begin() { _server.begin(); }
+  void close();
+  void loop();
+  void onEvent(WebSocketServerEvent event) { _event = event; }
+
+  bool sendTXT(uint8_t num, const char *payload, size_t length = 0);
+  bool sendTXT(uint8_t num, const uint8_t *payload, size_t length = 0) { return sendTXT(num, (const char *)payload, length); }
+  bool sendTXT(uint8_t num, const String &payload) { return sendTXT(num, payload.c_str(), payload.length()); }
+  bool broadcastTXT(const char *payload, size_t length = 0);
+  void disconnect(uint8_t num);
+  IPAddress remoteIP(uint8_t num) { return num < WEBSOCKETS_SERVER_CLIENT_MAX ? _clients[num].client.remoteIP() : IPAddress(); }
+  int connectedClients();
+
+private:
+  struct Client
+  {
+    WiFiClient client;
+    bool open = false;
+    String buffer;
+  };
+
+  void handshake(uint8_t num);
+  void frames(uint8_t num);
+  bool sendFrame(uint8_t num, uint8_t opcode, const char *payload, size_t length);
+  void fire(uint8_t num, WStype_t type, uint8_t *payload, size_t length)
+  {
+    if (_event)
+    {
+      _event(num, type, payload, length);
+    }
+  }
+
+  WiFiServer _server;
+  Client _clients[WEBSOCKETS_SERVER_CLIENT_MAX];
+  WebSocketServerEvent _event;
+};
+
+#endif
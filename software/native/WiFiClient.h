@@ -0,0 +1,44 @@
+#ifndef WiFiClient_h
+#define WiFiClient_h
+
+// Host shim of the TCP client with a POSIX socket (non-blocking socket, blocking write like on the target)
+// Copies share the socket, stop() closes it for all copies, the last copy closes it when destroyed
+
+#include <memory>
+#include "Arduino.h"
+
+class WiFiClient : public Stream
+{
+public:
+  WiFiClient() {}
+  explicit WiFiClient(int fd);
+
+  int connect(IPAddress ip, uint16_t port);
+  int connect(const char *host, uint16_t port);
+  uint8_t connected();
+  int available() override;
+  int read() override;
+  int read(uint8_t *buffer, size_t size);
+  int peek() override;
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+  int availableForWrite() override;
+  void flush() override {}
+  void stop();
+  void setNoDelay(bool nodelay);
+  IPAddress remoteIP() const;
+  uint16_t remotePort() const;
+  int fd() const;
+  operator bool() { return connected(); }
+
+private:
+  struct Socket
+  {
+    int fd = -1;
+    ~Socket();
+  };
+  std::shared_ptr<Socket> _socket;
+};
+
+#endif
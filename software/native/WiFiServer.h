@@ -0,0 +1,31 @@
+#ifndef WiFiServer_h
+#define WiFiServer_h
+
+// Host shim of the TCP server with a POSIX socket
+// Ports below 1024 are moved to port + 8000 if the host does not allow them (80 => 8080)
+
+#include "WiFiClient.h"
+
+class WiFiServer
+{
+public:
+  WiFiServer(uint16_t port) : _port(port) {}
+  ~WiFiServer() { stop(); }
+
+  void begin();
+  void begin(uint16_t port) { _port = port; begin(); }
+  WiFiClient accept();
+  WiFiClient available() { return accept(); }
+  bool hasClient();
+  void setNoDelay(bool nodelay) { _nodelay = nodelay; }
+  void stop();
+  uint16_t port() const { return _port; }   // Used port (after moving)
+  uint8_t status() const { return _fd >= 0 ? 1 : 0; }
+
+private:
+  uint16_t _port;
+  int _fd = -1;
+  bool _nodelay = false;
+};
+
+#endif
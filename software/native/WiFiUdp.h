@@ -0,0 +1,45 @@
+#ifndef WiFiUdp_h
+#define WiFiUdp_h
+
+// Host shim of the UDP socket, one datagram per beginPacket() ... endPacket()
+
+#include <vector>
+#include "Arduino.h"
+
+class WiFiUDP : public Stream
+{
+public:
+  ~WiFiUDP() { stop(); }
+
+  uint8_t begin(uint16_t port);
+  void stop();
+  int beginPacket(IPAddress ip, uint16_t port);
+  int beginPacket(const char *host, uint16_t port);
+  int beginPacketMulticast(IPAddress multicastAddress, uint16_t port, IPAddress interfaceAddress, int ttl = 1);
+  int endPacket();
+  size_t write(uint8_t c) override { _packet.push_back(c); return 1; }
+  size_t write(const uint8_t *buffer, size_t size) override { _packet.insert(_packet.end(), buffer, buffer + size); return size; }
+  using Print::write;
+
+  int parsePacket();
+  int available() override { return int(_received.size() - _position); }
+  int read() override { return _position < _received.size() ? _received[_position++] : -1; }
+  int read(uint8_t *buffer, size_t size);
+  int peek() override { return _position < _received.size() ? _received[_position] : -1; }
+  IPAddress remoteIP() const { return _remoteIP; }
+  uint16_t remotePort() const { return _remotePort; }
+
+private:
+  bool open();
+
+  int _fd = -1;
+  IPAddress _ip;
+  uint16_t _port = 0;
+  std::vector<uint8_t> _packet;
+  std::vector<uint8_t> _received;
+  size_t _position = 0;
+  IPAddress _remoteIP;
+  uint16_t _remotePort = 0;
+};
+
+#endif
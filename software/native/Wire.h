@@ -0,0 +1,34 @@
+#ifndef Wire_h
+#define Wire_h
+
+// Host shim of the I2C bus without devices: every address answers with NACK
+
+#include "Arduino.h"
+
+class TwoWire : public Stream
+{
+public:
+  void begin() {}
+  void begin(int sda, int scl) {}
+  void setClock(uint32_t frequency) {}
+  void setClockStretchLimit(uint32_t limit) {}
+  void beginTransmission(uint8_t address) { _address = address; }
+  void beginTransmission(int address) { beginTransmission(uint8_t(address)); }
+  uint8_t endTransmission(bool sendStop = true) { return 2; }   // 2 = NACK on address
+  uint8_t requestFrom(uint8_t address, uint8_t quantity, bool sendStop = true) { return 0; }
+  uint8_t requestFrom(int address, int quantity) { return 0; }
+  uint8_t requestFrom(int address, int quantity, int sendStop) { return 0; }
+  size_t write(uint8_t data) override { return 1; }
+  size_t write(const uint8_t *data, size_t quantity) override { return quantity; }
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+
+private:
+  uint8_t _address = 0;
+};
+
+extern TwoWire Wire;
+
+#endif
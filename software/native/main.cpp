@@ -0,0 +1,35 @@
+// Host entry point of the native environment: setup() once, then loop() like the Arduino core
+// NATIVE_LOOPS=<n> stops after n loop() calls, benchmarks build with NATIVE_NO_MAIN and call the firmware directly
+// The unit tests (pio test, PIO_UNIT_TESTING) have their own main()
+
+#if !defined(NATIVE_NO_MAIN) && !defined(PIO_UNIT_TESTING)
+
+#include "Arduino.h"
+
+static unsigned long loopCount = 0;
+
+namespace native
+{
+  unsigned long loops()
+  {
+    return loopCount;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  const char *limit = getenv("NATIVE_LOOPS");
+  unsigned long maxLoops = limit ? strtoul(limit, nullptr, 10) : 0;
+  setup();
+  while (maxLoops == 0 || loopCount < maxLoops)
+  {
+    loop();
+    loopCount++;
+    // The target runs the WiFi stack between loops, the host gives the other threads a slot
+    delay(1);
+  }
+  Serial.flush();
+  return 0;
+}
+
+#endif
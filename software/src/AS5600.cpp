@@ -14,6 +14,7 @@
 #include "Arduino.h"
 #include "AS5600.h"
 #include "Wire.h"
+#include "I2CBus.h"
 
 /****************************************************
   Method: AMS_5600
@@ -85,7 +86,7 @@ int AMS_5600::getAddress()
 /*******************************************************
   Method: setMaxAngle
   In: new maximum angle to set OR none
-  Out: value of max angle register
+  Out: value of max angle register, 0xffff on bus error
   Description: sets a value in maximum angle register.
   If no value is provided, method will read position of
   magnet.  Setting this register zeros out max position
@@ -94,9 +95,11 @@ int AMS_5600::getAddress()
 word AMS_5600::setMaxAngle(word newMaxAngle)
 {
   word retVal;
-  if (newMaxAngle == -1)
+  if (newMaxAngle == 0xffff)
   {
     _maxAngle = getRawAngle();
+    if (_maxAngle == 0xffff)
+      return 0xffff;
   }
   else
     _maxAngle = newMaxAngle;
@@ -106,7 +109,7 @@ word AMS_5600::setMaxAngle(word newMaxAngle)
   writeOneByte(_mang_lo, lowByte(_maxAngle));
   delay(2);
 
-  retVal = readTwoBytes(_mang_hi, _mang_lo);
+  retVal = readTwoBytes(_mang_hi);
   return retVal;
 }
 
@@ -118,22 +121,24 @@ word AMS_5600::setMaxAngle(word newMaxAngle)
 *******************************************************/
 word AMS_5600::getMaxAngle()
 {
-  return readTwoBytes(_mang_hi, _mang_lo);
+  return readTwoBytes(_mang_hi);
 }
 
 /*******************************************************
   Method: setStartPosition
   In: new start angle position
-  Out: value of start position register
+  Out: value of start position register, 0xffff on bus error
   Description: sets a value in start position register.
   If no value is provided, method will read position of
   magnet.  
 *******************************************************/
 word AMS_5600::setStartPosition(word startAngle)
 {
-  if (startAngle == -1)
+  if (startAngle == 0xffff)
   {
     _rawStartAngle = getRawAngle();
+    if (_rawStartAngle == 0xffff)
+      return 0xffff;
   }
   else
     _rawStartAngle = startAngle;
@@ -142,7 +147,7 @@ word AMS_5600::setStartPosition(word startAngle)
   delay(2);
   writeOneByte(_zpos_lo, lowByte(_rawStartAngle));
   delay(2);
-  _zPosition = readTwoBytes(_zpos_hi, _zpos_lo);
+  _zPosition = readTwoBytes(_zpos_hi);
 
   return (_zPosition);
 }
@@ -155,7 +160,7 @@ word AMS_5600::setStartPosition(word startAngle)
 *******************************************************/
 word AMS_5600::getStartPosition()
 {
-  return readTwoBytes(_zpos_hi, _zpos_lo);
+  return readTwoBytes(_zpos_hi);
 }
 
 /*******************************************************
@@ -168,8 +173,12 @@ word AMS_5600::getStartPosition()
 *******************************************************/
 word AMS_5600::setEndPosition(word endAngle)
 {
-  if (endAngle == -1)
+  if (endAngle == 0xffff)
+  {
     _rawEndAngle = getRawAngle();
+    if (_rawEndAngle == 0xffff)
+      return 0xffff;
+  }
   else
     _rawEndAngle = endAngle;
 
@@ -177,7 +186,7 @@ word AMS_5600::setEndPosition(word endAngle)
   delay(2);
   writeOneByte(_mpos_lo, lowByte(_rawEndAngle));
   delay(2);
-  _mPosition = readTwoBytes(_mpos_hi, _mpos_lo);
+  _mPosition = readTwoBytes(_mpos_hi);
 
   return (_mPosition);
 }
@@ -190,7 +199,7 @@ word AMS_5600::setEndPosition(word endAngle)
 *******************************************************/
 word AMS_5600::getEndPosition()
 {
-  word retVal = readTwoBytes(_mpos_hi, _mpos_lo);
+  word retVal = readTwoBytes(_mpos_hi);
   return retVal;
 }
 
@@ -203,7 +212,7 @@ word AMS_5600::getEndPosition()
 *******************************************************/
 word AMS_5600::getRawAngle()
 {
-  return readTwoBytes(_raw_ang_hi, _raw_ang_lo);
+  return readTwoBytes(_raw_ang_hi);
 }
 
 /*******************************************************
@@ -216,7 +225,7 @@ word AMS_5600::getRawAngle()
 *******************************************************/
 word AMS_5600::getScaledAngle()
 {
-  return readTwoBytes(_ang_hi, _ang_lo);
+  return readTwoBytes(_ang_hi);
 }
 
 /*******************************************************
@@ -291,7 +300,29 @@ int AMS_5600::getAgc()
 *******************************************************/
 word AMS_5600::getMagnitude()
 {
-  return readTwoBytes(_mag_hi, _mag_lo);
+  return readTwoBytes(_mag_hi);
+}
+
+/*******************************************************
+  Method: readData
+  In: structure for the values
+  Out: true if the values are read
+  Description: reads status, raw angle, AGC and magnitude
+  with two burst reads (0x0B...0x0D and 0x1A...0x1C).
+  The values are not changed on a bus error.
+*******************************************************/
+bool AMS_5600::readData(as5600Data &data)
+{
+  uint8_t angle[3];
+  uint8_t field[3];
+  if (!i2cBus.read(_ams5600_Address, _stat, angle, 3) || !i2cBus.read(_ams5600_Address, _agc, field, 3))
+    return false;
+
+  data.status = angle[0];
+  data.rawAngle = word((angle[1] & 0x0f) << 8 | angle[2]);
+  data.agc = field[0];
+  data.magnitude = word((field[1] & 0x0f) << 8 | field[2]);
+  return true;
 }
 
 /*******************************************************
@@ -371,57 +402,33 @@ int AMS_5600::burnMaxAngleAndConfig()
 /*******************************************************
   Method: readOneByte
   In: register to read
-  Out: data read from i2c
+  Out: data read from i2c, -1 on bus error
   Description: reads one byte register from i2c
 *******************************************************/
 int AMS_5600::readOneByte(int in_adr)
 {
-  int retVal = -1;
-  Wire.beginTransmission(_ams5600_Address);
-  Wire.write(in_adr);
-  Wire.endTransmission();
-  Wire.requestFrom(_ams5600_Address, 1);
-  while (Wire.available() == 0)
-    ;
-  retVal = Wire.read();
+  uint8_t data;
+  if (!i2cBus.read(_ams5600_Address, in_adr, &data, 1))
+    return -1;
 
-  return retVal;
+  return data;
 }
 
 /*******************************************************
   Method: readTwoBytes
-  In: two registers to read
-  Out: data read from i2c as a word
-  Description: reads two bytes register from i2c
+  In: register of the high byte
+  Out: data read from i2c as a word, 0xffff on bus error
+  Description: reads two bytes register from i2c with
+  one burst read, the low byte register follows the
+  high byte register
 *******************************************************/
-word AMS_5600::readTwoBytes(int in_adr_hi, int in_adr_lo)
+word AMS_5600::readTwoBytes(int in_adr_hi)
 {
-  word retVal = -1;
-
-  /* Read Low Byte */
-  Wire.beginTransmission(_ams5600_Address);
-  Wire.write(in_adr_lo);
-  Wire.endTransmission();
-  Wire.requestFrom(_ams5600_Address, 1);
-  while (Wire.available() == 0)
-    ;
-  int low = Wire.read();
-
-  /* Read High Byte */
-  Wire.beginTransmission(_ams5600_Address);
-  Wire.write(in_adr_hi);
-  Wire.endTransmission();
-  Wire.requestFrom(_ams5600_Address, 1);
+  uint8_t data[2];
+  if (!i2cBus.read(_ams5600_Address, in_adr_hi, data, 2))
+    return 0xffff;
 
-  while (Wire.available() == 0)
-    ;
-
-  word high = Wire.read();
-
-  high = high << 8;
-  retVal = high | low;
-
-  return retVal;
+  return word(data[0] << 8 | data[1]);
 }
 
 /*******************************************************
@@ -432,10 +439,7 @@ word AMS_5600::readTwoBytes(int in_adr_hi, int in_adr_lo)
 *******************************************************/
 void AMS_5600::writeOneByte(int adr_in, int dat_in)
 {
-  Wire.beginTransmission(_ams5600_Address);
-  Wire.write(adr_in);
-  Wire.write(dat_in);
-  Wire.endTransmission();
+  i2cBus.write(_ams5600_Address, adr_in, dat_in);
 }
 
 /**********  END OF AMS 5600 CALSS *****************/
@@ -16,19 +16,27 @@
 
 #include <Arduino.h>
 
+/* Measuring values of one readData() */
+typedef struct {
+  word rawAngle;   /* raw angle 0...4095 */
+  word magnitude;  /* magnitude of the magnet field */
+  uint8_t status;  /* 0 0 MD ML MH 0 0 0 */
+  uint8_t agc;     /* automatic gain control */
+} as5600Data;
+
 class AMS_5600
 {
 public:
   AMS_5600(void);
   int getAddress();
 
-  word setMaxAngle(word newMaxAngle = -1);
+  word setMaxAngle(word newMaxAngle = 0xffff);
   word getMaxAngle();
 
-  word setStartPosition(word startAngle = -1);
+  word setStartPosition(word startAngle = 0xffff);
   word getStartPosition();
 
-  word setEndPosition(word endAngle = -1);
+  word setEndPosition(word endAngle = 0xffff);
   word getEndPosition();
 
   word getRawAngle();
@@ -38,6 +46,7 @@ public:
   int getMagnetStrength();
   int getAgc();
   word getMagnitude();
+  bool readData(as5600Data &data);
 
   int getBurnCount();
   int burnAngle();
@@ -74,7 +83,7 @@ private:
   int _burn;
 
   int readOneByte(int in_adr);
-  word readTwoBytes(int in_adr_hi, int in_adr_lo);
+  word readTwoBytes(int in_adr_hi);
   void writeOneByte(int adr_in, int dat_in);
 };
 #endif
\ No newline at end of file
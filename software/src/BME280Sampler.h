@@ -0,0 +1,177 @@
+#ifndef BME280Sampler_h
+#define BME280Sampler_h
+
+// Environment sensor BME280 in forced mode with its own measuring period
+// The measurement is started on one calculation cycle and collected on a later one with a single burst read
+// of the 8 data registers 0xF7...0xFE. The values are compensated with the calibration data of the library
+// and cached for the wind calculation, between the measurements no I2C transfer takes place.
+// The library reads used before (temperature, pressure, humidity, altitude) cost 4 conversions and
+// 7 transfers on every cycle, the I2C time saved against them is counted for /metrics.
+
+#define BME280_REGISTER_CTRL_MEAS 0xF4      // Oversampling temperature, pressure and mode
+#define BME280_REGISTER_DATA 0xF7           // First data register (press_msb)
+#define BME280_DATA_LENGTH 8                // press[3], temp[3], hum[2]
+
+class BME280Sampler : public Adafruit_BME280
+{
+public:
+  // period in [s] (1...10), oversampling 1, 2, 4, 8 or 16 for all three values
+  void configure(uint8_t address, int period, int oversampling)
+  {
+    _address = address;
+    _period = (unsigned long)constrain(period, 1, 10) * 1000;
+    _oversampling = uint8_t(constrain(oversampling, 1, 16));
+    sensor_sampling sampling = samplingOf(_oversampling);
+    setSampling(MODE_FORCED, sampling, sampling, sampling, FILTER_OFF);
+    // ctrl_meas with forced mode starts one measurement, afterwards the sensor sleeps
+    _ctrlMeas = uint8_t((sampling << 5) | (sampling << 2) | MODE_FORCED);
+    _measuring = false;
+    _start = millis() - _period;            // First measurement with the next cycle
+  }
+
+  // Called by each calculation cycle, returns true if new values are read
+  bool handle()
+  {
+    _cycles++;
+    unsigned long now = millis();
+    if (!_measuring)
+    {
+      if (now - _start < _period)
+      {
+        return false;
+      }
+      bool ok = i2cBus.write(_address, BME280_REGISTER_CTRL_MEAS, _ctrlMeas);
+      _busTime += i2cBus.lastTime();
+      _start = now;
+      if (!ok)
+      {
+        error();
+        return false;
+      }
+      _measuring = true;
+      return false;
+    }
+    if (now - _start < measuringTime())
+    {
+      return false;
+    }
+    _measuring = false;
+    return read();
+  }
+
+  float temperature() const { return _temperature; }          // [°C]
+  float pressure() const { return _pressure; }                // [hPa]
+  float humidity() const { return _humidity; }                // [%]
+  float altitude(float seaLevel) const                        // [m], barometric formula as in the library
+  {
+    return 44330.0 * (1.0 - pow(_pressure / seaLevel, 0.1903));
+  }
+
+  // Run time of the library reads used before on each cycle in [us], measured once at start
+  void legacyTime(uint32_t us) { _legacyTime = us; }
+  uint32_t legacyTime() const { return _legacyTime; }
+
+  uint32_t readings() const { return _readings; }             // Measurements since start
+  uint32_t errors() const { return _errors; }                 // Failed transfers
+  uint64_t busTime() const { return _busTime; }               // I2C time of trigger and burst reads in [us]
+  uint64_t freedTime() const                                  // I2C time saved against the library reads in [us]
+  {
+    uint64_t legacy = uint64_t(_legacyTime) * _cycles;
+    return legacy > _busTime ? legacy - _busTime : 0;
+  }
+
+private:
+  static sensor_sampling samplingOf(uint8_t oversampling)
+  {
+    switch (oversampling)
+    {
+    case 1: return SAMPLING_X1;
+    case 2: return SAMPLING_X2;
+    case 4: return SAMPLING_X4;
+    case 8: return SAMPLING_X8;
+    default: return SAMPLING_X16;
+    }
+  }
+
+  // Max measuring time in [ms] (datasheet 9.1) rounded up
+  unsigned long measuringTime() const
+  {
+    return (1250 + 2300 * 3 * _oversampling + 2 * 575) / 1000 + 1;
+  }
+
+  void error()
+  {
+    _errors++;                              // Counted for the bus by i2cBus
+  }
+
+  // Burst read of all data registers and compensation (datasheet 4.2.3, integer formulas)
+  bool read()
+  {
+    uint8_t data[BME280_DATA_LENGTH];
+    bool ok = i2cBus.read(_address, BME280_REGISTER_DATA, data, BME280_DATA_LENGTH);
+    _busTime += i2cBus.lastTime();
+    if (!ok)
+    {
+      error();
+      return false;
+    }
+    int32_t adcP = (int32_t(data[0]) << 12) | (int32_t(data[1]) << 4) | (data[2] >> 4);
+    int32_t adcT = (int32_t(data[3]) << 12) | (int32_t(data[4]) << 4) | (data[5] >> 4);
+    int32_t adcH = (int32_t(data[6]) << 8) | data[7];
+    if (adcT == 0x80000)
+    {
+      error();                              // Measurement not finished
+      return false;
+    }
+    const bme280_calib_data &c = _bme280_calib;
+
+    int32_t var1 = ((((adcT >> 3) - (int32_t(c.dig_T1) << 1))) * int32_t(c.dig_T2)) >> 11;
+    int32_t var2 = (((((adcT >> 4) - int32_t(c.dig_T1)) * ((adcT >> 4) - int32_t(c.dig_T1))) >> 12) * int32_t(c.dig_T3)) >> 14;
+    int32_t fine = var1 + var2;
+    _temperature = ((fine * 5 + 128) >> 8) / 100.0;
+
+    int64_t p1 = int64_t(fine) - 128000;
+    int64_t p2 = p1 * p1 * int64_t(c.dig_P6);
+    p2 = p2 + ((p1 * int64_t(c.dig_P5)) << 17);
+    p2 = p2 + (int64_t(c.dig_P4) << 35);
+    p1 = ((p1 * p1 * int64_t(c.dig_P3)) >> 8) + ((p1 * int64_t(c.dig_P2)) << 12);
+    p1 = ((int64_t(1) << 47) + p1) * int64_t(c.dig_P1) >> 33;
+    if (p1 != 0)
+    {
+      int64_t p = 1048576 - adcP;
+      p = (((p << 31) - p2) * 3125) / p1;
+      int64_t p3 = (int64_t(c.dig_P9) * (p >> 13) * (p >> 13)) >> 25;
+      int64_t p4 = (int64_t(c.dig_P8) * p) >> 19;
+      p = ((p + p3 + p4) >> 8) + (int64_t(c.dig_P7) << 4);
+      _pressure = p / 256.0 / 100;
+    }
+
+    int32_t h = fine - 76800;
+    h = (((((adcH << 14) - (int32_t(c.dig_H4) << 20) - (int32_t(c.dig_H5) * h)) + 16384) >> 15) *
+         (((((((h * int32_t(c.dig_H6)) >> 10) * (((h * int32_t(c.dig_H3)) >> 11) + 32768)) >> 10) + 2097152) *
+           int32_t(c.dig_H2) + 8192) >> 14));
+    h = h - (((((h >> 15) * (h >> 15)) >> 7) * int32_t(c.dig_H1)) >> 4);
+    h = constrain(h, 0, 419430400);
+    _humidity = (h >> 12) / 1024.0;
+
+    _readings++;
+    return true;
+  }
+
+  uint8_t _address = 0x76;
+  unsigned long _period = 5000;             // Measuring period in [ms]
+  uint8_t _oversampling = 1;
+  uint8_t _ctrlMeas = 0;
+  bool _measuring = false;
+  unsigned long _start = 0;
+  float _temperature = 0;
+  float _pressure = 0;
+  float _humidity = 0;
+  uint32_t _readings = 0;
+  uint32_t _errors = 0;
+  uint32_t _cycles = 0;                     // Calculation cycles with BME280
+  uint32_t _legacyTime = 0;
+  uint64_t _busTime = 0;
+};
+
+#endif
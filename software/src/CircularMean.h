@@ -0,0 +1,76 @@
+#ifndef CircularMean_h
+#define CircularMean_h
+
+// Mean of angles on the unit circle
+// Each angle is added as vector (sin, cos) with length 1 or the weight, the mean direction is the direction
+// of the vector sum. A linear mean of 350° and 10° is 180°, the circular mean is 0°.
+
+class CircularMean
+{
+public:
+  void add(float degrees, float weight = 1)
+  {
+    float rad = degrees * DEG_TO_RAD;
+    addVector(weight * sinf(rad), weight * cosf(rad), weight);
+  }
+
+  // Vector of an angle, for callers that calculate sin and cos outside a critical section
+  void addVector(float sine, float cosine, float weight = 1)
+  {
+    _sin += sine;
+    _cos += cosine;
+    _weight += weight;
+    _count++;
+  }
+
+  // Add all angles of another mean
+  void add(const CircularMean &other)
+  {
+    _sin += other._sin;
+    _cos += other._cos;
+    _weight += other._weight;
+    _count += other._count;
+  }
+
+  void clear()
+  {
+    _sin = 0;
+    _cos = 0;
+    _weight = 0;
+    _count = 0;
+  }
+
+  uint32_t count() const { return _count; }
+
+  // Mean direction 0...360° (0° without values)
+  float direction() const
+  {
+    float mean = atan2f(_sin, _cos) * RAD_TO_DEG;
+    return mean < 0 ? mean + 360 : mean;
+  }
+
+  // Mean resultant length 0...1, 1 = all angles equal, 0 = no preferred direction
+  float length() const
+  {
+    return _weight > 0 ? sqrtf(_sin * _sin + _cos * _cos) / _weight : 0;
+  }
+
+  // Circular standard deviation in [°]
+  float deviation() const
+  {
+    float r = length();
+    if (r <= 0)
+    {
+      return 180;
+    }
+    return r < 1 ? sqrtf(-2 * logf(r)) * RAD_TO_DEG : 0;
+  }
+
+private:
+  float _sin = 0;
+  float _cos = 0;
+  float _weight = 0;                        // Sum of the weights
+  uint32_t _count = 0;
+};
+
+#endif
@@ -15,7 +15,7 @@ enum WindSensorType {
 };
 
 typedef struct {
-  int valid = 11;                           // Number of configuration (Please change when the structure or values are changed)
+  int valid = 20;                           // Number of configuration (Please change when the structure or values are changed)
   int crypt = 0;                            // Activate for critical webside a password query [0 = off|1 = on]
   char password[31] = "12345678";           // Password for critical websides (settings, update and reboot)
   char devname[21] = "Windsensor";          // Device name for web configuration
@@ -34,6 +34,15 @@ typedef struct {
   char hostname [31] = "windsensor";        // Hostname WiFi Server
   int dataport = 6666;                      // Port for NMEA data output
   int httpport = 80;                        // Port for HTTP and update pages
+  int wsport = 81;                          // Port for WebSocket live data
+  int udpMode = 0;                          // NMEA UDP output [0|1|2] 0=off, 1=broadcast, 2=multicast or unicast
+  char udpAddress[16] = "255.255.255.255";  // Destination address for NMEA UDP output
+  int udpPort = 10110;                      // Destination port for NMEA UDP output
+  char mqttHost[41] = "";                   // MQTT broker host name or IP address (Server Mode 2)
+  int mqttPort = 1883;                      // MQTT broker port
+  char mqttTopic[31] = "windsensor";        // MQTT topic prefix
+  int mqttFormat = 0;                       // MQTT message format [0|1] 0=one JSON message, 1=one message per value
+  int mqttRetain = 0;                       // MQTT retain flag for measuring values [0|1] 0=off, 1=on
   int serverMode = 0;                       // Used server mode [0|1|2|3|4] 0=HTTP (JSON, NMEA), 1=NMEA Serial, 2=MQTT, 3=Diagnostic, 4=Demo (Simulation data)
   int serspeed = 115200;                    // Serial speed in [Bd] 8N1 [300|1200|2400|4800|9600|19200|38400|57600|74880|115200]
   int skin = 0;                             // Skin for websides [0|1|2]
@@ -45,9 +54,13 @@ typedef struct {
   #endif
   WindSensorType windSensorType = SENSOR_TYPE;  // Type of wind sensor
   int windSensor = 1;                       // Send wind data 0=off 1=on (WIMWV, WIVWR, WIVPW, PWINF) or Serial or JSON
+  int gustData = 0;                         // Send gust data with the wind data 0=off 1=on (PWGST)
   char windType[2] = "R";                   // Type of wind R=relative, T=true
   int offset = 0;                           // Offset of wind direction [-180°...+180°]
+  int vaneRate = 100;                       // Sampling rate of magnetic wind vanes in [Hz] [0|50|100|200], 0 = one angle per 500ms
   int average = 1;                          // Number of values for average building [1...10], for high speed use 1, default use 2
+                                            // Magnetic wind vanes with vane sampler: number of 500ms cycles of the mean
+  int dirWeighting = 0;                     // Direction average WiFi 1000: 0=each rotation equal 1=weighted with rotation speed
   char speedUnit[5] = "kn";                 // Unit of speed [m/s|km/h|kn|bft] for WIMWV
   int downWindSensor = 1;                   // Send data to down wind 0=off 1=on (WIVPW)
   int downWindRange = 50;                   // Down wind area = 180° +/- downWindRange
@@ -56,6 +69,10 @@ typedef struct {
   char tempSensorType[10] = "DS18B20";      // Type of temperature sensor [Off|DS18B20|BME280]
   int tempSensor = 1;                       // Send data for temp 0=off 1=on (PWWST)
   char tempUnit[2] = "C";                   // Unit of temperature [C|F]
+  int tempResolution = 12;                  // Resolution of DS18B20 in [bit] [9|10|11|12], conversion time 94...750ms
+  int bmePeriod = 5;                        // Measuring period of BME280 in [s] [1|2|5|10]
+  int bmeOversampling = 1;                  // Oversampling of BME280 for temperature, pressure and humidity [1|2|4|8|16]
+  int historySize = 1024;                   // History ring in LittleFS in [kB] [0|256|512|1024|2048], 0 = off, about 40 h per MB
 } configData;
 
 #endif
@@ -0,0 +1,99 @@
+#ifndef DS18B20Sampler_h
+#define DS18B20Sampler_h
+
+// Non-blocking temperature measurement with the DS18B20
+// The conversion is started on one calculation cycle and collected on a later one, the wind calculation
+// never waits for the 1Wire bus. The temperature is measured every DS18B20_PERIOD, between the
+// measurements the last value is used.
+// The ROM address is searched once (and again while no sensor is found), the value is read with the address.
+
+#define DS18B20_PERIOD 5000                 // Period of the temperature measurement in [ms]
+
+class DS18B20Sampler
+{
+public:
+  // resolution 9...12 bit (conversion time 94...750ms)
+  void begin(DallasTemperature *sensor, int resolution)
+  {
+    _sensor = sensor;
+    _resolution = uint8_t(constrain(resolution, 9, 12));
+    _converting = false;
+    _found = false;
+    _start = millis() - DS18B20_PERIOD;     // First conversion with the next cycle
+    if (_sensor == nullptr)
+    {
+      return;
+    }
+    _sensor->begin();
+    _sensor->setWaitForConversion(false);
+    search();
+  }
+
+  // Called by each calculation cycle, returns true if a new value is read
+  bool handle()
+  {
+    if (_sensor == nullptr)
+    {
+      return false;
+    }
+    unsigned long now = millis();
+    if (!_converting)
+    {
+      if (now - _start < DS18B20_PERIOD)
+      {
+        return false;
+      }
+      if (!_found && !search())
+      {
+        _celsius = DEVICE_DISCONNECTED_C;
+        _start = now;
+        return false;
+      }
+      _sensor->requestTemperaturesByAddress(_address);   // Start conversion, returns immediately
+      _start = now;
+      _converting = true;
+      return false;
+    }
+    if (now - _start < (unsigned long)_sensor->millisToWaitForConversion(_resolution))
+    {
+      return false;
+    }
+    _converting = false;
+    _celsius = _sensor->getTempC(_address);
+    if (_celsius == DEVICE_DISCONNECTED_C)
+    {
+      _found = false;                       // Search again with the next measurement
+      _errors++;
+    }
+    _readings++;
+    return true;
+  }
+
+  float celsius() const { return _celsius; }                  // Last value, DEVICE_DISCONNECTED_C without sensor
+  uint8_t resolution() const { return _resolution; }
+  uint32_t readings() const { return _readings; }             // Measurements since start
+  uint32_t errors() const { return _errors; }                 // Measurements without valid value
+
+private:
+  bool search()
+  {
+    _found = _sensor->getAddress(_address, 0);
+    if (_found)
+    {
+      _sensor->setResolution(_address, _resolution);
+    }
+    return _found;
+  }
+
+  DallasTemperature *_sensor = nullptr;
+  DeviceAddress _address;
+  uint8_t _resolution = 12;
+  bool _found = false;
+  bool _converting = false;
+  unsigned long _start = 0;
+  float _celsius = DEVICE_DISCONNECTED_C;
+  uint32_t _readings = 0;
+  uint32_t _errors = 0;
+};
+
+#endif
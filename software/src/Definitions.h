@@ -20,6 +20,11 @@ volatile bool flag1 = false;      // Flag for data sending (normal speed)
 volatile bool flag2 = false;      // Flag for data sending (reduced speed)
 volatile bool flag3 = false;      // Flag for zero wind speed detection (true = zero)
 
+// Sensor settings changed by the settings page, applied by the calculation task (see applySettings())
+volatile bool reconfigDS18B20 = false;  // New DS18B20 resolution
+volatile bool reconfigBME280 = false;   // New BME280 period or oversampling
+volatile bool reconfigVane = false;     // New vane sampling rate
+
 // Pin definitions WiFi 1000 wind sensor (default)
 int ledPin = 2;                   // LED low activ GPIO 2 (D4)
 int INT_PIN1 = 5;                 // Wind speed GPIO 5 (Hall sensor) (D1)
@@ -38,7 +43,7 @@ byte i2cAddressBME280 = 0x76;     // I2C address BME280
 #define SEALEVELPRESSURE_HPA (1013.25)// Sea level air pressure
 
 
-// Measuring data (used in interrupt)
+// Measuring data (used in pulse processing)
 volatile int marker1 = 0;         // Wind speed
 volatile int marker2 = 0;         // Wind direction
 volatile int marker3 = 0;         // Marker for data saving in a array (sensor 1 and 2 binary switching data)
@@ -47,8 +52,11 @@ volatile int rpcounter = 0;       // Raw pulse counter for wind direction sensor
 volatile int pcounter = 0;        // Pulse counter for wind direction sensor (per revolution)
 volatile unsigned long icounter = 0;    // Interrupt counter for rotation detection
 volatile unsigned long icounterold = 0; // Old interrupt counter for rotation detektion
-volatile unsigned long counter1;  // Wind spped
-volatile unsigned long counter2;  // Wind direction
+volatile uint32_t time1start;     // Edge timestamp in [us] of wind speed sensor (start of rotation), 32 bit like micros()
+volatile uint32_t time1stop;      // Edge timestamp in [us] of wind speed sensor (end of rotation)
+volatile uint32_t time2stop;      // Edge timestamp in [us] of wind direction sensor
+uint32_t lastSpeedEdge = 0;       // Last edge timestamp in [us] of wind speed sensor (pulse period for gusts)
+bool speedEdgeSeen = false;       // First edge of wind speed sensor processed
 volatile float time1;             // Wind speed (time in [ms] for one rotation)
 volatile float time2;             // Wind direction (time in [ms] between wind speed sensor and wind direction sensor)
 volatile int average;             // Number of values for average calculation [1...10]
@@ -57,6 +65,9 @@ volatile float timearray2[10];    // Array2 of time values (average building)
 volatile int mc = 0;              // Modulo counter
 volatile float time1_avg;         // Average wind speed (time in [ms] for one rotation)
 volatile float time2_avg;         // Average direction (time in [ms] between wind speed sensor and wind direction sensor)
+volatile float winddir_avg;       // Average direction 0...360[°] of the last rotations, circular mean (WiFi 1000)
+volatile float winddir_dev;       // Circular standard deviation of the last rotations in [°] (WiFi 1000)
+PulseRing<64> pulseRing;          // Edge timestamps from the interrupt routines (64 events, 50ms polling)
 
 static float radius = 0.06;       // Radius between center and middle of half hemisphere position (WiFi 1000)
 static float radius2 = 0.043;     // Radius between center and middle of half hemisphere position (Yachta|Jukolein)
@@ -64,33 +75,12 @@ static float radius3 = 0.055;     // Radius between center and middle of half he
 static float lamda = 0.3;         // Lambda is a constant for amemometer type with 3 hemisphere, lamda = 0,3
 static constexpr float pi = 3.14159265358979;   // Pi constant
 
-volatile float fieldstrength;     // WLAN field strength
-volatile float quality;           // WLAN quality
-volatile float temperature;       // Windsensor temperature 1Wire (DS18B20)
-volatile float windspeed;         // Selected windspeed for Web interface
-volatile float windspeed_hz;      // Wind speed in [Hz], [rps]
-volatile float windspeed_mps;     // Wind speed in [m/s]
-volatile float windspeed_kn;      // Wind speed in [kn]
-volatile float windspeed_kph;     // Wind speed in [km/h]
-volatile int windspeed_bft;       // Wind speed in [bft]
-volatile float dwspeed;           // Down wind speed for Web interface
-volatile float downwindspeed_kn;  // Down wind speed in [kn]
-volatile float downwindspeed_mps; // Down wind speed in [m/s]
-volatile float rawwinddirection;  // Wind direction 0...360[°] in relation to midle of ship line (midle = 0°) without offset
-volatile float winddirection;     // Wind direction 0...360[°] in relation to midle of ship line (midle = 0°) with offset
-volatile float winddirection2;    // Wind direction 0...180[°] in relation to midle of ship line (midle = 0°) for each boat side with offet
+SeqLock<WindSnapshot> windData;   // Measuring values of the last calculation cycle (see WindSnapshot.h)
+nmeaFrame nmeaframe;              // NMEA sentences of the last calculation cycle (only used in loop)
 volatile float winddirection_old; // Last wind direction 0...360[°] in relation to midle of ship line (midle = 0°) with offset
 static constexpr float maxwinddirdev = 45;  // Maximum of wind direction deviation in [°] between two measuring values  
-volatile float dirresolution;     // Resolution of wind direction [°]
 volatile int sensor1;             // Output hallsensor signal for wind speed (Web interface)
 volatile int sensor2;             // Output hallsensor signal for wind direction (Web interface)
-volatile float magsensor;         // Output magnetic sensor (AS5600) for wind direction 0...360° without offset
-volatile float magnitude;         // Magetic flux density of magnetic sensor in [mT] (AS5600)
-volatile float airtemperature;    // Air temperature in [°C] (BME280)
-volatile float airpressure;       // Air pressure in [mbar] (BME280)
-volatile float airhumidity;       // Air humidity in [%] (BME280)
-volatile float dewpoint;          // Dewpoint in [%] calculated with air humidity and airtemperature
-volatile float altitude;          // Altitude in [m] calculated with air pressure (BME280)
 
 volatile bool sensor1TimeArray[1000]; // Time array for Hall sensor 1 (Debug Mode)
 volatile bool sensor2TimeArray[1000]; // Time array for Hall sensor 2 (Debug Mode)
@@ -117,7 +107,10 @@ String serspeed[10] = {"300", "1200", "2400", "4800", "9600", "19200", "38400",
 String sensorid[10] = {"0", "1", "2", "3", "4", "5", "6", "7", "8", "9"};
 String wstype[6] = {"WiFi 1000", "Yachta", "Yachta 2.0", "Jukolein", "Ventus", "Sednav c6"};
 String sendwsdata[2] = {"0", "1"};
+String sendgustdata[2] = {"0", "1"};
 String windtype[2] = {"R", "T"};
+String vanerate[4] = {"0", "50", "100", "200"};
+String dirweighting[2] = {"0", "1"};
 String averages[10] = {"1", "2", "3", "4", "5", "6", "7", "8", "9", "10"};
 String speedunits[4] = {"m/s", "km/h", "kn", "bft"};
 String dwsensor[2] = {"0", "1"};
@@ -125,9 +118,17 @@ String dwrange[9] = {"20", "25", "30", "35", "40", "45", "50", "55", "60"};
 String tstype[3] = {"Off", "DS18B20", "BME280"};
 String sendtsd[2] = {"0", "1"};
 String tempunits[2] = {"C", "F"};
+String tempresolution[4] = {"9", "10", "11", "12"};
+String bmeperiod[4] = {"1", "2", "5", "10"};
+String bmeoversampling[5] = {"1", "2", "4", "8", "16"};
+String historysize[5] = {"0", "256", "512", "1024", "2048"};
 String mdnsservice[2] = {"0", "1"};
+String udpmode[3] = {"0", "1", "2"};
+String mqttformat[2] = {"0", "1"};
+String mqttretain[2] = {"0", "1"};
 
 #ifdef ESP32
+    hw_timer_t *timer = NULL;     // Hardware timer for Hall sensor trace sampling (Diagnostic Mode)
     portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
     #define NO_INTERRUPTS portENTER_CRITICAL(&mux)
     #define INTERRUPTS portEXIT_CRITICAL(&mux)
@@ -0,0 +1,183 @@
+#ifndef EventServer_h
+#define EventServer_h
+
+// Server-Sent Events (SSE) for the web pages (/events)
+// The HTTP request is answered by the web server handler with add(), then the connection stays open
+// and the server pushes one event per calculation cycle. Each client holds only the newest event:
+// if the last event is not completely sent, the new one is skipped for this client (no stale queue).
+// A client is disconnected if it takes no data for EVENT_CLIENT_TIMEOUT.
+
+#ifndef EVENT_MAX_CLIENTS
+  #define EVENT_MAX_CLIENTS 4               // Max number of event clients (browser pages)
+#endif
+#define EVENT_SIZE 384                      // Buffer size for one event in [Byte]
+#define EVENT_CLIENT_TIMEOUT 10000          // Timeout in [ms] for a client without progress
+
+// Event client with the actual event
+typedef struct {
+  WiFiClient client;
+  bool active = false;                      // Slot is used
+  char data[EVENT_SIZE];                    // Event (or HTTP header) to send
+  size_t length = 0;                        // Length of data
+  size_t sent = 0;                          // Sent bytes of data
+  unsigned long lastProgress = 0;           // Time in [ms] of the last successful write or connect
+} eventClient;
+
+class EventServer
+{
+public:
+  // Take over the client of the actual HTTP request, returns false if all slots are used
+  bool add(WiFiClient client)
+  {
+    for (int i = 0; i < EVENT_MAX_CLIENTS; i++)
+    {
+      eventClient &c = _clients[i];
+      if (!c.active)
+      {
+        c.client = client;
+        c.client.setNoDelay(true);
+        c.active = true;
+        // The response header is sent like an event, the browser reconnects after 2s if the connection is lost
+        c.length = snprintf(c.data, EVENT_SIZE,
+                            "HTTP/1.1 200 OK\r\n"
+                            "Content-Type: text/event-stream\r\n"
+                            "Cache-Control: no-cache\r\n"
+                            "Connection: keep-alive\r\n"
+                            "Access-Control-Allow-Origin: *\r\n"
+                            "\r\n"
+                            "retry: 2000\n\n");
+        c.sent = 0;
+        c.lastProgress = millis();
+        DebugPrint(3, "Event client connected: ");
+        DebugPrint(3, c.client.remoteIP());
+        DebugPrint(3, " Slot: ");
+        DebugPrintln(3, i);
+        flush(c);
+        return true;
+      }
+    }
+    _rejects++;
+    DebugPrintln(2, "Event client rejected, all slots used");
+    return false;
+  }
+
+  // Send waiting data and remove dead clients (call in loop)
+  void handle()
+  {
+    for (int i = 0; i < EVENT_MAX_CLIENTS; i++)
+    {
+      if (_clients[i].active)
+      {
+        flush(_clients[i]);
+      }
+    }
+  }
+
+  // A new event is needed for the epoch
+  bool due(uint32_t epoch) const
+  {
+    return epoch != _epoch && clients() > 0;
+  }
+
+  // Send data (JSON without line breaks) as event of the epoch to all clients
+  void send(uint32_t epoch, const char *data, size_t length)
+  {
+    _epoch = epoch;
+    if (length == 0)
+    {
+      return;
+    }
+    for (int i = 0; i < EVENT_MAX_CLIENTS; i++)
+    {
+      eventClient &c = _clients[i];
+      if (!c.active)
+      {
+        continue;
+      }
+      if (c.sent < c.length || length + 8 > EVENT_SIZE)
+      {
+        _skips++;                           // Last event still on the way, newest wins next time
+        continue;
+      }
+      memcpy(c.data, "data: ", 6);
+      memcpy(c.data + 6, data, length);
+      memcpy(c.data + 6 + length, "\n\n", 2);
+      c.length = length + 8;
+      c.sent = 0;
+      c.lastProgress = millis();
+      _events++;
+    }
+    handle();
+  }
+
+  // Number of connected clients
+  int clients() const
+  {
+    int n = 0;
+    for (int i = 0; i < EVENT_MAX_CLIENTS; i++)
+    {
+      if (_clients[i].active)
+      {
+        n++;
+      }
+    }
+    return n;
+  }
+
+  uint32_t events() const { return _events; }               // Events put to clients since start
+  uint32_t skips() const { return _skips; }                 // Events skipped for slow clients
+  uint32_t rejects() const { return _rejects; }             // Clients rejected because all slots are used
+
+private:
+  // Write as much as possible without blocking
+  void flush(eventClient &c)
+  {
+    if (!c.client.connected())
+    {
+      remove(c, "closed");
+      return;
+    }
+    // Received data are not used, discard it
+    while (c.client.available() > 0)
+    {
+      c.client.read();
+    }
+    while (c.sent < c.length)
+    {
+      int written = writeNonBlocking(c.client, (const uint8_t*)c.data + c.sent, c.length - c.sent);
+      if (written < 0)
+      {
+        remove(c, "error");
+        return;
+      }
+      if (written == 0)
+      {
+        break;                              // Send buffer full, try again in next loop
+      }
+      c.sent += written;
+      c.lastProgress = millis();
+    }
+    if (c.sent < c.length && millis() - c.lastProgress > EVENT_CLIENT_TIMEOUT)
+    {
+      remove(c, "timeout");
+    }
+  }
+
+  void remove(eventClient &c, const char *reason)
+  {
+    DebugPrint(3, "Event client disconnected: ");
+    DebugPrintln(3, reason);
+    c.client.stop();
+    c.active = false;
+    c.length = 0;
+    c.sent = 0;
+  }
+
+  eventClient _clients[EVENT_MAX_CLIENTS];
+  uint32_t _epoch = 0;                      // Epoch of the last event
+  uint32_t _events = 0;
+  uint32_t _skips = 0;
+  uint32_t _rejects = 0;
+};
+
+#endif
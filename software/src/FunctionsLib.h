@@ -16,68 +16,82 @@ void DebugPrint(int type, const T& value) {
   }
 }
 
-// Interrupt routine for wind speed and Hall sensor data array saving
+// Interrupt routine for wind speed
+// Only the edge timestamp is saved, the rotation time is calculated in processPulses()
 void IRAM_ATTR interruptRoutine1() {
-  NO_INTERRUPTS_ISR;
+  PROFILE(PROBE_ISR_SPEED);
+  metrics.pulseSpeed();
   // Run if not Demo mode
   if (actconf.serverMode != 4){
-    if(marker1 == 0){
-      time1 = float(counter1) / 10;     // Time1 in ms for speed
-      time2 = float(counter2) / 10;     // Time2 in ms for direction
-      if(time1 > 1000){                 // Limiting time1 for correct average building
-        time1 = 1000;
-      }
-      if(time2 > 1000){                 // Limiting time2 for correct average building
-        time2 = 1000;
-      }
-      mc = icounter % average;          // Modulo counter for average building, average see Definition.h
-      timearray1[mc] = time1;
-      if(time2 <= (time1 / 2)){         // Overflow exception from 0° to 360° and backwarts
-        timearray2[mc] = time2;         // build positiv values in range 0°...180°
-      }
-      else{
-        timearray2[mc] = time2 - time1; // build negativ values in range >180°...360°
-      }
-      counter1 = 0;
-      counter2 = 0;
-      marker1 = 1;
-      marker2 = 1;
-      
-      icounter += 1;
-      
-      marker3 = 1;                      // Set marker for Hall sensor saving, marker3 reset in json2_html.h after JSON string sending
-    }
-    else{
-      marker1 = 0;
-      pcounter = rpcounter;             // Write pcounter for JSON
-      rpcounter = 0;                    // Reset raw pulse counter for wind direction sensor
-    }
+    pulseRing.push(PULSE_EDGE_SPEED, micros());
+    marker3 = 1;                        // Set marker for Hall sensor saving, marker3 reset in json2_html.h after JSON string sending
   }
-  INTERRUPTS_ISR;
 }
 
 // Interrupt routine for wind direction
 void IRAM_ATTR interruptRoutine2() {
-  NO_INTERRUPTS_ISR;
+  PROFILE(PROBE_ISR_DIRECTION);
+  metrics.pulseDirection();
   // Run if not Demo mode
   if (actconf.serverMode != 4){
-    marker2 = 0;
-    if(marker1 == 1){
-      rpcounter += 1;                   // Increment raw pulse counter for wind direction sensor
+    pulseRing.push(PULSE_EDGE_DIRECTION, micros());
+  }
+}
+
+// Calculate the rotation times from the saved edge timestamps (called in average building)
+// Differences of the timestamps in [us] are overflow safe
+void processPulses() {
+  pulseEvent event;
+  while(pulseRing.pop(event)){
+    if(event.edge == PULSE_EDGE_SPEED){
+      if(speedEdgeSeen){                // Every pulse period for gust detection, unlimited
+        gust.revolution(event.timestamp, event.timestamp - lastSpeedEdge);
+      }
+      lastSpeedEdge = event.timestamp;
+      speedEdgeSeen = true;
+      if(marker1 == 0){
+        if(marker2 == 1){               // No edge on wind direction sensor during the rotation
+          time2stop = event.timestamp;
+        }
+        time1 = float(time1stop - time1start) / 1000;  // Time1 in ms for speed
+        time2 = float(time2stop - time1start) / 1000;  // Time2 in ms for direction
+        if(time1 > 1000){               // Limiting time1 for correct average building
+          time1 = 1000;
+        }
+        if(time2 > 1000){               // Limiting time2 for correct average building
+          time2 = 1000;
+        }
+        mc = icounter % average;        // Modulo counter for average building, average see Definition.h
+        timearray1[mc] = time1;
+        timearray2[mc] = time2;         // 0...time1, the direction is averaged on the unit circle
+        time1start = event.timestamp;
+        marker1 = 1;
+        marker2 = 1;
+
+        icounter += 1;
+      }
+      else{
+        time1stop = event.timestamp;
+        marker1 = 0;
+        pcounter = rpcounter;           // Write pcounter for JSON
+        rpcounter = 0;                  // Reset raw pulse counter for wind direction sensor
+      }
+    }
+    else{
+      if(marker2 == 1){                 // First edge after start of rotation
+        time2stop = event.timestamp;
+      }
+      marker2 = 0;
+      if(marker1 == 1){
+        rpcounter += 1;                 // Increment raw pulse counter for wind direction sensor
+      }
     }
   }
-  INTERRUPTS_ISR;
 }
 
-// Timer1 hardware interrupt routine for 100us counter
+// Timer1 hardware interrupt routine with 100us for Hall sensor data saving (only Diagnostic Mode)
 void IRAM_ATTR counter(){
   NO_INTERRUPTS_ISR;
-  if(marker1 == 1){
-    counter1 += 1;
-  }
-  if(marker2 == 1){
-    counter2 += 1;
-  }
   // Save Hall sensor data if marker3 == 1 (Rising signal on sensor 1)
   if(marker3 == 1 && scounter < 10000){
     // Save only every 10 values one value
@@ -93,14 +107,142 @@ void IRAM_ATTR counter(){
   INTERRUPTS_ISR;  
 }
 
+// Start or stop the 100us timer for Hall sensor data saving
+// The timer is only needed in Diagnostic Mode (Server Mode 3), otherwise it costs 10000 interrupts per second
+void hallTraceTimer(bool enable){
+  static bool active = false;
+  if(enable == active){
+    return;
+  }
+  #ifdef ESP8266
+    if(enable){
+      timer1_attachInterrupt(counter);              // Start interrupt routine counter
+      timer1_enable(TIM_DIV16, TIM_EDGE, TIM_LOOP); // 80MHz / 16 => 0,2us
+      timer1_write(500);                            // Start timer1 100us @ 0,2us
+    }
+    else{
+      timer1_disable();
+      timer1_detachInterrupt();
+    }
+  #elif defined(ESP32)
+    if(enable){
+      timer = timerBegin(5000000);                  // Timer at 5 MHz, tick = 0.2 µs
+      timerAttachInterrupt(timer, &counter);        // Attach the ISR
+      timerAlarm(timer, 500, true, 0);              // Trigger alarm every 500 ticks, so every 100 µs
+    }
+    else{
+      timerEnd(timer);
+      timer = NULL;
+    }
+  #endif
+  active = enable;
+  DebugPrint(3, "Hall sensor trace timer: ");
+  DebugPrintln(3, enable ? "on" : "off");
+}
+
+// Vane sampler routine, reads the angle of the magnetic wind vane (50...200 Hz)
+// Same rotation direction as in calculationData()
+void sampleVane(){
+  PROFILE(PROBE_VANE);
+  word angle;
+  switch(actconf.windSensorType){
+  case WIND_SENSOR_YACHTA:
+  case WIND_SENSOR_JUKOLEIN:
+  case WIND_SENSOR_SEDNAV_C6:
+  case WIND_SENSOR_VENTUS:
+    angle = ams5600.getRawAngle();
+    if(angle > 4095){
+      vane.error();
+      return;
+    }
+    if(actconf.windSensorType == WIND_SENSOR_VENTUS){
+      vane.add(360 - angle * 0.087);                // Inverse rotation, AS5600 on bottom side
+    }
+    else{
+      vane.add(angle * 0.087);                      // 0...4096 which is 0.087 of a degree
+    }
+    break;
+
+  case WIND_SENSOR_YACHTA_2_0:
+    if(!mt6701.readRawAngle(angle)){
+      vane.error();
+      return;
+    }
+    vane.add(360 - float(angle) * 360 / 16384);     // Inverse rotation, 0...16384 which is 0.0219 of a degree
+    break;
+
+  default:
+    break;
+  }
+}
+
+// Start, change or stop the vane sampler, rate in [Hz], 0 = off (one angle per calculation cycle)
+// Only for magnetic wind vanes found by the I2C scan
+void vaneTimer(int rate){
+  bool magnetic = false;
+  switch(actconf.windSensorType){
+  case WIND_SENSOR_YACHTA:
+  case WIND_SENSOR_JUKOLEIN:
+  case WIND_SENSOR_SEDNAV_C6:
+  case WIND_SENSOR_VENTUS:
+    magnetic = i2creadyAS5600;
+    break;
+  case WIND_SENSOR_YACHTA_2_0:
+    magnetic = i2creadyMT6701;
+    break;
+  default:
+    break;
+  }
+  if(!magnetic){
+    rate = 0;
+  }
+  vane.begin(rate, sampleVane);
+  DebugPrint(3, "Vane sampler [Hz]: ");
+  DebugPrintln(3, rate);
+}
+
+// Start, resize or stop the history ring in LittleFS, max 3/4 of the file system
+void historyBegin(){
+  static bool mounted = false;
+  uint32_t size = uint32_t(max(actconf.historySize, 0)) * 1024;
+  if(!mounted){
+    #ifdef ESP32
+      mounted = LittleFS.begin(true);   // Format at the first start
+    #else
+      mounted = LittleFS.begin();       // Formats at the first start
+    #endif
+  }
+  if(!mounted){
+    DebugPrintln(3, "LittleFS not mounted, no history");
+    return;
+  }
+  #ifdef ESP32
+    uint32_t total = LittleFS.totalBytes();
+  #else
+    FSInfo info;
+    LittleFS.info(info);
+    uint32_t total = info.totalBytes;
+  #endif
+  size = min(size, total / 4 * 3);
+  history.begin(LittleFS, size);
+  DebugPrint(3, "History [kB]: ");
+  DebugPrintln(3, history.size() / 1024);
+  // Minute aggregates of the last 24h from the ring
+  minuteHistory.clear();
+  history.read(history.time() - MINUTE_COUNT * 60, [](const historyRecord &r){
+    minuteHistory.add(r);
+    return true;
+  });
+}
+
 // Timer2 routine for average building
 void buildaverage() {
+  PROFILE(PROBE_BUILDAVERAGE);
   float local_times1[10];
   float local_times2[10];
   int local_average;
   bool average_error = false;
   
-  NO_INTERRUPTS;
   average = actconf.average;
   // Limiting for average
   if(average < 1){
@@ -113,29 +255,48 @@ void buildaverage() {
   }
   local_average = average;
 
+  // Measured time values are only written by processPulses() in this routine
+  processPulses();
+  gust.tick(micros());
+
+  // Demo data are written by the wind data calculation (other task on ESP32)
+  bool demo = (actconf.serverMode == 4);
+  if(demo){
+    NO_INTERRUPTS;
+  }
   for(int i = 0; i < local_average; i++) {
     local_times1[i] = timearray1[i];
     local_times2[i] = timearray2[i];
   }
-  INTERRUPTS;
+  if(demo){
+    INTERRUPTS;
+  }
 
   // Calculate average values
-  float sum1 = 0, sum2 = 0;
+  // The direction of each rotation dir[°] = time2[ms] / time1[ms] * 360 is averaged as vector,
+  // the mean is correct across 0°/360° for any number of values
+  // Speed weighted: vector length = rotation speed 1 / time1, fast rotations count more
+  float sum1 = 0;
+  CircularMean direction;
   for(int i = 0; i < local_average; i++){
     sum1 += local_times1[i];
-    sum2 += local_times2[i];
+    if(local_times1[i] > 0){
+      float weight = actconf.dirWeighting == 1 ? 1000 / local_times1[i] : 1;
+      direction.add(local_times2[i] / local_times1[i] * 360, weight);
+    }
   }
   
   float local_time1_avg =  sum1 / local_average;
-  float local_time2_avg =  sum2 / local_average;
-  // Overflow exception from 0° to 360° and backwarts for time2_avg
-  if(local_time2_avg < 0){                    // If average value from time2 positiv (in range 0°...180°)
-    local_time2_avg += local_time1_avg;
-  }
+  float local_winddir_avg = direction.direction();
+  float local_winddir_dev = direction.count() > 0 ? direction.deviation() : 0;
+  // Average time2 of the mean direction, for the validity checks of the calculation
+  float local_time2_avg = local_winddir_avg / 360 * local_time1_avg;
 
   NO_INTERRUPTS;
   time1_avg = local_time1_avg;
   time2_avg = local_time2_avg;
+  winddir_avg = local_winddir_avg;
+  winddir_dev = local_winddir_dev;
   INTERRUPTS;
 
   if (average_error)
@@ -163,8 +324,29 @@ void sendNMEA2() {
   INTERRUPTS;
 }
 
+// Apply the sensor settings of the settings page at the start of the calculation cycle
+// The web server only sets the flags, the sensors are used by the calculation (own task on ESP32)
+void applySettings(){
+  if(reconfigDS18B20){
+    reconfigDS18B20 = false;
+    ds18b20.begin(DS18B20, actconf.tempResolution);
+  }
+  if(reconfigBME280){
+    reconfigBME280 = false;
+    if(i2creadyBME280){
+      bme.configure(i2cAddressBME280, actconf.bmePeriod, actconf.bmeOversampling);
+    }
+  }
+  if(reconfigVane){
+    reconfigVane = false;
+    vaneTimer(actconf.vaneRate);
+  }
+}
+
 // Timer5 routine for calculation of wind data (all 500ms)
 void winddata(){
+  applySettings();
+  metrics.update();
   // Simulation if Server Mode 4
   if(actconf.serverMode == 4){
     simulationData();
@@ -174,17 +356,6 @@ void winddata(){
   }
 }
 
-// Checksum calculation for NMEA
-char CheckSum(String NMEAData) {
-  char checksum = 0;
-  // Iterate over the string, XOR each byte with the total sum
-  for (unsigned long c = 0; c < NMEAData.length(); c++) {
-    checksum = char(checksum ^ NMEAData.charAt(c));
-  } 
-  // Return the result
-  return checksum;
-}
-
 #if defined(ESP32)
   // ESP32 variants: Use NVS with namespace
   #include <nvs_flash.h>
@@ -192,6 +363,7 @@ char CheckSum(String NMEAData) {
   
   void saveEEPROMConfig(configData cfg) {
     // Save configuration using NVS (faster than EEPROM emulation)
+    metrics.configSave();
     nvs_handle_t handle;
     esp_err_t err = nvs_open("config", NVS_READWRITE, &handle);
     
@@ -270,6 +442,7 @@ void eraseEEPROMConfig(configData cfg) {
 
 void saveEEPROMConfig(configData cfg) {
   // Save configuration from RAM into EEPROM
+  metrics.configSave();
   noInterrupts();                       // Stop all interrupts important for writing in EEPROM
   EEPROM.begin(sizeEEPROM);
   EEPROM.put( cfgStart, cfg );
@@ -561,4 +734,28 @@ WindSensorType stringToWindSensorType(String typeStr) {
   }
 #endif
 
+// Wind speed value for Web interface depends on unit
+float webWindSpeed(const WindSnapshot &wd)
+{
+  if (strcmp(actconf.speedUnit, "km/h") == 0) {
+    return wd.windspeed_kph;
+  }
+  if (strcmp(actconf.speedUnit, "kn") == 0) {
+    return wd.windspeed_kn;
+  }
+  if (strcmp(actconf.speedUnit, "bft") == 0) {
+    return wd.windspeed_bft;
+  }
+  return wd.windspeed_mps;
+}
+
+// Down wind speed for Web interface, 0 outside of the down wind range
+float webDownWindSpeed(const WindSnapshot &wd)
+{
+  if ((wd.winddirection > (180 - actconf.downWindRange)) && (wd.winddirection < (actconf.downWindRange + 180))){
+    return webWindSpeed(wd);
+  }
+  return 0;
+}
+
 #endif
@@ -0,0 +1,166 @@
+#ifndef GustDetector_h
+#define GustDetector_h
+
+// Gust and lull detection on each pulse of the anemometer (WMO: gust = highest 3s running mean)
+// processPulses() hands over the period of each wind speed pulse, the 3s running mean is calculated with every
+// pulse and every 50ms (buildaverage()). Peaks between two calculation cycles of 500ms are not lost.
+// 3s mean = pulses in the last 3s / their duration including the running pulse, 0 after 3s without pulse.
+// The 3s mean is sampled with 4 Hz into a 10min sliding window (mean), the min and max of the window include
+// the lowest and highest 3s mean between two samples (lull and max gust).
+// All values are pulse rates in [Hz], the calculation divides them by the pulses per round like the wind speed.
+// Only timestamps in [us] are used, recorded pulses can be replayed on the host.
+
+#include "WindowStats.h"
+
+#define GUST_REVOLUTIONS 128                // Max pulses in the 3s window (42 Hz)
+#define GUST_WINDOW 3000000                 // Running mean for gusts in [us]
+#define GUST_MIN_PERIOD 10000               // Shortest valid pulse period in [us] (100 Hz)
+#define GUST_SAMPLE 250                     // Sample period of the 3s mean in [ms] (4 Hz)
+#define GUST_PERIOD 600000                  // Window of mean, max gust and lull in [ms] (10min)
+
+// Gust values in [Hz]
+typedef struct {
+  float peak = 0;                   // Highest 3s mean since the last take()
+  float mean = 0;                   // 10min mean
+  float gust = 0;                   // 10min max of the 3s mean
+  float lull = 0;                   // 10min min of the 3s mean
+  bool complete = false;            // 10min of samples since start
+} gustData;
+
+class GustDetector
+{
+public:
+  void begin(uint32_t now)
+  {
+    _count = 0;
+    _head = 0;
+    _sum = 0;
+    _last = now;
+    _sampleTime = now;
+    _clock = 0;
+    _samples = 0;
+    _mean = 0;
+    _low = 0;
+    _high = 0;
+    _window.begin(GUST_PERIOD, _clock);
+    NO_INTERRUPTS;
+    _peak = 0;
+    _result = gustData();
+    INTERRUPTS;
+  }
+
+  // One pulse, end = timestamp of the edge in [us], period since the previous edge in [us]
+  void revolution(uint32_t end, uint32_t period)
+  {
+    if (period < GUST_MIN_PERIOD)
+    {
+      return;                               // Disturbance
+    }
+    if (_count == GUST_REVOLUTIONS)
+    {
+      expire();                             // Window shorter than 3s, the mean stays correct
+    }
+    period = min(period, uint32_t(GUST_WINDOW));
+    _periods[(_head + _count) % GUST_REVOLUTIONS] = period;
+    _count++;
+    _sum += period;
+    _last = end;
+    evaluate(end);
+  }
+
+  // Called all 50ms, samples the 3s mean with 4 Hz
+  void tick(uint32_t now)
+  {
+    evaluate(now);
+    if (now - _sampleTime < uint32_t(GUST_SAMPLE) * 1000)
+    {
+      return;
+    }
+    _sampleTime += uint32_t(GUST_SAMPLE) * 1000;
+    if (now - _sampleTime >= uint32_t(GUST_SAMPLE) * 1000)
+    {
+      _sampleTime = now;                    // Resynchronize after a pause of the timer
+    }
+    _clock += GUST_SAMPLE;                  // Own clock in [ms], micros() / 1000 is not overflow safe
+    _window.add(_clock, fixed(_mean), fixed(_low), fixed(_high), 0, 0);
+    _samples++;
+    _low = _mean;
+    _high = _mean;
+    windowResult r = _window.result(_clock);
+    NO_INTERRUPTS;
+    _result.mean = r.mean;
+    _result.gust = r.maximum;
+    _result.lull = r.minimum;
+    _result.complete = _samples >= GUST_PERIOD / GUST_SAMPLE;
+    INTERRUPTS;
+  }
+
+  // Gust values of the last cycle, starts the next 3s peak
+  gustData take()
+  {
+    NO_INTERRUPTS;
+    gustData data = _result;
+    data.peak = _peak;
+    _peak = _mean;
+    INTERRUPTS;
+    return data;
+  }
+
+  float mean() const { return _mean; }                        // Actual 3s mean in [Hz]
+
+private:
+  // Remove the oldest pulse
+  void expire()
+  {
+    _sum -= _periods[_head];
+    _head = (_head + 1) % GUST_REVOLUTIONS;
+    _count--;
+  }
+
+  void evaluate(uint32_t now)
+  {
+    // Remove the pulses ending before the 3s window, the end of the oldest is _last - (_sum - its period)
+    while (_count > 0 && now - (_last - (_sum - _periods[_head])) >= GUST_WINDOW)
+    {
+      expire();
+    }
+    float mean = 0;
+    if (_count > 0)
+    {
+      uint32_t running = min(now - _last, uint32_t(GUST_WINDOW));
+      mean = _count * 1e6f / (_sum + running);
+    }
+    _mean = mean;
+    _low = min(_low, mean);
+    _high = max(_high, mean);
+    NO_INTERRUPTS;
+    if (mean > _peak)
+    {
+      _peak = mean;
+    }
+    INTERRUPTS;
+  }
+
+  // Speed in [Hz] to fixed point of the window
+  static uint16_t fixed(float hz)
+  {
+    return uint16_t(constrain(hz, 0.0f, 600.0f) * STATS_SPEED_SCALE + 0.5f);
+  }
+
+  uint32_t _periods[GUST_REVOLUTIONS];      // Pulse periods in the 3s window in [us]
+  uint16_t _head = 0;                       // Oldest pulse
+  uint16_t _count = 0;
+  uint32_t _sum = 0;                        // Sum of the periods in [us]
+  uint32_t _last = 0;                       // End of the last pulse in [us]
+  uint32_t _sampleTime = 0;                 // Time of the last sample in [us]
+  uint32_t _clock = 0;                      // Sample clock of the window in [ms]
+  uint32_t _samples = 0;
+  float _mean = 0;                          // Actual 3s mean
+  float _low = 0;                           // Range of the 3s mean since the last sample
+  float _high = 0;
+  float _peak = 0;                          // Highest 3s mean since the last take()
+  gustData _result;
+  SlidingWindow _window;                    // 10min window of the 3s mean
+};
+
+#endif
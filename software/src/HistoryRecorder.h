@@ -0,0 +1,520 @@
+#ifndef HistoryRecorder_h
+#define HistoryRecorder_h
+
+// History of the measuring values with 1 Hz in a ring of files in LittleFS
+// The records are delta encoded against the record before (zigzag varint, mostly 1 byte per value, about 6.5 bytes
+// per record, 40 h per MB) and collected in a page of 256 bytes in RAM. Only full pages are written, one flash write
+// about every 40s from loop(), the measurement in the timers is not blocked.
+// The ring consists of segment files of 16 kB (/history/000.bin ...). When the newest segment is full, the oldest
+// is overwritten. LittleFS spreads the blocks of the rewritten files over the flash (wear leveling).
+// Each page starts with a header and the first record against zero, a page can be decoded alone.
+// The history time in [s] continues after a restart with the last record + 1s, the first page after the
+// start is marked (HISTORY_START). The records of the open page (max 40s) are lost on power off.
+
+#define HISTORY_PAGE 256                    // Page size in [Byte], written at once
+#define HISTORY_SEGMENT 16384               // Segment file size in [Byte] (64 pages)
+#define HISTORY_PAGES (HISTORY_SEGMENT / HISTORY_PAGE)
+#define HISTORY_MAX_SEGMENTS 256            // Max 4 MB
+#define HISTORY_RECORD_MAX 20               // Max length of one encoded record (time 5 bytes, 5 values 3 bytes)
+#define HISTORY_PERIOD 1000                 // Record period in [ms]
+#define HISTORY_VERSION 1
+#define HISTORY_START 0x01                  // Page flag: first page after start
+
+// One record, fixed point values
+typedef struct {
+  uint32_t time = 0;                // History time in [s]
+  uint16_t speed = 0;               // Wind speed in [0.1 m/s]
+  uint16_t direction = 0;           // Wind direction 0...359[°]
+  uint16_t gust = 0;                // Highest 3s gust since the last record in [0.1 m/s]
+  int16_t temperature = 0;          // Temperature in [0.1 °C] (DS18B20 or BME280)
+  uint16_t pressure = 0;            // Air pressure in [0.1 mbar], 0 = no BME280
+} historyRecord;
+
+// Header of one page
+typedef struct {
+  uint32_t time;                    // History time of the first record in [s]
+  uint16_t length;                  // Used bytes of the page including the header
+  uint8_t records;                  // Records in the page
+  uint8_t flags;                    // Version in the high nibble, HISTORY_START
+} historyHeader;
+
+#define HISTORY_HEADER sizeof(historyHeader)
+
+class HistoryRecorder
+{
+public:
+  // size = size of the ring in [Byte], 0 = off
+  bool begin(FS &fs, uint32_t size)
+  {
+    _fs = &fs;
+    _file.close();
+    _segments = min(size / HISTORY_SEGMENT, uint32_t(HISTORY_MAX_SEGMENTS));
+    if (_segments < 2)
+    {
+      _segments = 0;                        // Off, all segments are removed
+    }
+    // Segments of a larger ring before
+    for (uint32_t i = _segments; i < HISTORY_MAX_SEGMENTS && _fs->exists(path(i)); i++)
+    {
+      _fs->remove(path(i));
+    }
+    if (_segments == 0)
+    {
+      return false;
+    }
+    _fs->mkdir("/history");
+    // Newest segment = segment with the latest first page
+    _segment = 0;
+    uint32_t newest = 0;
+    bool found = false;
+    for (uint32_t i = 0; i < _segments; i++)
+    {
+      historyHeader header;
+      if (readHeader(i, 0, header) && (!found || int32_t(header.time - newest) > 0))
+      {
+        newest = header.time;
+        _segment = i;
+        found = true;
+      }
+    }
+    _time = 0;
+    _pages = 0;
+    if (found)
+    {
+      File file = _fs->open(path(_segment), "r");
+      _pages = file.size() / HISTORY_PAGE;
+      file.close();
+      uint8_t page[HISTORY_PAGE];
+      historyRecord last;
+      if (_pages > 0 && readPage(_segment, _pages - 1, page) && lastRecord(page, last))
+      {
+        _time = last.time + 1;
+      }
+    }
+    startPage(HISTORY_START);
+    _lastRecord = millis();
+    return true;
+  }
+
+  bool active() const { return _segments > 0; }
+
+  // Called by loop(), one record per second, returns true with a new record in r
+  // The records are built without ring too (time from 0 on), for the minute aggregates in RAM
+  bool handle(const SeqLock<WindSnapshot> &data, historyRecord &r)
+  {
+    // Highest gust of all cycles since the last record
+    uint32_t epoch = data.epoch();
+    if (epoch != _epoch)
+    {
+      data.read(_wd);
+      _epoch = epoch;
+      _gust = max(_gust, _wd.gust);
+    }
+    unsigned long now = millis();
+    if (now - _lastRecord < HISTORY_PERIOD || _epoch == 0)
+    {
+      return false;
+    }
+    _lastRecord += HISTORY_PERIOD;
+    if (now - _lastRecord >= HISTORY_PERIOD)
+    {
+      _lastRecord = now;                    // Resynchronize after a long loop()
+    }
+    r.time = _time;
+    r.speed = fixed(_wd.windspeed_mps, 10, 0, 65535);
+    r.direction = fixed(_wd.winddirection, 1, 0, 359.4f) % 360;
+    r.gust = fixed(max(_gust, _wd.windspeed_mps), 10, 0, 65535);
+    if (strcmp(actconf.tempSensorType, "BME280") == 0)
+    {
+      r.temperature = celsius(_wd.airtemperature);
+      r.pressure = fixed(_wd.airpressure, 10, 0, 65535);
+    }
+    else
+    {
+      r.temperature = celsius(_wd.temperature);
+    }
+    _gust = 0;
+    if (active())
+    {
+      add(r);
+    }
+    else
+    {
+      _time = r.time + 1;
+    }
+    return true;
+  }
+
+  // Append one record, writes the page if it is full
+  void add(const historyRecord &r)
+  {
+    uint8_t data[HISTORY_RECORD_MAX];
+    historyRecord zero;                     // First record of a page against zero, time in the header
+    zero.time = r.time;
+    size_t length = encode(r, _header.records == 0 ? zero : _previous, data);
+    if (_length + length > HISTORY_PAGE)
+    {
+      writePage();
+      startPage(0);
+      length = encode(r, zero, data);
+    }
+    if (_header.records == 0)
+    {
+      _header.time = r.time;
+    }
+    memcpy(_page + _length, data, length);
+    _length += length;
+    _header.records++;
+    _previous = r;
+    _time = r.time + 1;
+    _records++;
+  }
+
+  // All records from the history time from on in time order, callback(const historyRecord &) returns false to stop
+  // The records of the open page are included
+  template <typename F>
+  void read(uint32_t from, F callback)
+  {
+    if (!active())
+    {
+      return;
+    }
+    uint8_t page[HISTORY_PAGE];
+    for (uint32_t n = 1; n <= _segments; n++)
+    {
+      uint32_t segment = (_segment + n) % _segments;
+      File file = _fs->open(path(segment), "r");
+      if (!file)
+      {
+        continue;
+      }
+      uint32_t pages = file.size() / HISTORY_PAGE;
+      for (uint32_t p = 0; p < pages; p++)
+      {
+        if (file.read(page, HISTORY_PAGE) != HISTORY_PAGE)
+        {
+          break;
+        }
+        // Skip pages before from, the next page starts later
+        historyHeader next;
+        if (p + 1 < pages && peekHeader(file, next) && int32_t(next.time - from) <= 0)
+        {
+          continue;
+        }
+        if (!decodePage(page, from, callback))
+        {
+          return;
+        }
+        yield();                            // Reading the whole ring takes more than a second
+      }
+      file.close();
+    }
+    memcpy(page, &_header, HISTORY_HEADER);
+    ((historyHeader *)page)->length = _length;
+    memcpy(page + HISTORY_HEADER, _page + HISTORY_HEADER, _length - HISTORY_HEADER);
+    decodePage(page, from, callback);
+  }
+
+  // Written pages of the ring in time order as one byte stream (without the open page), for downloads
+  // New pages are appended at the end, the start changes when the oldest segment is overwritten.
+  uint32_t bytes()
+  {
+    uint32_t total = 0;
+    for (uint32_t n = 1; active() && n <= _segments; n++)
+    {
+      total += segmentSize((_segment + n) % _segments);
+    }
+    return total;
+  }
+
+  // History time of the first page of the byte stream, identifies its start
+  uint32_t oldest()
+  {
+    historyHeader header;
+    for (uint32_t n = 1; active() && n <= _segments; n++)
+    {
+      if (readHeader((_segment + n) % _segments, 0, header))
+      {
+        return header.time;
+      }
+    }
+    return _time;
+  }
+
+  // length bytes of the byte stream from offset on, callback(const uint8_t *data, size_t length) per page
+  template <typename F>
+  void readBytes(uint32_t offset, uint32_t length, F callback)
+  {
+    uint8_t page[HISTORY_PAGE];
+    for (uint32_t n = 1; active() && n <= _segments && length > 0; n++)
+    {
+      uint32_t segment = (_segment + n) % _segments;
+      uint32_t size = segmentSize(segment);
+      if (offset >= size)
+      {
+        offset -= size;
+        continue;
+      }
+      File file = _fs->open(path(segment), "r");
+      if (!file || !file.seek(offset))
+      {
+        return;
+      }
+      while (offset < size && length > 0)
+      {
+        uint32_t chunk = min(min(uint32_t(HISTORY_PAGE), size - offset), length);
+        if (file.read(page, chunk) != int(chunk))
+        {
+          return;
+        }
+        callback(page, size_t(chunk));
+        offset += chunk;
+        length -= chunk;
+      }
+      file.close();
+      offset = 0;
+    }
+  }
+
+  uint32_t time() const { return _time; }                    // History time of the next record in [s]
+  uint32_t size() const { return _segments * HISTORY_SEGMENT; }
+  uint32_t records() const { return _records; }               // Records since start
+  uint32_t pages() const { return _written; }                 // Pages written since start
+  uint32_t errors() const { return _errors; }                 // Pages not written
+  uint32_t maxWriteTime() const { return _maxWriteTime; }     // Longest page write in [us]
+
+  // Decode all records of one page with time >= from
+  template <typename F>
+  static bool decodePage(const uint8_t *page, uint32_t from, F callback)
+  {
+    historyHeader header;
+    memcpy(&header, page, HISTORY_HEADER);
+    if ((header.flags >> 4) != HISTORY_VERSION || header.length > HISTORY_PAGE)
+    {
+      return true;                          // Not a page of this format, skip it
+    }
+    const uint8_t *p = page + HISTORY_HEADER;
+    const uint8_t *end = page + header.length;
+    historyRecord r;
+    r.time = header.time;
+    for (uint8_t i = 0; i < header.records; i++)
+    {
+      historyRecord previous = r;
+      if (!decode(p, end, previous, r))
+      {
+        break;
+      }
+      if (int32_t(r.time - from) >= 0 && !callback(r))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Delta and zigzag varint encoding against the previous record, returns the length
+  static size_t encode(const historyRecord &r, const historyRecord &previous, uint8_t *data)
+  {
+    uint8_t *p = data;
+    int32_t direction = int32_t(r.direction) - previous.direction;
+    if (direction > 180)
+    {
+      direction -= 360;
+    }
+    else if (direction <= -180)
+    {
+      direction += 360;
+    }
+    p = varint(p, r.time - previous.time);
+    p = varint(p, zigzag(int32_t(r.speed) - previous.speed));
+    p = varint(p, zigzag(direction));
+    p = varint(p, zigzag(int32_t(r.gust) - previous.gust));
+    p = varint(p, zigzag(int32_t(r.temperature) - previous.temperature));
+    p = varint(p, zigzag(int32_t(r.pressure) - previous.pressure));
+    return p - data;
+  }
+
+  static bool decode(const uint8_t *&p, const uint8_t *end, const historyRecord &previous, historyRecord &r)
+  {
+    uint32_t v[6];
+    for (int i = 0; i < 6; i++)
+    {
+      if (!unvarint(p, end, v[i]))
+      {
+        return false;
+      }
+    }
+    r.time = previous.time + v[0];
+    r.speed = uint16_t(previous.speed + unzigzag(v[1]));
+    r.direction = uint16_t((int32_t(previous.direction) + unzigzag(v[2]) + 360) % 360);
+    r.gust = uint16_t(previous.gust + unzigzag(v[3]));
+    r.temperature = int16_t(previous.temperature + unzigzag(v[4]));
+    r.pressure = uint16_t(previous.pressure + unzigzag(v[5]));
+    return true;
+  }
+
+private:
+  static uint16_t fixed(float value, float scale, float low, float high)
+  {
+    return uint16_t(lroundf(constrain(value * scale, low, high)));
+  }
+
+  // Temperature of the snapshot (in the unit of tempUnit) in [0.1 °C]
+  static int16_t celsius(float value)
+  {
+    if (strcmp(actconf.tempUnit, "F") == 0)
+    {
+      value = (value - 32) * 5 / 9;
+    }
+    return int16_t(lroundf(constrain(value, -300.0f, 300.0f) * 10));
+  }
+
+  static uint32_t zigzag(int32_t v) { return (uint32_t(v) << 1) ^ uint32_t(v >> 31); }
+  static int32_t unzigzag(uint32_t v) { return int32_t(v >> 1) ^ -int32_t(v & 1); }
+
+  static uint8_t *varint(uint8_t *p, uint32_t v)
+  {
+    while (v >= 0x80)
+    {
+      *p++ = uint8_t(v) | 0x80;
+      v >>= 7;
+    }
+    *p++ = uint8_t(v);
+    return p;
+  }
+
+  static bool unvarint(const uint8_t *&p, const uint8_t *end, uint32_t &v)
+  {
+    v = 0;
+    for (int shift = 0; shift < 35; shift += 7)
+    {
+      if (p >= end)
+      {
+        return false;
+      }
+      uint8_t b = *p++;
+      v |= uint32_t(b & 0x7f) << shift;
+      if ((b & 0x80) == 0)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static String path(uint32_t segment)
+  {
+    char name[24];
+    snprintf(name, sizeof(name), "/history/%03u.bin", unsigned(segment));
+    return String(name);
+  }
+
+  void startPage(uint8_t flags)
+  {
+    _header.time = _time;
+    _header.records = 0;
+    _header.flags = uint8_t((HISTORY_VERSION << 4) | flags);
+    _length = HISTORY_HEADER;
+  }
+
+  // Write the page to the newest segment, a full segment continues with the oldest
+  void writePage()
+  {
+    uint32_t start = micros();
+    _header.length = _length;
+    memcpy(_page, &_header, HISTORY_HEADER);
+    memset(_page + _length, 0, HISTORY_PAGE - _length);
+    if (_pages >= HISTORY_PAGES)
+    {
+      _file.close();
+      _segment = (_segment + 1) % _segments;
+      _pages = 0;
+      _file = _fs->open(path(_segment), "w");
+    }
+    else if (!_file)
+    {
+      _file = _fs->open(path(_segment), "a");
+    }
+    if (_file && _file.write(_page, HISTORY_PAGE) == HISTORY_PAGE)
+    {
+      _file.flush();
+      _pages++;
+      _written++;
+    }
+    else
+    {
+      _errors++;
+      _file.close();
+    }
+    uint32_t time = micros() - start;
+    _maxWriteTime = max(_maxWriteTime, time);
+  }
+
+  // Size of the written pages of a segment, the newest segment can be open for append
+  uint32_t segmentSize(uint32_t segment)
+  {
+    File file = _fs->open(path(segment), "r");
+    uint32_t size = file ? file.size() / HISTORY_PAGE * HISTORY_PAGE : 0;
+    file.close();
+    return size;
+  }
+
+  bool readPage(uint32_t segment, uint32_t index, uint8_t *page)
+  {
+    File file = _fs->open(path(segment), "r");
+    bool ok = file && file.seek(index * HISTORY_PAGE) && file.read(page, HISTORY_PAGE) == HISTORY_PAGE;
+    file.close();
+    return ok;
+  }
+
+  bool readHeader(uint32_t segment, uint32_t index, historyHeader &header)
+  {
+    File file = _fs->open(path(segment), "r");
+    bool ok = file && file.seek(index * HISTORY_PAGE) &&
+              file.read((uint8_t *)&header, HISTORY_HEADER) == int(HISTORY_HEADER) &&
+              (header.flags >> 4) == HISTORY_VERSION;
+    file.close();
+    return ok;
+  }
+
+  // Header of the next page without moving the position
+  static bool peekHeader(File &file, historyHeader &header)
+  {
+    size_t position = file.position();
+    bool ok = file.read((uint8_t *)&header, HISTORY_HEADER) == int(HISTORY_HEADER);
+    file.seek(position);
+    return ok && (header.flags >> 4) == HISTORY_VERSION;
+  }
+
+  static bool lastRecord(const uint8_t *page, historyRecord &last)
+  {
+    bool found = false;
+    decodePage(page, 0, [&last, &found](const historyRecord &r) {
+      last = r;
+      found = true;
+      return true;
+    });
+    return found;
+  }
+
+  FS *_fs = nullptr;
+  File _file;                               // Newest segment, open for append
+  uint32_t _segments = 0;                   // Segments of the ring, 0 = off
+  uint32_t _segment = 0;                    // Newest segment
+  uint32_t _pages = 0;                      // Pages in the newest segment
+  uint32_t _time = 0;                       // History time of the next record in [s]
+  historyHeader _header = {};               // Header of the open page
+  uint8_t _page[HISTORY_PAGE];              // Open page
+  uint16_t _length = HISTORY_HEADER;        // Used bytes of the open page
+  historyRecord _previous;                  // Last record of the open page
+  WindSnapshot _wd;                         // Last measuring values
+  uint32_t _epoch = 0;
+  float _gust = 0;
+  unsigned long _lastRecord = 0;
+  uint32_t _records = 0;
+  uint32_t _written = 0;
+  uint32_t _errors = 0;
+  uint32_t _maxWriteTime = 0;
+};
+
+#endif
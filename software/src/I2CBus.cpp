@@ -0,0 +1,124 @@
+// I2C transport with bounded transaction time and bus recovery (see I2CBus.h)
+
+#include "I2CBus.h"
+
+I2CBus i2cBus;
+
+void I2CBus::begin(int sda, int scl, uint32_t clock)
+{
+  _sda = sda;
+  _scl = scl;
+  _clock = clock;
+  start();
+}
+
+// Start the I2C driver with clock and timeout, returns false if the driver could not be started
+bool I2CBus::start()
+{
+  bool ok = true;
+  #ifdef ESP32
+    ok = _wire->begin(_sda, _scl);
+  #else
+    _wire->begin(_sda, _scl);
+  #endif
+  _wire->setClock(_clock);
+  #ifdef ESP32
+    _wire->setTimeOut(I2C_TIMEOUT);
+  #else
+    _wire->setClockStretchLimit(I2C_TIMEOUT * 1000);
+  #endif
+  return ok;
+}
+
+// Release the pins from the I2C driver
+// The ESP8266 driver is a software I2C on the GPIOs without end(), pinMode() takes the pins over directly.
+void I2CBus::stop()
+{
+  #ifdef ESP32
+    _wire->end();
+  #endif
+}
+
+bool I2CBus::probe(uint8_t address)
+{
+  uint32_t begin = micros();
+  _wire->beginTransmission(address);
+  return finish(_wire->endTransmission() == 0, begin);
+}
+
+// Burst read of length registers from reg on
+bool I2CBus::read(uint8_t address, uint8_t reg, uint8_t *data, uint8_t length)
+{
+  uint32_t begin = micros();
+  _wire->beginTransmission(address);
+  _wire->write(reg);
+  bool ok = _wire->endTransmission(false) == 0;               // Repeated start, the bus is kept
+  ok = ok && _wire->requestFrom(address, length) == length;
+  for (uint8_t i = 0; ok && i < length; i++)
+  {
+    if (_wire->available() == 0)
+    {
+      ok = false;
+      break;
+    }
+    data[i] = _wire->read();
+  }
+  return finish(ok, begin);
+}
+
+bool I2CBus::write(uint8_t address, uint8_t reg, uint8_t value)
+{
+  uint32_t begin = micros();
+  _wire->beginTransmission(address);
+  _wire->write(reg);
+  _wire->write(value);
+  return finish(_wire->endTransmission() == 0, begin);
+}
+
+// Clock out a device holding SDA low after an aborted transaction
+bool I2CBus::recover()
+{
+  _recoveries++;
+  stop();                                                     // The peripheral must not drive SCL and SDA
+  pinMode(_sda, INPUT_PULLUP);
+  pinMode(_scl, OUTPUT_OPEN_DRAIN);
+  digitalWrite(_scl, HIGH);
+  for (uint8_t i = 0; i < I2C_RECOVERY_PULSES && digitalRead(_sda) == LOW; i++)
+  {
+    digitalWrite(_scl, LOW);
+    delayMicroseconds(I2C_RECOVERY_DELAY);
+    digitalWrite(_scl, HIGH);
+    delayMicroseconds(I2C_RECOVERY_DELAY);
+  }
+  // STOP condition: SDA low to high while SCL is high
+  pinMode(_sda, OUTPUT_OPEN_DRAIN);
+  digitalWrite(_sda, LOW);
+  delayMicroseconds(I2C_RECOVERY_DELAY);
+  digitalWrite(_sda, HIGH);
+  delayMicroseconds(I2C_RECOVERY_DELAY);
+  bool free = digitalRead(_sda) == HIGH;
+  if (!start() || !free)
+  {
+    _restartFailures++;
+  }
+  return free;
+}
+
+bool I2CBus::finish(bool ok, uint32_t begin)
+{
+  _lastTime = micros() - begin;
+  if (_lastTime > _maxTime)
+  {
+    _maxTime = _lastTime;
+  }
+  _transfers++;
+  if (!ok)
+  {
+    _errors++;
+    if (digitalRead(_sda) == LOW)
+    {
+      recover();
+    }
+  }
+  return ok;
+}
@@ -0,0 +1,54 @@
+#ifndef I2CBus_h
+#define I2CBus_h
+
+// I2C transport for the magnetic rotation sensors and the BME280
+// Register reads are one transaction with repeated start and auto increment. Each transaction is bounded
+// by the bus timeout (clock stretch limit on ESP8266), no busy waiting on Wire.available().
+// A failed transaction with SDA held low by a device is followed by a bus recovery: up to 9 clock pulses
+// until the device releases SDA, a STOP condition and a restart of the I2C driver. The driver is stopped
+// before the pins are bit-banged. A recovery that leaves SDA low or cannot restart the driver is counted.
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#define I2C_CLOCK 400000            // Bus clock in [Hz], fast mode is supported by AS5600, MT6701 and BME280
+#define I2C_TIMEOUT 2               // Max time of one transaction in [ms]
+#define I2C_RECOVERY_PULSES 9       // Clock pulses for a device holding SDA low
+#define I2C_RECOVERY_DELAY 5        // Half period of the recovery clock in [us]
+
+class I2CBus
+{
+public:
+  void begin(int sda, int scl, uint32_t clock = I2C_CLOCK);
+  bool probe(uint8_t address);                                        // Device answers with ACK
+  bool read(uint8_t address, uint8_t reg, uint8_t *data, uint8_t length);
+  bool write(uint8_t address, uint8_t reg, uint8_t value);
+  bool recover();                                                     // Returns true if SDA is free
+
+  uint32_t transfers() const { return _transfers; }   // Transactions since start
+  uint32_t errors() const { return _errors; }         // Failed transactions (NACK, timeout, short read)
+  uint32_t recoveries() const { return _recoveries; } // Bus recoveries
+  uint32_t restartFailures() const { return _restartFailures; } // Recoveries with SDA still low or failed driver start
+  uint32_t maxTime() const { return _maxTime; }       // Longest transaction in [us]
+  uint32_t lastTime() const { return _lastTime; }     // Last transaction in [us]
+
+private:
+  bool start();
+  void stop();
+  bool finish(bool ok, uint32_t begin);
+
+  TwoWire *_wire = &Wire;
+  int _sda = SDA;
+  int _scl = SCL;
+  uint32_t _clock = I2C_CLOCK;
+  uint32_t _transfers = 0;
+  uint32_t _errors = 0;
+  uint32_t _recoveries = 0;
+  uint32_t _restartFailures = 0;
+  uint32_t _maxTime = 0;
+  uint32_t _lastTime = 0;
+};
+
+extern I2CBus i2cBus;               // Shared I2C bus
+
+#endif
@@ -0,0 +1,221 @@
+#ifndef LiveServer_h
+#define LiveServer_h
+
+// WebSocket live data for instrument pages and dashboards (ws://<ip>:<wsport>/)
+// Each subscriber selects its own update rate and field set, in the URL or later as text message:
+//   ws://192.168.5.1:81/?rate=2&fields=WindSpeed,WindDirection
+//   rate=0.5&fields=WindSpeed,AirPressure
+// rate in [Hz] 0.1...2 (default 2), fields = names like in /json MeasuringValues (default all)
+// A subscriber gets only the newest measuring values: when it is due, the actual snapshot is sent
+// if it has a new epoch. Older values are never queued, the rate is an upper limit.
+// New values come once per calculation cycle (500ms), so the max rate is the epoch rate and higher rates
+// are clamped. A subscriber with the max rate gets every epoch, independent of the loop timing.
+
+#include <WebSocketsServer.h>
+
+#define LIVE_RATE_DEFAULT 2.0               // Default update rate in [Hz]
+#define LIVE_RATE_MIN 0.1                   // Min update rate in [Hz]
+#define LIVE_EPOCH_PERIOD 500               // Calculation cycle in [ms] (winddata), one new epoch per cycle
+#define LIVE_RATE_MAX (1000.0 / LIVE_EPOCH_PERIOD) // Max update rate in [Hz] = epoch rate
+#define LIVE_MESSAGE_SIZE 384               // Buffer size for one message in [Byte]
+
+// Field names for the field set (bit number = index)
+const char *const liveFields[] = {
+  "WindDirection", "WindSpeed", "DownWindSpeed", "RotationSpeed", "RawWindDirection",
+  "DeviceTemperature", "AirTemperature", "AirPressure", "AirHumidity", "Dewpoint", "Altitude",
+  "ConnectionQuality"
+};
+#define LIVE_FIELDS (sizeof(liveFields) / sizeof(liveFields[0]))
+#define LIVE_FIELDS_ALL ((1UL << LIVE_FIELDS) - 1)
+
+// Subscriber settings
+typedef struct {
+  bool active = false;                      // Slot is used
+  unsigned long interval = 500;             // Time in [ms] between two messages
+  unsigned long lastSent = 0;               // Time in [ms] of the last message
+  uint32_t epoch = 0;                       // Epoch of the last message
+  uint32_t fields = LIVE_FIELDS_ALL;        // Field set, one bit per field
+} liveSubscriber;
+
+class LiveServer
+{
+public:
+  LiveServer(uint16_t port) : _ws(port) {}
+
+  // Start the WebSocket server
+  void begin()
+  {
+    _ws.begin();
+    _ws.onEvent([this](uint8_t num, WStype_t type, uint8_t *payload, size_t length) {
+      event(num, type, payload, length);
+    });
+  }
+
+  // Handle the WebSocket connections and send the newest values to all due subscribers (call in loop)
+  void handle(const SeqLock<WindSnapshot> &data)
+  {
+    _ws.loop();
+    unsigned long now = millis();
+    uint32_t epoch = data.epoch();
+    bool read = false;
+    WindSnapshot wd;
+    for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++)
+    {
+      liveSubscriber &s = _subscribers[i];
+      // The max rate sends every new epoch, the time check would skip epochs with the jitter of the loop
+      bool due = s.interval <= LIVE_EPOCH_PERIOD || now - s.lastSent >= s.interval;
+      if (!s.active || s.epoch == epoch || !due)
+      {
+        continue;
+      }
+      if (!read)
+      {
+        data.read(wd);                      // One snapshot for all subscribers of this loop
+        read = true;
+      }
+      size_t length = message(wd, s.fields);
+      if (length > 0 && _ws.sendTXT(i, _message, length))
+      {
+        _messages++;
+      }
+      s.epoch = wd.epoch;
+      s.lastSent = now;
+    }
+  }
+
+  // Number of subscribers
+  int clients() const
+  {
+    int n = 0;
+    for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++)
+    {
+      if (_subscribers[i].active)
+      {
+        n++;
+      }
+    }
+    return n;
+  }
+
+  uint32_t messages() const { return _messages; }           // Sent messages since start
+
+private:
+  void event(uint8_t num, WStype_t type, uint8_t *payload, size_t length)
+  {
+    if (num >= WEBSOCKETS_SERVER_CLIENT_MAX)
+    {
+      return;
+    }
+    liveSubscriber &s = _subscribers[num];
+    switch (type)
+    {
+      case WStype_CONNECTED:
+        s = liveSubscriber();
+        s.active = true;
+        s.interval = 1000 / LIVE_RATE_DEFAULT;
+        // The URL can hold the settings (?rate=...&fields=...)
+        settings(s, (const char*)payload, length);
+        DebugPrint(3, "Live client connected: ");
+        DebugPrintln(3, _ws.remoteIP(num));
+        break;
+      case WStype_TEXT:
+        settings(s, (const char*)payload, length);
+        break;
+      case WStype_DISCONNECTED:
+        s.active = false;
+        DebugPrintln(3, "Live client disconnected");
+        break;
+      default:
+        break;
+    }
+  }
+
+  // Read rate=<Hz> and fields=<name>,<name>,... separated by & or ? or space
+  void settings(liveSubscriber &s, const char *text, size_t length)
+  {
+    char buffer[256];
+    length = (length < sizeof(buffer) - 1) ? length : sizeof(buffer) - 1;
+    memcpy(buffer, text, length);
+    buffer[length] = '\0';
+    char *rest = buffer;
+    char *token;
+    while ((token = strtok_r(rest, "?& \r\n", &rest)) != nullptr)
+    {
+      if (strncmp(token, "rate=", 5) == 0)
+      {
+        float rate = atof(token + 5);
+        rate = (rate < LIVE_RATE_MIN) ? LIVE_RATE_MIN : ((rate > LIVE_RATE_MAX) ? LIVE_RATE_MAX : rate);
+        s.interval = (unsigned long)(1000.0 / rate);
+      }
+      if (strncmp(token, "fields=", 7) == 0)
+      {
+        s.fields = 0;
+        char *names = token + 7;
+        char *name;
+        while ((name = strtok_r(names, ",", &names)) != nullptr)
+        {
+          for (size_t f = 0; f < LIVE_FIELDS; f++)
+          {
+            if (strcmp(name, liveFields[f]) == 0)
+            {
+              s.fields |= (1UL << f);
+            }
+          }
+        }
+        if (s.fields == 0)
+        {
+          s.fields = LIVE_FIELDS_ALL;
+        }
+      }
+    }
+    s.epoch = 0;                            // Send the actual values with the new settings
+  }
+
+  // Value of a field
+  float value(const WindSnapshot &wd, size_t field) const
+  {
+    switch (field)
+    {
+      case 0: return wd.winddirection;
+      case 1: return webWindSpeed(wd);
+      case 2: return webDownWindSpeed(wd);
+      case 3: return wd.windspeed_hz;
+      case 4: return wd.rawwinddirection;
+      case 5: return wd.temperature;
+      case 6: return wd.airtemperature;
+      case 7: return wd.airpressure;
+      case 8: return wd.airhumidity;
+      case 9: return wd.dewpoint;
+      case 10: return wd.altitude;
+      case 11: return wd.quality;
+    }
+    return 0;
+  }
+
+  // JSON message with the epoch and the selected fields, returns the length
+  size_t message(const WindSnapshot &wd, uint32_t fields)
+  {
+    int length = snprintf(_message, sizeof(_message), "{\"Epoch\":%lu", (unsigned long)wd.epoch);
+    for (size_t f = 0; f < LIVE_FIELDS && length > 0 && size_t(length) < sizeof(_message); f++)
+    {
+      if (fields & (1UL << f))
+      {
+        length += snprintf(_message + length, sizeof(_message) - length, ",\"%s\":%.2f", liveFields[f], value(wd, f));
+      }
+    }
+    if (length <= 0 || size_t(length) + 1 >= sizeof(_message))
+    {
+      return 0;
+    }
+    _message[length++] = '}';
+    _message[length] = '\0';
+    return length;
+  }
+
+  WebSocketsServer _ws;
+  liveSubscriber _subscribers[WEBSOCKETS_SERVER_CLIENT_MAX];
+  char _message[LIVE_MESSAGE_SIZE];
+  uint32_t _messages = 0;
+};
+
+#endif
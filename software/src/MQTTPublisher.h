@@ -0,0 +1,182 @@
+#ifndef MQTTPublisher_h
+#define MQTTPublisher_h
+
+// MQTT publisher for Server Mode 2 (MQTT)
+// The measuring values of one calculation cycle are published once as batch, either as one JSON
+// message on <prefix>/data or as one message per value on <prefix>/<name>. QoS 0, retain is optional.
+// The connection is handled in handle() without waiting: a lost broker is retried with a growing
+// pause (MQTT_RETRY_MIN...MQTT_RETRY_MAX) and the connect itself is limited to MQTT_CONNECT_TIMEOUT.
+// The measuring runs in timers / tasks and is not stopped by the loop.
+
+#include <PubSubClient.h>
+
+#define MQTT_BUFFER_SIZE 512                // Max MQTT packet size in [Byte] (JSON message)
+#define MQTT_CONNECT_TIMEOUT 1000           // Timeout in [ms] for TCP connect to the broker
+#define MQTT_RETRY_MIN 1000                 // First pause in [ms] after a failed connect
+#define MQTT_RETRY_MAX 60000                // Max pause in [ms] between connects
+#define MQTT_FORMAT_JSON 0                  // One JSON message per calculation cycle
+#define MQTT_FORMAT_FIELDS 1                // One message per measuring value
+
+// One published measuring value
+typedef struct {
+  const char *name;                         // Topic name below the prefix and JSON key
+  float value;                              // Value
+  uint8_t decimals;                         // Number of decimals
+} mqttValue;
+
+class MQTTPublisher
+{
+public:
+  MQTTPublisher() : _mqtt(_client) {}
+
+  // Set broker and topic from configuration, the connect is done in handle()
+  void begin(const char *host, int port, const char *prefix, const char *clientid)
+  {
+    _mqtt.disconnect();
+    _host = host;
+    _port = uint16_t(port);
+    _prefix = prefix;
+    _clientid = clientid;
+    _mqtt.setServer(_host, _port);
+    _mqtt.setBufferSize(MQTT_BUFFER_SIZE);
+    _mqtt.setSocketTimeout(MQTT_CONNECT_TIMEOUT / 1000);
+    _retry = 0;
+    _pause = 0;
+    _epoch = 0;
+  }
+
+  // Keep the connection alive and reconnect without waiting (call in loop)
+  void handle()
+  {
+    if (_host == nullptr || _host[0] == '\0' || WiFi.status() != WL_CONNECTED)
+    {
+      return;
+    }
+    if (_mqtt.connected())
+    {
+      _mqtt.loop();
+      return;
+    }
+    if (_retry != 0 && millis() - _retry < _pause)
+    {
+      return;
+    }
+    connect();
+  }
+
+  // Publish the measuring values of one calculation cycle, only once per epoch
+  // format = MQTT_FORMAT_JSON or MQTT_FORMAT_FIELDS
+  bool publish(const WindSnapshot &wd, int format, bool retain)
+  {
+    if (!_mqtt.connected() || wd.epoch == 0 || wd.epoch == _epoch)
+    {
+      return false;
+    }
+    _epoch = wd.epoch;
+
+    const mqttValue values[] = {
+      {"windspeed_mps", wd.windspeed_mps, 2},
+      {"windspeed_kn", wd.windspeed_kn, 2},
+      {"windspeed_kph", wd.windspeed_kph, 2},
+      {"windspeed_bft", float(wd.windspeed_bft), 0},
+      {"winddirection", wd.winddirection, 1},
+      {"temperature", wd.temperature, 1},
+      {"airtemperature", wd.airtemperature, 1},
+      {"airpressure", wd.airpressure, 1},
+      {"airhumidity", wd.airhumidity, 1},
+      {"dewpoint", wd.dewpoint, 1},
+      {"quality", wd.quality, 0},
+    };
+    const size_t count = sizeof(values) / sizeof(values[0]);
+    char topic[64];
+    char payload[MQTT_BUFFER_SIZE - 96];
+    bool ok = true;
+
+    if (format == MQTT_FORMAT_FIELDS)
+    {
+      // All messages are written before the next loop, Nagle puts them into a few TCP segments
+      _client.setNoDelay(false);
+      for (size_t i = 0; i < count; i++)
+      {
+        snprintf(topic, sizeof(topic), "%s/%s", _prefix, values[i].name);
+        snprintf(payload, sizeof(payload), "%.*f", values[i].decimals, values[i].value);
+        ok &= _mqtt.publish(topic, payload, retain);
+      }
+      snprintf(topic, sizeof(topic), "%s/epoch", _prefix);
+      snprintf(payload, sizeof(payload), "%lu", (unsigned long)wd.epoch);
+      ok &= _mqtt.publish(topic, payload, retain);
+    }
+    else
+    {
+      size_t length = snprintf(payload, sizeof(payload), "{\"epoch\":%lu", (unsigned long)wd.epoch);
+      for (size_t i = 0; i < count && length < sizeof(payload); i++)
+      {
+        length += snprintf(payload + length, sizeof(payload) - length, ",\"%s\":%.*f",
+                           values[i].name, values[i].decimals, values[i].value);
+      }
+      if (length + 1 < sizeof(payload))
+      {
+        payload[length++] = '}';
+        payload[length] = '\0';
+      }
+      snprintf(topic, sizeof(topic), "%s/data", _prefix);
+      ok = _mqtt.publish(topic, payload, retain);
+    }
+
+    if (ok)
+    {
+      _batches++;
+    }
+    else
+    {
+      _errors++;
+    }
+    return ok;
+  }
+
+  bool connected() { return _mqtt.connected(); }
+  uint32_t batches() const { return _batches; }             // Published batches since start
+  uint32_t errors() const { return _errors; }               // Batches with failed publish
+  uint32_t reconnects() const { return _reconnects; }       // Successful connects since start
+
+private:
+  void connect()
+  {
+    DebugPrint(3, "MQTT connect to: ");
+    DebugPrint(3, _host);
+    DebugPrint(3, ":");
+    DebugPrintln(3, _port);
+    _retry = millis();
+    _client.setTimeout(MQTT_CONNECT_TIMEOUT);
+    char topic[64];
+    snprintf(topic, sizeof(topic), "%s/status", _prefix);
+    // Last will: the broker sets the status offline if the sensor is lost
+    if (_mqtt.connect(_clientid, topic, 0, true, "offline"))
+    {
+      _mqtt.publish(topic, "online", true);
+      _pause = 0;
+      _retry = 0;
+      _reconnects++;
+      DebugPrintln(3, "MQTT connected");
+      return;
+    }
+    _pause = (_pause == 0) ? MQTT_RETRY_MIN : min(_pause * 2, (unsigned long)MQTT_RETRY_MAX);
+    DebugPrint(2, "MQTT connect failed, state: ");
+    DebugPrintln(2, _mqtt.state());
+  }
+
+  WiFiClient _client;
+  PubSubClient _mqtt;
+  const char *_host = nullptr;
+  uint16_t _port = 1883;
+  const char *_prefix = "windsensor";
+  const char *_clientid = "windsensor";
+  unsigned long _retry = 0;                 // Time in [ms] of the last failed connect, 0 = connect now
+  unsigned long _pause = 0;                 // Pause in [ms] before the next connect
+  uint32_t _epoch = 0;                      // Epoch of the last published values
+  uint32_t _batches = 0;
+  uint32_t _errors = 0;
+  uint32_t _reconnects = 0;
+};
+
+#endif
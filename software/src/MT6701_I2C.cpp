@@ -29,26 +29,11 @@ MT6701I2C::MT6701I2C(TwoWire* _twi) : _wire_(_twi ? _twi : &Wire) {
  * @param _reg_addr: 1 байт адреса регистра
  * @return: значение байта из регистра, который был запрошен
  * @note: использовать для одиночного регистра, например 0x29
+ * @note: one transaction with repeated start over the shared I2C transport, 0 on bus error
  */
 uint8_t MT6701I2C::MT_RequestSingleRegister(uint8_t _reg_addr) {
   uint8_t single_byte = 0;
-
-  // Начать передачу по адресу
-  _wire_->beginTransmission(MT6701_I2C_ADDRESS);
-  // Отправить байт регистра
-  _wire_->write(_reg_addr);
-  // Завершить соединение
-  _wire_->endTransmission();
-  
-  // Запросить байт данных по адресу
-  _wire_->requestFrom(MT6701_I2C_ADDRESS, (uint8_t)1);
-  // Прочитать данные из буфера
-  if (_wire_->available() >= 1 ) {
-    single_byte = _wire_->read();
-  }
-  // Завершить соединение
-  _wire_->endTransmission();
-
+  i2cBus.read(MT6701_I2C_ADDRESS, _reg_addr, &single_byte, 1);
   return single_byte;
 }
 /*
@@ -57,12 +42,7 @@ uint8_t MT6701I2C::MT_RequestSingleRegister(uint8_t _reg_addr) {
  * @param _payload: 1 байт полезных данных
  */
 void MT6701I2C::MT_WriteOneByte(uint8_t _reg_addr, uint8_t _payload) {
-  // Начать передачу по адресу для прередачи байта данных в регистр
-  _wire_->beginTransmission(MT6701_I2C_ADDRESS);
-  _wire_->write(_reg_addr);
-  _wire_->write(_payload);
-  // Завершить соединение
-  _wire_->endTransmission();
+  i2cBus.write(MT6701_I2C_ADDRESS, _reg_addr, _payload);
 }
 
 // ########## PUBLIC ##########
@@ -161,9 +141,22 @@ void MT6701I2C::enableUVWorABZ(void) {
  *  0 - 16383
  */
 word MT6701I2C::getRawAngle(void) {
-  uint8_t high_byte = MT_RequestSingleRegister(MT6701_I2C_ANGLE_DATA_REG_H);
-  uint8_t low_byte = MT_RequestSingleRegister(MT6701_I2C_ANGLE_DATA_REG_L);
-  return (word)(high_byte << 6) | (low_byte >> 2);
+  word angle = 0;
+  readRawAngle(angle);
+  return angle;
+}
+/* 
+ * @brief: read Angle Data Register(13:0) with one burst read of 0x03 and 0x04
+ * @param _angle: 0 - 16383, not changed on bus error
+ * @return: true if the angle is read
+ */
+bool MT6701I2C::readRawAngle(word &_angle) {
+  uint8_t data[2];
+  if (!i2cBus.read(MT6701_I2C_ADDRESS, MT6701_I2C_ANGLE_DATA_REG_H, data, 2)) {
+    return false;
+  }
+  _angle = (word)(data[0] << 6) | (data[1] >> 2);
+  return true;
 }
 /* 
  * @brief: получить значение угла в градусах
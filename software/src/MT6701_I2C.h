@@ -17,6 +17,7 @@
 #pragma once
 #include "Arduino.h"
 #include "Wire.h"
+#include "I2CBus.h"
 
 /*=== Настройки шины I2C датчика ===*/
 const uint32_t MT6701_I2C_CLOCK_100KHZ = 100000;
@@ -160,6 +161,7 @@ class MT6701I2C {
     void enableUVWorABZ(void); // Включить интерфейс UVW/ABZ. MT6701I2C_MODE_UVW_ABZ
 
     word getRawAngle(void); // Получить угол в чистом виде. 0 - 16383
+    bool readRawAngle(word &_angle); // Angle 0 - 16383 with one burst read, false on bus error
     float getDegreesAngle(void); // Получить угол в градусах. 0.00 - 359.98
     float getRadiansAngle(void); // Получить угол в радианах. 0.00 - 6.28 
 
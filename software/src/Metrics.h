@@ -0,0 +1,115 @@
+#ifndef Metrics_h
+#define Metrics_h
+
+// Counters for the monitoring endpoint /metrics (Prometheus text format, see metrics_html.h)
+// The counters are only incremented, Prometheus calculates rates from the differences between two scrapes.
+
+// Routes of the web server with request counter, the paths are in httpRoutes[]
+enum HttpRoute {
+  HTTP_ROUTE_ROOT,
+  HTTP_ROUTE_SETTINGS,
+  HTTP_ROUTE_RESTART,
+  HTTP_ROUTE_FIRMWARE,
+  HTTP_ROUTE_DEVINFO,
+  HTTP_ROUTE_WINDV,
+  HTTP_ROUTE_WINDI,
+  HTTP_ROUTE_FAVICON,
+  HTTP_ROUTE_CSS,
+  HTTP_ROUTE_ASSET,
+  HTTP_ROUTE_JSON,
+  HTTP_ROUTE_EVENTS,
+  HTTP_ROUTE_JSON2,
+  HTTP_ROUTE_METRICS,
+  HTTP_ROUTE_HISTORY,
+  HTTP_ROUTE_NOTFOUND,
+  HTTP_ROUTE_COUNT
+};
+
+const char *const httpRoutes[HTTP_ROUTE_COUNT] = {
+  "/", "/settings", "/restart", "/firmware", "/devinfo", "/windv", "/windi", "/favicon.ico", "/css", "assets",
+  "/json", "/events", "/json2", "/metrics", "/history", "other"
+};
+
+// Outputs of the NMEA frame, the names are in nmeaSinks[]
+enum NmeaSink {
+  NMEA_SINK_TCP,
+  NMEA_SINK_UDP,
+  NMEA_SINK_SERIAL,
+  NMEA_SINK_COUNT
+};
+
+const char *const nmeaSinks[NMEA_SINK_COUNT] = {"tcp", "udp", "serial"};
+
+class Metrics
+{
+public:
+  // Interrupt routines, one call per edge
+  void IRAM_ATTR pulseSpeed() { _pulses[0]++; }
+  void IRAM_ATTR pulseDirection() { _pulses[1]++; }
+
+  // Interrupt rate of the last calculation cycle, called by winddata() every 500ms
+  void update()
+  {
+    unsigned long now = millis();
+    unsigned long elapsed = now - _rateTime;
+    if (elapsed == 0)
+    {
+      return;
+    }
+    for (int i = 0; i < 2; i++)
+    {
+      uint32_t pulses = _pulses[i];
+      _rate[i] = float(pulses - _ratePulses[i]) * 1000 / elapsed;
+      _ratePulses[i] = pulses;
+    }
+    _rateTime = now;
+  }
+
+  // One NMEA frame handed to an output
+  void nmea(NmeaSink sink, uint32_t sentences, uint32_t bytes)
+  {
+    _sentences[sink] += sentences;
+    _bytes[sink] += bytes;
+  }
+
+  void request(HttpRoute route) { _requests[route]++; }
+  void i2cError() { _i2cErrors++; }
+  void configSave() { _configSaves++; }
+
+  // Run time of one loop() in [us]
+  void loopTime(uint32_t us)
+  {
+    _loopSum += us;
+    _loopCount++;
+    _loopLast = us;
+  }
+
+  uint32_t pulses(int sensor) const { return _pulses[sensor]; }
+  float rate(int sensor) const { return _rate[sensor]; }
+  uint32_t sentences(int sink) const { return _sentences[sink]; }
+  uint32_t bytes(int sink) const { return _bytes[sink]; }
+  uint32_t requests(int route) const { return _requests[route]; }
+  uint32_t i2cErrors() const { return _i2cErrors; }
+  uint32_t configSaves() const { return _configSaves; }
+  uint64_t loopSum() const { return _loopSum; }
+  uint32_t loopCount() const { return _loopCount; }
+  uint32_t loopLast() const { return _loopLast; }
+
+private:
+  volatile uint32_t _pulses[2] = {0, 0};          // Edges of wind speed and wind direction sensor since start
+  uint32_t _ratePulses[2] = {0, 0};               // Edges at the last rate calculation
+  unsigned long _rateTime = 0;                    // Time of the last rate calculation in [ms]
+  float _rate[2] = {0, 0};                        // Interrupt rate in [Hz]
+  uint32_t _sentences[NMEA_SINK_COUNT] = {};      // NMEA sentences per output
+  uint32_t _bytes[NMEA_SINK_COUNT] = {};          // NMEA bytes per output
+  uint32_t _requests[HTTP_ROUTE_COUNT] = {};      // HTTP requests per route
+  uint32_t _i2cErrors = 0;                        // I2C sensors missing at start, failed transfers in i2cBus
+  uint32_t _configSaves = 0;                      // Configuration writes to EEPROM / NVS
+  uint64_t _loopSum = 0;                          // Sum of loop() run times in [us]
+  uint32_t _loopCount = 0;                        // Number of loop() runs
+  uint32_t _loopLast = 0;                         // Last loop() run time in [us]
+};
+
+Metrics metrics;                      // Counters for /metrics
+
+#endif
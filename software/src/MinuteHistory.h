@@ -0,0 +1,146 @@
+#ifndef MinuteHistory_h
+#define MinuteHistory_h
+
+// 1 minute aggregates of the history records for the last 24h in RAM (8 bytes per minute, 11.5 kB)
+// Fed with the 1 Hz records of HistoryRecorder, at start rebuilt from the history in LittleFS.
+// The minutes are numbered with the history time / 60, a ring entry is valid if its minute is in the last 24h.
+// The temperature is in [°C] like the records, independent of tempUnit.
+
+#include "CircularMean.h"
+
+#define MINUTE_COUNT 1440                   // Minutes in RAM (24h)
+
+// Aggregate of one minute
+typedef struct {
+  uint8_t speed;                    // Mean wind speed in [0.2 m/s]
+  uint8_t minimum;                  // Min wind speed in [0.2 m/s]
+  uint8_t maximum;                  // Max wind speed in [0.2 m/s]
+  uint8_t gust;                     // Max gust in [0.2 m/s]
+  uint8_t direction;                // Vector mean of wind direction in [360/256 °]
+  int8_t temperature;               // Mean temperature in [0.5 °C], -64...63.5 °C
+  uint16_t pressure;                // Mean air pressure in [0.1 mbar], 0 = no BME280
+} minuteAggregate;
+
+// Aggregate values in the units of the web pages
+typedef struct {
+  uint32_t time = 0;                // History time of the first second in [s]
+  float speed = 0;                  // [m/s]
+  float minimum = 0;                // [m/s]
+  float maximum = 0;                // [m/s]
+  float gust = 0;                   // [m/s]
+  float direction = 0;              // [°]
+  float temperature = 0;            // [°C]
+  float pressure = 0;               // [mbar]
+} minuteValues;
+
+class MinuteHistory
+{
+public:
+  void clear()
+  {
+    _count = 0;
+    _open = false;
+  }
+
+  // One record of the history, the minute is closed with the first record of the next minute
+  void add(const historyRecord &r)
+  {
+    uint32_t minute = r.time / 60;
+    if (_open && minute != _minute)
+    {
+      close();
+    }
+    if (!_open)
+    {
+      _open = true;
+      _minute = minute;
+      _records = 0;
+      _speed = 0;
+      _minimum = r.speed;
+      _maximum = r.speed;
+      _gust = 0;
+      _direction.clear();
+      _temperature = 0;
+      _pressure = 0;
+    }
+    _records++;
+    _speed += r.speed;
+    _minimum = min(_minimum, r.speed);
+    _maximum = max(_maximum, r.speed);
+    _gust = max(_gust, r.gust);
+    _direction.add(r.direction);
+    _temperature += r.temperature;
+    _pressure += r.pressure;
+  }
+
+  // Closed minutes: newest = last closed minute, count = valid minutes up to it
+  uint32_t newest() const { return _newest; }
+  uint32_t count() const { return _count; }
+
+  // Minute number in the ring
+  bool get(uint32_t minute, minuteValues &v) const
+  {
+    if (_count == 0 || int32_t(_newest - minute) < 0 || _newest - minute >= _count)
+    {
+      return false;
+    }
+    const minuteAggregate &a = _ring[minute % MINUTE_COUNT];
+    v.time = minute * 60;
+    v.speed = a.speed * 0.2f;
+    v.minimum = a.minimum * 0.2f;
+    v.maximum = a.maximum * 0.2f;
+    v.gust = a.gust * 0.2f;
+    v.direction = a.direction * (360.0f / 256);
+    v.temperature = a.temperature * 0.5f;
+    v.pressure = a.pressure * 0.1f;
+    return true;
+  }
+
+private:
+  void close()
+  {
+    _open = false;
+    if (_records == 0)
+    {
+      return;
+    }
+    // Ring positions of minutes without records (time jump) are invalid
+    if (_count > 0 && _minute - _newest != 1)
+    {
+      _count = 0;
+    }
+    minuteAggregate &a = _ring[_minute % MINUTE_COUNT];
+    a.speed = scale(float(_speed) / _records / 2);
+    a.minimum = scale(_minimum / 2.0f);
+    a.maximum = scale(_maximum / 2.0f);
+    a.gust = scale(_gust / 2.0f);
+    a.direction = uint8_t(lroundf(_direction.direction() * 256 / 360) & 0xff);
+    a.temperature = int8_t(constrain(lroundf(float(_temperature) / _records / 5), -128L, 127L));
+    a.pressure = uint16_t(lroundf(float(_pressure) / _records));
+    _newest = _minute;
+    _count = min(_count + 1, uint32_t(MINUTE_COUNT));
+  }
+
+  // [0.1 m/s] / 2 to [0.2 m/s]
+  static uint8_t scale(float value)
+  {
+    return uint8_t(constrain(lroundf(value), 0L, 255L));
+  }
+
+  minuteAggregate _ring[MINUTE_COUNT];
+  uint32_t _newest = 0;                     // Newest closed minute
+  uint32_t _count = 0;                      // Valid minutes up to _newest
+  // Open minute
+  bool _open = false;
+  uint32_t _minute = 0;
+  uint16_t _records = 0;
+  uint32_t _speed = 0;                      // Sums in the units of historyRecord
+  uint16_t _minimum = 0;
+  uint16_t _maximum = 0;
+  uint16_t _gust = 0;
+  CircularMean _direction;
+  int32_t _temperature = 0;
+  uint32_t _pressure = 0;
+};
+
+#endif
@@ -0,0 +1,238 @@
+#ifndef NMEAServer_h
+#define NMEAServer_h
+
+// NMEA TCP server for several clients (chartplotter, tablets, ...)
+// Every client has its own send queue. The queues are written without blocking in handle(),
+// a slow client can't stop the loop or the other clients.
+// A frame is dropped for a client if it does not fit in its queue. A client is disconnected
+// if it takes no data for NMEA_CLIENT_TIMEOUT while data are waiting.
+
+#ifdef ESP32
+  #include <lwip/sockets.h>
+#endif
+
+#ifndef NMEA_MAX_CLIENTS
+  #if defined(ESP32) || defined(NATIVE)
+    #define NMEA_MAX_CLIENTS 8              // Max number of NMEA clients (host build like ESP32)
+  #else
+    #define NMEA_MAX_CLIENTS 4              // Max number of NMEA clients (ESP8266 has only 5 TCP connections)
+  #endif
+#endif
+#define NMEA_QUEUE_SIZE 1024                // Send queue per client in [Byte] (approx. 3 frames)
+#define NMEA_CLIENT_TIMEOUT 10000           // Timeout in [ms] for a client without progress
+
+// Non-blocking write to a TCP client, returns the written bytes or -1 if the connection is broken
+// Also used by the event server (EventServer.h), inline for the host tests that include this header
+inline int writeNonBlocking(WiFiClient &client, const uint8_t *data, size_t length)
+{
+  #ifdef ESP32
+    // WiFiClient::write() waits until all data are sent, use the socket directly
+    int fd = client.fd();
+    if (fd < 0)
+    {
+      return -1;
+    }
+    int written = ::send(fd, data, length, MSG_DONTWAIT);
+    if (written < 0)
+    {
+      return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+    }
+    return written;
+  #else
+    size_t room = client.availableForWrite();
+    if (room == 0)
+    {
+      return 0;
+    }
+    return client.write(data, (length < room) ? length : room);
+  #endif
+}
+
+// NMEA client with send queue
+typedef struct {
+  WiFiClient client;
+  bool active = false;                      // Slot is used
+  uint8_t queue[NMEA_QUEUE_SIZE];           // Ring buffer for data to send
+  size_t head = 0;                          // Write position
+  size_t tail = 0;                          // Read position
+  unsigned long lastProgress = 0;           // Time in [ms] of the last successful write or connect
+  uint32_t bytes = 0;                       // Sent bytes
+  uint32_t drops = 0;                       // Dropped frames (queue full)
+} nmeaClient;
+
+class NMEAServer
+{
+public:
+  NMEAServer(WiFiServer &server) : _server(server) {}
+
+  // Start the TCP server
+  void begin()
+  {
+    _server.begin();
+    _server.setNoDelay(true);             // Each frame is written at once, no need for Nagle
+  }
+
+  // Accept new clients, send waiting data and remove dead clients (call in loop)
+  void handle()
+  {
+    accept();
+    for (int i = 0; i < NMEA_MAX_CLIENTS; i++)
+    {
+      if (_clients[i].active)
+      {
+        flush(_clients[i]);
+      }
+    }
+  }
+
+  // Put data in the send queue of all clients
+  void send(const char *data, size_t length)
+  {
+    for (int i = 0; i < NMEA_MAX_CLIENTS; i++)
+    {
+      nmeaClient &c = _clients[i];
+      if (!c.active)
+      {
+        continue;
+      }
+      if (NMEA_QUEUE_SIZE - 1 - queued(c) < length)
+      {
+        c.drops++;                          // Slow client, drop the whole frame
+        _drops++;
+        continue;
+      }
+      if (queued(c) == 0)
+      {
+        c.lastProgress = millis();          // Timeout starts with the first waiting byte
+      }
+      for (size_t n = 0; n < length; n++)
+      {
+        c.queue[c.head] = uint8_t(data[n]);
+        c.head = (c.head + 1) % NMEA_QUEUE_SIZE;
+      }
+    }
+    handle();
+  }
+
+  // Number of connected clients
+  int clients() const
+  {
+    int n = 0;
+    for (int i = 0; i < NMEA_MAX_CLIENTS; i++)
+    {
+      if (_clients[i].active)
+      {
+        n++;
+      }
+    }
+    return n;
+  }
+
+  // Client slot [0...NMEA_MAX_CLIENTS-1] for statistics
+  const nmeaClient &client(int i) const { return _clients[i]; }
+
+  uint32_t bytes() const { return _bytes; }                 // Sent bytes to all clients since start
+  uint32_t drops() const { return _drops; }                 // Dropped frames since start
+  uint32_t disconnects() const { return _disconnects; }     // Clients removed because of timeout or error
+  uint32_t rejects() const { return _rejects; }             // Clients rejected because all slots are used
+
+private:
+  void accept()
+  {
+    WiFiClient newClient = _server.accept();
+    if (!newClient)
+    {
+      return;
+    }
+    for (int i = 0; i < NMEA_MAX_CLIENTS; i++)
+    {
+      nmeaClient &c = _clients[i];
+      if (!c.active)
+      {
+        c.client = newClient;
+        c.client.setNoDelay(true);
+        c.active = true;
+        c.head = 0;
+        c.tail = 0;
+        c.bytes = 0;
+        c.drops = 0;
+        c.lastProgress = millis();
+        DebugPrint(3, "NMEA client connected: ");
+        DebugPrint(3, c.client.remoteIP());
+        DebugPrint(3, " Slot: ");
+        DebugPrintln(3, i);
+        return;
+      }
+    }
+    newClient.stop();
+    _rejects++;
+    DebugPrintln(2, "NMEA client rejected, all slots used");
+  }
+
+  // Bytes waiting in the queue
+  size_t queued(const nmeaClient &c) const
+  {
+    return (c.head + NMEA_QUEUE_SIZE - c.tail) % NMEA_QUEUE_SIZE;
+  }
+
+  // Write as much as possible without blocking
+  void flush(nmeaClient &c)
+  {
+    if (!c.client.connected())
+    {
+      remove(c, "closed", false);
+      return;
+    }
+    // Received data are not used, discard it
+    while (c.client.available() > 0)
+    {
+      c.client.read();
+    }
+    while (queued(c) > 0)
+    {
+      size_t length = (c.head >= c.tail) ? (c.head - c.tail) : (NMEA_QUEUE_SIZE - c.tail);
+      int written = writeNonBlocking(c.client, &c.queue[c.tail], length);
+      if (written < 0)
+      {
+        remove(c, "error", true);
+        return;
+      }
+      if (written == 0)
+      {
+        break;                              // Send buffer full, try again in next loop
+      }
+      c.tail = (c.tail + written) % NMEA_QUEUE_SIZE;
+      c.bytes += written;
+      _bytes += written;
+      c.lastProgress = millis();
+    }
+    if (queued(c) > 0 && millis() - c.lastProgress > NMEA_CLIENT_TIMEOUT)
+    {
+      remove(c, "timeout", true);
+    }
+  }
+
+  // Remove a client, dropped = true if the client was removed by the server
+  void remove(nmeaClient &c, const char *reason, bool dropped)
+  {
+    DebugPrint(3, "NMEA client disconnected: ");
+    DebugPrintln(3, reason);
+    if (dropped)
+    {
+      _disconnects++;
+    }
+    c.client.stop();
+    c.active = false;
+    c.head = 0;
+    c.tail = 0;
+  }
+
+  WiFiServer &_server;
+  nmeaClient _clients[NMEA_MAX_CLIENTS];
+  uint32_t _bytes = 0;
+  uint32_t _drops = 0;
+  uint32_t _disconnects = 0;
+  uint32_t _rejects = 0;
+};
+
+#endif
@@ -1,216 +1,259 @@
 // NMEA telegrams
-// sendmode 0 = no serial, 1 = serial active
-
-String sendMWV(int sendmode){
-  
-  String HexCheckSum;
-  String NMEAWindSpeed;
-  String SendWindSpeed;
-  
+// The telegrams are written into the buffer of the caller (size NMEA_MAX_LENGTH), return value is the length
+// All telegrams of one calculation cycle use the same snapshot of measuring values
+
+size_t sendMWV(const WindSnapshot &wd, char *buffer, size_t size){
+  PROFILE(PROBE_NMEA_MWV);
+
+  NmeaWriter nmea(buffer, size);
+
   // Create NMEA string for wind speed $WIMWV,x.x,a,x.x,a,A*hh<CR><LF>
-  NMEAWindSpeed = "WIMWV," + String(winddirection);
-  if(String(actconf.windType) == "R"){
-    NMEAWindSpeed +=  ",R,"; 
+  nmea.begin("WIMWV");
+  nmea.field(wd.winddirection);
+  if(strcmp(actconf.windType, "R") == 0){
+    nmea.field('R');
   }
   else{
-    NMEAWindSpeed +=  ",T,";
-  } 
-  if(String(actconf.speedUnit) == "kn"){
-    NMEAWindSpeed +=  String(windspeed_kn);
-    NMEAWindSpeed +=  ",N,A";
-  }  
-  if(String(actconf.speedUnit) == "m/s"){
-    NMEAWindSpeed +=  String(windspeed_mps);
-    NMEAWindSpeed +=  ",M,A";
-  }
-  if(String(actconf.speedUnit) == "km/h"){
-    NMEAWindSpeed +=  String(windspeed_kph);
-    NMEAWindSpeed +=  ",K,A";
-  }        
-  // Build CheckSum
-  HexCheckSum = String(CheckSum(NMEAWindSpeed), HEX);
-  // Build complete NMEA string
-  SendWindSpeed = "$" + NMEAWindSpeed;
-  SendWindSpeed += "*";
-  SendWindSpeed += HexCheckSum;
-  if((int(actconf.serverMode) == 1 && sendmode == 1) || (int(actconf.serverMode) == 4 && sendmode == 1) || (int(actconf.debug) >= 3 && sendmode == 1)){
-    Serial.println(SendWindSpeed);
-  }
-
-  return SendWindSpeed;
+    nmea.field('T');
+  }
+  if(strcmp(actconf.speedUnit, "kn") == 0){
+    nmea.field(wd.windspeed_kn);
+    nmea.field('N');
+    nmea.field('A');
+  }
+  if(strcmp(actconf.speedUnit, "m/s") == 0){
+    nmea.field(wd.windspeed_mps);
+    nmea.field('M');
+    nmea.field('A');
+  }
+  if(strcmp(actconf.speedUnit, "km/h") == 0){
+    nmea.field(wd.windspeed_kph);
+    nmea.field('K');
+    nmea.field('A');
+  }
+  // Build complete NMEA string with checksum
+  nmea.end();
+
+  return nmea.length();
 }
 
-String sendVWR(int sendmode){
-  
-  String HexCheckSum;
-  String NMEAWindSpeed;
-  String SendWindSpeed;
-    
-  // Create NMEA string for wind speed $WIVWR,x.x,a,x.x,N,x.x,M,x.x,K*hh<CR><LF>    
-  NMEAWindSpeed = "WIVWR," + String(winddirection2);
-  if(winddirection >= 0 && winddirection < 180){
-    NMEAWindSpeed += ",R,";
+size_t sendVWR(const WindSnapshot &wd, char *buffer, size_t size){
+  PROFILE(PROBE_NMEA_VWR);
+
+  NmeaWriter nmea(buffer, size);
+
+  // Create NMEA string for wind speed $WIVWR,x.x,a,x.x,N,x.x,M,x.x,K*hh<CR><LF>
+  nmea.begin("WIVWR");
+  nmea.field(wd.winddirection2);
+  if(wd.winddirection >= 0 && wd.winddirection < 180){
+    nmea.field('R');
   }
   else{
-    NMEAWindSpeed += ",L,";
-  }
-  NMEAWindSpeed += String(windspeed_kn);
-  NMEAWindSpeed += ",N,";
-  NMEAWindSpeed += String(windspeed_mps);
-  NMEAWindSpeed += ",M,";
-  NMEAWindSpeed += String(windspeed_kph);
-  NMEAWindSpeed += ",K";
-  // Build CheckSum
-  HexCheckSum = String(CheckSum(NMEAWindSpeed), HEX);
-  // Build complete NMEA string
-  SendWindSpeed = "$" + NMEAWindSpeed;
-  SendWindSpeed += "*";
-  SendWindSpeed += HexCheckSum;
-  if((int(actconf.serverMode) == 1 && sendmode == 1) || (int(actconf.debug) >= 3 && sendmode == 1)){
-    Serial.println(SendWindSpeed);
-  }
-
-  return SendWindSpeed;
+    nmea.field('L');
+  }
+  nmea.field(wd.windspeed_kn);
+  nmea.field('N');
+  nmea.field(wd.windspeed_mps);
+  nmea.field('M');
+  nmea.field(wd.windspeed_kph);
+  nmea.field('K');
+  // Build complete NMEA string with checksum
+  nmea.end();
+
+  return nmea.length();
 }
-  
-String sendVPW(int sendmode){
-  
-  String HexCheckSum;
-  String NMEAWindSpeed;
-  String SendWindSpeed;
-
-   if (winddirection >= (180 - float(actconf.downWindRange)) && winddirection <= (180 + float(actconf.downWindRange))){
-    downwindspeed_kn = windspeed_kn;
-    downwindspeed_mps = windspeed_mps;
+
+size_t sendVPW(const WindSnapshot &wd, char *buffer, size_t size){
+  PROFILE(PROBE_NMEA_VPW);
+
+  NmeaWriter nmea(buffer, size);
+  float downwindspeed_kn;
+  float downwindspeed_mps;
+
+   if (wd.winddirection >= (180 - float(actconf.downWindRange)) && wd.winddirection <= (180 + float(actconf.downWindRange))){
+    downwindspeed_kn = wd.windspeed_kn;
+    downwindspeed_mps = wd.windspeed_mps;
    }
    else{
     downwindspeed_kn = 0;
     downwindspeed_mps = 0;
    }
 
-  // Create NMEA string for wind speed $WIVPW,x.x,N,x.x,M*hh<CR><LF>    
-  NMEAWindSpeed = "WIVPW," + String(downwindspeed_kn);
-  NMEAWindSpeed += ",N,";
-  NMEAWindSpeed += String(downwindspeed_mps);
-  NMEAWindSpeed += ",M";
-  // Build CheckSum
-  HexCheckSum = String(CheckSum(NMEAWindSpeed), HEX);
-  // Build complete NMEA string
-  SendWindSpeed = "$" + NMEAWindSpeed;
-  SendWindSpeed += "*";
-  SendWindSpeed += HexCheckSum;
-  if((int(actconf.serverMode) == 1 && sendmode == 1) || (int(actconf.debug) >= 3 && sendmode == 1)){
-    Serial.println(SendWindSpeed);
-  }
-
-  return SendWindSpeed;
+  // Create NMEA string for wind speed $WIVPW,x.x,N,x.x,M*hh<CR><LF>
+  nmea.begin("WIVPW");
+  nmea.field(downwindspeed_kn);
+  nmea.field('N');
+  nmea.field(downwindspeed_mps);
+  nmea.field('M');
+  // Build complete NMEA string with checksum
+  nmea.end();
+
+  return nmea.length();
 }
-  
-String sendINF(int sendmode){
-  
-  String HexCheckSum;
-  String NMEAWindSpeed;
-  String SendWindSpeed;
-  
+
+size_t sendINF(const WindSnapshot &wd, char *buffer, size_t size){
+  PROFILE(PROBE_NMEA_INF);
+
+  NmeaWriter nmea(buffer, size);
+
   // Create NMEA string for wind speed $PWINF,0,x.x,D,x.x,D,x.x,M,x.x,K,x.x,N,x.x,B,A*hh<CR><LF>
-  NMEAWindSpeed = "PWINF," + String(actconf.sensorID);
-  NMEAWindSpeed +=  ",";
-  NMEAWindSpeed +=  String(winddirection);
-  NMEAWindSpeed +=  ",D,";
-  NMEAWindSpeed +=  String(dirresolution);
-  NMEAWindSpeed +=  ",D,";
-  NMEAWindSpeed +=  String(windspeed_mps);
-  NMEAWindSpeed +=  ",M,";
-  NMEAWindSpeed +=  String(windspeed_kph);
-  NMEAWindSpeed +=  ",K,";
-  NMEAWindSpeed +=  String(windspeed_kn);
-  NMEAWindSpeed +=  ",N,";
-  NMEAWindSpeed +=  String(windspeed_bft);
-  NMEAWindSpeed +=  ",B,";
-  // Build CheckSum
-  HexCheckSum = String(CheckSum(NMEAWindSpeed), HEX);
-  // Build complete NMEA string
-  SendWindSpeed = "$" + NMEAWindSpeed;
-  SendWindSpeed += "*";
-  SendWindSpeed += HexCheckSum;
-  if((int(actconf.serverMode) == 1 && sendmode == 1) || (int(actconf.debug) >= 3 && sendmode == 1)){
-    Serial.println(SendWindSpeed);
-  }
-
-  return SendWindSpeed;
+  nmea.begin("PWINF");
+  nmea.field(actconf.sensorID);
+  nmea.field(wd.winddirection);
+  nmea.field('D');
+  nmea.field(wd.dirresolution);
+  nmea.field('D');
+  nmea.field(wd.windspeed_mps);
+  nmea.field('M');
+  nmea.field(wd.windspeed_kph);
+  nmea.field('K');
+  nmea.field(wd.windspeed_kn);
+  nmea.field('N');
+  nmea.field(wd.windspeed_bft);
+  nmea.field('B');
+  nmea.field("");
+  // Build complete NMEA string with checksum
+  nmea.end();
+
+  return nmea.length();
+}
+
+// Send gust data, detected on each rotation
+size_t sendGST(const WindSnapshot &wd, char *buffer, size_t size){
+  PROFILE(PROBE_NMEA_GST);
+
+  NmeaWriter nmea(buffer, size);
+
+  // Create NMEA string for gusts $PWGST,0,x.x,x.x,x.x,x.x,M,A*hh<CR><LF>
+  // 3s gust, 10min mean, 10min max gust, 10min lull, status V = less than 10min of data
+  nmea.begin("PWGST");
+  nmea.field(actconf.sensorID);
+  nmea.field(wd.gust);
+  nmea.field(wd.mean10);
+  nmea.field(wd.gust10);
+  nmea.field(wd.lull10);
+  nmea.field('M');
+  nmea.field(wd.gustcomplete ? 'A' : 'V');
+  // Build complete NMEA string with checksum
+  nmea.end();
+
+  return nmea.length();
 }
-  
+
 // Send temperature data from DS18B20
-String sendWST(int sendmode){
-  
-  String HexCheckSum;
-  String NMEASensorTemp;
-  String SendSensorTemp;
-  
+size_t sendWST(const WindSnapshot &wd, char *buffer, size_t size){
+  PROFILE(PROBE_NMEA_WST);
+
+  NmeaWriter nmea(buffer, size);
+
   // Create NMEA string for wind sensor temperature $PWWST,C,0,x.x,A*hh<CR><LF>
-  if(String(actconf.tempUnit) == "C"){
-    NMEASensorTemp = "PWWST,C," + String(actconf.sensorID);
-    NMEASensorTemp += ",";
-    NMEASensorTemp += String(temperature);
+  nmea.begin("PWWST");
+  if(strcmp(actconf.tempUnit, "C") == 0){
+    nmea.field('C');
   }
   else{
-    NMEASensorTemp = "PWWST,F," + String(actconf.sensorID);
-    NMEASensorTemp += ",";
-    NMEASensorTemp += String(temperature);
-  }
-  NMEASensorTemp += ",A";
-  // Build CheckSum
-  HexCheckSum = String(CheckSum(NMEASensorTemp), HEX);
-  // Build complete NMEA string
-  SendSensorTemp = "$" + NMEASensorTemp;
-  SendSensorTemp += "*";
-  SendSensorTemp += HexCheckSum;
-  if((int(actconf.serverMode) == 1 && sendmode == 1) || (int(actconf.debug) >= 3 && sendmode == 1)){
-    Serial.println(SendSensorTemp);
-  }
-  
-  return SendSensorTemp;
+    nmea.field('F');
+  }
+  nmea.field(actconf.sensorID);
+  nmea.field(wd.temperature);
+  nmea.field('A');
+  // Build complete NMEA string with checksum
+  nmea.end();
+
+  return nmea.length();
 }
 
 // Send environment data from BME280
-String sendWSE(int sendmode){
-  
-  String HexCheckSum;
-  String NMEAWSE;
-  String SendWSE;
-  
+size_t sendWSE(const WindSnapshot &wd, char *buffer, size_t size){
+  PROFILE(PROBE_NMEA_WSE);
+
+  NmeaWriter nmea(buffer, size);
+  char tunit = (strcmp(actconf.tempUnit, "C") == 0) ? 'C' : 'K';
+
   // Create NMEA string for wind speed $PWWSE,0,x.x,C,x.x,B,x.x,P,x.x,C,x.x,M,A*hh<CR><LF>
-  NMEAWSE = "PWWSE," + String(actconf.sensorID);
-  NMEAWSE +=  ",";
-  NMEAWSE +=  String(airtemperature);
-  if(String(actconf.tempUnit) == "C"){
-    NMEAWSE +=  ",C,";
+  nmea.begin("PWWSE");
+  nmea.field(actconf.sensorID);
+  nmea.field(wd.airtemperature);
+  nmea.field(tunit);
+  nmea.field(wd.airpressure);
+  nmea.field('B');
+  nmea.field(wd.airhumidity);
+  nmea.field('P');
+  nmea.field(wd.dewpoint);
+  nmea.field(tunit);
+  nmea.field(wd.altitude);
+  nmea.field('M');
+  nmea.field("");
+  // Build complete NMEA string with checksum
+  nmea.end();
+
+  return nmea.length();
+}
+
+// Render all telegrams of the actual calculation cycle into the NMEA frame
+// The frame is only rendered once per calculation cycle and then reused by all outputs
+const nmeaFrame &NMEAFrame(){
+  WindSnapshot wd;
+  uint32_t epoch = windData.read(wd);
+
+  if(nmeaframe.epoch == epoch && nmeaframe.length > 0){
+    return nmeaframe;
   }
-  else{
-    NMEAWSE +=  ",K,";
+
+  size_t length = 0;
+  uint32_t sentences = 0;
+  // Append one telegram with <CR><LF>
+  auto append = [&length, &sentences, &wd](size_t (*send)(const WindSnapshot&, char*, size_t)){
+    if(NMEA_FRAME_SIZE - length < NMEA_MAX_LENGTH){
+      return;
+    }
+    length += send(wd, nmeaframe.data + length, NMEA_MAX_LENGTH - 2);
+    nmeaframe.data[length++] = '\r';
+    nmeaframe.data[length++] = '\n';
+    sentences++;
+  };
+
+  if(int(actconf.windSensor) == 1){
+    append(sendMWV);
+    append(sendVWR);
+    append(sendVPW);
+    append(sendINF);
+    if(int(actconf.gustData) == 1){
+      append(sendGST);
+    }
   }
-  NMEAWSE +=  String(airpressure);
-  NMEAWSE +=  ",B,";
-  NMEAWSE +=  String(airhumidity);
-  NMEAWSE +=  ",P,";
-  NMEAWSE +=  String(dewpoint);
-  if(String(actconf.tempUnit) == "C"){
-    NMEAWSE +=  ",C,";
+  if(int(actconf.tempSensor) == 1){
+    if(strcmp(actconf.tempSensorType, "DS18B20") == 0){
+      append(sendWST);
+    }
+    if(strcmp(actconf.tempSensorType, "BME280") == 0){
+      append(sendWSE);
+    }
   }
-  else{
-    NMEAWSE +=  ",K,";
+  nmeaframe.length = length;
+  nmeaframe.sentences = sentences;
+  nmeaframe.epoch = epoch;
+
+  return nmeaframe;
+}
+
+// Send the NMEA frame of the actual calculation cycle to all outputs, each output with one write
+// tcp = nullptr if the NMEA TCP server is not used, udp = nullptr if the NMEA UDP output is not used
+void sendNMEAFrame(NMEAServer *tcp, NMEAUdp *udp){
+  const nmeaFrame &frame = NMEAFrame();
+  if(frame.length == 0){
+    return;
   }
-  NMEAWSE +=  String(altitude);
-  NMEAWSE +=  ",M,";
-  // Build CheckSum
-  HexCheckSum = String(CheckSum(NMEAWSE), HEX);
-  // Build complete NMEA string
-  SendWSE = "$" + NMEAWSE;
-  SendWSE += "*";
-  SendWSE += HexCheckSum;
-  if((int(actconf.serverMode) == 1 && sendmode == 1) || (int(actconf.debug) >= 3 && sendmode == 1)){
-    Serial.println(SendWSE);
+  if(tcp != nullptr){
+    tcp->send(frame.data, frame.length);
+    metrics.nmea(NMEA_SINK_TCP, frame.sentences, frame.length);
+  }
+  if(udp != nullptr){
+    udp->send(frame.data, frame.length);
+    metrics.nmea(NMEA_SINK_UDP, frame.sentences, frame.length);
+  }
+  if(int(actconf.serverMode) == 1 || int(actconf.serverMode) == 4 || int(actconf.debug) >= 3){
+    Serial.write((const uint8_t*)frame.data, frame.length);
+    metrics.nmea(NMEA_SINK_SERIAL, frame.sentences, frame.length);
   }
-
-  return SendWSE;
 }
@@ -0,0 +1,129 @@
+#ifndef NMEAUdp_h
+#define NMEAUdp_h
+
+// NMEA UDP output for navigation apps (OpenCPN, AvNav, iNavX, ...) listening on a UDP port (default 10110)
+// The NMEA frame of one calculation cycle is sent as one datagram, independent of the NMEA TCP server.
+// Mode 1 = broadcast: 255.255.255.255 is sent as subnet broadcast in the client network and in the access point network
+// Mode 2 = multicast (224.0.0.0...239.255.255.255) or unicast to the configured address
+
+#include <WiFiUdp.h>
+
+#define NMEA_UDP_TTL 1                      // Multicast TTL, only the local network
+
+class NMEAUdp
+{
+public:
+  // Set destination from configuration, mode 0 = off
+  // With an invalid address or port nothing is sent, each frame is counted in errors()
+  void begin(int mode, const char *address, int port)
+  {
+    _mode = mode;
+    _port = uint16_t(port);
+    _valid = true;
+    if (_mode != 0 && !_address.fromString(address))
+    {
+      DebugPrint(1, "NMEA UDP address not valid: ");
+      DebugPrintln(1, address);
+      _valid = false;
+    }
+    if (_mode != 0 && _port == 0)
+    {
+      DebugPrintln(1, "NMEA UDP port not valid");
+      _valid = false;
+    }
+    if (_mode != 0 && _valid)
+    {
+      DebugPrint(3, "NMEA UDP output to: ");
+      DebugPrint(3, _address);
+      DebugPrint(3, ":");
+      DebugPrintln(3, _port);
+    }
+  }
+
+  // UDP output is used
+  bool active() const { return _mode != 0; }
+
+  // Send data as one datagram to the destination
+  void send(const char *data, size_t length)
+  {
+    if (_mode == 0)
+    {
+      return;
+    }
+    if (!_valid)
+    {
+      _errors++;
+      return;
+    }
+    if (_mode == 1 && _address == IPAddress(255, 255, 255, 255))
+    {
+      // Directed broadcast in each active network, the limited broadcast leaves only the default interface
+      if (WiFi.status() == WL_CONNECTED)
+      {
+        datagram(broadcast(WiFi.localIP(), WiFi.subnetMask()), data, length);
+      }
+      if (WiFi.softAPgetStationNum() > 0)
+      {
+        datagram(broadcast(WiFi.softAPIP(), IPAddress(255, 255, 255, 0)), data, length);
+      }
+      return;
+    }
+    datagram(_address, data, length);
+  }
+
+  uint32_t packets() const { return _packets; }             // Sent datagrams since start
+  uint32_t errors() const { return _errors; }               // Datagrams not sent (invalid address, no buffer, no route)
+
+private:
+  // Broadcast address of a network
+  static IPAddress broadcast(IPAddress ip, IPAddress mask)
+  {
+    return IPAddress(uint32_t(ip) | ~uint32_t(mask));
+  }
+
+  // Multicast address range 224.0.0.0...239.255.255.255
+  static bool multicast(IPAddress ip)
+  {
+    return ip[0] >= 224 && ip[0] <= 239;
+  }
+
+  void datagram(IPAddress ip, const char *data, size_t length)
+  {
+    int ok;
+    #ifdef ESP8266
+      if (multicast(ip))
+      {
+        ok = _udp.beginPacketMulticast(ip, _port, WiFi.localIP(), NMEA_UDP_TTL);
+      }
+      else
+      {
+        ok = _udp.beginPacket(ip, _port);
+      }
+    #else
+      ok = _udp.beginPacket(ip, _port);     // lwIP sends multicast over the default interface
+    #endif
+    if (ok)
+    {
+      _udp.write((const uint8_t*)data, length);
+      ok = _udp.endPacket();
+    }
+    if (ok)
+    {
+      _packets++;
+    }
+    else
+    {
+      _errors++;
+    }
+  }
+
+  WiFiUDP _udp;
+  int _mode = 0;
+  bool _valid = false;                      // Address and port of the configuration are valid
+  IPAddress _address;
+  uint16_t _port = 0;
+  uint32_t _packets = 0;
+  uint32_t _errors = 0;
+};
+
+#endif
@@ -0,0 +1,180 @@
+#ifndef NmeaWriter_h
+#define NmeaWriter_h
+
+// NMEA sentence builder without heap allocation
+// Writes into a buffer of the caller, floats are formatted with integer fixed-point arithmetic
+// The XOR checksum is calculated while writing, output $<sentence>*HH (no <CR><LF>)
+//
+// Example: $WIMWV,123.45,R,12.30,N,A*hh
+//   NmeaWriter nmea(buffer, sizeof(buffer));
+//   nmea.begin("WIMWV");
+//   nmea.field(123.45f); nmea.field('R'); nmea.field(12.3f); nmea.field('N'); nmea.field('A');
+//   nmea.end();
+
+#include <math.h>
+
+#define NMEA_MAX_LENGTH 96            // Buffer size for one sentence (NMEA limit 82 characters with <CR><LF>)
+#define NMEA_FRAME_SIZE (6 * NMEA_MAX_LENGTH) // Buffer size for all sentences of one calculation cycle
+
+// All NMEA sentences of one calculation cycle, each with <CR><LF>
+typedef struct {
+  uint32_t epoch = 0;                 // Epoch of the measuring values (see WindSnapshot.h), 0 = empty
+  size_t length = 0;                  // Length of data
+  uint32_t sentences = 0;             // Number of sentences
+  char data[NMEA_FRAME_SIZE];         // Sentences
+} nmeaFrame;
+
+class NmeaWriter
+{
+public:
+  NmeaWriter(char *buffer, size_t size) : _buffer(buffer), _size(size)
+  {
+    reset();
+  }
+
+  // Clear the buffer
+  void reset()
+  {
+    _length = 0;
+    _checksum = 0;
+    _overflow = false;
+    if (_size > 0)
+    {
+      _buffer[0] = '\0';
+    }
+  }
+
+  // Start a sentence with the address field (talker + type, e.g. "WIMWV")
+  void begin(const char *address)
+  {
+    reset();
+    put('$', false);
+    text(address);
+  }
+
+  // Text field
+  void field(const char *value)
+  {
+    put(',');
+    text(value);
+  }
+
+  // Single character field (units, status)
+  void field(char value)
+  {
+    put(',');
+    put(value);
+  }
+
+  // Integer field
+  void field(int value)
+  {
+    put(',');
+    number(value);
+  }
+
+  // Float field with fixed number of decimals [0...4], empty field if the value is not valid
+  void field(float value, uint8_t decimals = 2)
+  {
+    static const int32_t scale[5] = {1, 10, 100, 1000, 10000};
+    put(',');
+    if (decimals > 4)
+    {
+      decimals = 4;
+    }
+    if (isnan(value) || isinf(value) || fabsf(value) > 200000.0f)
+    {
+      return;                           // NMEA null field
+    }
+    int32_t fixed = lroundf(value * scale[decimals]);
+    if (fixed < 0)
+    {
+      put('-');
+      fixed = -fixed;
+    }
+    number(fixed / scale[decimals]);
+    if (decimals > 0)
+    {
+      put('.');
+      int32_t fraction = fixed % scale[decimals];
+      for (int32_t div = scale[decimals] / 10; div > 0; div /= 10)
+      {
+        put('0' + (fraction / div) % 10);
+      }
+    }
+  }
+
+  // Finish the sentence with *HH and return the length
+  size_t end()
+  {
+    static const char hex[] = "0123456789ABCDEF";
+    uint8_t checksum = _checksum;
+    put('*', false);
+    put(hex[checksum >> 4], false);
+    put(hex[checksum & 0x0F], false);
+    return _length;
+  }
+
+  const char *c_str() const { return _buffer; }
+  size_t length() const { return _length; }
+  uint8_t checksum() const { return _checksum; }
+  bool overflow() const { return _overflow; }
+
+private:
+  // Append one character, the terminating zero is always kept
+  inline void put(char c, bool sum = true)
+  {
+    if (_length + 1 >= _size)
+    {
+      _overflow = true;
+      return;
+    }
+    _buffer[_length++] = c;
+    _buffer[_length] = '\0';
+    if (sum)
+    {
+      _checksum ^= uint8_t(c);
+    }
+  }
+
+  void text(const char *value)
+  {
+    while (*value)
+    {
+      put(*value++);
+    }
+  }
+
+  void number(int32_t value)
+  {
+    char digits[11];
+    uint8_t n = 0;
+    uint32_t v;
+    if (value < 0)
+    {
+      put('-');
+      v = uint32_t(-(value + 1)) + 1;
+    }
+    else
+    {
+      v = uint32_t(value);
+    }
+    do
+    {
+      digits[n++] = '0' + (v % 10);
+      v /= 10;
+    } while (v > 0);
+    while (n > 0)
+    {
+      put(digits[--n]);
+    }
+  }
+
+  char *_buffer;
+  size_t _size;
+  size_t _length;
+  uint8_t _checksum;
+  bool _overflow;
+};
+
+#endif
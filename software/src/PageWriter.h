@@ -0,0 +1,206 @@
+#ifndef PageWriter_h
+#define PageWriter_h
+
+// Streaming output of the web pages with chunked transfer encoding
+// The page is collected in one chunk buffer of PAGE_CHUNK bytes and sent chunk by chunk, the buffer is the only
+// heap memory of a page. The HTTP header is sent with the first chunk.
+// Static text comes from the flash: F() strings or templates in PROGMEM. A template is the page text with
+// placeholders {{name}}. For each placeholder the fill function is called, it writes the dynamic part:
+//
+//   static const char page[] PROGMEM = R"html(<h2>{{devname}}</h2>)html";
+//   content.render(page, [](PageWriter &w, const char *name) {
+//     if (strcmp(name, "devname") == 0) w += actconf.devname;
+//   });
+
+#include <new>
+#include <type_traits>
+
+#define PAGE_CHUNK 1024                     // Chunk buffer in [Byte]
+#define PAGE_PLACEHOLDER 24                 // Max length of a placeholder name
+
+class PageWriter
+{
+public:
+  // Output of the chunks, type is set only for the first chunk (send the HTTP header first)
+  typedef void (*Sink)(void *context, const char *type, const char *data, size_t length);
+
+  template <typename Server>
+  explicit PageWriter(Server &server, const char *type = "text/html")
+    : _sink(serverSink<Server>), _context(&server), _type(type) {}
+
+  PageWriter(Sink sink, void *context, const char *type = "text/html")
+    : _sink(sink), _context(context), _type(type) {}
+
+  ~PageWriter() { end(); }
+
+  PageWriter(const PageWriter &) = delete;
+  PageWriter &operator=(const PageWriter &) = delete;
+
+  PageWriter &operator+=(const __FlashStringHelper *text)
+  {
+    PGM_P p = reinterpret_cast<PGM_P>(text);
+    append(p, strlen_P(p), true);
+    return *this;
+  }
+
+  PageWriter &operator+=(const char *text)
+  {
+    append(text, strlen(text), false);
+    return *this;
+  }
+
+  PageWriter &operator+=(const String &text)
+  {
+    append(text.c_str(), text.length(), false);
+    return *this;
+  }
+
+  PageWriter &operator+=(char c)
+  {
+    append(&c, 1, false);
+    return *this;
+  }
+
+  // Numbers formatted like String (short, without heap memory)
+  template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+  PageWriter &operator+=(T value)
+  {
+    return *this += String(value);
+  }
+
+  // Template in PROGMEM with placeholders {{name}}, fill(PageWriter &, const char *name) writes the values
+  template <typename F>
+  void render(PGM_P text, F fill)
+  {
+    PGM_P run = text;                       // Start of the static text before the next placeholder
+    PGM_P p = text;
+    char c;
+    while ((c = pgm_read_byte(p)) != 0)
+    {
+      if (c == '{' && pgm_read_byte(p + 1) == '{')
+      {
+        char name[PAGE_PLACEHOLDER];
+        size_t n = 0;
+        PGM_P q = p + 2;
+        char d;
+        while ((d = pgm_read_byte(q)) != 0 && d != '}' && n < sizeof(name) - 1)
+        {
+          name[n++] = d;
+          q++;
+        }
+        if (d == '}' && pgm_read_byte(q + 1) == '}')
+        {
+          append(run, p - run, true);
+          name[n] = 0;
+          fill(*this, name);
+          p = q + 2;
+          run = p;
+          continue;
+        }
+      }
+      p++;
+    }
+    append(run, p - run, true);
+  }
+
+  // Send the rest of the buffer, the last chunk is sent by the web server after the handler
+  void end()
+  {
+    flush();
+    delete[] _buffer;
+    _buffer = nullptr;
+  }
+
+  uint32_t bytes() const { return _bytes; }   // Page length in [Byte]
+
+private:
+  template <typename Server>
+  static void serverSink(void *context, const char *type, const char *data, size_t length)
+  {
+    Server &server = *static_cast<Server *>(context);
+    if (type)
+    {
+      server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+      server.sendHeader("Cache-Control", "no-cache");
+      server.send(200, type, "");
+    }
+    if (length > 0)
+    {
+      server.sendContent(data, length);
+    }
+  }
+
+  void append(const char *data, size_t length, bool progmem)
+  {
+    _bytes += length;
+    if (!_buffer && length > 0)
+    {
+      _buffer = new (std::nothrow) char[PAGE_CHUNK];
+      if (!_buffer)
+      {
+        output(data, length, progmem);      // No heap memory, send unbuffered
+        return;
+      }
+    }
+    while (length > 0)
+    {
+      if (_length == PAGE_CHUNK)
+      {
+        flush();
+      }
+      size_t n = min(length, size_t(PAGE_CHUNK - _length));
+      if (progmem)
+      {
+        memcpy_P(_buffer + _length, data, n);
+      }
+      else
+      {
+        memcpy(_buffer + _length, data, n);
+      }
+      _length += n;
+      data += n;
+      length -= n;
+    }
+  }
+
+  // Unbuffered output of flash text in small parts
+  void output(const char *data, size_t length, bool progmem)
+  {
+    char part[64];
+    while (length > 0)
+    {
+      size_t n = min(length, sizeof(part));
+      if (progmem)
+      {
+        memcpy_P(part, data, n);
+      }
+      else
+      {
+        memcpy(part, data, n);
+      }
+      _sink(_context, _type, part, n);
+      _type = nullptr;
+      data += n;
+      length -= n;
+    }
+  }
+
+  void flush()
+  {
+    if (_type || _length > 0)
+    {
+      _sink(_context, _type, _buffer, _length);
+      _type = nullptr;
+      _length = 0;
+    }
+  }
+
+  Sink _sink;
+  void *_context;
+  const char *_type;                        // Content type, nullptr after the header is sent
+  char *_buffer = nullptr;                  // Chunk buffer, allocated with the first text
+  size_t _length = 0;                       // Used bytes of the buffer
+  uint32_t _bytes = 0;
+};
+
+#endif
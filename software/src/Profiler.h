@@ -0,0 +1,219 @@
+#ifndef Profiler_h
+#define Profiler_h
+
+// Cycle counting probes for the run time of interrupt routines, timer routines, NMEA sentences, HTTP handlers and loop()
+// Only active with the build flag -D PROFILING=1, otherwise the macros are empty and nothing is compiled in.
+//
+//   void buildaverage() {
+//     PROFILE(PROBE_BUILDAVERAGE);       // Measures until the end of the scope
+//     ...
+//   }
+//
+// Each probe keeps count, min, max, sum and a histogram with 2 buckets per power of two (p99 with max 41% error).
+// The probes are served as JSON on /metrics/profile with chunked sends, without heap allocation.
+
+#ifndef PROFILING
+  #define PROFILING 0
+#endif
+
+// Probe numbers, the names are in probeNames[]
+enum ProbeID {
+  PROBE_ISR_SPEED,                    // interruptRoutine1()
+  PROBE_ISR_DIRECTION,                // interruptRoutine2()
+  PROBE_BUILDAVERAGE,                 // buildaverage() Timer2
+  PROBE_CALCULATION,                  // calculationData() Timer5
+  PROBE_SIMULATION,                   // simulationData() Timer5 in Demo Mode
+  PROBE_NMEA_MWV,                     // NMEA sentences
+  PROBE_NMEA_VWR,
+  PROBE_NMEA_VPW,
+  PROBE_NMEA_INF,
+  PROBE_NMEA_GST,
+  PROBE_NMEA_WST,
+  PROBE_NMEA_WSE,
+  PROBE_HTTP_ROOT,                    // HTTP handlers in ServerPages.h
+  PROBE_HTTP_SETTINGS,
+  PROBE_HTTP_RESTART,
+  PROBE_HTTP_FIRMWARE,
+  PROBE_HTTP_DEVINFO,
+  PROBE_HTTP_WINDV,
+  PROBE_HTTP_WINDI,
+  PROBE_HTTP_FAVICON,
+  PROBE_HTTP_CSS,
+  PROBE_HTTP_ASSET,
+  PROBE_HTTP_JSON,
+  PROBE_HTTP_EVENTS,
+  PROBE_HTTP_JSON2,
+  PROBE_HTTP_METRICS,
+  PROBE_HTTP_HISTORY,
+  PROBE_HTTP_NOTFOUND,
+  PROBE_VANE,                         // sampleVane() vane sampler
+  PROBE_LOOP,                         // loop() without the delay at the end
+  PROBE_COUNT
+};
+
+#if PROFILING
+
+#ifdef ESP32
+  #include <esp_cpu.h>
+  #define PROFILE_CYCLES() esp_cpu_get_cycle_count()
+#else
+  #define PROFILE_CYCLES() ESP.getCycleCount()
+#endif
+
+#define PROFILE_BUCKETS 64            // 2 buckets per power of two for 32 bit cycle values
+#define PROFILE_BUFFER 192            // Buffer for the JSON record of one probe
+
+const char *const probeNames[PROBE_COUNT] = {
+  "isr_speed", "isr_direction", "buildaverage", "calculation", "simulation",
+  "nmea_mwv", "nmea_vwr", "nmea_vpw", "nmea_inf", "nmea_gst", "nmea_wst", "nmea_wse",
+  "http_root", "http_settings", "http_restart", "http_firmware", "http_devinfo", "http_windv", "http_windi",
+  "http_favicon", "http_css", "http_asset", "http_json", "http_events", "http_json2", "http_metrics",
+  "http_history", "http_notfound", "vane", "loop"
+};
+
+// Run time statistic of one probe in [cycles], written only by the measured routine
+typedef struct {
+  uint32_t count;                     // Number of measurements
+  uint32_t min;                       // Minimum
+  uint32_t max;                       // Maximum
+  uint64_t sum;                       // Sum for the average
+  uint16_t buckets[PROFILE_BUCKETS];  // Histogram, halved when a bucket is full
+} probeData;
+
+class Profiler
+{
+public:
+  // Add one measurement, also called from interrupt routines
+  void IRAM_ATTR record(uint8_t id, uint32_t cycles)
+  {
+    probeData &p = _probes[id];
+    if (p.count == 0 || cycles < p.min)
+    {
+      p.min = cycles;
+    }
+    if (cycles > p.max)
+    {
+      p.max = cycles;
+    }
+    p.count++;
+    p.sum += cycles;
+    uint8_t bucket = bucketOf(cycles);
+    if (p.buckets[bucket] == UINT16_MAX)
+    {
+      // Keep the distribution and make room
+      for (uint8_t i = 0; i < PROFILE_BUCKETS; i++)
+      {
+        p.buckets[i] >>= 1;
+      }
+    }
+    p.buckets[bucket]++;
+  }
+
+  // Stream all probes as JSON in chunks, the run times in [us]
+  template <typename Server>
+  void sendJSON(Server &server)
+  {
+    char buffer[PROFILE_BUFFER];
+    float mhz = float(ESP.getCpuFreqMHz());
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.sendHeader("Cache-Control", "no-cache");
+    server.send(200, "application/json", "");
+    int length = snprintf(buffer, sizeof(buffer), "{\"CPUFrequency\": {\"Value\": %d,\"Unit\": \"MHz\"},\"Probes\": [", int(mhz));
+    server.sendContent(buffer, length);
+    for (uint8_t id = 0; id < PROBE_COUNT; id++)
+    {
+      // Consistent copy, the probes of interrupt and timer routines change while sending
+      probeData p;
+      NO_INTERRUPTS;
+      p = _probes[id];
+      INTERRUPTS;
+      float avg = p.count > 0 ? float(p.sum / p.count) : 0;
+      length = snprintf(buffer, sizeof(buffer),
+        "%s{\"Name\": \"%s\",\"Count\": %u,\"Min\": %.2f,\"Avg\": %.2f,\"Max\": %.2f,\"P99\": %.2f,\"Unit\": \"us\"}",
+        id > 0 ? "," : "", probeNames[id], unsigned(p.count), p.min / mhz, avg / mhz, p.max / mhz, percentile(p, 99) / mhz);
+      server.sendContent(buffer, min(length, int(sizeof(buffer) - 1)));
+    }
+    server.sendContent("]}", 2);
+  }
+
+private:
+  // Bucket = 2 * (highest bit) + next bit
+  static uint8_t IRAM_ATTR bucketOf(uint32_t cycles)
+  {
+    if (cycles < 2)
+    {
+      return 0;
+    }
+    uint8_t msb = 31 - __builtin_clz(cycles);
+    return 2 * msb + ((cycles >> (msb - 1)) & 1);
+  }
+
+  // Upper limit of a bucket in [cycles]
+  static uint32_t bucketLimit(uint8_t bucket)
+  {
+    uint8_t msb = bucket / 2;
+    uint64_t limit = (uint64_t(2 + (bucket & 1) + 1) << msb) / 2;
+    return limit > UINT32_MAX ? UINT32_MAX : uint32_t(limit);
+  }
+
+  // Percentile in [cycles] from the histogram, limited by the measured maximum
+  static float percentile(const probeData &p, uint8_t percent)
+  {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < PROFILE_BUCKETS; i++)
+    {
+      total += p.buckets[i];
+    }
+    if (total == 0)
+    {
+      return 0;
+    }
+    uint32_t rank = (total * percent + 99) / 100;
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < PROFILE_BUCKETS; i++)
+    {
+      sum += p.buckets[i];
+      if (sum >= rank)
+      {
+        return float(min(bucketLimit(i), p.max));
+      }
+    }
+    return float(p.max);
+  }
+
+  probeData _probes[PROBE_COUNT] = {};
+};
+
+Profiler profiler;                    // Run time statistic of all probes
+
+// Measures the run time from the declaration to the end of the scope or to stop()
+class ProfileScope
+{
+public:
+  IRAM_ATTR ProfileScope(uint8_t id) : _id(id), _start(PROFILE_CYCLES()) {}
+  IRAM_ATTR ~ProfileScope() { stop(); }
+  void IRAM_ATTR stop()
+  {
+    if (_id < PROBE_COUNT)
+    {
+      profiler.record(_id, uint32_t(PROFILE_CYCLES() - _start));
+      _id = PROBE_COUNT;
+    }
+  }
+
+private:
+  uint8_t _id;
+  uint32_t _start;
+};
+
+#define PROFILE(id) ProfileScope profile_##id(id)
+#define PROFILE_END(id) profile_##id.stop()
+
+#else
+
+#define PROFILE(id)
+#define PROFILE_END(id)
+
+#endif
+
+#endif
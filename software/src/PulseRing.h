@@ -0,0 +1,74 @@
+#ifndef PulseRing_h
+#define PulseRing_h
+
+// Lock-free ring buffer for pulse events between the interrupt routines and the average building
+// Single producer: the GPIO interrupts (they don't nest, both run on the same interrupt level)
+// Single consumer: processPulses() in buildaverage()
+// Neither side waits or disables interrupts. If the buffer is full the new event is dropped and counted.
+
+#include <atomic>
+
+// Pulse event
+typedef struct {
+  uint32_t timestamp;         // Edge timestamp in [us]
+  uint8_t edge;               // Sensor with edge [1|2] 1=wind speed, 2=wind direction
+} pulseEvent;
+
+#define PULSE_EDGE_SPEED 1
+#define PULSE_EDGE_DIRECTION 2
+
+template <uint16_t SIZE>
+class PulseRing
+{
+  static_assert((SIZE & (SIZE - 1)) == 0, "PulseRing size must be a power of two");
+
+public:
+  // Producer side, call only from the interrupt routines
+  inline __attribute__((always_inline)) bool push(uint8_t edge, uint32_t timestamp)
+  {
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    if (head - _tail.load(std::memory_order_acquire) >= SIZE)
+    {
+      _overflows.store(_overflows.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      return false;
+    }
+    pulseEvent &slot = _events[head & (SIZE - 1)];
+    slot.timestamp = timestamp;
+    slot.edge = edge;
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side, returns false if no event is waiting
+  inline bool pop(pulseEvent &event)
+  {
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail == _head.load(std::memory_order_acquire))
+    {
+      return false;
+    }
+    event = _events[tail & (SIZE - 1)];
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Number of waiting events
+  uint32_t size() const
+  {
+    return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+  }
+
+  // Number of dropped events since start
+  uint32_t overflows() const
+  {
+    return _overflows.load(std::memory_order_relaxed);
+  }
+
+private:
+  pulseEvent _events[SIZE];
+  std::atomic<uint32_t> _head{0};
+  std::atomic<uint32_t> _tail{0};
+  std::atomic<uint32_t> _overflows{0};
+};
+
+#endif
@@ -2,6 +2,8 @@
 // Insert this library after server definition
 
 httpServer.on("/", []() {
+  PROFILE(PROBE_HTTP_ROOT);
+  metrics.request(HTTP_ROUTE_ROOT);
   // Read all received get arguments and save in a array
   int num = httpServer.args();
   String vname[num];
@@ -17,13 +19,14 @@ httpServer.on("/", []() {
       resetESP = 0;
     }
   } 
-  // Send page     
-  String content = Startpage(num, vname, value);
-  httpServer.sendHeader("Cache-Control", "no-cache");
-  httpServer.send(200, "text/html", content);
+  // Send page as chunks
+  PageWriter content(httpServer);
+  Startpage(content, num, vname, value);
+  content.end();
 
   // Restart routine
   if(resetESP == 1){
+    httpServer.sendContent("");     // Last chunk before the restart
     delay(3000); // Waiting time for system restart
     resetESP = 0;
     // Restart the ESP8266
@@ -32,6 +35,8 @@ httpServer.on("/", []() {
 });
 
 httpServer.on("/settings", []() {
+  PROFILE(PROBE_HTTP_SETTINGS);
+  metrics.request(HTTP_ROUTE_SETTINGS);
   // Read all received get arguments and save in a array
   int num = httpServer.args();
   String vname[num];
@@ -40,13 +45,14 @@ httpServer.on("/settings", []() {
     vname[i] = httpServer.argName(i);
     value[i] = httpServer.arg(i);  
   } 
-  // Send page
-  String content = Settings(num, vname, value);
-  httpServer.sendHeader("Cache-Control", "no-cache");
-  httpServer.send(200, "text/html", content);  
+  // Send page as chunks
+  PageWriter content(httpServer);
+  Settings(content, num, vname, value);
 });
 
 httpServer.on("/restart", []() {
+  PROFILE(PROBE_HTTP_RESTART);
+  metrics.request(HTTP_ROUTE_RESTART);
   // Read all received get arguments and save in a array
   int num = httpServer.args();
   String vname[num];
@@ -62,6 +68,8 @@ httpServer.on("/restart", []() {
 });
 
 httpServer.on("/firmware", []() {
+  PROFILE(PROBE_HTTP_FIRMWARE);
+  metrics.request(HTTP_ROUTE_FIRMWARE);
   // Read all received get arguments and save in a array
   int num = httpServer.args();
   String vname[num];
@@ -77,78 +85,101 @@ httpServer.on("/firmware", []() {
 });
 
 httpServer.on("/devinfo", []() {
-  String content = Devinfo();
-  httpServer.sendHeader("Cache-Control", "no-cache");
-  httpServer.send(200, "text/html", content);
+  PROFILE(PROBE_HTTP_DEVINFO);
+  metrics.request(HTTP_ROUTE_DEVINFO);
+  PageWriter content(httpServer);
+  Devinfo(content);
 });
 
 httpServer.on("/windv", []() {
-  String content = Windv();
-  httpServer.sendHeader("Cache-Control", "no-cache");
-  httpServer.send(200, "text/html", content);
+  PROFILE(PROBE_HTTP_WINDV);
+  metrics.request(HTTP_ROUTE_WINDV);
+  PageWriter content(httpServer);
+  Windv(content);
 });
 
 httpServer.on("/windi", []() {
-  String content = Windi();
-  httpServer.sendHeader("Cache-Control", "no-cache");
-  httpServer.send(200, "text/html", content);
+  PROFILE(PROBE_HTTP_WINDI);
+  metrics.request(HTTP_ROUTE_WINDI);
+  PageWriter content(httpServer);
+  Windi(content);
 });
 
 httpServer.on("/favicon.ico", []() {
+  PROFILE(PROBE_HTTP_FAVICON);
+  metrics.request(HTTP_ROUTE_FAVICON);
   String content = Icon();
   httpServer.sendHeader("Cache-Control", "max-age=600");
   httpServer.send(200, "image/svg+xml", content);
 });
 
+// Style sheet of the actual skin for pages with the old link, the pages use the hashed URL
 httpServer.on("/css", []() {
-  String content = CSS();
-   httpServer.sendHeader("Cache-Control", "no-cache");
-  httpServer.send(200, "text/css", content);
-});
-
-httpServer.on("/js", []() {
-  String content = JS();
-  httpServer.sendHeader("Cache-Control", "no-cache");
-  httpServer.send(200, "text/javascript", content);
-});
-
-httpServer.on("/tween-min.js", []() {
-  httpServer.sendHeader("Cache-Control", "max-age=600");
-  httpServer.sendHeader("content-encoding", "gzip");
-  // Send binary data as compessed gz content
-  httpServer.send_P(200, "text/javascript", tween_min_js_gz, sizeof(tween_min_js_gz));
+  PROFILE(PROBE_HTTP_CSS);
+  metrics.request(HTTP_ROUTE_CSS);
+  sendAsset(httpServer, cssAsset(), "no-cache");
 });
 
-httpServer.on("/steelseries_micro.js", []() {
-  httpServer.sendHeader("Cache-Control", "max-age=600");
-  httpServer.sendHeader("content-encoding", "gzip");
-  // Send binary data as compessed gz content
-  httpServer.send_P(200, "text/javascript", steelseries_micro_js_gz, sizeof(steelseries_micro_js_gz));
-});
+// Static assets with content hash in the URL, cached by the browser without revalidation
+for (size_t i = 0; i < ASSET_COUNT; i++) {
+  httpServer.on(staticAssets[i].path, [i]() {
+    PROFILE(PROBE_HTTP_ASSET);
+    metrics.request(HTTP_ROUTE_ASSET);
+    sendAsset(httpServer, staticAssets[i], "public, max-age=31536000, immutable");
+  });
+}
 
 httpServer.on("/json", []() {
+  PROFILE(PROBE_HTTP_JSON);
+  metrics.request(HTTP_ROUTE_JSON);
   String content = JSON();
   httpServer.sendHeader("Access-Control-Allow-Origin", "*"); // Needs new browser for CORS (Cross Origin Resource Sharing)
   httpServer.sendHeader("Cache-Control", "no-cache");
   httpServer.send(200, "application/json", content);
 });
 
+// Server-Sent Events with the wind values of each calculation cycle, the connection stays open
+httpServer.on("/events", []() {
+  PROFILE(PROBE_HTTP_EVENTS);
+  metrics.request(HTTP_ROUTE_EVENTS);
+  if(!eventServer.add(httpServer.client())){
+    httpServer.sendHeader("Retry-After", "10");
+    httpServer.send(503, "text/plain", "Too many event clients");
+  }
+});
+
 // Send JSON2 only for Diagnostic Mode
 httpServer.on("/json2", []() {
+  PROFILE(PROBE_HTTP_JSON2);
+  metrics.request(HTTP_ROUTE_JSON2);
   String content = JSON2();
   httpServer.sendHeader("Access-Control-Allow-Origin", "*"); // Needs new browser for CORS (Cross Origin Resource Sharing)
   httpServer.sendHeader("Cache-Control", "no-cache");
   httpServer.send(200, "application/json", content);
 });
 
-// Use no cash because the js was permanently modifyed (transaction ID)
-httpServer.on("/MD5.js", []() {
-  String content = MD5();
-  httpServer.sendHeader("Cache-Control", "no-cache");
-  httpServer.send(200, "text/javascript", content);
+// Counters and gauges for monitoring in Prometheus text format
+httpServer.on("/metrics", []() {
+  PROFILE(PROBE_HTTP_METRICS);
+  metrics.request(HTTP_ROUTE_METRICS);
+  sendMetrics(httpServer);
 });
-
+// History as CSV, JSON or binary download, streamed in chunks
+httpServer.on("/history", []() {
+  PROFILE(PROBE_HTTP_HISTORY);
+  metrics.request(HTTP_ROUTE_HISTORY);
+  sendHistory(httpServer);
+});
+#if PROFILING
+// Run time statistic of the probes (build flag -D PROFILING=1)
+httpServer.on("/metrics/profile", []() {
+  PROFILE(PROBE_HTTP_METRICS);
+  profiler.sendJSON(httpServer);
+});
+#endif
 httpServer.onNotFound([]() {
+  PROFILE(PROBE_HTTP_NOTFOUND);
+  metrics.request(HTTP_ROUTE_NOTFOUND);
   String content = Error();
   httpServer.send(404, "text/html", content);
 });
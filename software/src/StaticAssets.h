@@ -0,0 +1,47 @@
+#ifndef StaticAssets_h
+#define StaticAssets_h
+
+// Static web assets (style sheets, JavaScript) from the asset pipeline tools/assets.py
+// The assets are gzip compressed in the PROGRAM memory and sent with send_P, no String on the heap.
+// The URL contains the content hash, the browser keeps the asset as immutable and asks again only after
+// a firmware update with changed content. A request with the ETag in If-None-Match gets 304 without data.
+
+typedef struct {
+  const char *path;                 // URL with content hash
+  const char *type;                 // MIME type
+  const char *data;                 // gzip data in PROGMEM
+  size_t length;                    // Length of the gzip data in [Byte]
+  const char *etag;                 // Content hash with quotes
+} staticAsset;
+
+#include "assets_html.h"    // Generated asset data
+
+// Style sheet of the display style (Style button of the main page): 0 = night red, 1 = day black, 2 = day white
+const staticAsset &cssAsset()
+{
+  switch (style)
+  {
+    case 0:
+      return staticAssets[ASSET_RED_CSS];
+    case 1:
+      return staticAssets[ASSET_BLACK_CSS];
+    default:
+      return staticAssets[ASSET_WHITE_CSS];
+  }
+}
+
+template <typename Server>
+void sendAsset(Server &server, const staticAsset &asset, const char *cacheControl)
+{
+  server.sendHeader("Cache-Control", cacheControl);
+  server.sendHeader("ETag", asset.etag);
+  if (server.header("If-None-Match").indexOf(asset.etag) >= 0)
+  {
+    server.send(304);
+    return;
+  }
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, asset.type, asset.data, asset.length);
+}
+
+#endif
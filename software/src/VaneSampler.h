@@ -0,0 +1,129 @@
+#ifndef VaneSampler_h
+#define VaneSampler_h
+
+// High rate sampling of the magnetic wind vane (AS5600, MT6701)
+// The angle is read with 50...200 Hz by an own timer (ESP8266 Ticker, ESP32 task) and added on the unit circle.
+// The calculation cycle takes the circular mean of the samples of the last 1...10 cycles (boxcar decimation to 2 Hz),
+// a vane oscillating around the wind direction is averaged instead of sampled once every 500ms.
+// Vane oscillating +/-30° with 1.3 Hz (test/test_vane): rms error 21.2° with one angle per cycle, 9.4° with the
+// mean of one cycle, 4.4° with 2 cycles.
+
+#include "CircularMean.h"
+
+#define VANE_CYCLES 10                      // Max calculation cycles of the mean
+
+class VaneSampler
+{
+public:
+  // rate in [Hz], 0 = off, sample is called with the rate
+  void begin(int rate, void (*sample)())
+  {
+    NO_INTERRUPTS;
+    _sum.clear();
+    INTERRUPTS;
+    for (int i = 0; i < VANE_CYCLES; i++)
+    {
+      _cycles[i].clear();
+    }
+    _period = rate > 0 ? 1000 / constrain(rate, 1, 1000) : 0;
+    _sample = sample;
+    #ifdef ESP8266
+      _timer.detach();
+      if (_period > 0)
+      {
+        _timer.attach_ms(_period, sample);
+      }
+    #elif defined(ESP32)
+      if (_period > 0 && !_task)
+      {
+        xTaskCreate(task, "vane", 4096, this, 1, NULL);
+        _task = true;
+      }
+    #endif
+  }
+
+  bool active() const { return _period > 0; }
+  int period() const { return _period; }                      // Sampling period in [ms]
+
+  // One angle in [°], called by the sampling timer
+  void add(float degrees)
+  {
+    float rad = degrees * DEG_TO_RAD;
+    float sine = sinf(rad);
+    float cosine = cosf(rad);
+    NO_INTERRUPTS;
+    _sum.addVector(sine, cosine);
+    INTERRUPTS;
+    _samples++;
+  }
+
+  void error() { _errors++; }                                 // Sample not read
+
+  // Circular mean of the samples of the last cycles (1...10, including this call) in [°], false without samples
+  // Called once per calculation cycle
+  bool take(float &degrees, int cycles)
+  {
+    NO_INTERRUPTS;
+    _cycles[_index] = _sum;
+    _sum.clear();
+    INTERRUPTS;
+    cycles = constrain(cycles, 1, VANE_CYCLES);
+    CircularMean mean;
+    for (int i = 0; i < cycles; i++)
+    {
+      mean.add(_cycles[(_index + VANE_CYCLES - i) % VANE_CYCLES]);
+    }
+    _index = (_index + 1) % VANE_CYCLES;
+    _count = mean.count();
+    if (_count == 0)
+    {
+      return false;
+    }
+    degrees = mean.direction();
+    _deviation = mean.deviation();
+    return true;
+  }
+
+  uint32_t samples() const { return _samples; }               // Samples since start
+  uint32_t errors() const { return _errors; }                 // Failed reads since start
+  uint32_t count() const { return _count; }                   // Samples of the last mean
+  float deviation() const { return _deviation; }              // Circular standard deviation of the last mean in [°]
+
+private:
+  #ifdef ESP32
+    // Sampling task, runs with the period of the last begin()
+    static void task(void *p)
+    {
+      VaneSampler *vane = (VaneSampler *)p;
+      TickType_t xLastWakeTime = xTaskGetTickCount();
+      for (;;)
+      {
+        int period = vane->_period;
+        if (period > 0)
+        {
+          vane->_sample();
+        }
+        else
+        {
+          period = 100;
+        }
+        xTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(period));
+      }
+    }
+    bool _task = false;
+  #else
+    Ticker _timer;
+  #endif
+
+  CircularMean _sum;                        // Samples since the last take()
+  CircularMean _cycles[VANE_CYCLES];        // Samples of the last calculation cycles
+  int _index = 0;                           // Position of the next cycle in _cycles
+  volatile int _period = 0;
+  void (*_sample)() = nullptr;
+  uint32_t _samples = 0;
+  uint32_t _errors = 0;
+  uint32_t _count = 0;
+  float _deviation = 0;
+};
+
+#endif
@@ -14,6 +14,7 @@
 // Wind direction and speed:  $WIVWR,x.x,a,x.x,N,x.x,M,x.x,K*hh
 // Down wind speed:           $WIVPW,x.x,N,x.x,M*hh                               (Wind speed parallel to wind direction)
 // Wind speed informations:   $PWINF,0,x.x,D,x.x,D,x.x,M,x.x,K,x.x,N,x.x,B,A*hh   (Custom sentence)
+// Wind gusts and lull:       $PWGST,0,x.x,x.x,x.x,x.x,M,A*hh                     (Custom sentence, optional)
 // Wind sensor temperature:   $PWWST,C,0,x.x,A*hh                                 (Custom sentence)
 //
 //*********************************************************************************************
@@ -39,39 +40,68 @@
 
 #include <Ticker.h>         // Timer lib
 #include <EEPROM.h>         // EEPROM lib
+#include <LittleFS.h>       // Flash file system for the history
 #include <WString.h>        // Needs for structures
 #include <Wire.h>           // Lib for I2C
 #include <Adafruit_Sensor.h>// Adafuit sensor lib
 #include <Adafruit_BME280.h>// Lib for BME280
+#include "I2CBus.h"         // I2C transport with timeout and bus recovery
 #include "AS5600.h"         // Lib for magnetic rotation sensor AS5600
 #include "MT6701_I2C.h"     // Lib for magnetic rotation sensor MT6701
 #include <DallasTemperature.h>// Dallas 1Wire lib
 #include "Configuration.h"  // Setup data structure in header file
+#include "PulseRing.h"      // Lock-free buffer for pulse events from interrupts
+#include "WindSnapshot.h"   // Measuring values of one calculation cycle
+#include "NmeaWriter.h"     // NMEA sentence builder without heap allocation
 #include "Definitions.h"    // Local definitions in additional file
+#include "Profiler.h"       // Run time probes, only with build flag -D PROFILING=1
+#include "Metrics.h"        // Counters for monitoring (/metrics)
+#include "BME280Sampler.h"  // BME280 in forced mode with own measuring period
 
 AMS_5600 ams5600;            // Declare magnetic rotation sensor AS5600
 MT6701I2C mt6701(&Wire);    // Declare magnetic rotation sensor MT6701
-Adafruit_BME280 bme;        // Declare environment sensor BME280
+BME280Sampler bme;          // Declare environment sensor BME280
 OneWire* oneWire = nullptr; // Declare 1Wire
 DallasTemperature* DS18B20 = nullptr; // Declare DS18B20
 configData actconf;         // Actual configuration, Global variable
                             // Overload with old EEPROM configuration by start. It is necessarry for port and serspeed
                             // Don't change the position!
 size_t x = sizeof(long);
+#include "DS18B20Sampler.h" // Non-blocking temperature measurement
+DS18B20Sampler ds18b20;     // Temperature of the DS18B20, measured independent of the wind calculation
+#include "VaneSampler.h"    // High rate sampling of the magnetic wind vane
+VaneSampler vane;           // Circular mean of the vane angle between two calculation cycles
+WindowStats windStats;      // Sliding windows 3s, 30s, 2min, 10min of wind speed and direction
+#include "GustDetector.h"   // Gust and lull detection on each pulse
+GustDetector gust;          // 3s gust, 10min mean, max gust and lull of the anemometer
+#include "HistoryRecorder.h"// History ring of the measuring values in LittleFS
+HistoryRecorder history;    // 1 Hz records of wind speed, direction, gust, temperature and pressure
+#include "MinuteHistory.h"  // 1 minute aggregates of the last 24h in RAM
+MinuteHistory minuteHistory;
 #include "Calculation.h"    // Function library for wind data calculation
 #include "FunctionsLib.h"   // Function library
+#include "NMEAServer.h"     // NMEA TCP server for several clients
+#include "EventServer.h"    // Server-Sent Events for the web pages
+WiFiServer server(actconf.dataport);  // Declare WiFi NMEA server port
+NMEAServer nmeaServer(server);        // NMEA TCP server with send queues for several clients
+EventServer eventServer;              // Server-Sent Events with the measuring values of each calculation cycle
+#include "NMEAUdp.h"        // NMEA UDP broadcast and multicast output
+NMEAUdp nmeaUdp;                      // NMEA UDP output, one datagram per calculation cycle
+#include "MQTTPublisher.h"  // MQTT publisher for Server Mode 2
+MQTTPublisher mqtt;                   // MQTT publisher, one batch per calculation cycle
+#include "LiveServer.h"     // WebSocket live data with rate and field set per subscriber
+LiveServer liveServer(actconf.wsport); // WebSocket live data server
 #include "NMEATelegrams.h"  // Function library for NMEA telegrams
 #include "icon_html.h"      // Favorit icon
-#include "css_html.h"       // CSS cascading style sheets
-#include "steel_html.h"     // JavaScript steelseries_micro.js.gz library
-#include "tween_html.h"     // JavaScript tween-min.js.gz library
-#include "js_html.h"        // JavaScript functions
+#include "StaticAssets.h"   // Style sheets and JavaScript libraries gzip compressed from assets/
+#include "PageWriter.h"     // Chunked output of the web pages with flash templates
 #include "main_html.h"      // Main webpage
 #include "settings_html.h"  // Settings webpage
 #include "firmware_html.h"  // Firmware update webpage
 #include "json_html.h"      // JSON webpage
 #include "json2_html.h"     // JSON webpage for Hall sensor signals
-#include "MD5_html.h"       // JavaScript crypt password with MD5
+#include "metrics_html.h"   // Monitoring page in Prometheus text format
+#include "history_html.h"   // History range query as CSV, JSON or binary
 #include "restart_html.h"   // Reset info webpage
 #include "devinfo_html.h"   // Device info webpage
 #include "windv_html.h"     // Wind value webpage
@@ -98,14 +128,10 @@ configData newconf;         // Configuration stucture for new config data in EEP
 #endif
 MDNSResponder mdns;                             // Activate DNS responder
 
-#ifdef ESP32
-  hw_timer_t *timer = NULL;
-#endif
 Ticker Timer2;              // Declare Timer2 for average building
 Ticker Timer3;              // Declare Timer3 for normal NMEA data sending
 Ticker Timer4;              // Declare Timer4 for reduced NMEA data sending
 Ticker Timer5;              // Declare Timer5 for calculation of windspeed und winddirection 
-WiFiServer server(actconf.dataport);  // Declare WiFi NMEA server port
  
 //*********************************************************************************************
 // Setup section
@@ -234,9 +260,10 @@ void setup() {
   // Start OneWire
   oneWire = new OneWire(oneWire_Bus);
   DS18B20 = new DallasTemperature(oneWire);
+  ds18b20.begin(DS18B20, actconf.tempResolution);
 
   // Start bus systems
-  Wire.begin(I2C_SDA, I2C_SCL);        // Start I2C
+  i2cBus.begin(I2C_SDA, I2C_SCL);      // Start I2C with 400kHz and transaction timeout
   bme.begin(i2cAddressBME280);         // Start BME280
 
   // Pin settings
@@ -331,11 +358,11 @@ void setup() {
       DebugPrint(3, "Magnitude [1]: ");
       DebugPrintln(3, ams5600.getMagnitude());
       DebugPrint(3, "Raw Angle [°]: ");
-      magsensor = ams5600.getRawAngle() * 0.087; // 0...4096 which is 0.087 of a degree
-      DebugPrintln(3, magsensor);
+      DebugPrintln(3, ams5600.getRawAngle() * 0.087); // 0...4096 which is 0.087 of a degree
     }
     else{
       i2creadyAS5600 = false;                        // Result I2C scan
+      metrics.i2cError();
       DebugPrintln(3, "error");
       DebugPrintln(3, "Stop I2C for device AS5600");
     }
@@ -358,14 +385,13 @@ void setup() {
       i2creadyMT6701 = true;                       // Result I2C scan
       DebugPrintln(3, "ready");
       DebugPrint(3, "Raw Value: ");
-      mt6701.begin();
       DebugPrintln(3, mt6701.getRawAngle());
       DebugPrint(3, "Raw Angle [°]: ");
-      magsensor = mt6701.getDegreesAngle();     // 0...16384 which is 0.0219 of a degree
-      DebugPrintln(3, magsensor);
+      DebugPrintln(3, mt6701.getDegreesAngle()); // 0...16384 which is 0.0219 of a degree
     }
     else{
       i2creadyMT6701 = false;                       // Result I2C scan
+      metrics.i2cError();
       DebugPrintln(3, "error");
       DebugPrintln(3, "Stop I2C for device MT6701");
     }
@@ -388,21 +414,28 @@ void setup() {
     if(Wire.endTransmission() == 0){
       i2creadyBME280 = true;                        // Result I2C scan
       DebugPrintln(3, "ready");
+      // The library reads as used on each calculation cycle before, for the I2C time saved
+      unsigned long start = micros();
+      float temperature = bme.readTemperature();
+      float pressure = bme.readPressure() / 100;
+      float humidity = bme.readHumidity();
+      float altitude = bme.readAltitude(SEALEVELPRESSURE_HPA);
+      bme.legacyTime(micros() - start);
       DebugPrint(3, "Temperature [°C]: ");
-      airtemperature = bme.readTemperature();
-      DebugPrintln(3, airtemperature);      
+      DebugPrintln(3, temperature);
       DebugPrint(3, "Air Pressure [mbar]: ");
-      airpressure = bme.readPressure() / 100;
-      DebugPrintln(3, airpressure);
+      DebugPrintln(3, pressure);
       DebugPrint(3, "Air Humidity [%]: ");
-      airhumidity = bme.readHumidity();
-      DebugPrintln(3, airhumidity);
+      DebugPrintln(3, humidity);
       DebugPrint(3, "Altitude [m]: ");
-      altitude = bme.readAltitude(SEALEVELPRESSURE_HPA);
       DebugPrintln(3, altitude);
+      DebugPrint(3, "Library reads [us]: ");
+      DebugPrintln(3, bme.legacyTime());
+      bme.configure(i2cAddressBME280, actconf.bmePeriod, actconf.bmeOversampling);  // Forced mode
     }
     else{
       i2creadyBME280 = false;                        // Result I2C scan
+      metrics.i2cError();
       DebugPrintln(3, "error");
       DebugPrintln(3, "Stop I2C for device BME280");
     }
@@ -459,6 +492,7 @@ void setup() {
     MDNS.begin(hname);      // Start mDNS service
     MDNS.addService("http", "tcp", actconf.httpport);       // HTTP service
     MDNS.addService("nmea-0183", "tcp", actconf.dataport);  // NMEA0183 data service for AVnav
+    MDNS.addService("ws", "tcp", actconf.wsport);           // WebSocket live data
   }  
   DebugPrintln(3, "mDNS service: activ");
   DebugPrint(3, "mDNS name: ");
@@ -467,6 +501,8 @@ void setup() {
   
   // Sart update server
   httpUpdater.setup(&httpServer);
+  static const char *requestHeaders[] = {"Range", "If-Range", "If-None-Match"};  // History downloads, assets
+  httpServer.collectHeaders(requestHeaders, 3);
   httpServer.begin();
   DebugPrint(3, "HTTP Update Server started at port: ");
   DebugPrintln(3, actconf.httpport);
@@ -518,9 +554,19 @@ void setup() {
   }
   
   // Start the NMEA TCP server
-  server.begin();
+  nmeaServer.begin();
   DebugPrint(3, "NMEA-Server started at port: ");
   DebugPrintln(3, actconf.dataport);
+  // Start the WebSocket live data server
+  liveServer.begin();
+  DebugPrint(3, "WebSocket live data started at port: ");
+  DebugPrintln(3, actconf.wsport);
+  // Set the NMEA UDP output
+  nmeaUdp.begin(actconf.udpMode, actconf.udpAddress, actconf.udpPort);
+  // Set the MQTT broker in Server Mode 2 (MQTT), the connect is done in loop
+  if(int(actconf.serverMode) == 2){
+    mqtt.begin(actconf.mqttHost, actconf.mqttPort, actconf.mqttTopic, actconf.hostname);
+  }
   // Print the IP address
   DebugPrint(3, "Use this URL : ");
   DebugPrint(3, "http://");
@@ -532,20 +578,17 @@ void setup() {
   };
 
   //*************************************************
+  hallTraceTimer(actconf.serverMode == 3);       // Hall sensor trace sampling only in Diagnostic Mode
+  vaneTimer(actconf.vaneRate);                   // High rate sampling of the magnetic wind vane
+  windStats.begin(millis());                     // Sliding window statistics
+  gust.begin(micros());                          // Gust and lull detection
+  historyBegin();                                // History ring in LittleFS
   #ifdef ESP8266
-    timer1_attachInterrupt(counter);              // Start interrupt routine counter
-    timer1_enable(TIM_DIV16, TIM_EDGE, TIM_LOOP); // 80MHz / 16 => 0,2us
-    timer1_write(500);                            // Start timer1 100us @ 0,2us
     Timer2.attach_ms(50, buildaverage);           // Start timer all 50ms for average building and reading magnetic sensor
     Timer3.attach_ms(SendPeriod, sendNMEA);       // Data transmission timer for NMEA
     Timer4.attach_ms(RedSendPeriod, sendNMEA2);   // Data transmission timer with reduced frequence for NMEA
     Timer5.attach_ms(500, winddata);              // Start Timer all 500ms for wind data calculation
   #elif defined(ESP32)
-    // Create timer 0, with prescaler 16 → tick = 0.2 µs
-    timer = timerBegin(5000000);  // timer 0 at 5 MHz
-    timerAttachInterrupt(timer, &counter); // Attach the ISR
-    timerAlarm(timer, 500, true, 0); // Trigger alarm every 500 ticks, so every 100 µs
-
     // Create other tasks using FreeRTOS instead of timers
     xTaskCreate(taskBuildAverage, "avg", 4096, NULL, 1, NULL);
     xTaskCreate(taskSendNMEA, "nmea1", 4096, NULL, 1, NULL);
@@ -576,6 +619,8 @@ void setup() {
   time2 = 0;
   time1_avg = 0;
   time2_avg = 0;
+  winddir_avg = 0;
+  winddir_dev = 0;
   INTERRUPTS;
 }
  
@@ -583,7 +628,9 @@ void setup() {
 // Loop section
 //*********************************************************************************************
 void loop() {
-  
+  PROFILE(PROBE_LOOP);
+  unsigned long loopStart = micros();
+
   httpServer.handleClient();        // HTTP Server-handler for HTTP update server
   #ifdef ESP8266
     MDNS.update();                    // Update DNS info
@@ -591,137 +638,69 @@ void loop() {
     // Not needed, it is done automagically in the background
   #endif
   
-  // Check if a client is connected
-  WiFiClient client = server.accept();
-  int i = 0;
-  
-  if(!client.connected() && WiFi.status() != WL_CONNECTED){
+  // Accept new NMEA clients, send waiting data and remove dead clients (non-blocking)
+  nmeaServer.handle();
+  int clients = nmeaServer.clients();
+
+  if(clients == 0 && WiFi.status() != WL_CONNECTED){
     digitalWrite(ledPin, LOW);      // LED on (Low activ)
-    i = 0;
   }
-
-  // While client is connected or Serial Mode is active
-  while (client.connected() && !client.available()) {
+  if(clients > 0){
     digitalWrite(ledPin, HIGH);     // LED off (Low activ)
-    
-    httpServer.handleClient();      // HTTP Server-handler for HTTP update server
-    if(actconf.mDNS == 1){
-      #ifdef ESP8266
-        MDNS.update();                    // Update DNS info
-      #elif defined(ESP32)
-        // Note needed, it is done automagically in the background
-      #endif
-    }  
-    
-    if ((i == 0) && ((int(actconf.serverMode) == 0) || (int(actconf.serverMode) == 4))) {
-      DebugPrintln(3, "Client connected");
-      DebugPrintln(3, "");
-    }
-
-    // Wind speed and wind direction data calculated via Timer5 interrupt all 500ms
-
-    // Sending NMEA data with normal speed
-    if (windspeed_mps > 0 && flag1 == true){     
-      i++;
-      DebugPrintln(3, "");
-      DebugPrint(3, "Send package:");
-      DebugPrintln(3, i);
-          
-      if((int(actconf.serverMode) == 0) || (int(actconf.serverMode) == 1) || (int(actconf.serverMode) == 4)){
-         if(int(actconf.windSensor) == 1){
-          client.println(sendMWV(1));  // Send NMEA telegrams
-          client.println(sendVWR(1));
-          client.println(sendVPW(1));
-          client.println(sendINF(1));
-         }
-        if(int(actconf.tempSensor) == 1){
-          if(String(actconf.tempSensorType) == "DS18B20"){
-            client.println(sendWST(1));
-          }
-          if(String(actconf.tempSensorType) == "BME280"){
-            client.println(sendWSE(1));
-          }    
-        } 
-      }
-         
-      flashLED(10);                 // Flash LED for data transmission
-      flag1 = false;                // Reset the flag
-    }
+  }
 
-    // Sending NMEA data with reduced speed
-    if (windspeed_mps <= 0 && flag2 == true){
-      i++;
-      DebugPrintln(3, "");
-      DebugPrint(3, "Send package:");
-      DebugPrintln(3, i);
-      
-      if((int(actconf.serverMode) == 0) || (int(actconf.serverMode) == 1) || (int(actconf.serverMode) == 4)){
-        if(int(actconf.windSensor) == 1){
-          client.println(sendMWV(1));  // Send NMEA telegrams
-          client.println(sendVWR(1));
-          client.println(sendVPW(1));
-          client.println(sendINF(1));
-        }
-        if(int(actconf.tempSensor) == 1){
-          if(String(actconf.tempSensorType) == "DS18B20"){
-            client.println(sendWST(1));
-          }
-          if(String(actconf.tempSensorType) == "BME280"){
-            client.println(sendWSE(1));
-          }    
-        }
-      }
-           
-      flashLED(10);                 // Flash LED for data transmission
-      flag2 = false;                // Reset the flag
-    }
+  // Send the newest measuring values to the WebSocket subscribers (each with its own rate)
+  liveServer.handle(windData);
 
+  // Push the wind record of a new calculation cycle to the web pages (/events)
+  eventServer.handle();
+  if(eventServer.due(windData.epoch())){
+    WindSnapshot wd;
+    char event[EVENT_SIZE - 8];
+    uint32_t epoch = windData.read(wd);
+    eventServer.send(epoch, event, WindEvent(wd, event, sizeof(event)));
   }
 
-  // If client not connected and server mode 1 (NMEA Serial) or server mode 4 (Demo)
-  if(!client.connected() && (int(actconf.serverMode) == 1 || int(actconf.serverMode) == 4)){
-    // Sending NMEA data with normal speed
-    if (windspeed_mps > 0 && flag1 == true){  
-      if(int(actconf.windSensor) == 1){
-        sendMWV(1);  // Send NMEA telegrams
-        sendVWR(1);
-        sendVPW(1);
-        sendINF(1);
-      }
-      if(int(actconf.tempSensor) == 1){
-        if(String(actconf.tempSensorType) == "DS18B20"){
-          sendWST(1);
-        }
-        if(String(actconf.tempSensorType) == "BME280"){
-          sendWSE(1);
-        }    
-      }
+  // History of the measuring values, one record per second, writes a page about every 40s
+  historyRecord record;
+  if(history.handle(windData, record)){
+    minuteHistory.add(record);
+  }
 
+  // MQTT in Server Mode 2, publish the measuring values once per calculation cycle
+  if(int(actconf.serverMode) == 2){
+    mqtt.handle();
+    if(mqtt.publish(windData.read(), actconf.mqttFormat, actconf.mqttRetain == 1)){
       flashLED(10);                 // Flash LED for data transmission
-      flag1 = false;                // Reset the flag
     }
+  }
 
-    // Sending NMEA data with reduced speed
-    if (windspeed_mps <= 0 && flag2 == true){      
-      if(int(actconf.windSensor) == 1){
-        sendMWV(1);  // Send NMEA telegrams
-        sendVWR(1);
-        sendVPW(1);
-        sendINF(1);
+  // Wind speed and wind direction data calculated via Timer5 interrupt all 500ms
+  float windspeed_mps = windData.read().windspeed_mps;
+
+  // Sending NMEA data with normal speed or with reduced speed when wind speed is zero
+  bool sendnormal = (windspeed_mps > 0 && flag1 == true);
+  bool sendreduced = (windspeed_mps <= 0 && flag2 == true);
+  if(sendnormal || sendreduced){
+    // NMEA TCP server in Server Mode 0 (HTTP, NMEA), 1 (NMEA Serial) and 4 (Demo)
+    bool tcp = (clients > 0) && ((int(actconf.serverMode) == 0) || (int(actconf.serverMode) == 1) || (int(actconf.serverMode) == 4));
+    // NMEA serial output in Server Mode 1 (NMEA Serial) and 4 (Demo)
+    bool serial = (int(actconf.serverMode) == 1) || (int(actconf.serverMode) == 4);
+    // NMEA UDP output in Server Mode 0 (HTTP, NMEA), 1 (NMEA Serial) and 4 (Demo), parallel to TCP
+    bool udp = nmeaUdp.active() && ((int(actconf.serverMode) == 0) || (int(actconf.serverMode) == 1) || (int(actconf.serverMode) == 4));
+    if(tcp || serial || udp){
+      sendNMEAFrame(tcp ? &nmeaServer : nullptr, udp ? &nmeaUdp : nullptr);  // Send NMEA telegrams of the actual calculation cycle
+      flashLED(10);                 // Flash LED for data transmission
+      if(sendnormal){
+        flag1 = false;              // Reset the flag
       }
-      if(int(actconf.tempSensor) == 1){
-        if(String(actconf.tempSensorType) == "DS18B20"){
-          sendWST(1);
-        }
-        if(String(actconf.tempSensorType) == "BME280"){
-          sendWSE(1);
-        }    
+      if(sendreduced){
+        flag2 = false;              // Reset the flag
       }
-           
-      flashLED(10);                 // Flash LED for data transmission
-      flag2 = false;                // Reset the flag
     }
   }
 
+  metrics.loopTime(micros() - loopStart);
+  PROFILE_END(PROBE_LOOP);
   delay(150);                       // Delay for load reducing
 }
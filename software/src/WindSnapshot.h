@@ -0,0 +1,103 @@
+#ifndef WindSnapshot_h
+#define WindSnapshot_h
+
+// Consistent set of all measuring values of one calculation cycle (epoch)
+// Written only by the wind data calculation (Timer5 / wind task), read by the NMEA, JSON and web pages
+// The values are published with a sequence lock. Readers copy the whole set without disabling interrupts
+// and repeat the copy if the calculation has written in between.
+
+#include <atomic>
+#include "WindowStats.h"
+
+// Measuring values of one epoch
+typedef struct {
+  uint32_t epoch = 0;               // Number of the calculation cycle, 0 = no data
+  float fieldstrength = 0;          // WLAN field strength
+  float quality = 0;                // WLAN quality
+  float temperature = 0;            // Windsensor temperature 1Wire (DS18B20)
+  float time1 = 0;                  // Wind speed (time in [ms] for one rotation)
+  float time2 = 0;                  // Wind direction (time in [ms] between wind speed sensor and wind direction sensor)
+  float windspeed_hz = 0;           // Wind speed in [Hz], [rps]
+  float windspeed_mps = 0;          // Wind speed in [m/s]
+  float windspeed_kn = 0;           // Wind speed in [kn]
+  float windspeed_kph = 0;          // Wind speed in [km/h]
+  int windspeed_bft = 0;            // Wind speed in [bft]
+  float rawwinddirection = 0;       // Wind direction 0...360[°] in relation to midle of ship line (midle = 0°) without offset
+  float winddirection = 0;          // Wind direction 0...360[°] in relation to midle of ship line (midle = 0°) with offset
+  float winddirection2 = 0;         // Wind direction 0...180[°] in relation to midle of ship line (midle = 0°) for each boat side with offet
+  float dirresolution = 0;          // Resolution of wind direction [°]
+  float dirdeviation = 0;           // Circular standard deviation of wind direction [°] over the averaged values
+  float magsensor = 0;              // Output magnetic sensor (AS5600) for wind direction 0...360° without offset
+  float magnitude = 0;              // Magetic flux density of magnetic sensor in [mT] (AS5600)
+  float airtemperature = 0;         // Air temperature in [°C] (BME280)
+  float airpressure = 0;            // Air pressure in [mbar] (BME280)
+  float airhumidity = 0;            // Air humidity in [%] (BME280)
+  float dewpoint = 0;               // Dewpoint in [%] calculated with air humidity and airtemperature
+  float altitude = 0;               // Altitude in [m] calculated with air pressure (BME280)
+  windowResult stats[STATS_WINDOWS];// Wind speed and direction of the last 3s, 30s, 2min and 10min
+  float gust = 0;                   // Highest 3s mean wind speed since the last cycle in [m/s] (WMO gust)
+  float mean10 = 0;                 // 10min mean wind speed in [m/s]
+  float gust10 = 0;                 // Max gust of the last 10min in [m/s]
+  float lull10 = 0;                 // Lull (min 3s mean) of the last 10min in [m/s]
+  bool gustcomplete = false;        // 10min of gust data since start
+} WindSnapshot;
+
+// Sequence lock for one writer and many readers
+// The sequence is odd while the writer copies the data
+template <typename T>
+class SeqLock
+{
+public:
+  // Writer side, only one task may publish
+  // Sets the epoch of the data and returns it
+  uint32_t publish(T &data)
+  {
+    uint32_t seq = _seq.load(std::memory_order_relaxed);
+    data.epoch = (seq / 2) + 1;
+    _seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    _data = data;
+    std::atomic_thread_fence(std::memory_order_release);
+    _seq.store(seq + 2, std::memory_order_relaxed);
+    return data.epoch;
+  }
+
+  // Reader side, copies a consistent set of data and returns the epoch
+  uint32_t read(T &data) const
+  {
+    uint32_t seq1, seq2 = 0;
+    do
+    {
+      seq1 = _seq.load(std::memory_order_acquire);
+      if (seq1 & 1)
+      {
+        yield();                    // Writer is active, let it finish
+        continue;
+      }
+      data = _data;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      seq2 = _seq.load(std::memory_order_relaxed);
+    } while ((seq1 & 1) || seq1 != seq2);
+    return data.epoch;
+  }
+
+  // Copy of the actual data
+  T read() const
+  {
+    T data;
+    read(data);
+    return data;
+  }
+
+  // Epoch of the last published data
+  uint32_t epoch() const
+  {
+    return _seq.load(std::memory_order_acquire) / 2;
+  }
+
+private:
+  T _data;
+  std::atomic<uint32_t> _seq{0};
+};
+
+#endif
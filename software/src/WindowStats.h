@@ -0,0 +1,242 @@
+#ifndef WindowStats_h
+#define WindowStats_h
+
+// Sliding time windows of wind speed and wind direction (3s, 30s, 2min, 10min at the same time)
+// Each window is a ring of buckets of window length / STATS_BUCKETS. A bucket holds the sums, min and max of its samples.
+// The window sums are running sums (the new sample is added, the expired bucket subtracted),
+// min and max are kept in monotonic deques of the bucket numbers. A sample costs the same time for all
+// window lengths and rates, the memory is fixed at compile time (static_assert against STATS_MEMORY).
+// The sums are fixed point integers, the running sums have no rounding drift over days.
+// The window slides in steps of one bucket, it covers (STATS_BUCKETS - 1)...STATS_BUCKETS buckets.
+
+#include "CircularMean.h"
+
+#define STATS_WINDOWS 4                     // Number of windows
+#define STATS_BUCKETS 30                    // Buckets per window, 3s window: 100ms, 10min window: 20s
+#define STATS_MEMORY 4096                   // Max memory of all windows in [Byte] (ESP8266)
+#define STATS_SPEED_SCALE 100               // Fixed point of wind speed, 0.01 m/s
+#define STATS_VECTOR_SCALE 1000             // Fixed point of the direction vectors
+
+const uint32_t statsLength[STATS_WINDOWS] = {3000, 30000, 120000, 600000};    // Window lengths in [ms]
+const char *const statsNames[STATS_WINDOWS] = {"3s", "30s", "2min", "10min"};
+
+// Statistics of one window
+typedef struct {
+  uint32_t count = 0;               // Samples in the window
+  float mean = 0;                   // Mean wind speed in [m/s]
+  float minimum = 0;                // Min wind speed in [m/s]
+  float maximum = 0;                // Max wind speed in [m/s]
+  float direction = 0;              // Vector mean of wind direction 0...360[°]
+  float deviation = 0;              // Circular standard deviation of wind direction in [°]
+} windowResult;
+
+class SlidingWindow
+{
+public:
+  // length in [ms]
+  void begin(uint32_t length, uint32_t now)
+  {
+    _bucketTime = max(length / STATS_BUCKETS, uint32_t(1));
+    clear(now);
+  }
+
+  // speed in 0.01 m/s, direction as vector with length STATS_VECTOR_SCALE
+  void add(uint32_t now, uint16_t speed, int32_t sine, int32_t cosine)
+  {
+    add(now, speed, speed, speed, sine, cosine);
+  }
+
+  // Sample with the range of the values since the last sample, min and max of the window include the range
+  void add(uint32_t now, uint16_t speed, uint16_t minimum, uint16_t maximum, int32_t sine, int32_t cosine)
+  {
+    advance(now);
+    statsBucket &bucket = _buckets[_bucket % STATS_BUCKETS];
+    if (bucket.count == 0 || minimum < bucket.minimum)
+    {
+      bucket.minimum = minimum;
+    }
+    if (bucket.count == 0 || maximum > bucket.maximum)
+    {
+      bucket.maximum = maximum;
+    }
+    bucket.speed += speed;
+    bucket.sine += sine;
+    bucket.cosine += cosine;
+    bucket.count++;
+    _speed += speed;
+    _sine += sine;
+    _cosine += cosine;
+    _count++;
+  }
+
+  windowResult result(uint32_t now)
+  {
+    advance(now);
+    windowResult r;
+    r.count = _count;
+    if (_count == 0)
+    {
+      return r;
+    }
+    const statsBucket &bucket = _buckets[_bucket % STATS_BUCKETS];
+    uint16_t minimum = bucket.count > 0 ? bucket.minimum : UINT16_MAX;
+    uint16_t maximum = bucket.count > 0 ? bucket.maximum : 0;
+    if (_min.size > 0)
+    {
+      minimum = min(minimum, _buckets[_min.front() % STATS_BUCKETS].minimum);
+    }
+    if (_max.size > 0)
+    {
+      maximum = max(maximum, _buckets[_max.front() % STATS_BUCKETS].maximum);
+    }
+    r.mean = float(_speed) / _count / STATS_SPEED_SCALE;
+    r.minimum = float(minimum) / STATS_SPEED_SCALE;
+    r.maximum = float(maximum) / STATS_SPEED_SCALE;
+    CircularMean direction;
+    direction.addVector(float(_sine) / STATS_VECTOR_SCALE, float(_cosine) / STATS_VECTOR_SCALE, _count);
+    r.direction = direction.direction();
+    r.deviation = direction.deviation();
+    return r;
+  }
+
+private:
+  // Samples of one bucket
+  typedef struct {
+    int32_t speed = 0;
+    int32_t sine = 0;
+    int32_t cosine = 0;
+    uint16_t count = 0;
+    uint16_t minimum = 0;
+    uint16_t maximum = 0;
+  } statsBucket;
+
+  // Deque of bucket numbers, the front is the min (max) of the closed buckets in the window
+  typedef struct {
+    uint32_t bucket[STATS_BUCKETS];
+    uint8_t head = 0;
+    uint8_t size = 0;
+    uint32_t front() const { return bucket[head]; }
+    uint32_t back() const { return bucket[(head + size - 1) % STATS_BUCKETS]; }
+    void popFront() { head = (head + 1) % STATS_BUCKETS; size--; }
+    void popBack() { size--; }
+    void push(uint32_t b) { bucket[(head + size) % STATS_BUCKETS] = b; size++; }
+  } statsDeque;
+
+  void clear(uint32_t now)
+  {
+    for (int i = 0; i < STATS_BUCKETS; i++)
+    {
+      _buckets[i] = statsBucket();
+    }
+    _min.size = 0;
+    _max.size = 0;
+    _speed = 0;
+    _sine = 0;
+    _cosine = 0;
+    _count = 0;
+    _start = now;
+  }
+
+  // Close the buckets up to now, a gap longer than the window clears it
+  void advance(uint32_t now)
+  {
+    uint32_t steps = (now - _start) / _bucketTime;
+    if (steps == 0)
+    {
+      return;
+    }
+    if (steps >= STATS_BUCKETS)
+    {
+      clear(now);
+      return;
+    }
+    _start += steps * _bucketTime;
+    while (steps-- > 0)
+    {
+      next();
+    }
+  }
+
+  void next()
+  {
+    // Closed bucket into the deques, monotonic from front to back
+    const statsBucket &closed = _buckets[_bucket % STATS_BUCKETS];
+    if (closed.count > 0)
+    {
+      while (_min.size > 0 && _buckets[_min.back() % STATS_BUCKETS].minimum >= closed.minimum)
+      {
+        _min.popBack();
+      }
+      _min.push(_bucket);
+      while (_max.size > 0 && _buckets[_max.back() % STATS_BUCKETS].maximum <= closed.maximum)
+      {
+        _max.popBack();
+      }
+      _max.push(_bucket);
+    }
+    _bucket++;
+    // The new bucket reuses the slot of the bucket leaving the window
+    statsBucket &expired = _buckets[_bucket % STATS_BUCKETS];
+    _speed -= expired.speed;
+    _sine -= expired.sine;
+    _cosine -= expired.cosine;
+    _count -= expired.count;
+    expired = statsBucket();
+    if (_min.size > 0 && _bucket - _min.front() >= STATS_BUCKETS)
+    {
+      _min.popFront();
+    }
+    if (_max.size > 0 && _bucket - _max.front() >= STATS_BUCKETS)
+    {
+      _max.popFront();
+    }
+  }
+
+  statsBucket _buckets[STATS_BUCKETS];
+  statsDeque _min;
+  statsDeque _max;
+  uint32_t _bucket = 0;                     // Number of the open bucket
+  uint32_t _bucketTime = 1;                 // Bucket length in [ms]
+  uint32_t _start = 0;                      // Start of the open bucket in [ms]
+  int32_t _speed = 0;                       // Running sums of the window
+  int32_t _sine = 0;
+  int32_t _cosine = 0;
+  uint32_t _count = 0;
+};
+
+class WindowStats
+{
+public:
+  void begin(uint32_t now)
+  {
+    for (int i = 0; i < STATS_WINDOWS; i++)
+    {
+      _windows[i].begin(statsLength[i], now);
+    }
+  }
+
+  // One sample, speed in [m/s], direction 0...360[°]
+  void add(uint32_t now, float speed, float direction)
+  {
+    float rad = direction * DEG_TO_RAD;
+    uint16_t s = uint16_t(constrain(speed, 0.0f, 600.0f) * STATS_SPEED_SCALE + 0.5f);
+    int32_t sine = lroundf(sinf(rad) * STATS_VECTOR_SCALE);
+    int32_t cosine = lroundf(cosf(rad) * STATS_VECTOR_SCALE);
+    for (int i = 0; i < STATS_WINDOWS; i++)
+    {
+      _windows[i].add(now, s, sine, cosine);
+    }
+    _samples++;
+  }
+
+  windowResult result(int window, uint32_t now) { return _windows[window].result(now); }
+  uint32_t samples() const { return _samples; }               // Samples since start
+
+private:
+  SlidingWindow _windows[STATS_WINDOWS];
+  uint32_t _samples = 0;
+};
+
+static_assert(sizeof(WindowStats) <= STATS_MEMORY, "Window statistics exceed the memory budget");
+
+#endif
@@ -1,16 +1,17 @@
 // Device information webpage
-String Devinfo()
+void Devinfo(PageWriter &content)
 {
  // Debug info
  DebugPrintln(3, "Send info.html");
 
  // Page content with auto reload
- String content;
  content +=F( "<!DOCTYPE html>");
  content +=F( "<html>");
  content +=F( "<head>");
  content +=F( "<title>Info Windsensor</title>");
- content +=F( "<link rel='stylesheet' type='text/css' href='/css'>");
+ content +=F( "<link rel='stylesheet' type='text/css' href='");
+ content += cssAsset().path;
+ content +=F( "'>");
  content +=F( "<meta http-equiv='content-type' content='text/html; charset=UTF-8'>");
  content +=F( "<meta name=viewport content='width=device-width, initial-scale=1'>");
  content +=F( "<style>");
@@ -18,7 +19,9 @@ String Devinfo()
  content +=F( "</style>");
  content +=F( "</head>");
  content +=F( "<body>");
- content +=F( "<script src='/js' type='text/javascript'></script>");
+ content +=F( "<script src='");
+ content += staticAssets[ASSET_DEVINFO_JS].path;
+ content +=F( "' type='text/javascript'></script>");
  
  // Web page title
  content +=F( "<h2>");
@@ -306,6 +309,4 @@ String Devinfo()
  content +=F( "<br>");
  content +=F( "</body>");
  content +=F( "</html>");
-
- return content;
 }
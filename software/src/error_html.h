@@ -10,7 +10,9 @@ String Error()
  content +=F( "<html>\r\n");
  content +=F( "<head>\r\n");
  content +=F( "<title>Error Windsensor</title>\r\n");
- content +=F( "<link rel='stylesheet' type='text/css' href='/css'>\r\n");
+ content +=F( "<link rel='stylesheet' type='text/css' href='");
+ content += cssAsset().path;
+ content +=F( "'>\r\n");
  content +=F( "<meta http-equiv='content-type' content='text/html; charset=UTF-8'>\r\n");
  content +=F( "<meta name=viewport content='width=device-width, initial-scale=1'>\r\n");
  content +=F( "<meta http-equiv='refresh' content='5; URL=/'>\r\n");
@@ -27,10 +27,17 @@ String Firmware(int num, String vname[20], String value[20])
    content +=F( "<html>");
    content +=F( "<head>");
    content +=F( "<title>Restart Windsensor</title>");
-   content +=F( "<link rel='stylesheet' type='text/css' href='/css'>");
+   content +=F( "<link rel='stylesheet' type='text/css' href='");
+   content += cssAsset().path;
+   content +=F( "'>");
    content +=F( "<meta http-equiv='content-type' content='text/html; charset=UTF-8'>");
    content +=F( "<meta name=viewport content='width=device-width, initial-scale=1'>");
-   content +=F( "<script src='MD5.js' type='text/javascript'></script>");
+   content +=F( "<script src='");
+   content += staticAssets[ASSET_MD5_JS].path;
+   content +=F( "' type='text/javascript'></script>");
+   content +=F( "<script>var transactionID = ");
+   content += transactionID;
+   content +=F( ";</script>");
    content +=F( " <style>");
   // content += CSS();
    content +=F( "</style>");
@@ -45,7 +52,7 @@ String Firmware(int num, String vname[20], String value[20])
    content +=F( ", "); 
    content += String(actconf.fversion);
    content +=F( ", CQ: ");
-   content += String(int(quality));
+   content += String(int(windData.read().quality));
    content +=F( "%"); 
    content +=F( "<hr align='left'>");
    
@@ -73,7 +80,9 @@ String Firmware(int num, String vname[20], String value[20])
    content +=F( "<meta name=viewport content='width=device-width, initial-scale=1'>");
    content +=F( "<title>Update Windsensor</title>");
    
-   content +=F( "<link rel='stylesheet' type='text/css' href='/css'>");
+   content +=F( "<link rel='stylesheet' type='text/css' href='");
+   content += cssAsset().path;
+   content +=F( "'>");
    content +=F( " <style>");
   // content += CSS();
    content +=F( "</style>");
@@ -192,7 +201,7 @@ String Firmware(int num, String vname[20], String value[20])
    content +=F( ", "); 
    content += String(actconf.fversion);
    content +=F( ", CQ: ");
-   content += String(int(quality));
+   content += String(int(windData.read().quality));
    content +=F( "%"); 
    content +=F( "<hr align='left'>");
    
@@ -0,0 +1,359 @@
+// Range query of the history /history?from=&to=&step=&format=&mode=
+// from, to: history time in [s], 0 and negative values are relative to the newest record (default -86400 and 0)
+// step: resolution in [s] (default 60), < 60 = 1 Hz records from LittleFS (max 1h from...to, else 400),
+// >= 60 = minute aggregates in RAM (24h)
+// mode: minmax = min/max/mean buckets of step (default), lttb = minute means selected with Largest-Triangle-Three-Buckets
+// format: csv (default), json or bin = written pages of the ring in LittleFS (HistoryRecorder.h), with Range requests
+// The rows are collected in a small buffer and sent as chunks, no String for the whole response
+// The temperature is always in [°C], independent of tempUnit
+
+#define HISTORY_BUFFER 512            // Buffer for the chunks in [Byte]
+#define HISTORY_LINE 96               // Max length of one row
+#define HISTORY_RAW_SPAN 3600         // Max time span of a query of the 1 Hz records in [s], read in one loop()
+
+template <typename Server>
+class HistoryWriter
+{
+public:
+  HistoryWriter(Server &server, bool json) : _server(server), _json(json) {}
+
+  void begin(uint32_t now, uint32_t from, uint32_t to, uint32_t step, const char *mode)
+  {
+    if (_json)
+    {
+      line("{\"Now\":%lu,\"From\":%lu,\"To\":%lu,\"Step\":%lu,\"Mode\":\"%s\",", (unsigned long)now,
+           (unsigned long)from, (unsigned long)to, (unsigned long)step, mode);
+      line("\"Fields\":[\"time\",\"speed\",\"min\",\"max\",\"gust\",\"direction\",\"temperature\",\"pressure\"],");
+      line("\"Units\":[\"s\",\"m/s\",\"m/s\",\"m/s\",\"m/s\",\"deg\",\"C\",\"mbar\"],\"Data\":[");
+    }
+    else
+    {
+      line("time,speed,min,max,gust,direction,temperature,pressure\n");
+    }
+  }
+
+  void row(const minuteValues &v)
+  {
+    line(_json ? "%s[%lu,%.1f,%.1f,%.1f,%.1f,%.0f,%.1f,%.1f]" : "%s%lu,%.1f,%.1f,%.1f,%.1f,%.0f,%.1f,%.1f\n",
+         _json && _rows > 0 ? "," : "", (unsigned long)v.time, v.speed, v.minimum, v.maximum, v.gust,
+         v.direction, v.temperature, v.pressure);
+    _rows++;
+  }
+
+  // One record of the history, min and max are the speed
+  void row(const historyRecord &r)
+  {
+    minuteValues v;
+    v.time = r.time;
+    v.speed = r.speed * 0.1f;
+    v.minimum = v.speed;
+    v.maximum = v.speed;
+    v.gust = r.gust * 0.1f;
+    v.direction = r.direction;
+    v.temperature = r.temperature * 0.1f;
+    v.pressure = r.pressure * 0.1f;
+    row(v);
+  }
+
+  // End of the data and rest of the buffer
+  void end()
+  {
+    if (_json)
+    {
+      line("]}");
+    }
+    if (_length > 0)
+    {
+      _server.sendContent(_buffer, _length);
+      _length = 0;
+    }
+  }
+
+private:
+  void line(const char *format, ...)
+  {
+    if (sizeof(_buffer) - _length < HISTORY_LINE)
+    {
+      _server.sendContent(_buffer, _length);
+      _length = 0;
+    }
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(_buffer + _length, HISTORY_LINE, format, args);
+    va_end(args);
+    if (length > 0)
+    {
+      _length += min(length, HISTORY_LINE - 1);
+    }
+  }
+
+  Server &_server;
+  bool _json;
+  char _buffer[HISTORY_BUFFER];
+  size_t _length = 0;
+  uint32_t _rows = 0;
+};
+
+// Written pages of the ring, Range: bytes=a-b, a- or -n for resumable downloads
+// The ETag is the time of the oldest page, it changes when the start of the byte stream is overwritten.
+template <typename Server>
+void sendHistoryBinary(Server &server)
+{
+  uint32_t total = history.bytes();
+  uint32_t start = 0;
+  uint32_t length = total;
+  char etag[16];
+  snprintf(etag, sizeof(etag), "\"%08lx\"", (unsigned long)history.oldest());
+  server.sendHeader("Accept-Ranges", "bytes");
+  server.sendHeader("ETag", etag);
+  server.sendHeader("Cache-Control", "no-cache");
+  const String &range = server.header("Range");
+  // A Range with an other If-Range is answered with the whole stream
+  if (range.startsWith("bytes=") && (!server.hasHeader("If-Range") || server.header("If-Range") == etag))
+  {
+    int dash = range.indexOf('-');
+    String first = range.substring(6, dash < 0 ? range.length() : dash);
+    String last = dash < 0 ? String() : range.substring(dash + 1);
+    uint32_t stop = total > 0 ? total - 1 : 0;
+    bool valid = dash >= 0 && range.indexOf(',') < 0 && (first.length() > 0 || last.length() > 0);
+    if (first.length() > 0)
+    {
+      start = strtoul(first.c_str(), nullptr, 10);
+      if (last.length() > 0)
+      {
+        stop = min(uint32_t(strtoul(last.c_str(), nullptr, 10)), stop);
+        valid = valid && stop >= start;
+      }
+    }
+    else if (valid)
+    {
+      uint32_t suffix = strtoul(last.c_str(), nullptr, 10);   // Last n bytes
+      valid = suffix > 0;
+      start = total - min(suffix, total);
+    }
+    if (!valid || start >= total)
+    {
+      char contentRange[24];
+      snprintf(contentRange, sizeof(contentRange), "bytes */%lu", (unsigned long)total);
+      server.sendHeader("Content-Range", contentRange);
+      server.send(416, "text/plain", "");
+      return;
+    }
+    length = stop - start + 1;
+    char contentRange[40];
+    snprintf(contentRange, sizeof(contentRange), "bytes %lu-%lu/%lu", (unsigned long)start, (unsigned long)stop,
+             (unsigned long)total);
+    server.sendHeader("Content-Range", contentRange);
+  }
+  server.sendHeader("Content-Disposition", "attachment; filename=\"history.bin\"");
+  server.setContentLength(length);
+  server.send(length < total ? 206 : 200, "application/octet-stream", "");
+  history.readBytes(start, length, [&server](const uint8_t *data, size_t size) {
+    server.sendContent((const char *)data, size);
+  });
+}
+
+// Time argument, 0 and negative values relative to now
+template <typename Server>
+uint32_t historyTime(Server &server, const char *name, long relative, uint32_t now)
+{
+  long value = server.hasArg(name) ? server.arg(name).toInt() : relative;
+  if (value > 0)
+  {
+    return uint32_t(value);
+  }
+  return uint32_t(-value) < now ? now + value : 0;
+}
+
+// Buckets of step seconds (whole minutes) from the minute aggregates, aligned to multiples of step
+template <typename Server>
+void sendHistoryBuckets(HistoryWriter<Server> &w, uint32_t from, uint32_t to, uint32_t step)
+{
+  if (minuteHistory.count() == 0)
+  {
+    return;
+  }
+  uint32_t minutes = step / 60;
+  uint32_t oldest = minuteHistory.newest() - minuteHistory.count() + 1;
+  uint32_t first = max(from / step, oldest / minutes) * minutes;
+  uint32_t last = min(to / 60, minuteHistory.newest());
+  for (uint32_t bucket = first; bucket <= last; bucket += minutes)
+  {
+    minuteValues sum, v;
+    CircularMean direction;
+    uint32_t count = 0;
+    for (uint32_t m = bucket; m < bucket + minutes && m <= last; m++)
+    {
+      if (!minuteHistory.get(m, v))
+      {
+        continue;
+      }
+      if (count == 0)
+      {
+        sum = v;
+        sum.time = bucket * 60;
+      }
+      else
+      {
+        sum.speed += v.speed;
+        sum.minimum = min(sum.minimum, v.minimum);
+        sum.maximum = max(sum.maximum, v.maximum);
+        sum.gust = max(sum.gust, v.gust);
+        sum.temperature += v.temperature;
+        sum.pressure += v.pressure;
+      }
+      direction.add(v.direction);
+      count++;
+    }
+    if (count > 0)
+    {
+      sum.speed /= count;
+      sum.direction = direction.direction();
+      sum.temperature /= count;
+      sum.pressure /= count;
+      w.row(sum);
+    }
+  }
+}
+
+// Largest-Triangle-Three-Buckets on the mean wind speed of the minutes, about (to - from) / step points
+// Keeps the peaks of the curve, the first and the last minute are always included.
+template <typename Server>
+void sendHistoryLTTB(HistoryWriter<Server> &w, uint32_t from, uint32_t to, uint32_t step)
+{
+  // Valid minutes are one continuous range up to the newest minute
+  uint32_t newest = minuteHistory.newest();
+  uint32_t count = minuteHistory.count();
+  if (count == 0)
+  {
+    return;
+  }
+  uint32_t oldest = newest - count + 1;
+  uint32_t first = max(from / 60, oldest);
+  uint32_t last = min(to / 60, newest);
+  if (int32_t(last - first) < 0)
+  {
+    return;
+  }
+  uint32_t n = last - first + 1;
+  uint32_t points = max((to - from) / step + 1, uint32_t(3));
+  minuteValues a, v;
+  if (points >= n)
+  {
+    for (uint32_t m = first; m <= last; m++)
+    {
+      if (minuteHistory.get(m, v))
+      {
+        w.row(v);
+      }
+    }
+    return;
+  }
+  minuteHistory.get(first, a);
+  w.row(a);
+  uint32_t selected = first;
+  float size = float(n - 2) / (points - 2);
+  for (uint32_t i = 0; i < points - 2; i++)
+  {
+    uint32_t start = first + 1 + uint32_t(i * size);
+    uint32_t stop = first + 1 + uint32_t((i + 1) * size);
+    // Mean point of the next bucket
+    uint32_t nextStop = min(first + 1 + uint32_t((i + 2) * size), last + 1);
+    float x = 0, y = 0;
+    if (nextStop > stop)
+    {
+      for (uint32_t m = stop; m < nextStop; m++)
+      {
+        minuteHistory.get(m, v);
+        x += m;
+        y += v.speed;
+      }
+      x /= nextStop - stop;
+      y /= nextStop - stop;
+    }
+    else
+    {
+      minuteHistory.get(last, v);         // Last bucket, the next point is the last minute
+      x = last;
+      y = v.speed;
+    }
+    // Point of this bucket with the largest triangle
+    float largest = -1;
+    uint32_t best = start;
+    for (uint32_t m = start; m < stop; m++)
+    {
+      minuteHistory.get(m, v);
+      float area = fabsf((float(selected) - x) * (v.speed - a.speed) - (float(selected) - m) * (y - a.speed));
+      if (area > largest)
+      {
+        largest = area;
+        best = m;
+      }
+    }
+    minuteHistory.get(best, a);
+    selected = best;
+    w.row(a);
+  }
+  minuteHistory.get(last, v);
+  w.row(v);
+}
+
+template <typename Server>
+void sendHistory(Server &server)
+{
+  String format = server.arg("format");
+  if (format == "bin")
+  {
+    sendHistoryBinary(server);
+    return;
+  }
+  bool json = format == "json";
+  bool lttb = server.arg("mode") == "lttb";
+  uint32_t now = history.time() > 0 ? history.time() - 1 : 0;
+  uint32_t from = historyTime(server, "from", -86400, now);
+  uint32_t to = historyTime(server, "to", 0, now);
+  long step = server.hasArg("step") ? server.arg("step").toInt() : 60;
+  step = step >= 60 ? step / 60 * 60 : max(step, 1L);
+  if (int32_t(to - from) < 0)
+  {
+    server.send(400, "text/plain", "from > to");
+    return;
+  }
+  if (step < 60 && to - from > HISTORY_RAW_SPAN)
+  {
+    server.send(400, "text/plain", "to - from > 3600s with step < 60");
+    return;
+  }
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  server.sendHeader("Cache-Control", "no-cache");
+  server.send(200, json ? "application/json" : "text/csv", "");
+  HistoryWriter<Server> w(server, json);
+  w.begin(now, from, to, uint32_t(step), step < 60 ? "raw" : lttb ? "lttb" : "minmax");
+  if (step < 60)
+  {
+    // Every step-th second of the 1 Hz records in LittleFS
+    uint32_t next = from;
+    history.read(from, [&w, &next, from, to, step](const historyRecord &r) {
+      if (int32_t(r.time - to) > 0)
+      {
+        return false;
+      }
+      if (int32_t(r.time - next) >= 0)
+      {
+        w.row(r);
+        next = from + ((r.time - from) / step + 1) * step;
+      }
+      return true;
+    });
+  }
+  else if (lttb)
+  {
+    sendHistoryLTTB(w, from, to, uint32_t(step));
+  }
+  else
+  {
+    sendHistoryBuckets(w, from, to, uint32_t(step));
+  }
+  w.end();
+}
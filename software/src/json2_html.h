@@ -19,6 +19,9 @@ String JSON2()
       sensor2 += String(boolToInt(sensor2TimeArray[i])); 
     }
     
+    // Consistent data of one calculation cycle
+    WindSnapshot wd = windData.read();
+
     // Page content
     String content = "";
 
@@ -28,21 +31,21 @@ String JSON2()
       
         content +=F( "\"ConnectionQuality\": {");
         content +=F( "\"Value\": ");
-        content += String(quality);
+        content += String(wd.quality);
         content +=F( ",");
         content +=F( "\"Unit\": \"%\"");
         content +=F( "},");
   
         content +=F( "\"Speed\": {");
         content +=F( "\"Value\": ");
-        content += String(windspeed_mps);
+        content += String(wd.windspeed_mps);
         content +=F( ",");
         content +=F( "\"Unit\": \"mps\"");
         content +=F( "},");
   
         content +=F( "\"Direction\": {");
         content +=F( "\"Value\": ");
-        content += String(rawwinddirection);
+        content += String(wd.rawwinddirection);
         content +=F( ",");
         content +=F( "\"Unit\": \"°\"");
         content +=F( "},");
@@ -56,7 +59,7 @@ String JSON2()
     
           content +=F( "\"Time1\": {");
           content +=F( "\"Value\": ");
-          content += String(time1);
+          content += String(wd.time1);
           content +=F( ",");
           content +=F( "\"Unit\": \"ms\"");
           content +=F( "},");
@@ -79,7 +82,7 @@ String JSON2()
     
           content +=F( "\"Time2\": {");
           content +=F( "\"Value\": ");
-          content += String(time2);
+          content += String(wd.time2);
           content +=F( ",");
           content +=F( "\"Unit\": \"ms\"");
           content +=F( "},");
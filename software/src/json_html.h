@@ -13,26 +13,16 @@ String JSON()
     // The main loop calculate the data all 1s.
     // This limited the data rate
 
+    // Consistent data of one calculation cycle
+    WindSnapshot wd = windData.read();
+
     // Wind speed value for Web interface depends on unit
-    windspeed = windspeed_mps;
-    if (String(actconf.speedUnit) == "km/h") {
-       windspeed = windspeed_kph;
-     }
-     if (String(actconf.speedUnit) == "kn") {
-       windspeed = windspeed_kn;
-     }
-     if (String(actconf.speedUnit) == "bft") {
-       windspeed = windspeed_bft;
-     }
-     if ((winddirection > (180 - actconf.downWindRange)) && (winddirection < (actconf.downWindRange + 180))){
-      dwspeed = windspeed;
-     }
-     else{
-      dwspeed = 0;
-     }
+    float windspeed = webWindSpeed(wd);
+    float dwspeed = webDownWindSpeed(wd);
         
     // Page content
     String content = "";
+    char sentence[NMEA_MAX_LENGTH];       // Buffer for NMEA telegrams
     content +=F(  "{");
     content +=F( "\"Device\": {");
     content +=F( "\"Type\": \"");
@@ -81,17 +71,90 @@ String JSON()
 
     content +=F( "\"FieldStrength\": {");
     content +=F( "\"Value\": ");
-    content += String(fieldstrength);
+    content += String(wd.fieldstrength);
     content +=F( ",");
     content +=F( "\"Unit\": \"dBm\"");
     content +=F( "},");
     content +=F( "\"ConnectionQuality\": {");
     content +=F( "\"Value\": ");
-    content += String(quality);
+    content += String(wd.quality);
     content +=F( ",");
     content +=F( "\"Unit\": \"%\"");
     content +=F( "},");
     
+    content +=F( "\"NMEAClients\": {");
+    content +=F( "\"Value\": ");
+    content += String(nmeaServer.clients());
+    content +=F( ",");
+    content +=F( "\"Max\": ");
+    content += String(NMEA_MAX_CLIENTS);
+    content +=F( ",");
+    content +=F( "\"Unit\": \"n\"");
+    content +=F( "},");
+    content +=F( "\"NMEABytes\": {");
+    content +=F( "\"Value\": ");
+    content += String(nmeaServer.bytes());
+    content +=F( ",");
+    content +=F( "\"Unit\": \"Byte\"");
+    content +=F( "},");
+    content +=F( "\"NMEADrops\": {");
+    content +=F( "\"Value\": ");
+    content += String(nmeaServer.drops());
+    content +=F( ",");
+    content +=F( "\"Unit\": \"n\"");
+    content +=F( "},");
+    content +=F( "\"NMEADisconnects\": {");
+    content +=F( "\"Value\": ");
+    content += String(nmeaServer.disconnects());
+    content +=F( ",");
+    content +=F( "\"Unit\": \"n\"");
+    content +=F( "},");
+    content +=F( "\"NMEAUdpPackets\": {");
+    content +=F( "\"Value\": ");
+    content += String(nmeaUdp.packets());
+    content +=F( ",");
+    content +=F( "\"Unit\": \"n\"");
+    content +=F( "},");
+    content +=F( "\"NMEAUdpErrors\": {");
+    content +=F( "\"Value\": ");
+    content += String(nmeaUdp.errors());
+    content +=F( ",");
+    content +=F( "\"Unit\": \"n\"");
+    content +=F( "},");
+    content +=F( "\"MQTTConnected\": ");
+    content += String(int(mqtt.connected()));
+    content +=F( ",");
+    content +=F( "\"MQTTBatches\": {");
+    content +=F( "\"Value\": ");
+    content += String(mqtt.batches());
+    content +=F( ",");
+    content +=F( "\"Unit\": \"n\"");
+    content +=F( "},");
+    content +=F( "\"MQTTErrors\": {");
+    content +=F( "\"Value\": ");
+    content += String(mqtt.errors());
+    content +=F( ",");
+    content +=F( "\"Unit\": \"n\"");
+    content +=F( "},");
+    content +=F( "\"EventClients\": {");
+    content +=F( "\"Value\": ");
+    content += String(eventServer.clients());
+    content +=F( ",");
+    content +=F( "\"Max\": ");
+    content += String(EVENT_MAX_CLIENTS);
+    content +=F( ",");
+    content +=F( "\"Unit\": \"n\"");
+    content +=F( "},");
+    content +=F( "\"LiveClients\": {");
+    content +=F( "\"Value\": ");
+    content += String(liveServer.clients());
+    content +=F( ",");
+    content +=F( "\"Max\": ");
+    content += String(WEBSOCKETS_SERVER_CLIENT_MAX);
+    content +=F( ",");
+    content +=F( "\"Unit\": \"n\"");
+    content +=F( "},");
+    
     content +=F( "\"WLANServerSSID\": \"");
     content += String(actconf.sssid);
     content +=F( "\",");
@@ -132,6 +195,9 @@ String JSON()
     content +=F( "\"SendWindData\": ");
     content += String(actconf.windSensor);
     content +=F( ",");
+    content +=F( "\"SendGustData\": ");
+    content += String(actconf.gustData);
+    content +=F( ",");
     content +=F( "\"WindType\": \"");
     content += String(actconf.windType);
     content +=F( "\",");
@@ -155,12 +221,17 @@ String JSON()
     content +=F( ",");
     content +=F( "\"TempUnit\": \"°");
     content += String(actconf.tempUnit);
-    content +=F( "\"");
+    content +=F( "\",");
+    content +=F( "\"TempResolution\": ");
+    content += String(ds18b20.resolution());
+    content +=F( ",");
+    content +=F( "\"HistorySize\": ");
+    content += String(history.size() / 1024);
     content +=F( "},");
     content +=F( "\"MeasuringValues\": {");
     content +=F( "\"DeviceTemperature\": {");
     content +=F( "\"Value\": ");
-    content += String(temperature);
+    content += String(wd.temperature);
     content +=F( ",");
     content +=F( "\"Unit\": \"°");
     content += String(actconf.tempUnit);
@@ -168,13 +239,19 @@ String JSON()
     content +=F( "},");
     content +=F( "\"WindDirection\": {");
     content +=F( "\"Value\": ");
-    content += String(winddirection);
+    content += String(wd.winddirection);
     content +=F( ",");
     content +=F( "\"Unit\": \"°\"");
     content +=F( "},");
     content +=F( "\"Resolution\": {");
     content +=F( "\"Value\": ");
-    content += String(dirresolution);
+    content += String(wd.dirresolution);
+    content +=F( ",");
+    content +=F( "\"Unit\": \"°\"");
+    content +=F( "},");
+    content +=F( "\"DirDeviation\": {");
+    content +=F( "\"Value\": ");
+    content += String(wd.dirdeviation);
     content +=F( ",");
     content +=F( "\"Unit\": \"°\"");
     content +=F( "},");
@@ -209,13 +286,13 @@ String JSON()
 
     content +=F( "\"MagFluxDensity\": {");
     content +=F( "\"Value\": ");
-    content += String(magnitude);
+    content += String(wd.magnitude);
     content +=F( ",");
     content +=F( "\"Unit\": \"mT\"");
     content +=F( "},");  
     content +=F( "\"MagnetSensor\": {");
     content +=F( "\"Value\": ");
-    content += String(magsensor);
+    content += String(wd.magsensor);
     content +=F( ",");
     content +=F( "\"Unit\": \"°\"");
     content +=F( "},");
@@ -226,31 +303,45 @@ String JSON()
     content +=F( ",");
     content +=F( "\"Unit\": \"n\"");
     content +=F( "},");
+
+    content +=F( "\"PulseOverflows\": {");
+    content +=F( "\"Value\": ");
+    content += String(pulseRing.overflows());
+    content +=F( ",");
+    content +=F( "\"Unit\": \"n\"");
+    content +=F( "},");
+
+    content +=F( "\"Epoch\": {");
+    content +=F( "\"Value\": ");
+    content += String(wd.epoch);
+    content +=F( ",");
+    content +=F( "\"Unit\": \"n\"");
+    content +=F( "},");
        
     content +=F( "\"Time1\": {");
     content +=F( "\"Value\": ");
-    content += String(time1);
+    content += String(wd.time1);
     content +=F( ",");
     content +=F( "\"Unit\": \"ms\"");
     content +=F( "},");
     
     content +=F( "\"Time2\": {");
     content +=F( "\"Value\": ");
-    content += String(time2);
+    content += String(wd.time2);
     content +=F( ",");
     content +=F( "\"Unit\": \"ms\"");
     content +=F( "},");
     
     content +=F( "\"RotationSpeed\": {");
     content +=F( "\"Value\": ");
-    content += String(windspeed_hz);
+    content += String(wd.windspeed_hz);
     content +=F( ",");
     content +=F( "\"Unit\": \"rps\"");
     content +=F( "},");
 
     content +=F( "\"AirTemperature\": {");
     content +=F( "\"Value\": ");
-    content += String(airtemperature);
+    content += String(wd.airtemperature);
     content +=F( ",");
     content +=F( "\"Unit\": \"°");
     content += String(actconf.tempUnit);
@@ -259,21 +350,21 @@ String JSON()
 
     content +=F( "\"AirPressure\": {");
     content +=F( "\"Value\": ");
-    content += String(airpressure);
+    content += String(wd.airpressure);
     content +=F( ",");
     content +=F( "\"Unit\": \"mbar\"");
     content +=F( "},");
 
     content +=F( "\"AirHumidity\": {");
     content +=F( "\"Value\": ");
-    content += String(airhumidity);
+    content += String(wd.airhumidity);
     content +=F( ",");
     content +=F( "\"Unit\": \"%\"");
     content +=F( "},");
 
     content +=F( "\"Dewpoint\": {");
     content +=F( "\"Value\": ");
-    content += String(dewpoint);
+    content += String(wd.dewpoint);
     content +=F( ",");
     content +=F( "\"Unit\": \"°");
     content += String(actconf.tempUnit);
@@ -282,27 +373,84 @@ String JSON()
 
     content +=F( "\"Altitude\": {");
     content +=F( "\"Value\": ");
-    content += String(altitude);
+    content += String(wd.altitude);
     content +=F( ",");
     content +=F( "\"Unit\": \"m\"");
     content +=F( "}");
     
+    content +=F( "},");
+    // Sliding windows, wind speed in m/s
+    content +=F( "\"WindStatistics\": {");
+    for(int i = 0; i < STATS_WINDOWS; i++){
+      const windowResult &ws = wd.stats[i];
+      content +=F( "\"");
+      content += statsNames[i];
+      content +=F( "\": {");
+      content +=F( "\"Samples\": ");
+      content += String(ws.count);
+      content +=F( ",");
+      content +=F( "\"SpeedMean\": {\"Value\": ");
+      content += String(ws.mean);
+      content +=F( ",\"Unit\": \"m/s\"},");
+      content +=F( "\"SpeedMin\": {\"Value\": ");
+      content += String(ws.minimum);
+      content +=F( ",\"Unit\": \"m/s\"},");
+      content +=F( "\"SpeedMax\": {\"Value\": ");
+      content += String(ws.maximum);
+      content +=F( ",\"Unit\": \"m/s\"},");
+      content +=F( "\"Direction\": {\"Value\": ");
+      content += String(ws.direction);
+      content +=F( ",\"Unit\": \"°\"},");
+      content +=F( "\"DirDeviation\": {\"Value\": ");
+      content += String(ws.deviation);
+      content +=F( ",\"Unit\": \"°\"}");
+      content +=F( "}");
+      if(i < STATS_WINDOWS - 1){
+        content +=F( ",");
+      }
+    }
+    content +=F( "},");
+    // Gusts detected on each rotation, wind speed in m/s
+    content +=F( "\"WindGusts\": {");
+    content +=F( "\"Gust\": {\"Value\": ");
+    content += String(wd.gust);
+    content +=F( ",\"Unit\": \"m/s\"},");
+    content +=F( "\"Mean10min\": {\"Value\": ");
+    content += String(wd.mean10);
+    content +=F( ",\"Unit\": \"m/s\"},");
+    content +=F( "\"Gust10min\": {\"Value\": ");
+    content += String(wd.gust10);
+    content +=F( ",\"Unit\": \"m/s\"},");
+    content +=F( "\"Lull10min\": {\"Value\": ");
+    content += String(wd.lull10);
+    content +=F( ",\"Unit\": \"m/s\"},");
+    content +=F( "\"Complete\": ");
+    content += String(wd.gustcomplete ? 1 : 0);
     content +=F( "},");
     content +=F( "\"NMEAValues\": {");
     content +=F( "\"String1\": \"");
-    content += sendMWV(0);
+    sendMWV(wd, sentence, sizeof(sentence));
+    content += sentence;
     content +=F( "\",");
     content +=F( "\"String2\": \"");
-    content += sendVWR(0);
+    sendVWR(wd, sentence, sizeof(sentence));
+    content += sentence;
     content +=F( "\",");
     content +=F( "\"String3\": \"");
-    content += sendVPW(0);
+    sendVPW(wd, sentence, sizeof(sentence));
+    content += sentence;
     content +=F( "\",");
     content +=F( "\"String4\": \"");
-    content += sendINF(0);
+    sendINF(wd, sentence, sizeof(sentence));
+    content += sentence;
     content +=F( "\",");
     content +=F( "\"String5\": \"");
-    content += sendWST(0);
+    sendWST(wd, sentence, sizeof(sentence));
+    content += sentence;
+    content +=F( "\",");
+    content +=F( "\"String6\": \"");
+    sendGST(wd, sentence, sizeof(sentence));
+    content += sentence;
     content +=F( "\"");
     content +=F( "}");
     content +=F( "}");
@@ -310,3 +458,20 @@ String JSON()
     
     return content;
 }
+
+// Compact wind record of one calculation cycle for the Server-Sent Events (/events)
+// Same names and units as MeasuringValues in JSON(), the units are known by the pages
+size_t WindEvent(const WindSnapshot &wd, char *buffer, size_t size)
+{
+    int length = snprintf(buffer, size,
+        "{\"Epoch\":%lu,\"WindDirection\":%.2f,\"WindSpeed\":%.2f,\"DownWindSpeed\":%.2f,"
+        "\"DeviceTemperature\":%.2f,\"AirTemperature\":%.2f,\"AirPressure\":%.2f,\"AirHumidity\":%.2f,"
+        "\"Dewpoint\":%.2f,\"Altitude\":%.2f,\"ConnectionQuality\":%.0f}",
+        (unsigned long)wd.epoch, wd.winddirection, webWindSpeed(wd), webDownWindSpeed(wd),
+        wd.temperature, wd.airtemperature, wd.airpressure, wd.airhumidity,
+        wd.dewpoint, wd.altitude, wd.quality);
+    if (length < 0 || size_t(length) >= size) {
+      return 0;
+    }
+    return length;
+}
@@ -0,0 +1,211 @@
+// Monitoring endpoint /metrics in Prometheus text format (version 0.0.4)
+// The lines are collected in a small buffer and sent as chunks, no String for the whole page
+
+#define METRICS_BUFFER 512            // Buffer for the chunks in [Byte]
+#define METRICS_LINE 160              // Max length of one line
+
+template <typename Server>
+class MetricsWriter
+{
+public:
+  MetricsWriter(Server &server) : _server(server) {}
+
+  // HELP and TYPE lines of one metric
+  void family(const char *name, const char *type, const char *help)
+  {
+    line("# HELP %s %s\n", name, help);
+    line("# TYPE %s %s\n", name, type);
+  }
+
+  void value(const char *name, uint64_t value)
+  {
+    line("%s %llu\n", name, (unsigned long long)value);
+  }
+
+  void value(const char *name, double value)
+  {
+    line("%s %.6f\n", name, value);
+  }
+
+  // Value with one label
+  void value(const char *name, const char *label, const char *labelValue, uint64_t value)
+  {
+    line("%s{%s=\"%s\"} %llu\n", name, label, labelValue, (unsigned long long)value);
+  }
+
+  void value(const char *name, const char *label, const char *labelValue, double value)
+  {
+    line("%s{%s=\"%s\"} %.6f\n", name, label, labelValue, value);
+  }
+
+  // Send the rest of the buffer
+  void flush()
+  {
+    if (_length > 0)
+    {
+      _server.sendContent(_buffer, _length);
+      _length = 0;
+    }
+  }
+
+private:
+  void line(const char *format, ...)
+  {
+    if (sizeof(_buffer) - _length < METRICS_LINE)
+    {
+      flush();
+    }
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(_buffer + _length, METRICS_LINE, format, args);
+    va_end(args);
+    if (length > 0)
+    {
+      _length += min(length, METRICS_LINE - 1);
+    }
+  }
+
+  Server &_server;
+  char _buffer[METRICS_BUFFER];
+  size_t _length = 0;
+};
+
+template <typename Server>
+void sendMetrics(Server &server)
+{
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.sendHeader("Cache-Control", "no-cache");
+  server.send(200, "text/plain; version=0.0.4; charset=utf-8", "");
+  MetricsWriter<Server> m(server);
+
+  // Wind sensor
+  m.family("windsensor_pulses_total", "counter", "Edges of the Hall sensors seen by the interrupt routines");
+  m.value("windsensor_pulses_total", "sensor", "speed", uint64_t(metrics.pulses(0)));
+  m.value("windsensor_pulses_total", "sensor", "direction", uint64_t(metrics.pulses(1)));
+  m.family("windsensor_isr_rate_hertz", "gauge", "Interrupt rate of the last calculation cycle");
+  m.value("windsensor_isr_rate_hertz", "sensor", "speed", metrics.rate(0));
+  m.value("windsensor_isr_rate_hertz", "sensor", "direction", metrics.rate(1));
+  m.family("windsensor_pulse_overflows_total", "counter", "Edges lost because the pulse buffer was full");
+  m.value("windsensor_pulse_overflows_total", uint64_t(pulseRing.overflows()));
+  m.family("windsensor_calculation_cycles_total", "counter", "Calculation cycles of the wind data");
+  m.value("windsensor_calculation_cycles_total", uint64_t(windData.epoch()));
+  m.family("windsensor_i2c_errors_total", "counter", "Failed I2C transfers and missing I2C sensors");
+  m.value("windsensor_i2c_errors_total", uint64_t(metrics.i2cErrors()) + i2cBus.errors());
+  m.family("windsensor_i2c_transfers_total", "counter", "I2C transactions of the sensor drivers");
+  m.value("windsensor_i2c_transfers_total", uint64_t(i2cBus.transfers()));
+  m.family("windsensor_i2c_recoveries_total", "counter", "I2C bus recoveries after SDA was held low");
+  m.value("windsensor_i2c_recoveries_total", uint64_t(i2cBus.recoveries()));
+  m.family("windsensor_i2c_restart_failures_total", "counter", "I2C bus recoveries with SDA still low or a failed driver restart");
+  m.value("windsensor_i2c_restart_failures_total", uint64_t(i2cBus.restartFailures()));
+  m.family("windsensor_i2c_max_transfer_seconds", "gauge", "Longest I2C transaction since start");
+  m.value("windsensor_i2c_max_transfer_seconds", i2cBus.maxTime() / 1e6);
+  m.family("windsensor_vane_samples_total", "counter", "Angles read by the vane sampler");
+  m.value("windsensor_vane_samples_total", uint64_t(vane.samples()));
+  m.family("windsensor_vane_errors_total", "counter", "Angles of the vane sampler not read");
+  m.value("windsensor_vane_errors_total", uint64_t(vane.errors()));
+  m.family("windsensor_vane_deviation_degrees", "gauge", "Circular standard deviation of the vane angles of the last cycle");
+  m.value("windsensor_vane_deviation_degrees", vane.deviation());
+  m.family("windsensor_ds18b20_readings_total", "counter", "Finished DS18B20 conversions");
+  m.value("windsensor_ds18b20_readings_total", uint64_t(ds18b20.readings()));
+  m.family("windsensor_ds18b20_errors_total", "counter", "DS18B20 conversions without valid value");
+  m.value("windsensor_ds18b20_errors_total", uint64_t(ds18b20.errors()));
+  m.family("windsensor_bme280_readings_total", "counter", "BME280 measurements read with one burst transfer");
+  m.value("windsensor_bme280_readings_total", uint64_t(bme.readings()));
+  m.family("windsensor_bme280_errors_total", "counter", "Failed BME280 transfers");
+  m.value("windsensor_bme280_errors_total", uint64_t(bme.errors()));
+  m.family("windsensor_bme280_i2c_seconds_total", "counter", "I2C time of the BME280 transfers");
+  m.value("windsensor_bme280_i2c_seconds_total", bme.busTime() / 1e6);
+  m.family("windsensor_bme280_i2c_freed_seconds_total", "counter", "I2C time saved against the former library reads");
+  m.value("windsensor_bme280_i2c_freed_seconds_total", bme.freedTime() / 1e6);
+  m.family("windsensor_history_records_total", "counter", "Records of the history ring");
+  m.value("windsensor_history_records_total", uint64_t(history.records()));
+  m.family("windsensor_history_pages_total", "counter", "History pages written to LittleFS");
+  m.value("windsensor_history_pages_total", uint64_t(history.pages()));
+  m.family("windsensor_history_errors_total", "counter", "History pages not written");
+  m.value("windsensor_history_errors_total", uint64_t(history.errors()));
+  m.family("windsensor_history_max_write_seconds", "gauge", "Longest history page write since start");
+  m.value("windsensor_history_max_write_seconds", history.maxWriteTime() / 1e6);
+
+  // Sliding windows of wind speed and direction
+  WindSnapshot wd = windData.read();
+  m.family("windsensor_wind_speed_mean_mps", "gauge", "Mean wind speed of the window");
+  for (int i = 0; i < STATS_WINDOWS; i++)
+  {
+    m.value("windsensor_wind_speed_mean_mps", "window", statsNames[i], double(wd.stats[i].mean));
+  }
+  m.family("windsensor_wind_speed_min_mps", "gauge", "Min wind speed of the window");
+  for (int i = 0; i < STATS_WINDOWS; i++)
+  {
+    m.value("windsensor_wind_speed_min_mps", "window", statsNames[i], double(wd.stats[i].minimum));
+  }
+  m.family("windsensor_wind_speed_max_mps", "gauge", "Max wind speed of the window");
+  for (int i = 0; i < STATS_WINDOWS; i++)
+  {
+    m.value("windsensor_wind_speed_max_mps", "window", statsNames[i], double(wd.stats[i].maximum));
+  }
+  m.family("windsensor_wind_direction_mean_degrees", "gauge", "Vector mean of the wind direction of the window");
+  for (int i = 0; i < STATS_WINDOWS; i++)
+  {
+    m.value("windsensor_wind_direction_mean_degrees", "window", statsNames[i], double(wd.stats[i].direction));
+  }
+  m.family("windsensor_wind_direction_deviation_degrees", "gauge", "Circular standard deviation of the window");
+  for (int i = 0; i < STATS_WINDOWS; i++)
+  {
+    m.value("windsensor_wind_direction_deviation_degrees", "window", statsNames[i], double(wd.stats[i].deviation));
+  }
+
+  // Outputs
+  m.family("windsensor_nmea_sentences_total", "counter", "NMEA sentences handed to the output");
+  for (int i = 0; i < NMEA_SINK_COUNT; i++)
+  {
+    m.value("windsensor_nmea_sentences_total", "sink", nmeaSinks[i], uint64_t(metrics.sentences(i)));
+  }
+  m.family("windsensor_nmea_bytes_total", "counter", "NMEA bytes handed to the output");
+  for (int i = 0; i < NMEA_SINK_COUNT; i++)
+  {
+    m.value("windsensor_nmea_bytes_total", "sink", nmeaSinks[i], uint64_t(metrics.bytes(i)));
+  }
+  m.family("windsensor_nmea_tcp_sent_bytes_total", "counter", "Bytes sent to all NMEA TCP clients");
+  m.value("windsensor_nmea_tcp_sent_bytes_total", uint64_t(nmeaServer.bytes()));
+  m.family("windsensor_nmea_tcp_drops_total", "counter", "NMEA frames dropped for slow TCP clients");
+  m.value("windsensor_nmea_tcp_drops_total", uint64_t(nmeaServer.drops()));
+  m.family("windsensor_nmea_udp_errors_total", "counter", "NMEA datagrams not sent");
+  m.value("windsensor_nmea_udp_errors_total", uint64_t(nmeaUdp.errors()));
+  m.family("windsensor_mqtt_batches_total", "counter", "Published MQTT batches");
+  m.value("windsensor_mqtt_batches_total", uint64_t(mqtt.batches()));
+  m.family("windsensor_mqtt_errors_total", "counter", "MQTT batches with failed publish");
+  m.value("windsensor_mqtt_errors_total", uint64_t(mqtt.errors()));
+  m.family("windsensor_clients", "gauge", "Connected clients");
+  m.value("windsensor_clients", "server", "nmea", uint64_t(nmeaServer.clients()));
+  m.value("windsensor_clients", "server", "events", uint64_t(eventServer.clients()));
+  m.value("windsensor_clients", "server", "websocket", uint64_t(liveServer.clients()));
+
+  // Web server
+  m.family("windsensor_http_requests_total", "counter", "HTTP requests per route");
+  for (int i = 0; i < HTTP_ROUTE_COUNT; i++)
+  {
+    m.value("windsensor_http_requests_total", "route", httpRoutes[i], uint64_t(metrics.requests(i)));
+  }
+
+  // System
+  m.family("windsensor_heap_free_bytes", "gauge", "Free heap");
+  m.value("windsensor_heap_free_bytes", uint64_t(ESP.getFreeHeap()));
+  m.family("windsensor_heap_max_block_bytes", "gauge", "Largest free heap block");
+  #ifdef ESP8266
+    m.value("windsensor_heap_max_block_bytes", uint64_t(ESP.getMaxFreeBlockSize()));
+  #else
+    m.value("windsensor_heap_max_block_bytes", uint64_t(ESP.getMaxAllocHeap()));
+  #endif
+  m.family("windsensor_wifi_rssi_dbm", "gauge", "WiFi field strength of the client connection");
+  m.value("windsensor_wifi_rssi_dbm", float(WiFi.status() == WL_CONNECTED ? WiFi.RSSI() : 0));
+  m.family("windsensor_loop_duration_seconds", "summary", "Run time of loop() without the delay at the end");
+  m.value("windsensor_loop_duration_seconds_sum", metrics.loopSum() / 1e6);
+  m.value("windsensor_loop_duration_seconds_count", uint64_t(metrics.loopCount()));
+  m.family("windsensor_loop_last_duration_seconds", "gauge", "Run time of the last loop()");
+  m.value("windsensor_loop_last_duration_seconds", metrics.loopLast() / 1e6);
+  m.family("windsensor_config_saves_total", "counter", "Configuration writes to EEPROM / NVS");
+  m.value("windsensor_config_saves_total", uint64_t(metrics.configSaves()));
+  m.family("windsensor_uptime_seconds", "gauge", "Time since start (overflow after 49 days)");
+  m.value("windsensor_uptime_seconds", millis() / 1000.0);
+  m.flush();
+}
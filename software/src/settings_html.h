@@ -1,5 +1,5 @@
 // Settings webpage
-String Settings(int num, String vname[30], String value[30])
+void Settings(PageWriter &content, int num, String vname[30], String value[30])
 { 
   String hash = "";
   
@@ -53,6 +53,30 @@ String Settings(int num, String vname[30], String value[30])
     if (vname[i] == "mdnsservice") {
       actconf.mDNS = toInteger(value[i]);
     }
+    if (vname[i] == "udpmode") {
+      actconf.udpMode = toInteger(value[i]);
+    }
+    if (vname[i] == "udpaddress") {
+      value[i].toCharArray(actconf.udpAddress, 16);
+    }
+    if (vname[i] == "udpport") {
+      actconf.udpPort = toInteger(value[i]);
+    }
+    if (vname[i] == "mqtthost") {
+      value[i].toCharArray(actconf.mqttHost, 41);
+    }
+    if (vname[i] == "mqttport") {
+      actconf.mqttPort = toInteger(value[i]);
+    }
+    if (vname[i] == "mqtttopic") {
+      value[i].toCharArray(actconf.mqttTopic, 31);
+    }
+    if (vname[i] == "mqttformat") {
+      actconf.mqttFormat = toInteger(value[i]);
+    }
+    if (vname[i] == "mqttretain") {
+      actconf.mqttRetain = toInteger(value[i]);
+    }
     if (vname[i] == "debugmode") {
       actconf.debug = toInteger(value[i]);
     }
@@ -68,6 +92,9 @@ String Settings(int num, String vname[30], String value[30])
     if (vname[i] == "sendwsdata") {
       actconf.windSensor = toInteger(value[i]);
     }
+    if (vname[i] == "sendgust") {
+      actconf.gustData = toInteger(value[i]);
+    }
     if (vname[i] == "windtype") {
       value[i].toCharArray(actconf.windType, 2);
     }
@@ -103,6 +130,24 @@ String Settings(int num, String vname[30], String value[30])
     if (vname[i] == "tempunit") {
       value[i].toCharArray(actconf.tempUnit, 2);
     }
+    if (vname[i] == "dirweight") {
+      actconf.dirWeighting = toInteger(value[i]);
+    }
+    if (vname[i] == "vanerate") {
+      actconf.vaneRate = toInteger(value[i]);
+    }
+    if (vname[i] == "tempres") {
+      actconf.tempResolution = toInteger(value[i]);
+    }
+    if (vname[i] == "bmeperiod") {
+      actconf.bmePeriod = toInteger(value[i]);
+    }
+    if (vname[i] == "bmeos") {
+      actconf.bmeOversampling = toInteger(value[i]);
+    }
+    if (vname[i] == "history") {
+      actconf.historySize = toInteger(value[i]);
+    }
     if (vname[i] == "cslope") {
       actconf.calslope = toFloat(value[i]);
     }
@@ -116,6 +161,15 @@ String Settings(int num, String vname[30], String value[30])
   if(num > 0) {
     saveEEPROMConfig(actconf);      // Save the new settings in EEPROM
     DebugPrintln(3, "New settings saved");
+    hallTraceTimer(actconf.serverMode == 3);  // Diagnostic Mode can be switched without restart
+    nmeaUdp.begin(actconf.udpMode, actconf.udpAddress, actconf.udpPort);  // UDP output can be switched without restart
+    reconfigDS18B20 = true;         // New resolution without restart, set by the calculation cycle
+    reconfigVane = true;            // New vane sampling rate without restart, set by the calculation cycle
+    reconfigBME280 = true;          // New BME280 period and oversampling, set by the calculation cycle
+    historyBegin();                 // New history size without restart
+    if(actconf.serverMode == 2){
+      mqtt.begin(actconf.mqttHost, actconf.mqttPort, actconf.mqttTopic, actconf.hostname);  // New broker without restart
+    }
   }
 
   // Debug info
@@ -127,15 +181,21 @@ String Settings(int num, String vname[30], String value[30])
    transID();
    
    // Page content for password input
-   String content;
    content +=F( "<!DOCTYPE html>");
    content +=F( "<html>");
    content +=F( "<head>");
    content +=F( "<title>Settings Windsensor</title>");
-   content +=F( "<link rel='stylesheet' type='text/css' href='/css'>");
+   content +=F( "<link rel='stylesheet' type='text/css' href='");
+   content += cssAsset().path;
+   content +=F( "'>");
    content +=F( "<meta http-equiv='content-type' content='text/html; charset=UTF-8'>");
    content +=F( "<meta name=viewport content='width=device-width, initial-scale=1'>");
-   content +=F( "<script src='MD5.js' type='text/javascript'></script>");
+   content +=F( "<script src='");
+   content += staticAssets[ASSET_MD5_JS].path;
+   content +=F( "' type='text/javascript'></script>");
+   content +=F( "<script>var transactionID = ");
+   content += transactionID;
+   content +=F( ";</script>");
    content +=F( " <style>");
   // content += CSS();
    content +=F( "</style>");
@@ -150,7 +210,7 @@ String Settings(int num, String vname[30], String value[30])
    content +=F( ", "); 
    content += String(actconf.fversion);
    content +=F( ", CQ: ");
-   content += String(int(quality));
+   content += String(int(windData.read().quality));
    content +=F( "%"); 
    content +=F( "<hr align='left'>");
    
@@ -162,20 +222,19 @@ String Settings(int num, String vname[30], String value[30])
    content +=F( "<form id='pwdForm2' action='/' method='get'><button type='button' onClick='document.getElementById(\"pwdForm2\").submit();'>Back</button></form>");
    content +=F( "</body>");
    content +=F( "</html>");
-  
-   return content;
  }
  else{
    // Generate a new transaction ID
    transID();
 
     // Page content
-    String content;
     content += F("<!DOCTYPE html>");
     content += F("<html>");
     content += F("<head>");
     content += F("<title>Settings Windsensor</title>");
-    content += F("<link rel='stylesheet' type='text/css' href='/css'>");
+    content += F("<link rel='stylesheet' type='text/css' href='");
+    content += cssAsset().path;
+    content += F("'>");
     content += F("<meta http-equiv='content-type' content='text/html; charset=UTF-8'>");
     content += F("<meta name=viewport content='width=device-width, initial-scale=1'>");
     content += F("<style type='text/css'>");
@@ -210,6 +269,15 @@ String Settings(int num, String vname[30], String value[30])
     content += F("document.SetForm.mdnsservice.selectedIndex = ");
     content += getindex(mdnsservice, String(actconf.mDNS));
     content += F(";");
+    content += F("document.SetForm.udpmode.selectedIndex = ");
+    content += getindex(udpmode, String(actconf.udpMode));
+    content += F(";");
+    content += F("document.SetForm.mqttformat.selectedIndex = ");
+    content += getindex(mqttformat, String(actconf.mqttFormat));
+    content += F(";");
+    content += F("document.SetForm.mqttretain.selectedIndex = ");
+    content += getindex(mqttretain, String(actconf.mqttRetain));
+    content += F(";");
     content += F("document.SetForm.debugmode.selectedIndex = ");
     content += getindex(debugmode, String(actconf.debug));
     content += F(";");
@@ -225,9 +293,18 @@ String Settings(int num, String vname[30], String value[30])
     content += F("document.SetForm.sendwsdata.selectedIndex = ");
     content += getindex(sendwsdata, String(actconf.windSensor));
     content += F(";");
+    content += F("document.SetForm.sendgust.selectedIndex = ");
+    content += getindex(sendgustdata, String(actconf.gustData));
+    content += F(";");
     content += F("document.SetForm.windtype.selectedIndex = ");
     content += getindex(windtype, String(actconf.windType));
     content += F(";");
+    content += F("document.SetForm.vanerate.selectedIndex = ");
+    content += getindex(vanerate, String(actconf.vaneRate));
+    content += F(";");
+    content += F("document.SetForm.dirweight.selectedIndex = ");
+    content += getindex(dirweighting, String(actconf.dirWeighting));
+    content += F(";");
     content += F("document.SetForm.average.selectedIndex = ");
     content += getindex(averages, String(actconf.average));
     content += F(";");
@@ -249,6 +326,18 @@ String Settings(int num, String vname[30], String value[30])
     content += F("document.SetForm.tempunit.selectedIndex = ");
     content += getindex(tempunits, String(actconf.tempUnit));
     content += F(";");   
+    content += F("document.SetForm.tempres.selectedIndex = ");
+    content += getindex(tempresolution, String(actconf.tempResolution));
+    content += F(";");
+    content += F("document.SetForm.bmeperiod.selectedIndex = ");
+    content += getindex(bmeperiod, String(actconf.bmePeriod));
+    content += F(";");
+    content += F("document.SetForm.bmeos.selectedIndex = ");
+    content += getindex(bmeoversampling, String(actconf.bmeOversampling));
+    content += F(";");
+    content += F("document.SetForm.history.selectedIndex = ");
+    content += getindex(historysize, String(actconf.historySize));
+    content += F(";");
     content += F("}");
   
     content += F("function check_ssid(iname) {");
@@ -294,7 +383,7 @@ String Settings(int num, String vname[30], String value[30])
     content += F(", "); 
     content += String(actconf.fversion);
     content += F(", CQ: ");
-    content += String(int(quality));
+    content += String(int(windData.read().quality));
     content += F("%"); 
     content += F("<hr align='left'>");
   
@@ -464,6 +553,80 @@ String Settings(int num, String vname[30], String value[30])
     content += F("</td>");
     content += F("<td></td>");
     content += F("</tr>");
+
+    content += F("<tr>");
+    content += F("<td>NMEA UDP Output</td>");
+    content += F("<td>");
+    content += F("<select name='udpmode' size='1'>");
+    content += F("<option value='0'>Off</option>");
+    content += F("<option value='1'>Broadcast</option>");
+    content += F("<option value='2'>Multicast / Unicast</option>");
+    content += F("</select>");
+    content += F("</td>");
+    content += F("<td></td>");
+    content += F("</tr>");
+
+    content += F("<tr>");
+    content += F("<td>UDP Address</td>");
+    content += F("<td><input type='text' name='udpaddress' size='20' value='");
+    content += String(actconf.udpAddress);
+    content += F("' maxlength='15'></td>");
+    content += F("<td></td>");
+    content += F("</tr>");
+
+    content += F("<tr>");
+    content += F("<td>UDP Port</td>");
+    content += F("<td><input type='text' name='udpport' size='20' value='");
+    content += String(actconf.udpPort);
+    content += F("' maxlength='5'></td>");
+    content += F("<td></td>");
+    content += F("</tr>");
+
+    content += F("<tr>");
+    content += F("<td>MQTT Broker</td>");
+    content += F("<td><input type='text' name='mqtthost' size='20' value='");
+    content += String(actconf.mqttHost);
+    content += F("' maxlength='40'></td>");
+    content += F("<td></td>");
+    content += F("</tr>");
+
+    content += F("<tr>");
+    content += F("<td>MQTT Port</td>");
+    content += F("<td><input type='text' name='mqttport' size='20' value='");
+    content += String(actconf.mqttPort);
+    content += F("' maxlength='5'></td>");
+    content += F("<td></td>");
+    content += F("</tr>");
+
+    content += F("<tr>");
+    content += F("<td>MQTT Topic</td>");
+    content += F("<td><input type='text' name='mqtttopic' size='20' value='");
+    content += String(actconf.mqttTopic);
+    content += F("' maxlength='30'></td>");
+    content += F("<td></td>");
+    content += F("</tr>");
+
+    content += F("<tr>");
+    content += F("<td>MQTT Format</td>");
+    content += F("<td>");
+    content += F("<select name='mqttformat' size='1'>");
+    content += F("<option value='0'>JSON</option>");
+    content += F("<option value='1'>Single Values</option>");
+    content += F("</select>");
+    content += F("</td>");
+    content += F("<td></td>");
+    content += F("</tr>");
+
+    content += F("<tr>");
+    content += F("<td>MQTT Retain</td>");
+    content += F("<td>");
+    content += F("<select name='mqttretain' size='1'>");
+    content += F("<option value='0'>Off</option>");
+    content += F("<option value='1'>On</option>");
+    content += F("</select>");
+    content += F("</td>");
+    content += F("<td></td>");
+    content += F("</tr>");
   
     content += F("<tr>");
     content += F("<td><h3>Device Settings</h3></td>");
@@ -547,6 +710,17 @@ String Settings(int num, String vname[30], String value[30])
     content += F("</td>");
     content += F("<td></td>");
     content += F("</tr>");
+
+    content += F("<tr>");
+    content += F("<td>Send Gust Data</td>");
+    content += F("<td>");
+    content += F("<select name='sendgust' size='1'>");
+    content += F("<option value='0'>Off</option>");
+    content += F("<option value='1'>On (PWGST)</option>");
+    content += F("</select>");
+    content += F("</td>");
+    content += F("<td></td>");
+    content += F("</tr>");
   
     content += F("<tr>");
     content += F("<td>Wind Type</td>");
@@ -566,6 +740,19 @@ String Settings(int num, String vname[30], String value[30])
     content += F("' maxlength='4'></td>");
     content += F("<td>[°]</td>");
     content += F("</tr>");
+
+    content += F("<tr>");
+    content += F("<td>Vane Sampling</td>");
+    content += F("<td>");
+    content += F("<select name='vanerate' size='1'>");
+    content += F("<option value='0'>Off</option>");
+    content += F("<option value='50'>50</option>");
+    content += F("<option value='100'>100</option>");
+    content += F("<option value='200'>200</option>");
+    content += F("</select>");
+    content += F("</td>");
+    content += F("<td>[Hz]</td>");
+    content += F("</tr>");
     
     content += F("<tr>");
     content += F("<td>Average</td>");
@@ -585,6 +772,17 @@ String Settings(int num, String vname[30], String value[30])
     content += F("</td>");
     content += F("<td></td>");
     content += F("</tr>");
+
+    content += F("<tr>");
+    content += F("<td>Direction Average</td>");
+    content += F("<td>");
+    content += F("<select name='dirweight' size='1'>");
+    content += F("<option value='0'>Each Rotation</option>");
+    content += F("<option value='1'>Speed Weighted</option>");
+    content += F("</select>");
+    content += F("</td>");
+    content += F("<td></td>");
+    content += F("</tr>");
   
     content += F("<tr>");
     content += F("<td>Speed Unit</td>");
@@ -661,6 +859,60 @@ String Settings(int num, String vname[30], String value[30])
     content += F("</td>");
     content += F("<td></td>");
     content += F("</tr>");
+
+    content += F("<tr>");
+    content += F("<td>Temp Resolution</td>");
+    content += F("<td>");
+    content += F("<select name='tempres' size='1'>");
+    content += F("<option value='9'>9 Bit (0.5&deg;)</option>");
+    content += F("<option value='10'>10 Bit (0.25&deg;)</option>");
+    content += F("<option value='11'>11 Bit (0.125&deg;)</option>");
+    content += F("<option value='12'>12 Bit (0.0625&deg;)</option>");
+    content += F("</select>");
+    content += F("</td>");
+    content += F("<td>[Bit]</td>");
+    content += F("</tr>");
+
+    content += F("<tr>");
+    content += F("<td>BME280 Period</td>");
+    content += F("<td>");
+    content += F("<select name='bmeperiod' size='1'>");
+    content += F("<option value='1'>1</option>");
+    content += F("<option value='2'>2</option>");
+    content += F("<option value='5'>5</option>");
+    content += F("<option value='10'>10</option>");
+    content += F("</select>");
+    content += F("</td>");
+    content += F("<td>[s]</td>");
+    content += F("</tr>");
+
+    content += F("<tr>");
+    content += F("<td>BME280 Oversampling</td>");
+    content += F("<td>");
+    content += F("<select name='bmeos' size='1'>");
+    content += F("<option value='1'>1x</option>");
+    content += F("<option value='2'>2x</option>");
+    content += F("<option value='4'>4x</option>");
+    content += F("<option value='8'>8x</option>");
+    content += F("<option value='16'>16x</option>");
+    content += F("</select>");
+    content += F("</td>");
+    content += F("<td></td>");
+    content += F("</tr>");
+
+    content += F("<tr>");
+    content += F("<td>History</td>");
+    content += F("<td>");
+    content += F("<select name='history' size='1'>");
+    content += F("<option value='0'>Off</option>");
+    content += F("<option value='256'>256 kB (10 h)</option>");
+    content += F("<option value='512'>512 kB (20 h)</option>");
+    content += F("<option value='1024'>1 MB (40 h)</option>");
+    content += F("<option value='2048'>2 MB (80 h)</option>");
+    content += F("</select>");
+    content += F("</td>");
+    content += F("<td></td>");
+    content += F("</tr>");
   
     content += F("<tr>");
     content += F("<td><h3>Speed Sensor Calibration</h3></td>");
@@ -741,8 +993,6 @@ String Settings(int num, String vname[30], String value[30])
   
     content += F("</body>");
     content += F("</html>");
-  
-    return content;
  }  
 }
 
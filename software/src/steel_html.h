@@ -1,1093 +0,0 @@
-// JavaScript library steelseries_micro.js.gz as HEX coded char array
-// The char array is stored in the PROGRAM memory
-
-constexpr char steelseries_micro_js_gz[] PROGMEM = {
-0x1F, 0x8B, 0x08, 0x08, 0x7A, 0xDE, 0x09, 0x5F, 0x00, 0x03, 0x73, 0x74, 0x65, 0x65, 0x6C, 0x73, 
-0x65, 0x72, 0x69, 0x65, 0x73, 0x35, 0x2E, 0x6A, 0x73, 0x00, 0xEC, 0x3D, 0x6B, 0x73, 0xDB, 0x38, 
-0x92, 0xDF, 0xF7, 0x57, 0x30, 0x4A, 0x55, 0x4A, 0xB2, 0x61, 0x86, 0x0F, 0x51, 0x0F, 0x7B, 0xB8, 
-0x53, 0xB2, 0x24, 0x27, 0xBA, 0x72, 0x6C, 0x9F, 0x28, 0x4F, 0x76, 0x6A, 0x2A, 0x75, 0x45, 0x8B, 
-0xB4, 0xCC, 0x0D, 0x4D, 0x79, 0x49, 0x2A, 0x5E, 0xDF, 0x6C, 0xFE, 0xFB, 0x75, 0x83, 0x2F, 0x90, 
-0x04, 0x28, 0xDA, 0xF1, 0xEE, 0xD6, 0xD5, 0x8E, 0x35, 0x52, 0x28, 0xA0, 0xD1, 0xE8, 0x17, 0xBA, 
-0x1B, 0x4D, 0x50, 0xF3, 0xFE, 0xE0, 0xCD, 0x9F, 0xA4, 0x03, 0xE9, 0xC2, 0xBE, 0x77, 0xA5, 0xFC, 
-0xEF, 0x58, 0x8A, 0x62, 0xD7, 0xF5, 0x23, 0x37, 0xF4, 0xDC, 0x48, 0x93, 0xFF, 0x1A, 0x21, 0xC8, 
-0x64, 0x17, 0xDF, 0x6D, 0xC3, 0x28, 0x07, 0xF9, 0xE0, 0x86, 0xA1, 0x17, 0x4B, 0x1F, 0xC2, 0x5D, 
-0xF0, 0x68, 0xFB, 0x0E, 0x91, 0x3E, 0xD9, 0xE1, 0x57, 0x69, 0x1A, 0x6E, 0xA3, 0xC8, 0x77, 0x9F, 
-0x88, 0x74, 0xB1, 0x0D, 0x6F, 0xDC, 0x30, 0x96, 0x3E, 0xDB, 0x7E, 0xEC, 0x86, 0x88, 0xE1, 0xDC, 
-0x8E, 0x62, 0xE9, 0x7E, 0xEB, 0x78, 0xB7, 0x9E, 0xEB, 0x00, 0x06, 0x75, 0x20, 0xAB, 0xAA, 0xAC, 
-0x29, 0xEA, 0x08, 0x7B, 0x97, 0xEE, 0x37, 0x2F, 0xF2, 0xB6, 0x41, 0x86, 0x5F, 0x91, 0xD5, 0xBE, 
-0x3C, 0x84, 0x1E, 0x4A, 0xDF, 0x36, 0xF6, 0xD6, 0xEE, 0x71, 0x05, 0xA9, 0x64, 0x3B, 0x0E, 0x60, 
-0xB2, 0xA5, 0xC0, 0x7D, 0x94, 0x1E, 0xBD, 0xC0, 0x99, 0x79, 0xA1, 0xBB, 0x8E, 0x01, 0x89, 0x26, 
-0x6D, 0xEC, 0xDD, 0xC6, 0x95, 0xA5, 0xD5, 0x9D, 0x17, 0x25, 0xD7, 0xD2, 0x2E, 0x72, 0xA5, 0x6D, 
-0xE0, 0x3F, 0xC1, 0x87, 0x2B, 0x3D, 0x6C, 0xBD, 0x80, 0x62, 0x08, 0x1C, 0x29, 0x7E, 0xDC, 0x4A, 
-0xE7, 0xD3, 0x99, 0xE4, 0x78, 0xD1, 0x83, 0x6F, 0x3F, 0x45, 0xD2, 0xED, 0x36, 0xA4, 0xE8, 0xA0, 
-0x25, 0xC5, 0x47, 0xE1, 0x68, 0x53, 0xF4, 0xE0, 0xBA, 0x8E, 0x9C, 0x92, 0x35, 0xDD, 0x3E, 0x3C, 
-0x85, 0xDE, 0xE6, 0x2E, 0x96, 0xBA, 0xEB, 0x9E, 0x04, 0x9C, 0xA8, 0x64, 0x8F, 0x5C, 0xA8, 0x24, 
-0x7D, 0x5F, 0xA2, 0xA3, 0x22, 0x29, 0x74, 0x41, 0xC8, 0xDF, 0x0A, 0x84, 0x20, 0x05, 0xA0, 0x22, 
-0x0E, 0xBD, 0x9B, 0x5D, 0x3E, 0x2D, 0xD2, 0xED, 0x05, 0x52, 0xB4, 0xDD, 0x85, 0x6B, 0x97, 0xB6, 
-0xDC, 0x78, 0x81, 0x1D, 0x3E, 0x21, 0x99, 0xF7, 0x11, 0x01, 0xB2, 0xE2, 0x3B, 0x89, 0x52, 0x0C, 
-0x0A, 0xDA, 0x65, 0x12, 0x5E, 0xDB, 0x88, 0x80, 0x48, 0x76, 0x08, 0xCC, 0xBA, 0xE1, 0xBD, 0x17, 
-0xC7, 0xAE, 0x43, 0xA7, 0x78, 0x08, 0xB7, 0xDF, 0x3C, 0x94, 0x5B, 0x7C, 0x67, 0xC7, 0xF0, 0xE1, 
-0x02, 0x22, 0xDF, 0xDF, 0x02, 0x77, 0x1B, 0x69, 0xBD, 0x0D, 0x1C, 0x0F, 0x07, 0x46, 0x74, 0xE0, 
-0xBD, 0x1B, 0x1F, 0x67, 0x94, 0xBD, 0xAD, 0xD0, 0x16, 0x49, 0xDB, 0xDB, 0x8C, 0xA8, 0xF5, 0xD6, 
-0x01, 0xE0, 0x1D, 0xA8, 0x37, 0x74, 0x63, 0x1B, 0x88, 0x45, 0xAC, 0xF6, 0xCD, 0xF6, 0x1B, 0x76, 
-0x65, 0x22, 0x0A, 0xA8, 0x0E, 0x09, 0xF4, 0x81, 0x4A, 0x7C, 0xC0, 0x84, 0x08, 0xD8, 0x09, 0x51, 
-0x15, 0x25, 0x6A, 0x60, 0xBA, 0xB5, 0x6F, 0x7B, 0xF7, 0x6E, 0x28, 0x0B, 0x48, 0x80, 0xA9, 0x18, 
-0x61, 0x64, 0x24, 0x00, 0x87, 0xCE, 0x0E, 0xC8, 0x7A, 0x15, 0x2A, 0xE8, 0xCC, 0x12, 0x43, 0x8B, 
-0x94, 0xF2, 0xE7, 0x6C, 0xD7, 0xBB, 0x7B, 0x37, 0x88, 0xED, 0x4C, 0x53, 0xEF, 0x41, 0x09, 0x5B, 
-0xE8, 0x09, 0xA5, 0x7B, 0x1B, 0x6C, 0xCB, 0xB3, 0xFD, 0xA8, 0x10, 0x36, 0xD5, 0x12, 0x1D, 0xC6, 
-0x30, 0x90, 0xAB, 0x5D, 0x5A, 0x7D, 0x5C, 0x58, 0x92, 0x75, 0x79, 0xB6, 0xFA, 0x3C, 0x59, 0xCE, 
-0x25, 0xB8, 0xBE, 0x5A, 0x5E, 0xFE, 0xB2, 0x98, 0xCD, 0x67, 0xD2, 0xE9, 0xAF, 0xD0, 0x39, 0x97, 
-0xA6, 0x97, 0x57, 0xBF, 0x2E, 0x17, 0x1F, 0x3E, 0xAE, 0xA4, 0x8F, 0x97, 0xE7, 0xB3, 0xF9, 0xD2, 
-0x92, 0x26, 0x17, 0x33, 0x68, 0xBD, 0x58, 0x2D, 0x17, 0xA7, 0xD7, 0xAB, 0x4B, 0x68, 0xE8, 0x4C, 
-0x2C, 0x18, 0xD9, 0xA1, 0x1D, 0x93, 0x8B, 0x5F, 0xA5, 0xF9, 0x5F, 0xAE, 0x96, 0x73, 0xCB, 0x92, 
-0x2E, 0x97, 0xD2, 0xE2, 0xD3, 0xD5, 0xF9, 0x02, 0x90, 0x01, 0xF6, 0xE5, 0xE4, 0x62, 0xB5, 0x98, 
-0x5B, 0x44, 0x5A, 0x5C, 0x4C, 0xCF, 0xAF, 0x67, 0x8B, 0x8B, 0x0F, 0x24, 0x21, 0x01, 0xB0, 0x48, 
-0x17, 0x97, 0x2B, 0xE9, 0x7C, 0xF1, 0x69, 0xB1, 0x02, 0xD8, 0xD5, 0x25, 0xA1, 0x33, 0xD7, 0xC7, 
-0x4A, 0x97, 0x67, 0xD2, 0xA7, 0xF9, 0x72, 0xFA, 0x11, 0xBE, 0x4E, 0x4E, 0x17, 0xE7, 0x8B, 0xD5, 
-0xAF, 0x74, 0xD2, 0xB3, 0xC5, 0xEA, 0x02, 0x27, 0x3C, 0x83, 0x19, 0x27, 0xD2, 0xD5, 0x64, 0xB9, 
-0x5A, 0x4C, 0xAF, 0xCF, 0x27, 0x4B, 0xE9, 0xEA, 0x7A, 0x79, 0x75, 0x69, 0xCD, 0x25, 0xE4, 0x6D, 
-0xB6, 0xB0, 0xA6, 0xE7, 0x93, 0xC5, 0xA7, 0xF9, 0x4C, 0x06, 0x12, 0x60, 0x46, 0x69, 0xFE, 0xCB, 
-0xFC, 0x62, 0x95, 0xD0, 0x60, 0x7D, 0x9C, 0x9C, 0x9F, 0x73, 0xF9, 0x45, 0x2E, 0x4A, 0xDC, 0x9E, 
-0xCE, 0x81, 0xD2, 0xC9, 0xE9, 0xF9, 0x3C, 0x99, 0x0E, 0xF8, 0x9D, 0x2D, 0x96, 0xF3, 0xE9, 0x0A, 
-0x19, 0x2B, 0xAE, 0xA6, 0x20, 0x43, 0x20, 0xF2, 0x9C, 0x48, 0xD6, 0xD5, 0x7C, 0xBA, 0xC0, 0x8B, 
-0xF9, 0x5F, 0xE6, 0xC0, 0xD1, 0x64, 0xF9, 0x2B, 0x49, 0x71, 0x5A, 0xF3, 0xFF, 0xBE, 0x06, 0x20, 
-0xE8, 0x4C, 0x88, 0x98, 0x4D, 0x3E, 0x4D, 0x3E, 0x00, 0x97, 0xDD, 0x42, 0x42, 0x5C, 0xE1, 0x80, 
-0x8A, 0xA6, 0xD7, 0xCB, 0xF9, 0x27, 0x18, 0x8B, 0x12, 0xB1, 0xAE, 0x4F, 0xAD, 0xD5, 0x62, 0x75, 
-0xBD, 0x9A, 0x4B, 0x1F, 0x2E, 0x2F, 0x67, 0x54, 0xEE, 0xD6, 0x7C, 0xF9, 0xCB, 0x62, 0x8A, 0xD2, 
-0x3E, 0xBF, 0xB4, 0xA8, 0xDC, 0xAE, 0xAD, 0x39, 0x81, 0x19, 0x56, 0x13, 0x3A, 0x3B, 0xA0, 0x00, 
-0xA1, 0x59, 0x27, 0x78, 0x7D, 0x7A, 0x6D, 0x2D, 0x50, 0x7C, 0x09, 0x11, 0x8B, 0x8B, 0xD5, 0x7C, 
-0xB9, 0xBC, 0xBE, 0x5A, 0x2D, 0x2E, 0x2F, 0x7A, 0x20, 0x83, 0xCF, 0x20, 0x25, 0xA0, 0x76, 0x02, 
-0xE3, 0x67, 0x54, 0xD8, 0x97, 0x17, 0x94, 0x69, 0x90, 0xD5, 0xE5, 0xF2, 0x57, 0xC4, 0x8C, 0xD2, 
-0xA0, 0xBA, 0x20, 0xD2, 0xE7, 0x8F, 0x73, 0x68, 0x5F, 0xA2, 0x7C, 0xA9, 0xCC, 0x26, 0x28, 0x0C, 
-0x0B, 0x64, 0x37, 0x5D, 0xB1, 0x60, 0x30, 0x29, 0x88, 0x72, 0xC5, 0x30, 0x2A, 0x5D, 0xCC, 0x3F, 
-0x9C, 0x2F, 0x3E, 0xCC, 0x2F, 0xA6, 0xF3, 0x84, 0x0C, 0x00, 0xB9, 0x44, 0x54, 0x9F, 0x17, 0xD6, 
-0xBC, 0x07, 0xFA, 0x5B, 0x58, 0x08, 0xB5, 0x48, 0xE6, 0xFE, 0x3C, 0x81, 0x89, 0xAF, 0x29, 0xF3, 
-0xA8, 0x32, 0x20, 0x2D, 0xB9, 0x64, 0x4C, 0x99, 0x50, 0xED, 0x4A, 0x8B, 0x33, 0x69, 0x32, 0xFB, 
-0x65, 0x81, 0xB4, 0xA7, 0xC0, 0x60, 0x0F, 0xD6, 0x22, 0xB5, 0x1D, 0x2A, 0xBC, 0xE9, 0xC7, 0x54, 
-0xF0, 0xB8, 0x28, 0xDE, 0xFF, 0xA9, 0xB3, 0x7D, 0xA0, 0xEB, 0x0A, 0x17, 0xCB, 0x3A, 0xEE, 0x9C, 
-0x7C, 0xB3, 0x43, 0x36, 0x2A, 0x99, 0xB7, 0xBB, 0x80, 0x7A, 0xE6, 0x6E, 0xEF, 0x77, 0xEC, 0x72, 
-0x4D, 0xD9, 0x38, 0xF8, 0x64, 0xC7, 0x77, 0xF2, 0xD5, 0x82, 0x6C, 0x4D, 0x2D, 0xBF, 0x8E, 0xCD, 
-0xEC, 0x2A, 0xCC, 0xAE, 0xDE, 0xAB, 0x23, 0x85, 0xD8, 0x66, 0x37, 0xEB, 0xC8, 0x16, 0x72, 0x8F, 
-0xF8, 0x66, 0x07, 0x02, 0xC1, 0xA7, 0x6D, 0xB0, 0xD5, 0xAE, 0xFD, 0x38, 0xB4, 0xC9, 0x04, 0x57, 
-0x31, 0xF9, 0xC5, 0x0D, 0x1D, 0x3B, 0xB0, 0x49, 0x64, 0x07, 0xD1, 0x11, 0xCE, 0x7F, 0xDB, 0x21, 
-0x81, 0xD9, 0x11, 0x77, 0x7A, 0x05, 0x79, 0x2E, 0x89, 0x89, 0x4D, 0x7C, 0x12, 0x10, 0x2F, 0xA1, 
-0xD4, 0x21, 0x1B, 0x12, 0x99, 0x6F, 0x14, 0xB2, 0x36, 0x3D, 0x39, 0x7A, 0xBA, 0xBF, 0xD9, 0xFA, 
-0xD3, 0xAD, 0xBF, 0x0D, 0xE5, 0x8D, 0x1B, 0x2F, 0x37, 0x37, 0x36, 0xFD, 0xD2, 0xED, 0x9D, 0x80, 
-0x43, 0xEB, 0xBA, 0x72, 0x64, 0x7F, 0x73, 0xBB, 0x3D, 0xE2, 0xCA, 0xBE, 0x17, 0xB8, 0x9F, 0x3D, 
-0x27, 0xBE, 0x33, 0x55, 0xF8, 0x76, 0xEB, 0xF9, 0xBE, 0x15, 0x3F, 0xF9, 0xAE, 0xB9, 0x86, 0x6F, 
-0x20, 0xA3, 0xED, 0x57, 0xB7, 0xF8, 0x0E, 0x94, 0x07, 0x91, 0x0F, 0x3E, 0xA8, 0x0B, 0x73, 0xF7, 
-0x88, 0x63, 0x2A, 0x27, 0xCE, 0x4F, 0xFA, 0x00, 0x3E, 0x0F, 0x4D, 0xD5, 0xE8, 0xC1, 0xEC, 0x11, 
-0x40, 0xDD, 0xB8, 0x1B, 0x2F, 0xB8, 0x02, 0x19, 0x50, 0xFC, 0x76, 0xB8, 0xEE, 0x2A, 0x44, 0x21, 
-0xB2, 0x36, 0x38, 0xF0, 0x89, 0x73, 0x10, 0x92, 0xAE, 0x73, 0x08, 0xC0, 0x70, 0xF1, 0x46, 0x2D, 
-0x03, 0xE8, 0x00, 0x90, 0x77, 0x22, 0xE4, 0x1B, 0x05, 0x01, 0xD6, 0xFE, 0x36, 0x72, 0x53, 0x7C, 
-0xD1, 0xBB, 0x77, 0x09, 0x91, 0x14, 0x77, 0x42, 0x5F, 0xCE, 0x53, 0x41, 0xDE, 0x51, 0x4C, 0x8E, 
-0x52, 0x02, 0x81, 0xBC, 0x3F, 0x9B, 0x0E, 0x52, 0x38, 0x56, 0x7A, 0x55, 0xE2, 0xEE, 0xC1, 0x87, 
-0xAF, 0xB6, 0x5D, 0xD9, 0x18, 0x28, 0xC3, 0xFE, 0x10, 0xA6, 0x97, 0x8D, 0x51, 0x5F, 0x55, 0xB5, 
-0x83, 0x20, 0x13, 0x0D, 0xF6, 0x0E, 0xFA, 0x90, 0x4A, 0x20, 0xF5, 0x70, 0xD5, 0x1F, 0x19, 0xE3, 
-0x72, 0x6F, 0x3A, 0x02, 0xC7, 0x26, 0x58, 0xCA, 0xBD, 0x5C, 0xCC, 0x2C, 0x4B, 0x55, 0xA1, 0xD7, 
-0xB8, 0xAB, 0x89, 0x34, 0xA7, 0x5A, 0xD3, 0xF5, 0x41, 0x1F, 0x71, 0xEB, 0xE3, 0xA1, 0x3A, 0x1E, 
-0x54, 0x66, 0xC6, 0x0E, 0x68, 0xD5, 0x06, 0x6A, 0xB9, 0xA3, 0x8F, 0xB0, 0x9A, 0x70, 0x18, 0x17, 
-0x29, 0x4B, 0x70, 0x77, 0x63, 0x42, 0x43, 0xE8, 0x82, 0xA0, 0xCF, 0x61, 0x90, 0x1D, 0x7E, 0x08, 
-0x6D, 0xC7, 0x03, 0x3B, 0x47, 0xD4, 0x83, 0x81, 0x8E, 0x13, 0x83, 0x3A, 0x0D, 0x90, 0xD9, 0x58, 
-0xC5, 0xEB, 0x5E, 0x4F, 0x86, 0x84, 0x8A, 0xDA, 0x9F, 0x15, 0x6F, 0x1F, 0x40, 0xDB, 0x9D, 0x70, 
-0x73, 0xD3, 0xD5, 0x34, 0x8D, 0x48, 0x9A, 0xA6, 0xC3, 0x87, 0x3A, 0xEA, 0x75, 0x7A, 0x64, 0x53, 
-0x06, 0x93, 0xFB, 0xA3, 0xB6, 0x80, 0x63, 0xB2, 0xAE, 0xB5, 0xAA, 0xD8, 0xC6, 0x0A, 0x77, 0x23, 
-0x10, 0x6E, 0xC5, 0xAA, 0x5D, 0x39, 0xDC, 0xC6, 0xF8, 0x0D, 0x2C, 0xB0, 0xDC, 0x9D, 0x58, 0xD5, 
-0x49, 0x55, 0x1D, 0xB5, 0xF1, 0xB9, 0x45, 0x53, 0xEE, 0xC9, 0x36, 0x35, 0xF4, 0x62, 0xA5, 0xC9, 
-0x8A, 0x86, 0xF2, 0x17, 0x50, 0x91, 0x1A, 0x2F, 0xD0, 0xE1, 0x46, 0xF1, 0x36, 0x84, 0xEE, 0xEF, 
-0x60, 0xC9, 0xA5, 0x85, 0x1F, 0xE2, 0xD2, 0x4F, 0x96, 0x3D, 0xAC, 0x7F, 0x5C, 0xF8, 0xB0, 0xEA, 
-0x63, 0x39, 0xDE, 0x5A, 0xE0, 0xD5, 0x82, 0x4D, 0xB7, 0x77, 0x18, 0xCA, 0xF1, 0xD3, 0x83, 0x7B, 
-0x68, 0xC3, 0xAC, 0x90, 0x9D, 0xA0, 0x0F, 0xF8, 0xE8, 0xFE, 0x3D, 0x75, 0x01, 0xD0, 0x7A, 0x0F, 
-0xF9, 0xCE, 0xEE, 0xBE, 0xDC, 0x7C, 0xE2, 0xDD, 0x76, 0xDF, 0x38, 0xF2, 0xDA, 0x5E, 0xDF, 0xB9, 
-0xBF, 0xAD, 0xBF, 0xF4, 0x7E, 0x8F, 0x20, 0xB7, 0x58, 0xDF, 0x75, 0x3D, 0xB3, 0x1B, 0x98, 0xE7, 
-0xC0, 0x5C, 0x0C, 0x8A, 0x84, 0x11, 0xD3, 0x2D, 0x64, 0xB8, 0x7F, 0x8F, 0xBB, 0x1D, 0xCD, 0x01, 
-0x5D, 0x24, 0x13, 0xF5, 0x7E, 0x5F, 0xDB, 0x91, 0xDB, 0xC1, 0x4B, 0xAD, 0x73, 0x0C, 0x16, 0xE2, 
-0xF1, 0x2D, 0x04, 0x84, 0x92, 0x9A, 0x5F, 0x4C, 0x05, 0xA4, 0x2B, 0xB0, 0x2A, 0x0E, 0xE2, 0xBA, 
-0x85, 0xF8, 0x15, 0xB7, 0x55, 0x57, 0xBA, 0x3E, 0x68, 0x05, 0xA4, 0x12, 0x46, 0x06, 0x4D, 0xB0, 
-0x62, 0x40, 0xAF, 0x64, 0x44, 0x5E, 0x49, 0xFD, 0x5E, 0xB1, 0x1A, 0x13, 0x7B, 0x8F, 0x0B, 0x0E, 
-0xB1, 0x37, 0x5F, 0x56, 0xCA, 0x58, 0xEF, 0x1B, 0xB4, 0x17, 0x57, 0xE4, 0x40, 0xD4, 0xAB, 0xA3, 
-0x93, 0x50, 0xAB, 0xBD, 0xFD, 0xC1, 0x10, 0x25, 0x56, 0xC8, 0x8B, 0xE9, 0xED, 0x8F, 0x0D, 0x5D, 
-0x1B, 0x8A, 0x7B, 0x95, 0x81, 0xD1, 0x17, 0x61, 0x2E, 0x7A, 0x79, 0x54, 0xF5, 0x47, 0x88, 0xB1, 
-0xCA, 0x11, 0xEB, 0x0A, 0xBC, 0x74, 0x41, 0x9D, 0xDC, 0x80, 0xB2, 0xBF, 0x9E, 0xE4, 0x36, 0xA0, 
-0x77, 0x8E, 0xAB, 0x62, 0xC2, 0x0D, 0x0F, 0x8F, 0x58, 0x22, 0x2B, 0x05, 0xF3, 0x43, 0x7D, 0xA4, 
-0xAB, 0xA2, 0x69, 0x12, 0x05, 0xF0, 0x95, 0x24, 0xA4, 0xA4, 0xDF, 0x64, 0x8D, 0x32, 0xCA, 0x75, 
-0x34, 0x4E, 0x6C, 0xD1, 0xD0, 0x46, 0x8A, 0x3E, 0xC0, 0xEB, 0xBA, 0x35, 0xDA, 0xB2, 0x03, 0x9B, 
-0xAD, 0xBD, 0xD6, 0x66, 0xA8, 0xAD, 0x21, 0xB5, 0x7F, 0x99, 0x59, 0x52, 0x61, 0xA3, 0x72, 0x47, 
-0x15, 0xAB, 0x52, 0x31, 0xAC, 0x25, 0xAA, 0x30, 0xE0, 0x4B, 0xA5, 0x17, 0xD4, 0x44, 0xB5, 0x63, 
-0x54, 0xDA, 0x93, 0xF0, 0x00, 0x1D, 0x03, 0x05, 0x05, 0x56, 0xB1, 0x98, 0xC4, 0xFF, 0x8B, 0x7A, 
-0x33, 0x69, 0x57, 0x91, 0x62, 0x50, 0x1D, 0xA9, 0x42, 0x52, 0xAA, 0x1C, 0xB4, 0xB1, 0x40, 0xA3, 
-0x59, 0xEF, 0x8C, 0x0F, 0x6A, 0xD6, 0x7B, 0x2B, 0x1D, 0xC9, 0xC6, 0xB3, 0x20, 0x0B, 0xE7, 0xBB, 
-0x4F, 0xF1, 0x02, 0xC8, 0x67, 0x68, 0x3E, 0x5B, 0x70, 0x65, 0x1D, 0x02, 0xC7, 0x43, 0x61, 0x2F, 
-0x15, 0x37, 0xED, 0xA9, 0x2A, 0x37, 0x15, 0x9A, 0x78, 0x18, 0xDB, 0xC1, 0xD3, 0x52, 0x0A, 0x9F, 
-0xE5, 0x9B, 0xC9, 0xB7, 0xA9, 0xFD, 0x60, 0x76, 0xA2, 0xBF, 0xED, 0xEC, 0xD0, 0xED, 0xA4, 0x4D, 
-0xFF, 0xB5, 0xF5, 0x20, 0x0F, 0xBE, 0xF7, 0x60, 0xB7, 0x8B, 0x4D, 0x6C, 0x1E, 0xCA, 0x5D, 0x60, 
-0x39, 0x4C, 0xDD, 0x10, 0x06, 0xE8, 0x8A, 0x58, 0xF7, 0xC1, 0x95, 0xA9, 0x50, 0x88, 0x8C, 0x0F, 
-0x4C, 0x8D, 0x94, 0xEF, 0x21, 0xF5, 0xB1, 0x06, 0x4B, 0x43, 0x64, 0xD6, 0xBA, 0x3A, 0x1C, 0x1A, 
-0xC3, 0xE7, 0xF8, 0xED, 0x66, 0x9F, 0x5F, 0xAC, 0x5D, 0x1E, 0xE6, 0x22, 0x12, 0xE9, 0xA3, 0xE1, 
-0xA8, 0xBA, 0x80, 0x8B, 0x30, 0xC5, 0x61, 0xA8, 0x98, 0xB6, 0xB9, 0x97, 0x87, 0x78, 0x3F, 0xA3, 
-0x5C, 0x21, 0xE5, 0xBD, 0xCD, 0x02, 0x66, 0x7B, 0xDB, 0x38, 0x80, 0x61, 0xB3, 0x03, 0xC8, 0xF0, 
-0x16, 0x89, 0xEA, 0x0F, 0x38, 0xFE, 0x1F, 0x5E, 0xAA, 0x45, 0x1C, 0xE6, 0xC6, 0xF0, 0x5C, 0x08, 
-0x42, 0x5D, 0x56, 0x3B, 0xF6, 0x64, 0x0C, 0xBC, 0xD9, 0xDA, 0x08, 0x75, 0xF4, 0x9F, 0xE4, 0x55, 
-0xDB, 0x78, 0x9D, 0x06, 0xCF, 0x9B, 0x46, 0xD0, 0xA6, 0xA0, 0x7A, 0xE3, 0xFE, 0xAF, 0xE7, 0x86, 
-0xD3, 0x5D, 0xF8, 0xAD, 0xD6, 0x4D, 0xD8, 0x8C, 0xD1, 0x18, 0x8E, 0xFB, 0x7A, 0xDE, 0xC1, 0xFA, 
-0xE6, 0x0A, 0x06, 0x26, 0x9F, 0xCB, 0xC7, 0x94, 0xA2, 0x2E, 0x11, 0x07, 0xE1, 0x2A, 0xD1, 0x02, 
-0xFF, 0x2D, 0xF2, 0xB3, 0xE3, 0x57, 0x31, 0x0D, 0xBA, 0xDF, 0x33, 0x14, 0x22, 0x25, 0x6F, 0xDE, 
-0x66, 0xCF, 0x20, 0x9D, 0xB7, 0x03, 0xFA, 0x57, 0xEF, 0x54, 0x79, 0x08, 0x9A, 0xF4, 0xDA, 0x79, 
-0xAB, 0xCD, 0xF1, 0xD5, 0x69, 0x58, 0x9A, 0x99, 0x7F, 0xA2, 0x99, 0x4F, 0x35, 0x37, 0xC9, 0x17, 
-0x1A, 0xB7, 0x37, 0x77, 0xD3, 0x7D, 0xEA, 0xFA, 0x44, 0xE1, 0x81, 0xDB, 0xCB, 0x9D, 0xB7, 0xAC, 
-0x94, 0x96, 0xEE, 0xA3, 0x88, 0xDB, 0x9C, 0x8D, 0x49, 0xD1, 0x9B, 0xA5, 0x05, 0x3C, 0xBB, 0xAA, 
-0x01, 0x11, 0x4E, 0xAE, 0xC7, 0x6B, 0xE3, 0x22, 0x2B, 0x80, 0x86, 0xF0, 0x25, 0xF1, 0xEE, 0x99, 
-0x8B, 0x2B, 0xDA, 0x4A, 0x20, 0xBC, 0xE5, 0x92, 0x7B, 0x3F, 0x66, 0x0C, 0x93, 0x9E, 0xF2, 0xDA, 
-0x84, 0x44, 0xD5, 0x81, 0x58, 0x5E, 0x9B, 0xAE, 0x04, 0x99, 0x55, 0xE3, 0x1E, 0xF0, 0xC7, 0xBC, 
-0x72, 0x1B, 0x5B, 0xA5, 0x85, 0x1F, 0xA1, 0xAD, 0x36, 0xF6, 0xF2, 0x72, 0x70, 0x36, 0x59, 0x69, 
-0xEA, 0x65, 0x31, 0x8B, 0x77, 0x70, 0xA2, 0x14, 0x8C, 0x1F, 0x74, 0x54, 0xA5, 0xBE, 0x9B, 0x2C, 
-0xEF, 0x6E, 0xC4, 0x0E, 0xB1, 0xD4, 0x0F, 0x5A, 0xA1, 0x2B, 0x2D, 0xC9, 0x54, 0x73, 0x4F, 0x99, 
-0xB7, 0xF1, 0xBD, 0x32, 0xD3, 0x9F, 0xF9, 0x67, 0xC6, 0x87, 0xD2, 0xFA, 0x5E, 0xE1, 0xB3, 0xD3, 
-0xAF, 0x8D, 0xCE, 0xBD, 0x18, 0x52, 0x5C, 0x71, 0x3A, 0xF9, 0x58, 0xF2, 0xFE, 0x82, 0x81, 0x0A, 
-0x8F, 0x35, 0x91, 0x54, 0x6A, 0x77, 0xFF, 0x91, 0xD1, 0x5B, 0x64, 0x71, 0x2F, 0xD9, 0x8D, 0xEC, 
-0x0D, 0x85, 0xAA, 0xBA, 0xCF, 0x60, 0x07, 0x23, 0x4D, 0xAB, 0xAE, 0xA1, 0x3C, 0x1A, 0x08, 0xCC, 
-0x90, 0xED, 0x67, 0x1D, 0x66, 0x5A, 0x57, 0xCE, 0x4D, 0x30, 0xFD, 0xCA, 0x75, 0x98, 0x59, 0x38, 
-0x62, 0xC6, 0xE4, 0x3E, 0xC9, 0xA8, 0x7D, 0xAD, 0xEF, 0x0A, 0x19, 0xBA, 0xDB, 0x59, 0x95, 0x52, 
-0x0C, 0xA2, 0x76, 0x95, 0x11, 0xC7, 0xB1, 0xAA, 0xF6, 0x16, 0xC0, 0x4D, 0xC9, 0x5F, 0x92, 0xBD, 
-0xED, 0xD7, 0xA4, 0xF6, 0x1A, 0x9A, 0x2C, 0x67, 0x58, 0xA9, 0x9F, 0xE5, 0x07, 0x86, 0x7F, 0x8E, 
-0xD4, 0xB3, 0x29, 0xFF, 0xBF, 0x48, 0x5D, 0xEF, 0x1C, 0x17, 0x5F, 0xFA, 0x62, 0x15, 0x30, 0x75, 
-0x23, 0x8E, 0x1E, 0x84, 0x91, 0x96, 0x89, 0xC3, 0xBC, 0x61, 0x85, 0x32, 0xD2, 0x2B, 0x81, 0x72, 
-0x1B, 0x7B, 0x45, 0x4A, 0xCB, 0x18, 0x34, 0x4D, 0x33, 0xA9, 0x9C, 0xFF, 0xDC, 0x6D, 0xD4, 0xA3, 
-0x71, 0xF0, 0xC3, 0x85, 0xF2, 0x91, 0xD1, 0x0E, 0xE8, 0xB5, 0x9D, 0x70, 0xEF, 0xB8, 0x81, 0xB5, 
-0x42, 0x54, 0x0A, 0xE3, 0x75, 0xB8, 0xE1, 0xE6, 0x9B, 0x1B, 0x3E, 0xCD, 0x5A, 0x15, 0x55, 0x9F, 
-0x53, 0x53, 0x15, 0x62, 0x2D, 0xF3, 0x20, 0xCE, 0x4A, 0x0C, 0xD6, 0x48, 0x07, 0x0D, 0x7E, 0xA2, 
-0xB6, 0x8F, 0x2B, 0x5B, 0x9B, 0x9A, 0xDA, 0x69, 0x35, 0xA5, 0x1A, 0x09, 0xDA, 0xAB, 0x3B, 0xBC, 
-0xB6, 0xDB, 0xC0, 0x56, 0x6D, 0x8D, 0xB9, 0x7F, 0x76, 0x8F, 0xA0, 0x84, 0xA2, 0x28, 0xD0, 0xB0, 
-0xBB, 0x54, 0x1E, 0x9E, 0xA2, 0xBF, 0x76, 0xA7, 0x04, 0x33, 0x20, 0xAC, 0xFD, 0x57, 0x12, 0x9B, 
-0xBE, 0xA6, 0x18, 0xFC, 0xDC, 0xBF, 0x0E, 0xC4, 0x1B, 0xC8, 0x47, 0x96, 0xA9, 0x8F, 0x59, 0x82, 
-0x3C, 0xF9, 0x1A, 0x82, 0xAD, 0x50, 0xB2, 0xA7, 0x48, 0x58, 0xA6, 0xD7, 0x59, 0x4D, 0x34, 0x1B, 
-0x38, 0x10, 0xC9, 0x91, 0x01, 0x4E, 0xA2, 0x70, 0xB1, 0x2B, 0xC7, 0x4B, 0x6E, 0xD2, 0xC8, 0xC0, 
-0x69, 0xC5, 0xF8, 0xC2, 0xA6, 0x04, 0x93, 0xA5, 0x94, 0x24, 0xC0, 0xFD, 0x82, 0x62, 0xC6, 0xB9, 
-0x55, 0xB7, 0x2E, 0xE5, 0x1E, 0x58, 0xBC, 0x3C, 0xA1, 0x0C, 0x34, 0xCC, 0x2C, 0x45, 0x23, 0xF3, 
-0x5E, 0x01, 0x62, 0xB1, 0x3E, 0xEB, 0x40, 0xA4, 0x65, 0x1B, 0x77, 0x2F, 0x97, 0xEF, 0xD1, 0x72, 
-0xAB, 0x62, 0x50, 0x14, 0x45, 0xB3, 0xA2, 0x4D, 0x20, 0xC4, 0xDC, 0x8C, 0x8A, 0x6C, 0xAB, 0xD8, 
-0xE1, 0xE5, 0xAB, 0x81, 0xBF, 0xC2, 0x85, 0x1C, 0x32, 0x0B, 0xA1, 0x55, 0x1B, 0x27, 0xEE, 0xD7, 
-0x4D, 0x58, 0x18, 0x41, 0xE8, 0x8D, 0x68, 0x6A, 0x25, 0xC7, 0x7B, 0x60, 0x72, 0xE5, 0xBD, 0x34, 
-0x4B, 0x90, 0xF5, 0x11, 0xFE, 0xB5, 0x87, 0x6F, 0xBF, 0x45, 0x18, 0xA8, 0xF8, 0xF7, 0xEF, 0xAA, 
-0xF2, 0xD5, 0x32, 0x96, 0xCA, 0x0E, 0x3C, 0x32, 0x65, 0x5C, 0x20, 0xB0, 0xDA, 0xDE, 0x6B, 0xD0, 
-0x85, 0xF7, 0xFF, 0xE5, 0x3C, 0xA7, 0x8E, 0xF0, 0x08, 0x40, 0xE3, 0xCE, 0x0B, 0xA0, 0x8E, 0x22, 
-0x0A, 0x7C, 0x18, 0x11, 0x25, 0xBD, 0xE0, 0xD4, 0xC6, 0xDE, 0xBA, 0x83, 0x1B, 0xDD, 0x58, 0x73, 
-0x6A, 0x62, 0x8A, 0xDA, 0xD4, 0x3B, 0x1E, 0x43, 0xEF, 0xBA, 0x3F, 0xD2, 0x14, 0x85, 0x5B, 0x32, 
-0x2B, 0xFA, 0xAA, 0xC2, 0x69, 0x51, 0x7D, 0x40, 0xDE, 0xE9, 0x7E, 0xB8, 0x25, 0xF3, 0x4B, 0xE0, 
-0xDA, 0xF6, 0x4B, 0xCC, 0xE7, 0x59, 0x4E, 0x31, 0x8C, 0xC7, 0xFD, 0xDA, 0xC0, 0x17, 0x87, 0x3F, 
-0x75, 0xDC, 0xD4, 0xAB, 0x69, 0xD0, 0xAB, 0xD0, 0x3F, 0x4E, 0xEF, 0xA8, 0xA9, 0x93, 0x0A, 0x6E, 
-0xA8, 0xE0, 0x8B, 0x2F, 0xB8, 0xBC, 0xAF, 0x8D, 0xE0, 0x6A, 0x19, 0x44, 0xE7, 0xD8, 0x71, 0x6F, 
-0xED, 0x9D, 0x1F, 0xBF, 0xC6, 0x81, 0x89, 0x67, 0xE4, 0x49, 0xFA, 0x33, 0x56, 0xE8, 0xF8, 0x59, 
-0x6B, 0xAE, 0x5D, 0x52, 0x25, 0xAE, 0x9B, 0x73, 0x8F, 0x50, 0x08, 0x77, 0xB1, 0x5C, 0xA7, 0xA9, 
-0x1A, 0xA3, 0xD1, 0xB0, 0xD2, 0x86, 0xC7, 0xB7, 0x04, 0x01, 0x96, 0xB9, 0xA3, 0x85, 0xF7, 0xAE, 
-0x8A, 0x02, 0x4A, 0x7E, 0x3C, 0xA1, 0xB6, 0x8D, 0xE0, 0x96, 0x98, 0x72, 0x70, 0xE6, 0xC0, 0x45, 
-0x8E, 0x91, 0x69, 0x4B, 0xCE, 0x54, 0xED, 0x49, 0xDA, 0x72, 0x1E, 0x98, 0x12, 0x31, 0x2F, 0xE3, 
-0x12, 0x0B, 0x89, 0x49, 0xDA, 0x0A, 0xF0, 0xBC, 0x6A, 0xC5, 0x1E, 0xFB, 0xA8, 0xDC, 0x0D, 0xA8, 
-0x65, 0x3B, 0x79, 0x3F, 0x73, 0xDF, 0x30, 0x0F, 0x86, 0xE5, 0x1B, 0x16, 0xC5, 0xBD, 0x03, 0x61, 
-0xA5, 0xB6, 0x18, 0x91, 0x5F, 0x70, 0xFA, 0x9A, 0x0B, 0x68, 0x4C, 0x8A, 0x56, 0x04, 0xE3, 0x82, 
-0x26, 0xAE, 0x0D, 0xF1, 0xD6, 0xE3, 0xF7, 0xE2, 0xAC, 0x93, 0x19, 0x7C, 0x0F, 0xDD, 0x78, 0x17, 
-0x06, 0x92, 0x2B, 0x3B, 0xA1, 0xFD, 0xB8, 0xB8, 0xB7, 0x37, 0x6E, 0xB7, 0xE8, 0xC7, 0x08, 0xD9, 
-0x23, 0x78, 0xB4, 0xFB, 0xFB, 0x49, 0xDA, 0x6A, 0xFE, 0xFE, 0x9D, 0x9E, 0x1D, 0xDD, 0x70, 0x4E, 
-0x66, 0x91, 0x20, 0x39, 0x9B, 0xE5, 0x11, 0x07, 0x4F, 0x66, 0x91, 0x1B, 0x32, 0x25, 0x16, 0xB9, 
-0x35, 0x7D, 0xF6, 0x84, 0x56, 0x70, 0x18, 0xCB, 0x8E, 0x1B, 0x79, 0x9B, 0x80, 0x1E, 0xBC, 0xDA, 
-0xA4, 0x93, 0xDD, 0x16, 0x07, 0xAF, 0xBA, 0x8E, 0xD9, 0xF5, 0xCC, 0xF3, 0x2E, 0xE2, 0xAB, 0x9F, 
-0xBC, 0xEA, 0x31, 0x4B, 0xAA, 0xF3, 0x76, 0xD4, 0xC7, 0x57, 0x87, 0x38, 0xE5, 0xDB, 0x1B, 0x21, 
-0x2C, 0xC2, 0xAE, 0xAA, 0x6B, 0x44, 0x2A, 0x3E, 0x14, 0xD9, 0xE8, 0x21, 0x20, 0xBB, 0x06, 0x1D, 
-0xEA, 0xB7, 0x29, 0xF1, 0xE0, 0xC5, 0xE9, 0x99, 0x35, 0x05, 0x5B, 0x59, 0xB9, 0x39, 0x59, 0x00, 
-0x70, 0x8A, 0x38, 0x28, 0xC2, 0x02, 0xAE, 0x93, 0x2A, 0x49, 0x8C, 0x2D, 0x63, 0x3E, 0x3D, 0x39, 
-0x76, 0xEF, 0xC6, 0xB6, 0xDF, 0x39, 0xEE, 0x46, 0xA6, 0x23, 0x74, 0x84, 0x4A, 0xB2, 0x58, 0xE9, 
-0xE9, 0xC2, 0x14, 0x7F, 0xC0, 0x0B, 0x14, 0xB7, 0x2E, 0xBE, 0xC0, 0x2B, 0x47, 0xD5, 0x30, 0x39, 
-0x4C, 0x0F, 0x14, 0xAA, 0x0A, 0x9E, 0x25, 0x4C, 0x3E, 0x7A, 0x1C, 0x40, 0x55, 0x4B, 0x00, 0xD5, 
-0xE1, 0x18, 0x84, 0x96, 0x7E, 0x70, 0x00, 0xD5, 0x0C, 0x1F, 0x3D, 0x9B, 0x98, 0x7C, 0x20, 0x98, 
-0xC3, 0xE8, 0x26, 0xCA, 0x05, 0xC7, 0x06, 0x80, 0x9B, 0xD0, 0x8E, 0xA2, 0xD7, 0xE1, 0x97, 0x52, 
-0xD0, 0x07, 0x1A, 0xB5, 0x3E, 0x50, 0xA0, 0x1A, 0x06, 0x8F, 0x23, 0xC5, 0xC8, 0x00, 0x07, 0x78, 
-0x96, 0x12, 0x3E, 0x54, 0x45, 0xE5, 0xB2, 0x9E, 0xC1, 0xA1, 0x74, 0x34, 0x83, 0xDA, 0x0C, 0x0F, 
-0x2E, 0xC5, 0x37, 0xC6, 0xDB, 0x6C, 0x43, 0x04, 0xE5, 0x01, 0x8D, 0x59, 0xEA, 0xF4, 0x21, 0x22, 
-0xE3, 0x89, 0x51, 0x1E, 0xE7, 0xD4, 0xE9, 0x39, 0x75, 0xA3, 0x06, 0x79, 0x2B, 0x68, 0xCB, 0x23, 
-0xFC, 0x68, 0x2B, 0x6F, 0x7A, 0xC4, 0xFB, 0x15, 0xE5, 0xAD, 0xAB, 0x29, 0x47, 0xF0, 0xD1, 0x24, 
-0x6F, 0x75, 0x84, 0xC6, 0x33, 0xA6, 0x1F, 0x3C, 0x8E, 0x32, 0x79, 0xAB, 0x63, 0x3C, 0xE3, 0xAA, 
-0x20, 0x56, 0x85, 0x6B, 0x92, 0x99, 0x84, 0x40, 0x40, 0x38, 0xB7, 0xAE, 0x37, 0xC8, 0x1B, 0xFC, 
-0x1E, 0xE2, 0x31, 0xF0, 0xA3, 0xDF, 0x24, 0x6F, 0x75, 0xDC, 0xA7, 0x30, 0xF8, 0xC1, 0x43, 0xA8, 
-0x32, 0x4C, 0x50, 0xE2, 0x80, 0x93, 0x76, 0xF2, 0xDE, 0x6C, 0x7D, 0xE7, 0x15, 0xC5, 0x6D, 0x20, 
-0x2F, 0xF4, 0x43, 0xE1, 0x8A, 0x5B, 0x35, 0x58, 0x40, 0xD4, 0xCB, 0x78, 0xC0, 0x83, 0xD3, 0xB4, 
-0x0C, 0xAE, 0x9F, 0xAA, 0xC5, 0xE0, 0xE2, 0xD3, 0x59, 0x74, 0xD4, 0x7A, 0xB9, 0xF2, 0x81, 0x18, 
-0xCF, 0x00, 0x52, 0x7C, 0x03, 0xAE, 0xC0, 0xFB, 0xFD, 0x0C, 0x0E, 0x8D, 0x16, 0xA5, 0x3E, 0xE0, 
-0x6B, 0x59, 0x65, 0x27, 0x46, 0xC5, 0x18, 0xDC, 0x05, 0x33, 0x60, 0x1C, 0x8F, 0xAA, 0xA3, 0xFE, 
-0xF8, 0x60, 0xA3, 0x12, 0x3A, 0x50, 0xA0, 0xC1, 0x15, 0xCB, 0x30, 0x13, 0x9F, 0x4A, 0x83, 0x84, 
-0x21, 0xC0, 0x97, 0xFB, 0x06, 0x6A, 0xF7, 0xA3, 0xDC, 0x87, 0xEC, 0x37, 0x07, 0x3B, 0x88, 0xEF, 
-0x42, 0x7B, 0xED, 0xC5, 0x6E, 0x3B, 0xA3, 0x08, 0x12, 0xA3, 0x80, 0x98, 0x3F, 0x10, 0x1A, 0x85, 
-0xAA, 0x22, 0x05, 0x2A, 0xF5, 0x2A, 0x7C, 0x9F, 0x97, 0x4A, 0x69, 0x08, 0xF2, 0xC1, 0xF7, 0x88, 
-0xEB, 0xA3, 0x32, 0x5F, 0x9F, 0x1F, 0x1A, 0xE0, 0x29, 0x30, 0xE5, 0x1C, 0x23, 0x01, 0xBE, 0x47, 
-0xC3, 0x76, 0x6C, 0xC7, 0x9E, 0x1F, 0xBB, 0x0E, 0xF0, 0xF7, 0xD4, 0xC4, 0x76, 0x76, 0x87, 0xDF, 
-0x07, 0xF6, 0xD3, 0x87, 0x04, 0x88, 0x3C, 0x52, 0x35, 0x63, 0x84, 0x4D, 0x63, 0x55, 0x19, 0xAB, 
-0x63, 0x41, 0xA4, 0xA3, 0x7F, 0x3F, 0x14, 0xE9, 0x06, 0xED, 0x22, 0x9D, 0xAC, 0xEB, 0x4D, 0xF3, 
-0x19, 0x06, 0xBB, 0x05, 0xAB, 0x99, 0xD7, 0xB8, 0x61, 0xAC, 0xCA, 0x9E, 0xE7, 0x68, 0x2B, 0xD2, 
-0x53, 0xDF, 0x5E, 0x7F, 0x6D, 0x96, 0x29, 0xE4, 0xAD, 0x43, 0x95, 0xCA, 0x14, 0x33, 0xE7, 0x31, 
-0x95, 0xA9, 0x02, 0xEB, 0x9E, 0x3E, 0x8C, 0x31, 0x1A, 0x43, 0x66, 0xAD, 0xF2, 0x85, 0x9A, 0x13, 
-0x53, 0x73, 0x1E, 0x2A, 0xBB, 0x59, 0xAC, 0x2D, 0xF1, 0x61, 0xD3, 0x58, 0xBA, 0x95, 0x14, 0x8D, 
-0x2D, 0xE1, 0x6D, 0xE1, 0x5B, 0x21, 0x8D, 0x8A, 0x9E, 0x3E, 0xD5, 0x32, 0xA6, 0xFA, 0xD6, 0x1A, 
-0x1F, 0x3B, 0x49, 0xD6, 0x52, 0x7A, 0x9D, 0x7C, 0x88, 0xBC, 0xAC, 0x32, 0xA4, 0x0E, 0x56, 0xE8, 
-0x65, 0xC7, 0x99, 0xDB, 0x51, 0x32, 0xEF, 0x04, 0x57, 0x4D, 0x7E, 0x02, 0x21, 0xD2, 0x0F, 0xF1, 
-0x82, 0xE1, 0x26, 0x91, 0x05, 0xF1, 0xF2, 0x78, 0xA8, 0xD3, 0xE7, 0x55, 0x92, 0x54, 0xB2, 0x9A, 
-0x47, 0x36, 0x79, 0x93, 0xE0, 0x48, 0x1E, 0x27, 0x9B, 0x80, 0xC4, 0x9F, 0xA4, 0xD7, 0xCD, 0x39, 
-0x54, 0xF2, 0xC1, 0x0D, 0x1E, 0x59, 0x54, 0x50, 0x14, 0x74, 0xE2, 0xD4, 0xE3, 0x73, 0x73, 0x28, 
-0x7D, 0xD0, 0xB8, 0x56, 0xB2, 0xAC, 0x08, 0x67, 0x1A, 0x8B, 0x5C, 0xF7, 0x70, 0x50, 0x9A, 0x8C, 
-0x86, 0x2B, 0x9E, 0xFF, 0xCA, 0x53, 0x22, 0x1A, 0xA4, 0x92, 0x8F, 0x97, 0xCB, 0x1A, 0xF7, 0x4E, 
-0xE8, 0x76, 0xF8, 0xB2, 0x76, 0x4A, 0x5B, 0x8E, 0xDB, 0x01, 0xBE, 0x3A, 0xED, 0x71, 0x1B, 0xED, 
-0xF0, 0xEA, 0xF4, 0xAF, 0xC3, 0x4F, 0x9B, 0x71, 0xDD, 0xA7, 0x96, 0x3F, 0x35, 0x7F, 0xC3, 0x8A, 
-0x08, 0xE4, 0xA8, 0xB2, 0xDE, 0x1F, 0xE2, 0x43, 0x42, 0x90, 0x24, 0x41, 0xC8, 0x53, 0x0C, 0xF0, 
-0x46, 0xF2, 0x08, 0x62, 0x9A, 0xFA, 0x85, 0x58, 0xE6, 0x6F, 0xF8, 0x10, 0xF7, 0x9C, 0x46, 0xFC, 
-0xEC, 0xAD, 0xF6, 0x48, 0xD2, 0x98, 0x94, 0x3E, 0xF3, 0xAF, 0xAA, 0xA1, 0x93, 0xFC, 0xFD, 0x03, 
-0x30, 0xE5, 0xB9, 0xBE, 0xE0, 0x86, 0x29, 0x79, 0xDC, 0x6E, 0xFF, 0x06, 0xC9, 0x7B, 0x00, 0xB0, 
-0xB5, 0x99, 0x1D, 0xA9, 0xF1, 0xC9, 0x0D, 0x5C, 0xD3, 0x32, 0xB4, 0x8F, 0xA6, 0x8E, 0xF8, 0xEF, 
-0xBB, 0xB0, 0x9B, 0x4C, 0xB7, 0x7F, 0x53, 0x2F, 0x5C, 0xFB, 0xB0, 0x53, 0xA5, 0xFB, 0xCE, 0x1B, 
-0x7C, 0xE2, 0xA9, 0xB2, 0x01, 0x7C, 0xDE, 0xC6, 0x70, 0xC4, 0xD9, 0x18, 0x16, 0x47, 0x24, 0xFC, 
-0xF7, 0x90, 0xED, 0xB7, 0xDB, 0x29, 0x32, 0x1B, 0xC4, 0xFC, 0x29, 0xA6, 0x52, 0x3A, 0x7E, 0xE7, 
-0x05, 0x4F, 0x75, 0x3D, 0x56, 0x75, 0x69, 0x68, 0xC3, 0xE1, 0x90, 0x60, 0x7A, 0xD2, 0x4E, 0x9F, 
-0x18, 0xE9, 0xB2, 0x77, 0xA1, 0x31, 0x08, 0x3F, 0xF9, 0x3B, 0x87, 0x84, 0xF4, 0x25, 0x7B, 0x17, 
-0x90, 0x03, 0x18, 0x96, 0xBD, 0x9B, 0x21, 0xB9, 0x38, 0x79, 0xB3, 0xFF, 0x61, 0x0B, 0xFB, 0x6C, 
-0x61, 0x7D, 0x17, 0x6E, 0xEF, 0xDD, 0xCC, 0x0E, 0xC0, 0x85, 0x61, 0x4A, 0x86, 0x89, 0x09, 0x35, 
-0x07, 0xF0, 0x90, 0x98, 0x7B, 0x60, 0xA6, 0x8D, 0x0F, 0x04, 0xE2, 0x93, 0x33, 0xF2, 0x40, 0xC7, 
-0x75, 0x0E, 0x36, 0x01, 0xFF, 0xE9, 0x68, 0x1A, 0xE8, 0xDB, 0x2B, 0xD6, 0x61, 0x90, 0xEC, 0xCD, 
-0xA8, 0x82, 0xD3, 0xA8, 0x82, 0xB3, 0x4E, 0xDE, 0x25, 0x43, 0x00, 0x65, 0x8D, 0x00, 0x6A, 0x5C, 
-0x5A, 0xF9, 0xA3, 0x44, 0xDF, 0xB0, 0xF1, 0x2C, 0x1A, 0x81, 0xD6, 0xFC, 0x9D, 0x4F, 0x04, 0x99, 
-0x82, 0xA6, 0x0D, 0xE9, 0x9B, 0x19, 0x0E, 0xF8, 0xC0, 0xAB, 0x97, 0x4C, 0x46, 0x35, 0x06, 0x69, 
-0xE3, 0xB0, 0x6A, 0x32, 0xAD, 0x88, 0xC7, 0xE1, 0x23, 0x25, 0x79, 0xE7, 0x8D, 0x63, 0x30, 0x56, 
-0x10, 0xA3, 0xA6, 0xAA, 0xCC, 0x70, 0xD8, 0xF7, 0x6B, 0x20, 0x3F, 0xCC, 0xDD, 0x8B, 0x46, 0x08, 
-0xE1, 0x1A, 0x08, 0x1A, 0xDF, 0x15, 0xDE, 0x47, 0x65, 0xDE, 0xCB, 0xB3, 0xFF, 0x61, 0xC5, 0xE9, 
-0x73, 0x99, 0xA5, 0xC0, 0x95, 0x6C, 0xA8, 0xE9, 0x26, 0x59, 0x4D, 0x53, 0x03, 0x71, 0x7D, 0x6C, 
-0x94, 0x3C, 0x8D, 0xD7, 0xAA, 0xDA, 0x06, 0xF9, 0xDE, 0x8D, 0xED, 0x4F, 0xB7, 0xF7, 0x0F, 0xDB, 
-0x08, 0x76, 0x50, 0x97, 0x0F, 0x6E, 0x48, 0x7F, 0x1B, 0xC2, 0xEC, 0x38, 0x40, 0x89, 0x17, 0xD0, 
-0x2F, 0x47, 0xDB, 0x5D, 0xDC, 0x34, 0x9F, 0xDE, 0x66, 0xAE, 0xA2, 0x08, 0x69, 0x7A, 0xBC, 0x8A, 
-0x68, 0xD1, 0xCF, 0x56, 0x44, 0x37, 0xE5, 0x8A, 0x68, 0xC4, 0x56, 0x44, 0xB7, 0x49, 0x4D, 0x34, 
-0xA9, 0x87, 0xD2, 0xA7, 0xD5, 0x09, 0x3E, 0xA8, 0x4E, 0x6B, 0xA2, 0xE6, 0x6F, 0x74, 0xC5, 0x7E, 
-0x21, 0xB7, 0x95, 0x67, 0x57, 0x0F, 0xB7, 0x69, 0x71, 0xF0, 0xD0, 0xA6, 0xB5, 0xD1, 0xA8, 0x5E, 
-0x1B, 0xF5, 0xF1, 0xB6, 0x53, 0xF2, 0x30, 0x7E, 0xF4, 0xB7, 0x30, 0xEE, 0xC6, 0x07, 0xF1, 0x61, 
-0x88, 0x0F, 0xEC, 0xFA, 0xC9, 0xD3, 0xF8, 0xF7, 0x5E, 0xD0, 0xC5, 0xE7, 0x9F, 0x0F, 0xBA, 0xF6, 
-0xCF, 0xF1, 0x71, 0xD8, 0xEB, 0x11, 0xFB, 0xE7, 0xEE, 0xC6, 0xEC, 0x3A, 0x30, 0x0E, 0xEB, 0xCB, 
-0x47, 0x2A, 0xDA, 0xA4, 0xA2, 0x8D, 0x0C, 0x5A, 0xB3, 0x3E, 0x2E, 0xFA, 0xC2, 0x72, 0x1F, 0xA0, 
-0xFC, 0x5A, 0x3C, 0x02, 0x1B, 0xF2, 0x1E, 0x81, 0xC5, 0xD8, 0x8F, 0x5C, 0x3A, 0xE5, 0xFB, 0x1C, 
-0x60, 0xA9, 0x3A, 0xBE, 0x98, 0x33, 0x83, 0x80, 0x89, 0xC0, 0xA2, 0x24, 0xF1, 0x91, 0x46, 0x42, 
-0x78, 0x6F, 0x7A, 0x64, 0xCB, 0xAF, 0x83, 0xDE, 0x34, 0xDC, 0x10, 0x52, 0xB2, 0x9B, 0x16, 0x45, 
-0xE1, 0x24, 0x6C, 0xAC, 0x83, 0xDE, 0xB4, 0xDD, 0x1D, 0x56, 0x01, 0x85, 0x75, 0xD0, 0x1B, 0x7E, 
-0x12, 0x5A, 0xAD, 0x83, 0xB2, 0xE2, 0xB8, 0xE1, 0xDE, 0x08, 0xCB, 0xEA, 0xA0, 0xAF, 0xC0, 0x2F, 
-0xB7, 0x0E, 0x5A, 0x63, 0x5D, 0x54, 0x07, 0xAD, 0xB1, 0x2E, 0xA8, 0x83, 0x56, 0xE1, 0xB8, 0x75, 
-0xD0, 0x2A, 0x90, 0xA8, 0x0E, 0x5A, 0x83, 0x13, 0xD5, 0x41, 0x05, 0xF2, 0xAE, 0xD6, 0x41, 0xF7, 
-0xCB, 0x3B, 0xAB, 0x83, 0xBE, 0x96, 0xBC, 0xAB, 0x75, 0x50, 0x91, 0xBC, 0x6B, 0x75, 0x50, 0x81, 
-0xBC, 0x6B, 0x75, 0x50, 0x81, 0xBC, 0xCB, 0x75, 0x50, 0x81, 0xBC, 0x6B, 0x75, 0x50, 0x91, 0xBC, 
-0x6B, 0x75, 0x50, 0xBE, 0xBC, 0x6B, 0x75, 0xD0, 0xFD, 0xF2, 0x4E, 0xEB, 0xA0, 0xAF, 0x25, 0xEE, 
-0x6A, 0x1D, 0xB4, 0x26, 0x45, 0x41, 0x1D, 0xB4, 0x0A, 0x27, 0xAA, 0x83, 0x56, 0xE1, 0x44, 0x75, 
-0xD0, 0x1A, 0x9C, 0xA0, 0x0E, 0x5A, 0x85, 0x13, 0xD5, 0x41, 0x6B, 0x5A, 0x16, 0xD4, 0x41, 0xAB, 
-0x70, 0x82, 0x3A, 0x68, 0x0D, 0x4C, 0x50, 0x07, 0xAD, 0xC2, 0x89, 0xEA, 0xA0, 0x82, 0xE5, 0x57, 
-0xAD, 0x83, 0xEE, 0x37, 0x87, 0x52, 0x1D, 0xB4, 0x85, 0x51, 0x84, 0x4C, 0x1D, 0x54, 0x64, 0x14, 
-0xB5, 0x3A, 0x68, 0x6D, 0x0D, 0x72, 0xEB, 0xA0, 0x22, 0x5F, 0x5F, 0xAE, 0x83, 0xF2, 0x39, 0x2F, 
-0xD7, 0x41, 0xF7, 0xB3, 0x5D, 0xAA, 0x83, 0x0A, 0xD9, 0xCE, 0x9F, 0x74, 0xCA, 0xEB, 0xA0, 0x61, 
-0x56, 0x07, 0x8D, 0xF3, 0x3A, 0x28, 0x3F, 0xD2, 0x65, 0xB5, 0x96, 0x97, 0x47, 0x3A, 0x51, 0x1D, 
-0xB4, 0x66, 0xE9, 0x7A, 0xD3, 0x7C, 0xE5, 0x3A, 0x68, 0xCD, 0xBC, 0xC6, 0x0D, 0x63, 0x4B, 0x75, 
-0xD0, 0xB6, 0x22, 0xCD, 0xEA, 0xA0, 0x0D, 0x32, 0x4D, 0xEA, 0xA0, 0x71, 0x5E, 0x07, 0x0D, 0xF3, 
-0x3A, 0x68, 0x9C, 0xD7, 0x41, 0xB9, 0x42, 0xCD, 0x89, 0xA9, 0x39, 0x8F, 0x52, 0xBD, 0xB2, 0xB6, 
-0xC4, 0x87, 0x4D, 0x63, 0xCB, 0x75, 0x50, 0x8E, 0x08, 0xF2, 0xBE, 0x16, 0xBE, 0x95, 0xAD, 0x83, 
-0x56, 0x53, 0x2B, 0x27, 0xB9, 0xED, 0x4F, 0x77, 0x1F, 0x4D, 0x2B, 0x4D, 0x85, 0x15, 0x06, 0xF0, 
-0x6D, 0x6B, 0x82, 0x35, 0x59, 0x08, 0x4A, 0x82, 0x1C, 0x47, 0x2A, 0xB6, 0x9A, 0xCC, 0x8B, 0x95, 
-0x0A, 0x82, 0x55, 0xA0, 0x51, 0x69, 0xA6, 0xA2, 0x1E, 0x28, 0x4A, 0x0D, 0x2A, 0xF5, 0x40, 0xBE, 
-0x38, 0x69, 0x46, 0xEA, 0x83, 0xB8, 0xF0, 0x0D, 0xA2, 0x3B, 0xE8, 0xC2, 0x45, 0x0F, 0x05, 0x92, 
-0x5E, 0xAD, 0x19, 0x31, 0x7A, 0xDC, 0xF2, 0x5F, 0x05, 0x95, 0x4A, 0xDF, 0x29, 0x2A, 0x35, 0x47, 
-0xA5, 0x36, 0xA1, 0xCA, 0x2A, 0x7E, 0xDC, 0x04, 0xF1, 0xC5, 0x15, 0xBF, 0xCE, 0xDB, 0x33, 0xFA, 
-0xD7, 0xC9, 0x36, 0xB1, 0x8C, 0x71, 0x65, 0x0D, 0x63, 0xFA, 0xF7, 0x63, 0x10, 0xD9, 0x2C, 0x5F, 
-0x2A, 0xE7, 0x9A, 0x04, 0x16, 0xC9, 0x1E, 0x44, 0x29, 0xEC, 0xB3, 0xBA, 0x0D, 0x5E, 0xE2, 0xCF, 
-0xA5, 0x78, 0x04, 0xCF, 0xD4, 0x85, 0xF0, 0xC6, 0xED, 0x85, 0x4F, 0xFC, 0x57, 0xAE, 0xA1, 0x71, 
-0x24, 0x34, 0xD3, 0xF0, 0xC5, 0x34, 0x9C, 0xEA, 0xF8, 0x62, 0x1A, 0xE6, 0xF4, 0x8F, 0x69, 0x98, 
-0x28, 0xF8, 0x6A, 0x82, 0xA8, 0xE1, 0xA8, 0xCD, 0xF2, 0xEF, 0x92, 0xE1, 0x3F, 0xA3, 0xF6, 0xC4, 
-0x91, 0x6A, 0xAD, 0x01, 0xCF, 0xC9, 0x8E, 0x59, 0x99, 0x4D, 0xFA, 0xA7, 0xE3, 0x53, 0x56, 0x66, 
-0xE3, 0x39, 0xC8, 0x6C, 0xC0, 0x34, 0xE4, 0x67, 0x0D, 0x73, 0x21, 0xCE, 0xE6, 0xFA, 0x9C, 0x95, 
-0xEA, 0xF8, 0xF4, 0x54, 0x29, 0x89, 0x79, 0x3C, 0x85, 0x06, 0x95, 0xA5, 0x63, 0xBE, 0x8F, 0x30, 
-0x18, 0xD2, 0x3F, 0xED, 0x33, 0x0D, 0xD3, 0xC1, 0x4C, 0x9D, 0xB1, 0x48, 0xCF, 0x06, 0x67, 0xA3, 
-0xB3, 0x21, 0x0B, 0x31, 0x9D, 0x8D, 0x66, 0xA3, 0x32, 0x2F, 0xD3, 0x12, 0x2F, 0xFF, 0x4A, 0xED, 
-0x7E, 0xDF, 0xEB, 0x86, 0xF0, 0xC3, 0xAB, 0x17, 0x6E, 0x68, 0x42, 0xAA, 0xA5, 0x6E, 0x15, 0x00, 
-0x9E, 0x51, 0x75, 0xA1, 0x53, 0xC2, 0x0B, 0xA7, 0xF3, 0xE9, 0x54, 0x3E, 0xE9, 0x33, 0x27, 0x66, 
-0x8B, 0xFA, 0x05, 0xFF, 0xA0, 0x59, 0xC4, 0x2D, 0xAB, 0x44, 0xE5, 0xB2, 0xCA, 0x7A, 0xDF, 0x6F, 
-0xFF, 0x65, 0xC7, 0xCC, 0xC8, 0x03, 0xB9, 0x23, 0x8F, 0x64, 0x45, 0x76, 0xE4, 0x8C, 0x2C, 0x4D, 
-0x99, 0x1E, 0x43, 0x34, 0x0E, 0x02, 0x10, 0xD2, 0x57, 0x33, 0x60, 0x0B, 0x2D, 0xDE, 0x61, 0x2C, 
-0x07, 0xF6, 0xBD, 0x4B, 0x8B, 0x2C, 0xEB, 0x94, 0x88, 0xAF, 0x5F, 0x7A, 0xBF, 0xC3, 0xF7, 0xA4, 
-0x20, 0x72, 0xDE, 0xC5, 0x39, 0x78, 0x87, 0xCF, 0x58, 0x3D, 0x6E, 0x68, 0x9D, 0x09, 0x29, 0x5A, 
-0xE6, 0x15, 0xA6, 0x4D, 0xF9, 0xB1, 0xA7, 0xE9, 0x64, 0x79, 0x7A, 0x79, 0x81, 0x07, 0xD6, 0x93, 
-0x29, 0xFF, 0xF1, 0x8F, 0xCE, 0xD5, 0xF5, 0xC5, 0xF4, 0xE3, 0x7C, 0xF6, 0x3F, 0xD6, 0xC7, 0xF9, 
-0x7C, 0x55, 0xEA, 0x39, 0x5D, 0x5E, 0x5B, 0xD8, 0xF3, 0x69, 0xBE, 0x9A, 0x9C, 0x73, 0x7B, 0xAC, 
-0xD5, 0x64, 0x71, 0x71, 0x3E, 0xB7, 0xAC, 0xA2, 0xB7, 0x57, 0x9B, 0xE3, 0xDD, 0xBB, 0xEE, 0x86, 
-0x3D, 0x77, 0x9A, 0xA6, 0x00, 0x40, 0x52, 0xEC, 0x86, 0x41, 0xF7, 0x1B, 0x44, 0x4A, 0xF7, 0x01, 
-0x5A, 0x3A, 0x48, 0x6D, 0xA2, 0x2A, 0xA0, 0x54, 0x40, 0xD6, 0x1E, 0x64, 0x4F, 0x5C, 0x64, 0xDD, 
-0x28, 0x07, 0xAC, 0x24, 0x1E, 0x28, 0xA8, 0xE0, 0x68, 0x29, 0xFA, 0x0D, 0x04, 0x1B, 0xFE, 0x95, 
-0xD2, 0xFF, 0xC0, 0x15, 0x89, 0x0F, 0x04, 0xB1, 0x80, 0xC2, 0xBB, 0x83, 0x1C, 0x6C, 0x2C, 0x2F, 
-0x11, 0x7C, 0x7B, 0x9E, 0x3A, 0x33, 0x0E, 0x49, 0x45, 0x55, 0x6F, 0x0A, 0x69, 0x71, 0x54, 0xF5, 
-0xA6, 0x50, 0x64, 0xD7, 0x32, 0x45, 0x5A, 0x26, 0xB7, 0xE6, 0x83, 0x1D, 0x46, 0xEE, 0x02, 0xA4, 
-0x14, 0xCB, 0x9B, 0x54, 0x60, 0xC8, 0x4D, 0xF9, 0xE7, 0xEA, 0xE4, 0x68, 0x77, 0x13, 0xC5, 0x61, 
-0xF7, 0x68, 0xD0, 0x23, 0x2A, 0xBC, 0x1F, 0xCC, 0xAB, 0xEE, 0x2D, 0x01, 0xAF, 0xAD, 0xC2, 0x22, 
-0x90, 0x8D, 0x32, 0x8B, 0x55, 0x75, 0x3D, 0x24, 0x0C, 0x60, 0xE5, 0x0E, 0x0D, 0x9C, 0x74, 0x82, 
-0xED, 0x51, 0x5D, 0x7F, 0x27, 0xF8, 0xAB, 0xA0, 0x12, 0x2C, 0x86, 0x0E, 0xC7, 0xDE, 0xC0, 0x1A, 
-0x57, 0xD7, 0xCB, 0x8B, 0xF9, 0x8C, 0x31, 0x41, 0x5C, 0x38, 0x37, 0x49, 0x28, 0xD1, 0x91, 0x10, 
-0x59, 0xED, 0x43, 0x14, 0xE9, 0x17, 0x51, 0x04, 0x03, 0x32, 0x06, 0x11, 0x0C, 0xC8, 0x03, 0xDC, 
-0xDC, 0xE0, 0x6D, 0xD1, 0x2C, 0x82, 0x4C, 0x99, 0x08, 0x32, 0xC3, 0x17, 0xEB, 0x42, 0xAB, 0x0D, 
-0xA7, 0x1A, 0xBC, 0x58, 0x47, 0x3D, 0x99, 0xC2, 0x6B, 0xDE, 0x34, 0x64, 0x34, 0xC7, 0x57, 0x53, 
-0xC3, 0x6B, 0x0C, 0xA9, 0xD1, 0x51, 0xA3, 0x54, 0xC8, 0xDC, 0x97, 0xE2, 0x86, 0x00, 0xF8, 0xB2, 
-0xF2, 0x0D, 0x81, 0x0D, 0xF5, 0x78, 0x0A, 0x59, 0x82, 0xB2, 0xEA, 0x72, 0xC7, 0x1F, 0x00, 0x7D, 
-0x34, 0x61, 0xFB, 0x75, 0xD0, 0xBD, 0x33, 0x01, 0x64, 0x65, 0x86, 0x07, 0xB0, 0x93, 0x55, 0xDE, 
-0xDF, 0xA1, 0x3A, 0xD3, 0x7B, 0x15, 0x22, 0x2B, 0xBF, 0x4B, 0xEE, 0x49, 0x57, 0x4D, 0x3C, 0x0D, 
-0x3D, 0x1B, 0xF6, 0x87, 0x1B, 0x0D, 0xB2, 0x33, 0xB7, 0x47, 0xB2, 0x7E, 0xB0, 0x22, 0x67, 0xA6, 
-0x72, 0x72, 0xF6, 0xD3, 0xEE, 0xE4, 0xEC, 0xD0, 0x5C, 0xF5, 0x36, 0x9C, 0x7B, 0x11, 0x49, 0xE9, 
-0x90, 0x7E, 0x60, 0xD9, 0x21, 0x59, 0x79, 0x7C, 0x22, 0x0E, 0x1F, 0x81, 0x8C, 0xC7, 0x8C, 0x8C, 
-0xFC, 0x56, 0xC3, 0x86, 0xF9, 0x55, 0x48, 0xFC, 0xC1, 0x47, 0x68, 0x48, 0x7F, 0x9B, 0x12, 0x29, 
-0x28, 0xF7, 0x1F, 0xD9, 0xE4, 0xC8, 0x2F, 0x46, 0x97, 0x08, 0xC1, 0x6D, 0x89, 0x92, 0xBC, 0x15, 
-0x59, 0x7D, 0x35, 0x22, 0x56, 0x47, 0x22, 0x32, 0x4E, 0x36, 0xCC, 0x4D, 0x92, 0xEF, 0xB8, 0x8A, 
-0xC4, 0x9E, 0x50, 0x61, 0x4E, 0x3D, 0x29, 0x44, 0x3B, 0x58, 0xD6, 0x3D, 0x22, 0xEB, 0x06, 0xEC, 
-0xB0, 0xFE, 0xB4, 0x50, 0xED, 0x28, 0x0E, 0x33, 0xE2, 0x2C, 0xB4, 0x69, 0xD0, 0xDC, 0x37, 0x48, 
-0x25, 0x75, 0x67, 0x53, 0x79, 0xDC, 0xA1, 0xEC, 0x31, 0xD3, 0xAD, 0x0A, 0xC3, 0x58, 0xE5, 0xFC, 
-0x4D, 0x62, 0xAF, 0xD4, 0x8D, 0xEE, 0x77, 0xF2, 0xDC, 0x23, 0x20, 0xED, 0xA0, 0xEA, 0x3E, 0x9E, 
-0x07, 0x36, 0x1A, 0xD4, 0x43, 0x01, 0xFF, 0x4C, 0xE3, 0x58, 0xE3, 0x40, 0xF2, 0xCF, 0x03, 0xD5, 
-0x29, 0x94, 0x55, 0xF1, 0x81, 0xA0, 0x12, 0x9C, 0xFE, 0x8A, 0x51, 0xA8, 0x48, 0x5D, 0x4C, 0x87, 
-0x97, 0x5F, 0x15, 0xFD, 0x6C, 0x7E, 0xB5, 0x2E, 0xE7, 0x57, 0x37, 0x4D, 0x07, 0xF9, 0xF3, 0x2C, 
-0xCA, 0x27, 0x4E, 0x91, 0x51, 0x11, 0xC8, 0x91, 0xFC, 0x23, 0xAF, 0x07, 0x99, 0x55, 0x64, 0x76, 
-0x83, 0x23, 0x07, 0xAE, 0x4E, 0xD2, 0xF9, 0x83, 0x9D, 0xEF, 0x63, 0xC0, 0x7B, 0xF7, 0x2E, 0x96, 
-0xEF, 0x5C, 0x7C, 0xC8, 0xED, 0xCF, 0x0A, 0x5E, 0x3F, 0xA2, 0x23, 0xC1, 0x4B, 0xF6, 0x47, 0x98, 
-0xEB, 0x3F, 0x99, 0x9C, 0xDE, 0xB4, 0x4B, 0xE6, 0x64, 0x6E, 0xDC, 0xB9, 0x99, 0x5B, 0x62, 0xF9, 
-0x8B, 0x69, 0xFA, 0xE7, 0x61, 0xFE, 0xCC, 0xFC, 0x6A, 0x6C, 0xCA, 0x27, 0x84, 0x95, 0xA6, 0xDF, 
-0x8E, 0x4D, 0x52, 0x47, 0xBC, 0x1F, 0x57, 0x4B, 0x1D, 0xC9, 0x04, 0x9F, 0x2E, 0x2C, 0xD2, 0x45, 
-0xFB, 0xD0, 0x67, 0x13, 0xC6, 0x69, 0x2A, 0xD5, 0x49, 0x92, 0x30, 0xAE, 0x2B, 0x77, 0xE4, 0xC2, 
-0x83, 0xF0, 0xD0, 0x3E, 0xB0, 0xF1, 0xDE, 0x6F, 0x7E, 0x47, 0x6E, 0x4D, 0xEF, 0xC8, 0xF9, 0x3F, 
-0x87, 0xC7, 0x36, 0x92, 0x07, 0x89, 0xB3, 0x65, 0x42, 0xC0, 0x3C, 0x47, 0x76, 0x79, 0x77, 0xD6, 
-0xD6, 0xF0, 0xC2, 0x74, 0x7A, 0x4D, 0x6C, 0xFA, 0xD9, 0x7F, 0x6E, 0x26, 0xC9, 0x8F, 0xDB, 0x2F, 
-0xCA, 0x2F, 0x45, 0xF1, 0x9E, 0x97, 0x76, 0x5A, 0x8C, 0x5D, 0x5B, 0x0D, 0x69, 0xA7, 0xD5, 0x26, 
-0xED, 0x6C, 0x42, 0xF6, 0xC4, 0x45, 0xD6, 0x3A, 0x5F, 0xC1, 0xA4, 0xF6, 0xC5, 0xE9, 0x4A, 0xF4, 
-0x47, 0xBA, 0xE2, 0xA4, 0xD9, 0x0A, 0x2C, 0x21, 0xDC, 0xCD, 0x5A, 0x3C, 0x83, 0xB5, 0xB2, 0x15, 
-0xEB, 0x14, 0xDB, 0x56, 0x8B, 0x6E, 0x59, 0xED, 0xF7, 0x5A, 0x09, 0x38, 0x6D, 0x03, 0xFD, 0x39, 
-0xB9, 0xA2, 0x6B, 0xC1, 0x72, 0x8D, 0x31, 0x05, 0xC1, 0x5B, 0x6F, 0x1C, 0x1C, 0xEE, 0x9D, 0xB6, 
-0xB2, 0x7B, 0xE7, 0x01, 0xF2, 0xE3, 0x0A, 0x6B, 0x8D, 0x8E, 0x98, 0xE7, 0xD4, 0x33, 0x5B, 0x85, 
-0x3B, 0xE2, 0xA4, 0x6D, 0x49, 0xDE, 0xF6, 0x90, 0xE4, 0x6D, 0xB7, 0x66, 0xE1, 0x3B, 0xBA, 0x14, 
-0x5F, 0xEF, 0x20, 0xFD, 0xF7, 0xB0, 0x6B, 0xA7, 0xDF, 0x53, 0xCE, 0x51, 0x48, 0x77, 0x26, 0xCA, 
-0xEB, 0xD1, 0x44, 0x29, 0xAE, 0xCC, 0xED, 0x7B, 0x7D, 0xA0, 0x1C, 0x74, 0xFB, 0x90, 0xF2, 0xDD, 
-0xE2, 0xB4, 0xA9, 0x6B, 0xB5, 0x2A, 0xF5, 0x86, 0x66, 0x0D, 0x59, 0xE5, 0x54, 0xCF, 0xCB, 0x52, 
-0xBD, 0x00, 0x52, 0xBD, 0xE0, 0x27, 0xEF, 0x24, 0xC0, 0x54, 0xCF, 0x6A, 0x9D, 0xEA, 0x95, 0x27, 
-0xB7, 0xA8, 0x5F, 0xBF, 0x3B, 0x7C, 0x00, 0x07, 0xFB, 0x90, 0x64, 0x59, 0x56, 0x91, 0x65, 0x59, 
-0x4C, 0x0E, 0x05, 0x2E, 0x98, 0x4A, 0x8E, 0x4D, 0xF5, 0xD8, 0xFE, 0xA3, 0x3B, 0x72, 0xF4, 0x58, 
-0x8C, 0x6E, 0x4E, 0xF5, 0x5E, 0x8D, 0x88, 0x23, 0x11, 0x15, 0xA2, 0x31, 0x5C, 0xF8, 0x13, 0xC6, 
-0x22, 0xBE, 0x8B, 0xED, 0xBC, 0xA2, 0xA5, 0x17, 0xDB, 0x3A, 0x7F, 0x93, 0xBC, 0xD7, 0xD0, 0x53, 
-0x6C, 0xCF, 0xB3, 0xF5, 0x17, 0xEF, 0x85, 0x77, 0xE2, 0xBD, 0xF0, 0xD9, 0xCB, 0xF6, 0xC2, 0x4B, 
-0xD8, 0x0B, 0x9F, 0x25, 0x7B, 0xE1, 0x1D, 0xDD, 0x0B, 0x37, 0xC5, 0x90, 0x65, 0xB1, 0x17, 0xC6, 
-0x30, 0x5C, 0xDE, 0x0B, 0xE7, 0x41, 0x25, 0xC9, 0xE2, 0x5F, 0xE6, 0x98, 0xF6, 0xE5, 0xEF, 0x55, 
-0xAD, 0xB5, 0xCA, 0xDF, 0x6B, 0x4A, 0xDC, 0x93, 0xBF, 0x97, 0x95, 0x99, 0xF1, 0x45, 0xFF, 0xD7, 
-0x11, 0x10, 0xC9, 0x78, 0xF9, 0x29, 0x3F, 0xB9, 0xE5, 0x27, 0xC7, 0xFC, 0xE4, 0x9A, 0x63, 0x7D, 
-0xED, 0x9A, 0xBE, 0xA4, 0x3E, 0x67, 0x08, 0x3E, 0xE7, 0xB0, 0x47, 0x2D, 0xEF, 0x30, 0xA0, 0x6F, 
-0x6A, 0x7D, 0x47, 0xB8, 0x59, 0xB2, 0xF3, 0xAB, 0xFE, 0xFF, 0xB5, 0xF7, 0xF5, 0x5F, 0x6D, 0xEB, 
-0x48, 0xC3, 0xBF, 0xBF, 0x7F, 0x05, 0xA5, 0xBB, 0x1C, 0x9B, 0x28, 0xA9, 0xED, 0x7C, 0x87, 0xBA, 
-0x1C, 0x08, 0xD0, 0xB2, 0xA5, 0xD0, 0x2D, 0xB4, 0xBD, 0xBD, 0x3D, 0x3D, 0x3D, 0x26, 0x71, 0x20, 
-0xB7, 0x21, 0x66, 0x9D, 0x00, 0xED, 0x6D, 0xF9, 0xDF, 0xDF, 0x99, 0x91, 0x64, 0x49, 0xB6, 0x1C, 
-0x02, 0xCB, 0xDE, 0xF7, 0x79, 0x9F, 0xB3, 0x40, 0x88, 0x3D, 0x96, 0x46, 0x9A, 0x0F, 0x8D, 0x46, 
-0xB2, 0x34, 0xCA, 0x1B, 0x83, 0xD9, 0xE7, 0xE9, 0x17, 0xAD, 0x61, 0x6F, 0x28, 0x57, 0x2D, 0x3C, 
-0xB5, 0x39, 0xC8, 0xEA, 0xB9, 0xEE, 0x20, 0xF7, 0x4D, 0x07, 0xF9, 0xD8, 0xB2, 0xAE, 0x8B, 0x89, 
-0x25, 0x5D, 0xDC, 0x9F, 0x94, 0x9E, 0x64, 0x9F, 0x9B, 0xF2, 0x41, 0x3C, 0x9E, 0x38, 0xD9, 0xAB, 
-0x5C, 0x97, 0x8D, 0x42, 0x0A, 0x75, 0xD0, 0x07, 0x83, 0x8D, 0xF6, 0x75, 0x3D, 0xA5, 0x4B, 0x18, 
-0xB6, 0x7B, 0xB4, 0x75, 0x17, 0x8C, 0x38, 0x3F, 0xB4, 0x60, 0x5E, 0x01, 0xCF, 0xB1, 0xE2, 0x5C, 
-0x27, 0xE3, 0xE1, 0x8A, 0x07, 0x0D, 0x65, 0xB2, 0x39, 0xA1, 0x07, 0xBD, 0xD5, 0xEA, 0xAA, 0xAB, 
-0xC1, 0xA7, 0x9B, 0x53, 0x20, 0x11, 0xE8, 0xCD, 0x3F, 0x18, 0x6E, 0x0E, 0x55, 0x06, 0xF2, 0x55, 
-0x8F, 0x05, 0x81, 0x27, 0x6A, 0x05, 0x19, 0x78, 0xEC, 0x67, 0xE5, 0x6B, 0xBA, 0x22, 0x70, 0x8D, 
-0x66, 0xB5, 0xD9, 0x79, 0x34, 0x4C, 0x6E, 0x48, 0x85, 0xC2, 0x82, 0x80, 0x71, 0x69, 0xA1, 0x4C, 
-0x72, 0x34, 0x1A, 0xCD, 0xE2, 0xF9, 0x6F, 0xA1, 0x79, 0xFF, 0x29, 0xBC, 0xC9, 0x52, 0x6C, 0x4F, 
-0xAE, 0xD2, 0x30, 0x58, 0xBF, 0x81, 0x5E, 0x25, 0x0C, 0xB5, 0x03, 0x67, 0x6A, 0x2F, 0xF1, 0x10, 
-0xB1, 0x13, 0xA8, 0x6D, 0xED, 0xE4, 0xD3, 0xDB, 0xDD, 0xE6, 0xA6, 0xFE, 0xEC, 0x28, 0x1D, 0xCB, 
-0x83, 0xA0, 0x6A, 0x1F, 0x77, 0x8F, 0x4F, 0x42, 0xA4, 0x0D, 0x7A, 0xCA, 0x5A, 0x5B, 0xBC, 0x29, 
-0x27, 0x0E, 0xCE, 0x34, 0x49, 0x5E, 0x3A, 0x7D, 0x1A, 0xB6, 0x80, 0x2F, 0x7F, 0xEE, 0xBA, 0xBD, 
-0x32, 0x64, 0xBB, 0x5B, 0x0A, 0xD9, 0x7C, 0xDD, 0xF1, 0xAB, 0x02, 0xA3, 0x7B, 0x17, 0x42, 0xE7, 
-0x3C, 0x2B, 0x3C, 0x5D, 0x94, 0xB6, 0xD6, 0xEA, 0x34, 0xDB, 0xF8, 0x5E, 0xB9, 0x57, 0x8A, 0xEC, 
-0x4E, 0xE6, 0x79, 0x26, 0xF3, 0x3C, 0x5C, 0x2C, 0x57, 0x3C, 0x6C, 0x62, 0x66, 0x86, 0xA3, 0xC8, 
-0x82, 0x09, 0xC8, 0x40, 0x95, 0x50, 0x15, 0x7E, 0x08, 0x4A, 0x8A, 0x4F, 0x73, 0x9B, 0xCA, 0x29, 
-0xE6, 0x09, 0x0F, 0x21, 0xD0, 0xA1, 0x90, 0xD6, 0xA9, 0x8A, 0x61, 0x8D, 0xDB, 0x16, 0x52, 0x23, 
-0xEA, 0x11, 0x46, 0xAF, 0xAE, 0x5B, 0xF1, 0xB4, 0x7C, 0xC4, 0x44, 0x3B, 0xFC, 0x69, 0xA7, 0x3E, 
-0x66, 0x6C, 0x67, 0xAB, 0x19, 0x04, 0x46, 0x7C, 0xF3, 0x2E, 0x4E, 0x38, 0x00, 0x58, 0x10, 0x34, 
-0x82, 0xAE, 0x15, 0x19, 0xC5, 0x47, 0xE5, 0x61, 0x05, 0x38, 0xDA, 0x54, 0xDF, 0xEA, 0xEE, 0xF1, 
-0x48, 0xA5, 0x54, 0x51, 0x8C, 0x3A, 0xA0, 0x85, 0x1F, 0xB0, 0x21, 0xF3, 0xBA, 0x1D, 0x9F, 0x08, 
-0x0C, 0x28, 0x1E, 0x01, 0xE6, 0xF3, 0xB4, 0x6D, 0xF3, 0x14, 0x5F, 0x20, 0x65, 0x25, 0xDC, 0x32, 
-0x36, 0xDA, 0x0C, 0x40, 0x40, 0xF6, 0x35, 0x06, 0x7A, 0x45, 0x08, 0x4D, 0x4A, 0xA1, 0xE0, 0x9B, 
-0x01, 0x8F, 0x3B, 0xD0, 0xAD, 0x37, 0x3B, 0x41, 0xD9, 0xF2, 0x95, 0x48, 0x5F, 0xD4, 0x24, 0x9C, 
-0xA7, 0x36, 0xF5, 0xBE, 0x03, 0x7B, 0x2F, 0x5D, 0x48, 0xEE, 0xD1, 0x94, 0x83, 0xE5, 0x08, 0x8A, 
-0x32, 0xCD, 0xF0, 0xF2, 0xD1, 0x0F, 0xED, 0x9A, 0xE1, 0xF1, 0xEA, 0x8B, 0x90, 0x9B, 0x86, 0x26, 
-0x88, 0x53, 0x7D, 0x52, 0x19, 0xF9, 0x40, 0xDC, 0x5A, 0xD0, 0x68, 0x11, 0x88, 0xB2, 0x3C, 0xB4, 
-0x0E, 0x23, 0x30, 0x61, 0xDD, 0x7C, 0xDC, 0x0A, 0x1B, 0x32, 0x95, 0x28, 0x10, 0xFA, 0xD4, 0xE6, 
-0x42, 0x35, 0x56, 0xCC, 0x34, 0xF5, 0x5B, 0x1B, 0x65, 0x78, 0x92, 0x42, 0x60, 0xE6, 0x51, 0x2C, 
-0x91, 0x98, 0xED, 0x4C, 0x5A, 0x4E, 0x21, 0xE8, 0x55, 0x2A, 0x36, 0x04, 0xBE, 0x7E, 0x89, 0x38, 
-0x58, 0xFF, 0xAB, 0x15, 0xA0, 0x51, 0xAE, 0x00, 0x2D, 0xD9, 0xC0, 0xB1, 0x09, 0x96, 0xB4, 0xC1, 
-0xB6, 0x94, 0x3F, 0x35, 0x2D, 0x6A, 0x23, 0x1D, 0xDE, 0x64, 0x29, 0x42, 0x07, 0x36, 0x4C, 0xBE, 
-0x3C, 0x49, 0xAA, 0xBE, 0x68, 0xA1, 0x56, 0x64, 0xB4, 0xAC, 0x8F, 0x1A, 0x17, 0xC5, 0x94, 0x22, 
-0xC9, 0x89, 0x48, 0xB9, 0xF8, 0x66, 0xBE, 0xED, 0x79, 0xBC, 0x91, 0x73, 0xA6, 0x21, 0x8C, 0xE7, 
-0xB0, 0x21, 0x53, 0x31, 0x41, 0xC4, 0xF4, 0x10, 0x5A, 0x02, 0xBE, 0x6D, 0x0B, 0x61, 0x59, 0x6D, 
-0x83, 0x0E, 0x06, 0x37, 0x21, 0x64, 0x7C, 0x09, 0x90, 0x55, 0x17, 0x04, 0x23, 0x44, 0x6D, 0x30, 
-0x1B, 0x45, 0x42, 0xE6, 0x30, 0xB2, 0x8D, 0x29, 0xD3, 0xD6, 0x65, 0x2D, 0x42, 0x95, 0x99, 0xD2, 
-0x36, 0x45, 0x78, 0xA6, 0x8C, 0x8A, 0x48, 0xCE, 0x4F, 0x84, 0x65, 0x0B, 0x92, 0xB8, 0x51, 0xB4, 
-0xA0, 0xAA, 0x73, 0xC2, 0x90, 0x9C, 0x36, 0x52, 0x41, 0x8D, 0x2F, 0x8B, 0x1A, 0x2D, 0x5A, 0x01, 
-0xC0, 0x48, 0x91, 0x49, 0x47, 0xC5, 0xBE, 0xB5, 0xC5, 0x92, 0x14, 0xF2, 0x33, 0xCC, 0x30, 0xE5, 
-0xA3, 0x7A, 0x71, 0xFB, 0x9F, 0xC5, 0x21, 0xB1, 0xA1, 0xEA, 0x88, 0xE8, 0x2D, 0xF2, 0xFC, 0x03, 
-0xCC, 0x85, 0x9C, 0x21, 0xEC, 0x41, 0x26, 0x46, 0x25, 0x5A, 0x9F, 0x8A, 0xB4, 0x57, 0xCB, 0xC3, 
-0x56, 0x41, 0x89, 0x88, 0xA9, 0x44, 0x0F, 0x4F, 0x8E, 0x30, 0xEC, 0x01, 0x48, 0x8C, 0x2D, 0x7E, 
-0x45, 0xC8, 0xB0, 0xB2, 0xF6, 0xEE, 0x87, 0xAB, 0x15, 0xD6, 0x82, 0xA3, 0xA5, 0x8C, 0x22, 0x02, 
-0xA8, 0x66, 0xF9, 0x6D, 0x8A, 0x5F, 0xD2, 0xA4, 0x4B, 0xE2, 0x34, 0xA5, 0x5A, 0x9C, 0xA6, 0x54, 
-0x9D, 0x03, 0xB1, 0x64, 0xCB, 0xB6, 0xB4, 0x6A, 0x90, 0xCA, 0x7D, 0x12, 0xD7, 0x97, 0x4F, 0x5C, 
-0x6A, 0x2F, 0xE4, 0x14, 0xB5, 0xDD, 0x38, 0x28, 0xF3, 0x18, 0x94, 0x9B, 0x07, 0xD5, 0xB8, 0x14, 
-0x73, 0x55, 0xCB, 0x11, 0x4F, 0x53, 0xC9, 0x67, 0xCD, 0x05, 0xB0, 0xE1, 0xCA, 0xD2, 0x50, 0x34, 
-0x22, 0xCA, 0xA6, 0xAC, 0x0F, 0x0F, 0x22, 0x64, 0xC2, 0xB8, 0x1A, 0x2E, 0x6A, 0xCF, 0x8D, 0xAC, 
-0x8D, 0x28, 0x72, 0x44, 0x08, 0xA1, 0x34, 0xAB, 0xF3, 0x1D, 0x1D, 0x60, 0x56, 0x2F, 0x11, 0x07, 
-0x0F, 0xBD, 0x04, 0xA9, 0x3F, 0xAD, 0xCC, 0x31, 0xA1, 0x82, 0x3A, 0x3A, 0xCC, 0x82, 0xCB, 0xE7, 
-0xE7, 0xE6, 0x19, 0x19, 0x3D, 0xD5, 0xE0, 0x78, 0xFC, 0xB0, 0x54, 0x0F, 0xA3, 0x54, 0x2F, 0x6F, 
-0xD0, 0x3E, 0x3F, 0x8E, 0x0F, 0x13, 0xF1, 0xC6, 0x47, 0x86, 0x46, 0x1A, 0x9F, 0x80, 0x8E, 0x93, 
-0x32, 0x29, 0x0F, 0xCA, 0xD4, 0xFD, 0xB4, 0xD4, 0xA5, 0x29, 0xD6, 0x04, 0x25, 0x00, 0x7C, 0x13, 
-0xF6, 0x3F, 0xE8, 0xB4, 0xDB, 0xF7, 0xEF, 0xD1, 0xAC, 0x6B, 0xF5, 0x4A, 0x7B, 0x34, 0xA8, 0xAD, 
-0xBE, 0x66, 0x6F, 0x56, 0x7E, 0xD4, 0xD1, 0x12, 0x9E, 0x8E, 0xDD, 0x39, 0xD4, 0xBA, 0xFD, 0xCC, 
-0x3E, 0x67, 0x7A, 0xB6, 0xBC, 0x4B, 0xD1, 0xE6, 0x4C, 0x37, 0x17, 0xEE, 0xD2, 0x61, 0x89, 0x3A, 
-0xFB, 0xC1, 0x74, 0x8B, 0x30, 0x79, 0xAA, 0x07, 0xB5, 0x7A, 0x39, 0xF4, 0x68, 0x9E, 0x9D, 0x8B, 
-0x40, 0xEE, 0x91, 0x84, 0x89, 0xF8, 0x4E, 0x58, 0x00, 0xF7, 0xB4, 0xE7, 0x59, 0x98, 0x47, 0x7B, 
-0xD7, 0x9B, 0xF9, 0x5A, 0x99, 0x96, 0x35, 0x29, 0x84, 0x98, 0xD9, 0x8F, 0xCB, 0xA3, 0x69, 0x54, 
-0x33, 0xB1, 0x69, 0x5E, 0x66, 0x52, 0x65, 0xBB, 0xD1, 0x1D, 0x67, 0xE9, 0xE3, 0x7B, 0x59, 0x2F, 
-0x2E, 0xFA, 0x73, 0x3B, 0xE7, 0x33, 0xED, 0xCF, 0x7C, 0x40, 0x4D, 0x5A, 0xBC, 0x0B, 0x62, 0x45, 
-0x01, 0x2E, 0xEF, 0x80, 0x49, 0x41, 0x78, 0xD9, 0xB1, 0x95, 0x7F, 0xB1, 0x03, 0xA6, 0xC5, 0xB7, 
-0xFB, 0xF7, 0x3C, 0xF1, 0xAC, 0xA7, 0x24, 0x32, 0x48, 0x84, 0xF5, 0xAC, 0xDB, 0x55, 0x96, 0x4E, 
-0x8F, 0xFF, 0x66, 0xED, 0x24, 0x79, 0x3F, 0x6B, 0xE4, 0x69, 0x53, 0x97, 0xCE, 0x71, 0x53, 0x98, 
-0xFF, 0xFF, 0x8D, 0xAE, 0xB8, 0x1C, 0xD9, 0x7A, 0x59, 0xEC, 0xB4, 0xFF, 0xB0, 0x26, 0xDC, 0xEA, 
-0x86, 0x6B, 0x90, 0x19, 0x2E, 0xA6, 0x66, 0x61, 0xC2, 0x33, 0xDB, 0x34, 0x94, 0x7A, 0xAE, 0x4F, 
-0x43, 0x1D, 0x9B, 0xD3, 0x50, 0xA3, 0xC2, 0x34, 0x14, 0x9F, 0x7C, 0xCA, 0xE6, 0xA2, 0xE8, 0x1C, 
-0xDC, 0x44, 0x7F, 0x71, 0x39, 0xAF, 0xA4, 0xF2, 0xB5, 0xEC, 0x48, 0x14, 0x31, 0xFB, 0xF2, 0xEB, 
-0x97, 0x33, 0x09, 0x9D, 0x28, 0x3C, 0x70, 0x12, 0xFB, 0xC9, 0x96, 0xE3, 0xDC, 0x0B, 0xCD, 0x64, 
-0x3D, 0xA9, 0xCC, 0x31, 0x9C, 0xDC, 0x59, 0xE8, 0x83, 0x02, 0xAE, 0x3B, 0x43, 0xFC, 0x5E, 0x77, 
-0xC6, 0xEA, 0xFD, 0xE6, 0x98, 0xDE, 0x6F, 0xA6, 0x9B, 0x49, 0x0F, 0x30, 0xBA, 0x2E, 0x9B, 0x18, 
-0x7A, 0x3F, 0x91, 0x7A, 0x3F, 0x64, 0xF3, 0xEA, 0x10, 0xEF, 0x45, 0x8C, 0xDC, 0xA4, 0x9A, 0x41, 
-0x4C, 0x05, 0x11, 0x0F, 0x58, 0x52, 0x3D, 0x03, 0x05, 0x03, 0x0D, 0xA0, 0x0B, 0x8A, 0x8F, 0x57, 
-0x4C, 0x7A, 0x06, 0x84, 0x63, 0x06, 0x4C, 0x4E, 0xEF, 0x82, 0x33, 0xFC, 0x43, 0x66, 0xC1, 0x3D, 
-0x24, 0x4E, 0xD5, 0x68, 0x97, 0x23, 0xDA, 0xAF, 0x32, 0xC4, 0xA2, 0x64, 0x5E, 0x91, 0xB1, 0xAC, 
-0xA7, 0xA1, 0x7D, 0xD3, 0x70, 0x52, 0xA6, 0x7D, 0x73, 0xA8, 0x8A, 0x47, 0x4B, 0x08, 0x97, 0x76, 
-0x10, 0xA7, 0xF6, 0xED, 0x2B, 0x4B, 0x26, 0x6E, 0xDF, 0x23, 0xB1, 0xBF, 0xC8, 0xF5, 0x2C, 0x24, 
-0x2E, 0xC3, 0x0C, 0x4A, 0x5F, 0x87, 0xCE, 0xC5, 0x9E, 0xC7, 0x2B, 0x6B, 0x2A, 0xB6, 0xE4, 0xED, 
-0xEE, 0x3D, 0x12, 0x77, 0xEE, 0x93, 0xB6, 0x51, 0x5A, 0x77, 0xE8, 0xD1, 0xFC, 0xB6, 0x2D, 0x4F, 
-0xB7, 0xCC, 0xD5, 0x06, 0x95, 0xE9, 0xB4, 0xBD, 0xC0, 0x9A, 0xA7, 0xB4, 0x9C, 0xA0, 0x0B, 0xA3, 
-0xE3, 0xAE, 0x35, 0x4F, 0x99, 0x78, 0x6B, 0xBE, 0xDF, 0x15, 0xFB, 0x48, 0x0B, 0x79, 0xEE, 0x21, 
-0xE5, 0x45, 0x02, 0x98, 0x68, 0x76, 0x6A, 0x2A, 0xEE, 0x40, 0xA1, 0x95, 0x91, 0x08, 0x23, 0x73, 
-0xA5, 0x85, 0x7A, 0xA2, 0x5B, 0xA8, 0x91, 0x69, 0xA1, 0x2E, 0x73, 0x0B, 0x2E, 0x0C, 0xFB, 0x14, 
-0xC6, 0xCF, 0x02, 0x36, 0xA4, 0xFF, 0x78, 0x8E, 0xB2, 0x6E, 0xA5, 0xF8, 0xEC, 0x77, 0xCA, 0xE7, 
-0xB4, 0x69, 0xDA, 0xFA, 0x52, 0x14, 0x77, 0xA6, 0x6F, 0x7C, 0x26, 0x9B, 0xE5, 0xC3, 0x70, 0xB0, 
-0xD3, 0xE9, 0xAE, 0xC7, 0x2C, 0xBB, 0xB2, 0xD9, 0xB0, 0xB9, 0x3E, 0x61, 0x4A, 0x7B, 0x8B, 0x5F, 
-0x4F, 0x93, 0x53, 0x70, 0x18, 0x05, 0x32, 0xBB, 0x7D, 0xA2, 0x21, 0x5E, 0x5C, 0x34, 0x05, 0x78, 
-0x48, 0x37, 0xFD, 0x40, 0xB1, 0xEA, 0x8A, 0xA7, 0x46, 0x6E, 0xE4, 0xD3, 0x83, 0x4B, 0x84, 0x3F, 
-0x94, 0x46, 0xCF, 0x11, 0x97, 0xE0, 0x8F, 0x99, 0xCA, 0xA1, 0xAE, 0x78, 0x6A, 0x66, 0x49, 0xAF, 
-0x63, 0xF4, 0x98, 0x5E, 0x9A, 0xC4, 0xBF, 0xAC, 0x99, 0xC2, 0xDF, 0xB8, 0x64, 0x0F, 0x10, 0x2E, 
-0x0A, 0xA7, 0x9D, 0x3D, 0x7C, 0x93, 0x5F, 0x5E, 0x17, 0x1B, 0x62, 0x8B, 0x19, 0x6E, 0x28, 0xC6, 
-0x8D, 0x42, 0x4D, 0x9B, 0xC6, 0xCA, 0x5D, 0x39, 0xB8, 0xB9, 0x15, 0xB7, 0xF6, 0xB6, 0x16, 0x68, 
-0x5F, 0x89, 0x50, 0x6A, 0xB8, 0xCB, 0xA5, 0x89, 0x9C, 0xB0, 0x33, 0x4F, 0x7B, 0x1E, 0x64, 0x4C, 
-0x54, 0x57, 0x46, 0x6E, 0x75, 0x6B, 0x13, 0x5A, 0x26, 0x62, 0x95, 0xA7, 0xDB, 0xC0, 0x1F, 0x13, 
-0xA3, 0x82, 0xD9, 0xF1, 0xA8, 0xE7, 0x0A, 0xA3, 0xBA, 0x32, 0x72, 0xAB, 0x5B, 0x9B, 0x90, 0x2D, 
-0x25, 0xAA, 0x9A, 0xD9, 0x6A, 0x6B, 0x11, 0xFE, 0x02, 0xD9, 0xAB, 0x8C, 0x9E, 0x28, 0xA2, 0x8E, 
-0xF9, 0x45, 0x3B, 0x14, 0x6D, 0xE7, 0x94, 0x6F, 0xB4, 0x9B, 0x5A, 0x35, 0x04, 0x77, 0x6B, 0x37, 
-0x40, 0xB4, 0x0D, 0x9B, 0x21, 0x95, 0xA2, 0xC7, 0xAD, 0xC8, 0x6D, 0xB6, 0x42, 0xBB, 0xC8, 0x2D, 
-0x3B, 0xE0, 0xED, 0x98, 0x7D, 0xDC, 0x89, 0xE9, 0xFB, 0xD9, 0x76, 0x4C, 0x3B, 0x6E, 0x3F, 0x68, 
-0x70, 0x15, 0x6D, 0xF9, 0x39, 0xE4, 0xB3, 0xF1, 0xE4, 0x3A, 0x4E, 0x95, 0x23, 0x6E, 0x2F, 0x45, 
-0xEC, 0x7C, 0xE6, 0xFF, 0xCA, 0x8B, 0xE9, 0xE0, 0x76, 0x62, 0x6C, 0x0C, 0xB8, 0x81, 0xFB, 0xF6, 
-0x9E, 0xDA, 0xAB, 0x1A, 0x76, 0x87, 0x76, 0x7B, 0xDD, 0xA1, 0x7A, 0xEA, 0x8A, 0x87, 0x7E, 0xA7, 
-0x2B, 0xFA, 0xC9, 0x54, 0x46, 0xDE, 0x5A, 0xF0, 0xF0, 0x40, 0xF4, 0x66, 0x1E, 0xA5, 0x46, 0x0A, 
-0xB7, 0xB2, 0x66, 0x0B, 0x2A, 0xA5, 0x32, 0x76, 0x32, 0xB4, 0xAA, 0x80, 0xE5, 0xF5, 0x58, 0x11, 
-0x62, 0x6B, 0x19, 0x0A, 0xB7, 0x9D, 0x53, 0x25, 0x96, 0xAC, 0x30, 0x4D, 0x57, 0x6C, 0xB2, 0x34, 
-0x03, 0x5F, 0x6C, 0xC8, 0x92, 0x84, 0xA5, 0x87, 0x02, 0x36, 0x0F, 0xE7, 0x01, 0x9D, 0x6B, 0x99, 
-0x82, 0x14, 0x4D, 0x8C, 0x85, 0x87, 0x92, 0x23, 0xF8, 0x6A, 0xAC, 0xA0, 0x16, 0x0B, 0x3A, 0xA2, 
-0xBA, 0xCC, 0x47, 0x47, 0x23, 0x49, 0x95, 0x50, 0x38, 0x8A, 0xB6, 0xD3, 0x82, 0x44, 0x65, 0xCC, 
-0xD0, 0xE9, 0x57, 0x99, 0x00, 0x9B, 0x06, 0x7B, 0x2D, 0x8A, 0xA0, 0xF0, 0x64, 0x79, 0x3A, 0x16, 
-0x8C, 0x76, 0x8E, 0x2C, 0xAB, 0x08, 0x44, 0xAC, 0x64, 0x09, 0xBE, 0xDF, 0x14, 0xBA, 0xB4, 0xAC, 
-0xB8, 0xDB, 0x30, 0x56, 0xF4, 0x6D, 0x1E, 0xDB, 0x23, 0xCA, 0x5C, 0x35, 0xAD, 0x66, 0x79, 0x7F, 
-0xA4, 0x12, 0xD5, 0x2D, 0xED, 0x4F, 0x43, 0x71, 0x87, 0xF8, 0x54, 0xFB, 0xD3, 0x4C, 0x81, 0x05, 
-0x77, 0x7B, 0x99, 0x4A, 0xA9, 0x44, 0x4A, 0x9A, 0xAA, 0x80, 0xB6, 0x59, 0xA9, 0x76, 0x79, 0xA5, 
-0x6C, 0xC5, 0x06, 0x16, 0xDC, 0x76, 0x4E, 0x2D, 0xEB, 0xDE, 0xA8, 0xEC, 0x9E, 0xB0, 0x39, 0xBE, 
-0x55, 0x13, 0xB4, 0xCD, 0xAD, 0x25, 0xBB, 0x8A, 0x73, 0x1D, 0xC5, 0x3D, 0xE5, 0xAD, 0x74, 0x7B, 
-0x01, 0x6B, 0x55, 0xA2, 0x46, 0xC1, 0x58, 0xE9, 0xCD, 0xA3, 0xA9, 0xDF, 0x2E, 0x94, 0xB7, 0xCA, 
-0xA3, 0xEC, 0x6D, 0xC3, 0x62, 0x83, 0x17, 0xC9, 0xDB, 0xD6, 0x1F, 0x29, 0x79, 0x2B, 0x14, 0xFA, 
-0xED, 0x62, 0x79, 0x67, 0x79, 0x54, 0xF5, 0x6C, 0x55, 0x7E, 0x90, 0xBC, 0x75, 0x7B, 0x97, 0xF5, 
-0x93, 0x25, 0xE1, 0x23, 0xC0, 0xB9, 0xC0, 0x70, 0x07, 0xE5, 0xFD, 0x3E, 0xB9, 0x36, 0x18, 0x6B, 
-0xA5, 0x5D, 0x2E, 0x72, 0x33, 0xC6, 0x4C, 0x34, 0x1D, 0x46, 0xE9, 0xD0, 0x18, 0x6A, 0x3C, 0xD4, 
-0xFB, 0xC6, 0xD0, 0x66, 0x2B, 0xF2, 0x9F, 0xD5, 0xFF, 0x16, 0xBB, 0xE7, 0x5B, 0xE0, 0x84, 0xF1, 
-0xCF, 0x02, 0x4A, 0x00, 0x0D, 0xFF, 0xD8, 0x28, 0x31, 0x75, 0x16, 0x17, 0x4A, 0xE2, 0x6C, 0x52, 
-0xAC, 0xAD, 0xBE, 0x37, 0x25, 0x90, 0xA9, 0xFB, 0x02, 0xD2, 0xE2, 0x6A, 0x4D, 0x0E, 0x80, 0xF8, 
-0x55, 0xA5, 0xC6, 0x2D, 0xC1, 0x3D, 0xDC, 0xCB, 0x5C, 0x50, 0xB1, 0x22, 0x0B, 0x44, 0xD4, 0x92, 
-0x06, 0x58, 0x61, 0x8C, 0xB6, 0xDA, 0x28, 0xB7, 0xDA, 0x8E, 0x4F, 0x2B, 0x44, 0x29, 0xB2, 0x50, 
-0xD0, 0xB9, 0x8F, 0x27, 0x1A, 0xD0, 0xB8, 0xC5, 0xC3, 0x50, 0x23, 0x6D, 0x9B, 0x8F, 0x28, 0x2B, 
-0xE1, 0x63, 0x3A, 0xF2, 0x45, 0x17, 0x8D, 0x83, 0x30, 0xC8, 0x2C, 0x06, 0x98, 0x5B, 0xF1, 0x29, 
-0xEE, 0xCC, 0x03, 0x5C, 0x56, 0x1F, 0xFB, 0x1D, 0xF1, 0x6F, 0x51, 0x75, 0x7C, 0x24, 0x55, 0xFC, 
-0x5B, 0x50, 0xA1, 0x1C, 0xBA, 0x82, 0x77, 0x6B, 0xD7, 0x0D, 0x92, 0xE5, 0xDD, 0xFA, 0x51, 0xDE, 
-0x4D, 0x23, 0x12, 0x8F, 0x69, 0xA8, 0x96, 0xDB, 0x29, 0x54, 0x98, 0x38, 0xB2, 0xAF, 0x73, 0x2D, 
-0x24, 0xB3, 0xED, 0x01, 0x2A, 0x6F, 0xF8, 0xE6, 0x8A, 0xD8, 0xE5, 0x5B, 0xCC, 0x72, 0x5C, 0xB9, 
-0x55, 0x93, 0x1B, 0x61, 0x24, 0x67, 0x83, 0x15, 0xEC, 0x76, 0xE3, 0xD2, 0x9C, 0x55, 0x39, 0x7F, 
-0xE0, 0xAC, 0x4A, 0x25, 0xAD, 0x25, 0x57, 0x73, 0x30, 0xC1, 0x48, 0xDD, 0xD7, 0xA3, 0x43, 0x9A, 
-0x58, 0x39, 0x2F, 0x9D, 0x58, 0x89, 0x99, 0x7D, 0x22, 0x85, 0x37, 0xD4, 0x15, 0xAF, 0xB7, 0x94, 
-0x30, 0x9B, 0x76, 0x59, 0xA6, 0xB5, 0xF1, 0x74, 0x2A, 0xAA, 0xE2, 0x7F, 0x3D, 0xDA, 0xDB, 0x2B, 
-0xCA, 0x28, 0x30, 0x12, 0x05, 0xD6, 0x44, 0x3E, 0x33, 0x69, 0xC2, 0x24, 0x4B, 0x8A, 0xA6, 0xF9, 
-0x68, 0xFA, 0x5A, 0x42, 0xE2, 0x32, 0x7A, 0xD8, 0x59, 0x26, 0x95, 0x45, 0x07, 0xAD, 0x2E, 0xC7, 
-0x23, 0x11, 0x6A, 0xE9, 0x43, 0x85, 0xE7, 0x8C, 0xDF, 0x95, 0x9A, 0xDF, 0xBC, 0x87, 0xEF, 0x5C, 
-0x3E, 0x88, 0x5E, 0xCE, 0x6D, 0xB6, 0xD1, 0x24, 0xEA, 0x11, 0x10, 0x5D, 0x35, 0x3E, 0xF1, 0xB6, 
-0x88, 0x38, 0xCD, 0xA6, 0xAE, 0xF8, 0x8F, 0xA9, 0xB5, 0x87, 0x4B, 0x28, 0x6D, 0x31, 0x4D, 0x5E, 
-0x67, 0x0F, 0xFF, 0xAB, 0xB2, 0xFF, 0x55, 0xD9, 0x87, 0x48, 0xD1, 0x2A, 0xC2, 0x3D, 0x27, 0xAD, 
-0x0D, 0x92, 0x34, 0x99, 0xF2, 0xF5, 0xFE, 0xCC, 0x73, 0xE1, 0x16, 0x2E, 0x8A, 0x82, 0x6C, 0x15, 
-0xD2, 0x02, 0xE9, 0x65, 0x89, 0xDB, 0xC5, 0xC4, 0x41, 0xB3, 0x34, 0x75, 0xA7, 0x98, 0xDA, 0x5F, 
-0x90, 0xBA, 0x59, 0x4C, 0xEE, 0x95, 0x26, 0xF7, 0x17, 0x90, 0xF8, 0x58, 0x7E, 0xEC, 0xED, 0xB9, 
-0xA5, 0x47, 0x3E, 0xD7, 0x7A, 0xE4, 0x73, 0xB3, 0x47, 0xBE, 0xC9, 0xBD, 0x89, 0xE5, 0x3D, 0xB2, 
-0xD8, 0x15, 0x10, 0xC6, 0xB8, 0x7F, 0x0A, 0x77, 0xCB, 0x7A, 0xDD, 0xE6, 0x7A, 0xF6, 0x86, 0x34, 
-0xA6, 0xDD, 0xE5, 0x61, 0x5C, 0xC5, 0x2D, 0xB3, 0x09, 0xFC, 0x1F, 0x84, 0xC3, 0xAA, 0xCF, 0x4E, 
-0xCD, 0x4E, 0x3B, 0xA9, 0xFC, 0xE3, 0xF8, 0xE8, 0x10, 0xF7, 0x2F, 0xC0, 0xFD, 0x78, 0xF4, 0xC3, 
-0x99, 0xBB, 0xF2, 0x05, 0xEE, 0x8D, 0xA8, 0xCF, 0x29, 0xBE, 0xC0, 0xE5, 0x9D, 0xB6, 0x93, 0x52, 
-0xBF, 0x9D, 0x58, 0xE3, 0x94, 0x2C, 0x18, 0x72, 0x78, 0x15, 0xDB, 0x7B, 0xC9, 0xA7, 0x8D, 0x01, 
-0xFE, 0x92, 0x8A, 0xE7, 0xDE, 0x2D, 0x76, 0xF4, 0xC8, 0x66, 0xF9, 0xA7, 0xB8, 0x6D, 0xBA, 0xF4, 
-0x29, 0x3F, 0x9F, 0x11, 0x7F, 0x71, 0x6F, 0x81, 0x26, 0xAF, 0x09, 0xFB, 0xE6, 0x44, 0x4C, 0xC4, 
-0xA1, 0xC0, 0xD7, 0xB4, 0x51, 0xD6, 0x16, 0x26, 0x61, 0xB4, 0x28, 0x68, 0x99, 0x6F, 0x3B, 0x23, 
-0x32, 0xB7, 0xD3, 0xA6, 0x2F, 0x15, 0x24, 0x47, 0x48, 0xDD, 0xB2, 0xC1, 0xC6, 0x2F, 0x49, 0xDC, 
-0xE8, 0x5A, 0x12, 0x07, 0x25, 0x89, 0x9B, 0x96, 0xB4, 0x75, 0x7B, 0xDA, 0xFC, 0x86, 0x1D, 0x91, 
-0xAA, 0xC8, 0x1C, 0x8C, 0x10, 0x44, 0x3B, 0x4B, 0x34, 0xE6, 0x28, 0x2D, 0x08, 0x53, 0xFD, 0xEE, 
-0x76, 0xE3, 0xC6, 0xD4, 0xD1, 0x93, 0x92, 0xD5, 0x02, 0xC2, 0x6B, 0x34, 0x95, 0x4E, 0x5B, 0x27, 
-0x70, 0x22, 0x50, 0x8E, 0x51, 0xCD, 0xA6, 0xA1, 0x26, 0x8C, 0xDD, 0x49, 0x7C, 0x81, 0x52, 0x58, 
-0x1D, 0x44, 0xD3, 0xEB, 0x68, 0xB6, 0x6A, 0xF3, 0x16, 0x27, 0x7C, 0x9B, 0x37, 0xB4, 0x81, 0x89, 
-0xD8, 0xFC, 0x0D, 0x97, 0x53, 0x8D, 0x32, 0xA8, 0xC9, 0xA6, 0x33, 0x35, 0x5A, 0xEA, 0x54, 0x3B, 
-0x59, 0x9E, 0xDE, 0x76, 0x4D, 0xE5, 0xEB, 0x7B, 0x7A, 0xD3, 0x98, 0xDD, 0xC5, 0xFC, 0xCE, 0x78, 
-0xB9, 0x21, 0x37, 0x69, 0xF5, 0xD2, 0x52, 0xAC, 0xF2, 0xB5, 0x48, 0x09, 0x56, 0x8F, 0x97, 0x68, 
-0xC7, 0xBA, 0xB0, 0xA6, 0x66, 0xDD, 0xE2, 0x25, 0x71, 0x32, 0xC5, 0xE0, 0x70, 0xA2, 0xDF, 0xDD, 
-0x6E, 0x9C, 0x98, 0x12, 0xBC, 0x5A, 0xE8, 0xF7, 0x63, 0xA7, 0x32, 0x0C, 0xE7, 0x60, 0x2A, 0x40, 
-0x34, 0x95, 0x38, 0x6F, 0x37, 0x52, 0x34, 0x36, 0x59, 0x7E, 0x91, 0x35, 0x4C, 0x3F, 0x7B, 0x5F, 
-0x36, 0x56, 0xAF, 0x2E, 0xF9, 0x46, 0x3B, 0xCA, 0xBA, 0xE9, 0xDC, 0x31, 0x97, 0x0A, 0xDD, 0xD7, 
-0x58, 0x4E, 0xA7, 0xD2, 0x75, 0xCD, 0xDA, 0xBB, 0x46, 0x4B, 0xF8, 0x4A, 0xD1, 0xDD, 0xBE, 0x52, 
-0x94, 0xF3, 0x95, 0xF0, 0x2C, 0xF5, 0x3B, 0x26, 0x50, 0xA0, 0x3E, 0x56, 0x73, 0x56, 0x0F, 0xF0, 
-0xD7, 0xDA, 0xB9, 0x3F, 0xA5, 0x40, 0x95, 0x60, 0xEA, 0xEE, 0xEA, 0x43, 0x72, 0xF2, 0x9E, 0x28, 
-0x79, 0x23, 0x2B, 0x34, 0x00, 0x8C, 0x44, 0x83, 0xF5, 0x52, 0x68, 0xBD, 0x6D, 0x82, 0x83, 0x85, 
-0x60, 0x13, 0x87, 0x97, 0x01, 0xAC, 0x9E, 0x03, 0x4A, 0xF3, 0x89, 0x26, 0xCD, 0x89, 0x65, 0x73, 
-0xAC, 0xE9, 0x96, 0x95, 0x11, 0xE9, 0x15, 0x6A, 0x5F, 0x4E, 0x75, 0x36, 0x8F, 0x6D, 0xA5, 0x3A, 
-0x47, 0x5E, 0xB6, 0xCD, 0xD6, 0x56, 0xB7, 0x82, 0x3F, 0x56, 0x2F, 0xAF, 0x61, 0x19, 0xDF, 0x4A, 
-0xB8, 0x6C, 0x15, 0x89, 0x02, 0xC8, 0x6A, 0x99, 0x2A, 0xB6, 0x5C, 0x13, 0x68, 0xDB, 0x9A, 0xC0, 
-0x9E, 0x13, 0x2D, 0xE9, 0x8B, 0x35, 0x0B, 0x69, 0x81, 0xEC, 0x45, 0xBE, 0x58, 0x2E, 0x71, 0xB0, 
-0xD0, 0x15, 0xCB, 0x25, 0xF6, 0x17, 0x7B, 0x62, 0xD1, 0x7D, 0x3C, 0xB1, 0x32, 0x02, 0xEF, 0xF6, 
-0xC4, 0x4C, 0xE6, 0xDD, 0xE1, 0x90, 0xB9, 0xB7, 0x6C, 0x66, 0xB3, 0x5E, 0xFE, 0x97, 0x0D, 0x13, 
-0x37, 0x86, 0xF5, 0x8E, 0x86, 0x3F, 0x0C, 0x7B, 0x36, 0x0D, 0x73, 0x46, 0xA4, 0x50, 0xBB, 0x14, 
-0x43, 0x11, 0xD4, 0xFC, 0x80, 0xA6, 0xA3, 0x1B, 0x3E, 0xD5, 0x49, 0xBC, 0x5E, 0x6F, 0x37, 0xB8, 
-0x72, 0x18, 0x49, 0x9A, 0x7E, 0xCB, 0x96, 0xC6, 0x5A, 0xF3, 0xC5, 0xF6, 0x8A, 0x97, 0x26, 0xBE, 
-0x2B, 0x02, 0xD5, 0x03, 0x6D, 0xD7, 0x43, 0xC8, 0xBA, 0xFF, 0xC8, 0x8A, 0xD3, 0x2E, 0x2F, 0xFE, 
-0xA3, 0x55, 0xBE, 0x0F, 0x9B, 0x33, 0xC9, 0x3F, 0x8E, 0xED, 0xD3, 0xB9, 0x56, 0x51, 0x45, 0x4B, 
-0x4B, 0xA2, 0x3D, 0x2D, 0x80, 0x2B, 0xB2, 0xC2, 0xF2, 0xA9, 0x66, 0xEE, 0x16, 0x96, 0x65, 0x30, 
-0xB4, 0x58, 0x18, 0x3D, 0x2E, 0x2F, 0x2D, 0x7B, 0xFC, 0x78, 0xD6, 0xD5, 0x4E, 0x4E, 0x39, 0xB1, 
-0x8B, 0x19, 0xA5, 0x3D, 0x5D, 0x8E, 0x23, 0x45, 0xD2, 0x16, 0x50, 0x7E, 0x07, 0xDF, 0x2C, 0x85, 
-0x2F, 0x61, 0xE6, 0x9B, 0x9A, 0x99, 0x6F, 0xFE, 0xD7, 0xCC, 0x3F, 0xDC, 0xCC, 0x37, 0x97, 0x36, 
-0xF3, 0x03, 0x9B, 0x99, 0x0F, 0xC0, 0x49, 0x1D, 0x26, 0x37, 0xD3, 0x7B, 0xB9, 0xA9, 0x1D, 0x4D, 
-0x78, 0x9D, 0xFF, 0x61, 0x6E, 0x6A, 0xAD, 0x55, 0x5F, 0x2F, 0x5B, 0x0E, 0xBC, 0xB4, 0x9F, 0x6A, 
-0x32, 0xDB, 0x14, 0x84, 0xEE, 0xA7, 0xE6, 0xBC, 0x9D, 0x4E, 0xCE, 0x29, 0x0A, 0x24, 0x87, 0x2C, 
-0x50, 0xAC, 0xA6, 0xC5, 0x91, 0x2B, 0x01, 0x9B, 0x38, 0xBC, 0x0C, 0x60, 0xF7, 0x53, 0x49, 0xA0, 
-0x8F, 0xE6, 0xA9, 0x76, 0x16, 0xD5, 0x28, 0xE7, 0x2E, 0xE6, 0xAB, 0xDF, 0x36, 0xC1, 0x77, 0x5A, 
-0xA7, 0xB6, 0x8D, 0x5C, 0x05, 0x78, 0x34, 0x03, 0x5C, 0x24, 0xAB, 0x5C, 0x9C, 0x0F, 0xAB, 0x74, 
-0x19, 0xE9, 0x4B, 0xD8, 0xC6, 0x42, 0xF3, 0xFA, 0xAF, 0x6D, 0x7C, 0x98, 0x6D, 0xEC, 0x2C, 0x6B, 
-0x1B, 0xE9, 0x7D, 0xDD, 0x95, 0x98, 0x1F, 0x18, 0xAA, 0xF7, 0x75, 0xF8, 0xB2, 0x0E, 0xA5, 0x48, 
-0x8B, 0xED, 0x68, 0x7E, 0xA6, 0x38, 0xF9, 0xA7, 0xA2, 0x0F, 0x49, 0x83, 0x1C, 0xE3, 0x9A, 0x68, 
-0x6A, 0x79, 0xE2, 0xCD, 0x3B, 0x8C, 0x1B, 0x7B, 0x03, 0xDC, 0x94, 0x04, 0x9F, 0xB3, 0xC2, 0x59, 
-0x39, 0xE8, 0x5A, 0xD1, 0xE3, 0x33, 0x9E, 0x44, 0x7F, 0x4C, 0x2D, 0x39, 0x7B, 0x4D, 0x2D, 0x12, 
-0x30, 0x48, 0x7C, 0xAB, 0x6A, 0xAB, 0xE6, 0x51, 0x15, 0xEC, 0x76, 0xE3, 0xCA, 0x9C, 0xE1, 0xB8, 
-0x0E, 0xB7, 0x1C, 0x3C, 0x3E, 0x2E, 0x60, 0x6A, 0xA6, 0x83, 0xF7, 0x02, 0x09, 0x9B, 0x87, 0x71, 
-0x8D, 0x4F, 0x34, 0xF1, 0x29, 0x25, 0x96, 0x2A, 0x00, 0x9F, 0x59, 0x62, 0x51, 0xE8, 0x6D, 0x68, 
-0xB1, 0x04, 0x4B, 0x82, 0x0A, 0x92, 0x8B, 0xE9, 0xE9, 0xBB, 0x77, 0x79, 0x30, 0x41, 0xC5, 0x72, 
-0x2D, 0x74, 0x20, 0x73, 0x12, 0x2C, 0xC6, 0x6E, 0xC5, 0x23, 0xB9, 0x09, 0x18, 0xE3, 0xFB, 0x95, 
-0x1D, 0x4A, 0x82, 0x67, 0xA7, 0xF0, 0x0F, 0xBE, 0x2C, 0x48, 0xEC, 0x2F, 0xDD, 0xEB, 0x62, 0x35, 
-0x34, 0xAD, 0x14, 0x88, 0x8D, 0xE9, 0xB1, 0x58, 0x1A, 0xCC, 0xC5, 0x04, 0xD5, 0x3C, 0xBE, 0xAC, 
-0x8D, 0x0E, 0xCF, 0x11, 0x8B, 0x5E, 0x68, 0x83, 0x17, 0x2D, 0x79, 0x59, 0x48, 0x22, 0xB0, 0x6D, 
-0x19, 0x32, 0x25, 0xAA, 0x45, 0xB4, 0x76, 0x80, 0x4E, 0xFA, 0x94, 0xD3, 0x5A, 0x07, 0x63, 0xCE, 
-0x3F, 0x0F, 0xA7, 0x55, 0x6D, 0xBB, 0x5E, 0x46, 0x84, 0x11, 0x86, 0x30, 0xFB, 0xFF, 0x46, 0x8E, 
-0x4D, 0x29, 0x47, 0xB1, 0xAF, 0xFC, 0x9E, 0xA2, 0x5C, 0x8E, 0xD4, 0xFF, 0x61, 0xB2, 0x5C, 0xB2, 
-0x2D, 0x2E, 0xA9, 0xA8, 0xE5, 0x72, 0x7C, 0x5A, 0xF7, 0xF0, 0xB7, 0x94, 0x1E, 0x73, 0x55, 0xD4, 
-0xBF, 0x2B, 0x3F, 0xD1, 0x22, 0x1F, 0x22, 0x44, 0x9E, 0xF5, 0x91, 0x24, 0xD9, 0xAC, 0xE3, 0x5E, 
-0x0C, 0xB9, 0x1F, 0xA3, 0x84, 0x72, 0x5C, 0x31, 0x45, 0x9F, 0x07, 0x53, 0xEE, 0xFD, 0xA5, 0x4D, 
-0x72, 0x91, 0x28, 0x9F, 0x06, 0x1D, 0xFC, 0xFD, 0xF7, 0x4D, 0xA9, 0x14, 0xE6, 0x83, 0xDA, 0xE1, 
-0x63, 0x89, 0xF0, 0x69, 0xBD, 0x89, 0xBF, 0x25, 0x94, 0x0E, 0xF1, 0x77, 0x11, 0xA5, 0x2A, 0xC8, 
-0xA0, 0xCB, 0x7E, 0x60, 0xFF, 0xDA, 0x64, 0xF0, 0xF7, 0x90, 0xFE, 0xF5, 0x3E, 0x7D, 0x2B, 0xBE, 
-0x9E, 0x58, 0xC0, 0x1F, 0xBD, 0xB6, 0xAB, 0x4F, 0xFD, 0x9D, 0xC0, 0x0F, 0xEA, 0xAB, 0x4B, 0xC8, 
-0x47, 0x9B, 0x99, 0x6E, 0x29, 0x29, 0x14, 0xF6, 0x66, 0xD1, 0x46, 0x76, 0x8F, 0xA7, 0x40, 0x89, 
-0x89, 0xB4, 0x38, 0xDD, 0xA8, 0xDD, 0x16, 0xB3, 0xEA, 0x52, 0xCE, 0xF2, 0xF0, 0x0D, 0xF8, 0xD9, 
-0x55, 0x79, 0xC1, 0x35, 0x11, 0xF8, 0xA9, 0xA8, 0x32, 0x9E, 0x59, 0x01, 0xAF, 0x1C, 0x85, 0xAA, 
-0x74, 0x96, 0xC7, 0xD3, 0x70, 0xE6, 0x08, 0x37, 0x56, 0xC1, 0x2E, 0x50, 0x34, 0x03, 0x59, 0x46, 
-0xFE, 0xA2, 0x55, 0xCF, 0x16, 0x55, 0xE3, 0xEB, 0x84, 0x1F, 0xD0, 0xA8, 0xF4, 0xD7, 0x09, 0x76, 
-0x79, 0xD5, 0x33, 0x9E, 0x69, 0x42, 0x53, 0xF2, 0xBA, 0x4B, 0x54, 0x99, 0x6C, 0x14, 0x1E, 0x2E, 
-0xAA, 0x72, 0x29, 0x29, 0x89, 0x64, 0x78, 0x3C, 0x5E, 0x9C, 0xB7, 0x48, 0x2A, 0xE4, 0x36, 0xEA, 
-0xCC, 0x0C, 0x6C, 0x76, 0x40, 0xD7, 0x6D, 0xAF, 0x09, 0xBF, 0xAD, 0x7B, 0xE8, 0xB6, 0x94, 0xCF, 
-0x9C, 0xE2, 0xA6, 0xD5, 0x79, 0x98, 0xB5, 0x22, 0x11, 0x59, 0xA2, 0x4E, 0x46, 0x49, 0x33, 0xE3, 
-0x48, 0x37, 0xE3, 0x43, 0x2B, 0x4B, 0xD7, 0x2D, 0x47, 0xD6, 0x31, 0xF3, 0x74, 0x2C, 0xB8, 0x3B, 
-0xCB, 0x54, 0x4A, 0x25, 0xE2, 0x79, 0x78, 0x00, 0x87, 0x62, 0x55, 0x9A, 0xE5, 0x28, 0x14, 0x0D, 
-0x2A, 0x63, 0xC3, 0x44, 0x6B, 0xE7, 0xCF, 0xD2, 0x4D, 0x21, 0xC3, 0xEB, 0x69, 0x3C, 0xF9, 0x8B, 
-0x9B, 0x82, 0x4E, 0xD2, 0x02, 0x73, 0xA2, 0xE4, 0x60, 0x8A, 0x57, 0x89, 0x45, 0xF1, 0xB4, 0x53, 
-0x8E, 0xA7, 0x53, 0x26, 0xCA, 0x8E, 0x79, 0xBB, 0xA0, 0x2A, 0x2A, 0x91, 0x12, 0x4B, 0xC7, 0x34, 
-0x93, 0xAA, 0x2A, 0x0B, 0xEC, 0xAB, 0xA2, 0x41, 0xB3, 0xAF, 0x16, 0xDC, 0x76, 0xFE, 0xDC, 0xAB, 
-0x95, 0xE9, 0xFD, 0xDE, 0x5B, 0x73, 0xED, 0x83, 0x08, 0xFC, 0x2E, 0x61, 0x2B, 0x7C, 0x31, 0xCE, 
-0x4F, 0x3E, 0x3E, 0x75, 0xE2, 0x4A, 0x08, 0xC3, 0x69, 0x5A, 0xA7, 0x03, 0x83, 0xE6, 0x61, 0x72, 
-0xE1, 0xB8, 0x55, 0xDF, 0x5D, 0x4F, 0x7E, 0x79, 0xEE, 0x73, 0x6F, 0xD3, 0xEB, 0xC5, 0x2F, 0x82, 
-0x66, 0x73, 0x13, 0x3E, 0xBD, 0xF8, 0x36, 0x43, 0x31, 0xC6, 0x8E, 0x54, 0x06, 0x72, 0x28, 0x24, 
-0x13, 0x0F, 0x70, 0x8F, 0x34, 0x55, 0x50, 0x55, 0x47, 0x04, 0x9D, 0xE7, 0x9D, 0x70, 0xF1, 0xD8, 
-0xA2, 0x6B, 0xF6, 0x83, 0xBD, 0x65, 0xBB, 0xEC, 0x82, 0x0E, 0x30, 0x8A, 0x5F, 0xBC, 0xF0, 0x5B, 
-0x6B, 0x38, 0x6F, 0xF4, 0x0D, 0xAF, 0x3B, 0x74, 0xB9, 0x15, 0xC2, 0xFF, 0xB5, 0x98, 0xED, 0x80, 
-0x73, 0xFC, 0x12, 0xAF, 0xD7, 0x53, 0x9C, 0x28, 0x18, 0xF2, 0x58, 0x0C, 0xA3, 0x49, 0x92, 0xA4, 
-0xCE, 0x10, 0x5F, 0xFE, 0x6B, 0xF7, 0x67, 0x2E, 0xBB, 0x0A, 0x9D, 0x93, 0xD0, 0xB9, 0x09, 0x0F, 
-0x9C, 0xCB, 0xD0, 0x99, 0x69, 0x61, 0x4A, 0x67, 0xAE, 0x5B, 0x1D, 0xB2, 0xF3, 0xD0, 0x19, 0x68, 
-0xC0, 0x01, 0x00, 0xCF, 0x16, 0xAC, 0x2A, 0xA2, 0x3D, 0xE1, 0x3B, 0xD1, 0x3C, 0x72, 0x2E, 0x31, 
-0x9E, 0xE5, 0x75, 0x78, 0x62, 0x7F, 0x40, 0x41, 0x4C, 0x5D, 0x8C, 0x34, 0x3B, 0xC2, 0xE3, 0xAE, 
-0x4F, 0x61, 0xC0, 0x7E, 0xFA, 0xFC, 0x72, 0xE3, 0xB4, 0x52, 0x71, 0x47, 0xB8, 0x84, 0x05, 0xAB, 
-0x3F, 0x11, 0x91, 0x26, 0xC6, 0x53, 0xE7, 0xF4, 0xD9, 0xE5, 0xFA, 0xDC, 0xFD, 0xE5, 0x51, 0x6C, 
-0xDA, 0x63, 0x48, 0x7C, 0xFC, 0xFC, 0x7C, 0xE3, 0x18, 0x13, 0xC3, 0x3D, 0xE2, 0x4A, 0xD6, 0xD6, 
-0x3C, 0xD6, 0x87, 0x07, 0x7D, 0xC0, 0xD2, 0x87, 0x07, 0x3F, 0xC2, 0xE3, 0xF5, 0xCB, 0xF5, 0x46, 
-0xA5, 0xB1, 0xDE, 0x07, 0xA9, 0xBF, 0x63, 0xBB, 0xE1, 0x37, 0x76, 0x11, 0x6E, 0xF1, 0x82, 0xD7, 
-0xD6, 0x9C, 0xB7, 0x95, 0x70, 0x2F, 0x1C, 0x7D, 0xEE, 0x7F, 0x61, 0xBB, 0x70, 0xC5, 0x2E, 0xE0, 
-0x1F, 0x1D, 0x88, 0xBD, 0x63, 0x95, 0xF9, 0xCB, 0x5F, 0x1E, 0xBB, 0xAA, 0x0D, 0xA1, 0xFA, 0x9F, 
-0x7F, 0x7C, 0x09, 0xC7, 0x90, 0x7B, 0xC7, 0xCD, 0x00, 0x15, 0x1F, 0x41, 0xBB, 0x06, 0x28, 0x40, 
-0xD0, 0x85, 0x01, 0xAA, 0x13, 0x55, 0x6E, 0xCF, 0x51, 0x88, 0xA6, 0xCE, 0x5B, 0xF6, 0xD2, 0x44, 
-0x34, 0x75, 0x76, 0x0D, 0x50, 0x80, 0xA0, 0x0B, 0x03, 0x24, 0x10, 0xC9, 0x75, 0x39, 0xC9, 0x0B, 
-0x6F, 0xD3, 0x79, 0x62, 0x0B, 0x44, 0x6B, 0x3B, 0xD2, 0xA0, 0xBF, 0x11, 0xBD, 0xC0, 0x23, 0x18, 
-0x9C, 0x28, 0x9C, 0x03, 0x65, 0xC4, 0xD0, 0xB3, 0xD0, 0x7F, 0x06, 0x54, 0x47, 0x15, 0xDF, 0x65, 
-0x33, 0xD0, 0x9E, 0x31, 0xF0, 0x71, 0xFC, 0x1C, 0xB4, 0x07, 0xF8, 0x48, 0xF1, 0xC8, 0x07, 0xE1, 
-0x69, 0x08, 0xCC, 0x15, 0x11, 0x78, 0x23, 0x8A, 0xC0, 0x3B, 0x0C, 0x1B, 0xEB, 0xCE, 0xAC, 0x32, 
-0x75, 0xD9, 0xA0, 0x02, 0x56, 0x96, 0xEA, 0x36, 0x04, 0x49, 0xAA, 0x9B, 0x0A, 0x1E, 0xE0, 0xA3, 
-0xDD, 0x06, 0x5F, 0xA8, 0x34, 0x8E, 0x64, 0x4E, 0x48, 0xA6, 0x2F, 0x30, 0xAA, 0x2C, 0x47, 0x55, 
-0x8D, 0xF8, 0x59, 0x64, 0x3A, 0xB2, 0xAA, 0x89, 0xAC, 0xAA, 0x23, 0x73, 0xD9, 0xB4, 0x12, 0x3D, 
-0x9F, 0x67, 0xF9, 0x2B, 0xD1, 0x7D, 0xAA, 0xE2, 0x32, 0xCC, 0x35, 0xC3, 0xC3, 0xC6, 0x79, 0xF2, 
-0x70, 0xB0, 0x7E, 0x06, 0x52, 0x4E, 0x54, 0x8E, 0xF0, 0xD4, 0x84, 0x80, 0x28, 0xFA, 0x26, 0x04, 
-0x24, 0x31, 0x61, 0xB3, 0x4A, 0xE5, 0xF6, 0xD6, 0xC1, 0x26, 0x8A, 0xCD, 0x35, 0x61, 0x28, 0x1B, 
-0x76, 0x52, 0xBB, 0xBC, 0x9A, 0x2B, 0x9D, 0xBF, 0x46, 0x09, 0xB8, 0x6E, 0x2F, 0x07, 0xBE, 0x22, 
-0x30, 0xBB, 0xB9, 0x15, 0xE7, 0x52, 0xEC, 0x2E, 0x0E, 0xE4, 0xB2, 0xE1, 0x87, 0x61, 0x18, 0xA5, 
-0x67, 0x57, 0xB8, 0xDA, 0x6A, 0x56, 0x9B, 0xC4, 0xD3, 0xB3, 0xF9, 0xF9, 0xA6, 0x33, 0x57, 0x11, 
-0xB1, 0x63, 0x19, 0xF6, 0xBA, 0xC9, 0x02, 0x1E, 0xF7, 0x3A, 0xB1, 0x3C, 0xAC, 0xCB, 0x87, 0xB1, 
-0xE5, 0xA1, 0x2F, 0x1F, 0xA6, 0xA1, 0xEF, 0xF6, 0xEA, 0x96, 0x12, 0x81, 0xE3, 0xF8, 0x0C, 0xC6, 
-0x36, 0x3B, 0x50, 0x4D, 0x22, 0x77, 0x02, 0x97, 0x82, 0xF2, 0x29, 0x5C, 0xCE, 0xF9, 0xE5, 0x18, 
-0x2E, 0x53, 0xE6, 0xF3, 0x98, 0x10, 0x14, 0x7D, 0x3A, 0x1E, 0xEA, 0x6F, 0x75, 0x84, 0x02, 0x47, 
-0x9C, 0xFC, 0xDA, 0x2C, 0x97, 0x00, 0x0C, 0xA9, 0x2A, 0xE2, 0x36, 0x43, 0xF2, 0x32, 0x8D, 0xE3, 
-0xA9, 0x05, 0xCD, 0x44, 0xA1, 0xC9, 0x25, 0x01, 0x44, 0x13, 0x0B, 0xA2, 0xED, 0xC9, 0x55, 0x6C, 
-0xC1, 0x33, 0x55, 0x78, 0xCC, 0x14, 0x80, 0x66, 0x6A, 0x41, 0xB3, 0x35, 0xB9, 0x3C, 0x8F, 0x2C, 
-0x78, 0xC6, 0x0A, 0x4F, 0x2E, 0x09, 0x9E, 0x92, 0x41, 0x88, 0x7C, 0x0D, 0x4D, 0x16, 0x99, 0xBB, 
-0x88, 0x8A, 0xBF, 0x30, 0x58, 0xAD, 0x44, 0x95, 0x55, 0xB6, 0xB2, 0x5A, 0x99, 0xF0, 0xAF, 0x29, 
-0xFF, 0x1A, 0x57, 0x56, 0xDD, 0x55, 0x03, 0xCD, 0x02, 0x2C, 0x36, 0x24, 0x7A, 0x6E, 0x19, 0x3F, 
-0xDD, 0x92, 0xFB, 0x29, 0x64, 0x55, 0x6B, 0x03, 0x41, 0x41, 0x2A, 0x13, 0xF3, 0x76, 0x6A, 0xDC, 
-0xDE, 0xDE, 0x82, 0xB9, 0xD5, 0xB4, 0x59, 0x69, 0x32, 0xB4, 0x42, 0xAE, 0x47, 0x55, 0x9F, 0xEC, 
-0x01, 0x4E, 0xD6, 0x46, 0xCF, 0xC3, 0xC9, 0x46, 0x04, 0x06, 0x21, 0xFE, 0x1C, 0x7D, 0x09, 0x93, 
-0x75, 0xFC, 0xAA, 0xCE, 0x37, 0xB2, 0x7E, 0x92, 0x9F, 0x78, 0xA5, 0xF0, 0x61, 0xDB, 0xB0, 0x45, 
-0xD9, 0x36, 0x7B, 0x4D, 0xAD, 0xDF, 0x1A, 0x62, 0x5F, 0x14, 0xAC, 0x5F, 0x89, 0xE0, 0xE6, 0x49, 
-0xA1, 0x57, 0xBA, 0x66, 0xD7, 0x2E, 0x0A, 0x56, 0x74, 0x45, 0xD7, 0xBC, 0x2B, 0xA2, 0xFE, 0x09, 
-0x3A, 0x9C, 0xAB, 0xEA, 0xA9, 0xBB, 0x7E, 0xCC, 0x06, 0xF0, 0x6C, 0x00, 0xCF, 0x06, 0xF0, 0x0C, 
-0xBA, 0xD6, 0x7E, 0x38, 0xA8, 0x5E, 0x31, 0xE8, 0x37, 0x55, 0x44, 0xA4, 0xFE, 0x7A, 0xBF, 0x32, 
-0x72, 0xDD, 0xE7, 0xE1, 0xD5, 0xDA, 0xDA, 0xE5, 0x8B, 0x70, 0xCC, 0xED, 0xA7, 0xE8, 0x73, 0xA1, 
-0x9C, 0x69, 0x40, 0xE7, 0x35, 0x32, 0x4E, 0x34, 0xA7, 0xF9, 0xEC, 0x45, 0x88, 0xF4, 0xAE, 0xAD, 
-0x9D, 0x3D, 0x87, 0x6F, 0x30, 0x3C, 0xD0, 0xC0, 0x6E, 0xC2, 0x77, 0x4E, 0x0A, 0x40, 0x96, 0x12, 
-0x84, 0xF1, 0x07, 0x55, 0x4C, 0xC7, 0xCE, 0xF8, 0xD7, 0x13, 0xCF, 0x75, 0x37, 0xA0, 0x7B, 0xBE, 
-0xC6, 0xBA, 0x5D, 0x53, 0x57, 0x87, 0x81, 0xA5, 0xC8, 0x34, 0x9D, 0x7F, 0x09, 0x6F, 0x3E, 0x7B, 
-0x5F, 0xB2, 0x5B, 0xB4, 0x66, 0x37, 0x9F, 0x7D, 0x0D, 0x10, 0x20, 0x20, 0xD0, 0x00, 0xBC, 0x57, 
-0xB9, 0x05, 0x67, 0xE0, 0x80, 0x98, 0x51, 0xEC, 0xE3, 0x4D, 0xDB, 0x35, 0xE3, 0xE1, 0x5E, 0x12, 
-0x2D, 0x14, 0xCC, 0x09, 0x9B, 0x03, 0x3F, 0xA6, 0xD5, 0x2B, 0xA9, 0xD6, 0xF2, 0x74, 0x0F, 0x8B, 
-0xE0, 0xB0, 0x43, 0xE2, 0xC2, 0xB3, 0x08, 0x8E, 0x5D, 0x93, 0x9C, 0x4E, 0x43, 0x19, 0x49, 0x8A, 
-0x64, 0x38, 0xC6, 0x53, 0x2E, 0xA0, 0x93, 0x97, 0x2E, 0x8D, 0x10, 0xAC, 0x4B, 0x3B, 0x9C, 0x14, 
-0xE4, 0x0C, 0x3B, 0x31, 0xDD, 0x8D, 0x61, 0xC7, 0x16, 0x79, 0xD3, 0xCA, 0x62, 0x94, 0xF7, 0x25, 
-0x48, 0xE2, 0xF2, 0xF9, 0x70, 0xE3, 0x52, 0xC8, 0xFB, 0x26, 0xEC, 0x57, 0x2F, 0xD9, 0x08, 0xA0, 
-0xA3, 0xE7, 0xE3, 0x8D, 0x91, 0xEC, 0x02, 0x2F, 0x5F, 0xCC, 0x40, 0xA2, 0xCF, 0x87, 0x55, 0xF8, 
-0x1A, 0xBD, 0x38, 0x83, 0x7F, 0xCF, 0xC7, 0x55, 0xF8, 0x02, 0xFD, 0x80, 0x6F, 0x3C, 0x7B, 0x63, 
-0x54, 0x3D, 0x95, 0x07, 0xFB, 0x70, 0x41, 0xD3, 0xD9, 0x0F, 0xBA, 0xA0, 0x07, 0x52, 0xD0, 0x03, 
-0x25, 0xE8, 0xAB, 0x05, 0x82, 0x1E, 0x68, 0x82, 0x06, 0x1F, 0x6D, 0x58, 0xBD, 0x74, 0xD7, 0xC7, 
-0x24, 0xE8, 0x11, 0x3B, 0xE6, 0x72, 0x3B, 0xF9, 0x12, 0x5E, 0xA1, 0xA0, 0xE5, 0x2D, 0x0A, 0xDA, 
-0x04, 0x04, 0x79, 0x80, 0x14, 0xF4, 0x35, 0x08, 0x1A, 0xB9, 0x70, 0x97, 0xA0, 0x8F, 0x8B, 0x82, 
-0xBE, 0x06, 0x41, 0x9F, 0x82, 0xA0, 0xFB, 0xD0, 0xCC, 0x37, 0x32, 0xD7, 0x77, 0x8F, 0x7B, 0xCF, 
-0x28, 0xD3, 0x39, 0xB8, 0xE2, 0xF8, 0x8E, 0x1E, 0x5C, 0xF5, 0xF3, 0x28, 0xDD, 0x82, 0xF1, 0x96, 
-0xBB, 0x29, 0x7B, 0x18, 0x32, 0x10, 0xAC, 0xED, 0xF6, 0xC0, 0x28, 0xE8, 0x67, 0x39, 0xA8, 0xA7, 
-0x9E, 0xEC, 0x82, 0x22, 0xFB, 0xF3, 0x00, 0xC3, 0xFB, 0xE3, 0xF3, 0x89, 0xFD, 0x79, 0x83, 0xF1, 
-0x43, 0x1F, 0x36, 0x74, 0x77, 0x9B, 0x5E, 0xC6, 0x85, 0xD2, 0x94, 0xA6, 0x60, 0xFE, 0xB8, 0x2D, 
-0xE4, 0xA6, 0x70, 0xB5, 0x92, 0xA0, 0x25, 0xE4, 0xFD, 0x70, 0x46, 0xD1, 0x3B, 0xE5, 0x4D, 0x89, 
-0x35, 0xD2, 0x40, 0x11, 0xEF, 0xC7, 0x70, 0xE5, 0x2E, 0xBF, 0xA1, 0xCE, 0xC6, 0x71, 0x69, 0xED, 
-0xB4, 0xE8, 0x55, 0x1C, 0xF4, 0x2E, 0xE2, 0xAC, 0x73, 0xC0, 0x97, 0x65, 0xA1, 0x93, 0x64, 0x39, 
-0xAB, 0x13, 0xF7, 0xD9, 0x1C, 0x46, 0x37, 0x33, 0x01, 0x14, 0x18, 0xAA, 0x53, 0x0E, 0x1E, 0x08, 
-0x30, 0xC7, 0x84, 0x87, 0x69, 0x21, 0xF4, 0x54, 0x40, 0x05, 0xC6, 0x75, 0xC7, 0x7F, 0x86, 0xFD, 
-0x50, 0x75, 0x28, 0xAF, 0x28, 0x99, 0x20, 0x19, 0x8C, 0x6A, 0xF4, 0xEB, 0xD7, 0x13, 0xDF, 0xDD, 
-0xFC, 0xEC, 0x4C, 0x2A, 0x67, 0x2E, 0x98, 0xE6, 0xBD, 0xF1, 0x77, 0x28, 0xDB, 0xC3, 0x45, 0x5D, 
-0x95, 0x99, 0x09, 0x18, 0x57, 0x06, 0x06, 0x60, 0x58, 0x39, 0xFD, 0xD2, 0xE3, 0x47, 0xFB, 0x3C, 
-0x2C, 0xB7, 0xAB, 0x58, 0xF8, 0xCD, 0xE2, 0x90, 0x86, 0x49, 0x25, 0x05, 0x76, 0xCD, 0x2B, 0xD1, 
-0x46, 0xC9, 0xB8, 0x38, 0xA9, 0x4C, 0xD8, 0x1C, 0xEF, 0xC5, 0xEB, 0xE9, 0x69, 0x55, 0xDC, 0xFF, 
-0xEB, 0x2A, 0x1A, 0xE2, 0xA1, 0xB3, 0x03, 0x39, 0x92, 0x9C, 0x92, 0x41, 0x99, 0x57, 0x26, 0x7A, 
-0x6A, 0xB8, 0x8F, 0xAA, 0x93, 0x92, 0xF4, 0x63, 0x86, 0xD8, 0xC6, 0x5A, 0x7A, 0x2C, 0x6D, 0x6C, 
-0x4D, 0x9D, 0x40, 0x6A, 0xF8, 0x54, 0x75, 0xEC, 0x89, 0x2C, 0xCD, 0x92, 0x7A, 0xCE, 0xB2, 0x9A, 
-0x9B, 0x63, 0x54, 0xF9, 0x3E, 0x5D, 0x31, 0xE6, 0x40, 0x6F, 0x2D, 0xA5, 0x2B, 0xE9, 0x33, 0x15, 
-0xCE, 0x96, 0xCF, 0xCB, 0xB3, 0xD3, 0x70, 0xC1, 0xBC, 0xC2, 0xB6, 0x65, 0xEC, 0x37, 0xB9, 0x1B, 
-0x5F, 0x9A, 0xE1, 0x4B, 0x35, 0x7C, 0x4E, 0x5A, 0x1C, 0xD8, 0xB1, 0x54, 0x95, 0xB2, 0xA3, 0x8F, 
-0x8F, 0xB3, 0xE1, 0x6D, 0xB2, 0x99, 0xE8, 0x23, 0xE0, 0x97, 0x46, 0x22, 0xEB, 0x7E, 0x18, 0x1C, 
-0x97, 0xCE, 0x9F, 0x87, 0x89, 0x3B, 0x3F, 0x4F, 0x93, 0x9B, 0xD5, 0x77, 0xC9, 0x3C, 0x4A, 0x7F, 
-0xAC, 0x9C, 0x26, 0x57, 0xD3, 0xE1, 0x6C, 0x25, 0x4A, 0xE3, 0x95, 0x64, 0xB4, 0x32, 0x8D, 0xCF, 
-0x80, 0xB7, 0xD7, 0x70, 0x9D, 0xAE, 0xFC, 0x19, 0xA7, 0xC9, 0xCA, 0x6C, 0xFC, 0x67, 0xBC, 0x9A, 
-0xD5, 0x1F, 0x46, 0x2F, 0x09, 0x8B, 0xAB, 0xDA, 0x58, 0xD6, 0x89, 0xAB, 0x89, 0xFB, 0x2C, 0x75, 
-0xD7, 0xD3, 0x5B, 0x27, 0xA9, 0xC6, 0xAC, 0x8A, 0x5B, 0xE4, 0x71, 0x87, 0xFC, 0x2D, 0x25, 0x9A, 
-0x24, 0x67, 0xBE, 0x67, 0xF8, 0x60, 0x02, 0x95, 0x7C, 0x0A, 0xA0, 0x67, 0x74, 0x7D, 0x70, 0xE8, 
-0x7B, 0xFC, 0x35, 0xF4, 0x36, 0xFB, 0x93, 0x1D, 0xB2, 0x7D, 0xF6, 0x86, 0x7D, 0x65, 0xDF, 0xD9, 
-0x11, 0xFB, 0xC4, 0x5E, 0xB1, 0xF7, 0xEC, 0x23, 0x7B, 0xCD, 0x3E, 0xB0, 0x7F, 0x85, 0x37, 0x63, 
-0x18, 0x20, 0xDE, 0xD4, 0xD2, 0xF8, 0x5F, 0x57, 0xF1, 0x6C, 0xBE, 0x35, 0x1D, 0x5F, 0xD0, 0x49, 
-0x12, 0x7B, 0x29, 0x9D, 0x61, 0x23, 0x9E, 0xDE, 0xC4, 0xA7, 0xDF, 0xC6, 0xD0, 0xEC, 0x17, 0xA5, 
-0xB9, 0x48, 0xFE, 0x5C, 0x9C, 0x20, 0xB9, 0x23, 0xFF, 0xAC, 0xE4, 0xB9, 0x4E, 0xAD, 0x48, 0x0B, 
-0xDE, 0xE8, 0xC9, 0xF8, 0x22, 0x4E, 0xAE, 0xC0, 0xE5, 0x67, 0xAD, 0xA0, 0x06, 0x9E, 0xAC, 0xB2, 
-0xE0, 0xFF, 0x50, 0x6C, 0x71, 0x56, 0xB9, 0x31, 0x05, 0x2B, 0x8E, 0xF1, 0xD2, 0x40, 0x20, 0x80, 
-0x2F, 0x5E, 0x19, 0x4F, 0x31, 0x94, 0xC1, 0x00, 0xEF, 0xB9, 0xAF, 0xB7, 0x49, 0x8B, 0x0C, 0x84, 
-0x9E, 0x6D, 0xFF, 0xD8, 0x1F, 0x02, 0x8A, 0x5E, 0x5C, 0xEC, 0x53, 0x6E, 0xFF, 0xB4, 0x9E, 0x95, 
-0xE2, 0xFE, 0xE4, 0xAE, 0x67, 0x61, 0x8B, 0x0E, 0x6A, 0xBA, 0xFE, 0xC4, 0xDC, 0x93, 0x83, 0xCA, 
-0x6A, 0x7B, 0xCA, 0x37, 0xE1, 0x84, 0x73, 0xFB, 0x53, 0xBE, 0xED, 0x26, 0x4C, 0x59, 0xAE, 0x4C, 
-0xB1, 0xD3, 0x26, 0x8C, 0xF8, 0x03, 0xAC, 0x34, 0x07, 0xC0, 0x90, 0xE2, 0x70, 0x51, 0xB5, 0xAF, 
-0xE3, 0xF4, 0xC7, 0x4E, 0x94, 0x7E, 0x93, 0x95, 0x1D, 0xE2, 0xB5, 0xA8, 0xDA, 0x45, 0x3C, 0x1C, 
-0x5F, 0x5D, 0xC8, 0xAA, 0x4C, 0xA8, 0x89, 0xA5, 0xDA, 0x4D, 0x9C, 0x95, 0x87, 0x58, 0x0E, 0xE8, 
-0x39, 0x94, 0xB7, 0x5F, 0x72, 0xA4, 0x8C, 0x28, 0xD1, 0x5C, 0xA3, 0x26, 0xCB, 0x35, 0x57, 0xA5, 
-0xC9, 0x1A, 0x18, 0x0B, 0xD1, 0x64, 0x45, 0xB4, 0x25, 0x2A, 0xB2, 0x3A, 0xB9, 0x0D, 0xD8, 0xB2, 
-0x5A, 0xB9, 0x2D, 0xD7, 0x30, 0xD2, 0x2D, 0x60, 0x05, 0x28, 0x8C, 0x96, 0xDE, 0x18, 0xAD, 0x8A, 
-0xB3, 0x10, 0x54, 0x26, 0x8C, 0x6F, 0xD9, 0xD7, 0xF2, 0x47, 0xDF, 0xCB, 0x1F, 0x1D, 0x15, 0x1F, 
-0x51, 0x64, 0x08, 0x7C, 0xF6, 0xA9, 0xF8, 0x6C, 0x18, 0xCF, 0xC6, 0x67, 0x53, 0x7C, 0xF8, 0xAA, 
-0x1C, 0xE7, 0xFB, 0xF2, 0x47, 0x1F, 0x8B, 0x8F, 0xC0, 0xE3, 0x83, 0x86, 0x84, 0x0F, 0x5F, 0x97, 
-0xE7, 0xFB, 0x60, 0xAB, 0x26, 0x18, 0x5D, 0x78, 0x46, 0xD6, 0xE3, 0xB7, 0xF0, 0xE7, 0xCE, 0xD6, 
-0xBB, 0xD7, 0x5F, 0x5F, 0xBE, 0xDB, 0xFA, 0x84, 0xDD, 0xA9, 0xB3, 0xBD, 0x74, 0x13, 0x28, 0xD3, 
-0xFE, 0xBC, 0xDE, 0xA3, 0xEE, 0x66, 0x2A, 0x16, 0x9D, 0xC6, 0x13, 0x43, 0xB0, 0xB3, 0x1F, 0x17, 
-0xA7, 0xC9, 0xC4, 0xD0, 0x6D, 0x3C, 0x42, 0x0B, 0xD4, 0xCC, 0x75, 0x78, 0xF7, 0xCE, 0xF7, 0xC9, 
-0xF8, 0xF2, 0x20, 0xBF, 0xA6, 0xCF, 0xF8, 0x5F, 0x06, 0xF1, 0x9B, 0x75, 0x96, 0x7D, 0x24, 0x10, 
-0xDD, 0x66, 0xF9, 0x51, 0x29, 0xB9, 0xB5, 0xE5, 0x1F, 0x97, 0xAD, 0x66, 0xA4, 0xE3, 0x91, 0x59, 
-0x5B, 0x27, 0xFB, 0x87, 0x19, 0x1F, 0x56, 0xB6, 0x45, 0xE9, 0x8D, 0x26, 0x6B, 0xB6, 0xF1, 0x2F, 
-0x43, 0xB2, 0x0C, 0xC4, 0x6F, 0xC1, 0x4D, 0xA7, 0x21, 0x0B, 0x12, 0xC0, 0x3A, 0x00, 0x9B, 0x00, 
-0x6C, 0xF2, 0xD2, 0x55, 0x89, 0x50, 0xFC, 0xC1, 0xFE, 0xCB, 0x57, 0x27, 0xC5, 0xE2, 0xFD, 0x3A, 
-0xA4, 0x95, 0x1F, 0x45, 0x06, 0x50, 0x2F, 0x3F, 0x8A, 0xE0, 0x3A, 0x93, 0x9F, 0x0C, 0x98, 0xE3, 
-0x1D, 0xD4, 0x86, 0xFF, 0x61, 0xF1, 0xAA, 0x44, 0x28, 0xFE, 0xE3, 0xAB, 0xFD, 0x93, 0x5D, 0xA3, 
-0x64, 0x2B, 0x03, 0x97, 0x07, 0x2E, 0x2A, 0x99, 0x0A, 0x83, 0x42, 0xB7, 0x0F, 0xB6, 0xFA, 0xAF, 
-0x8D, 0x42, 0x73, 0xB9, 0x16, 0xDF, 0xDA, 0x45, 0x8C, 0xCC, 0x95, 0x1F, 0x3C, 0xDD, 0x0D, 0xCB, 
-0xC0, 0xB2, 0x76, 0xF7, 0x5F, 0x9A, 0x04, 0xFA, 0xED, 0x0E, 0xF3, 0xDB, 0x81, 0x4C, 0x29, 0x70, 
-0x7A, 0x0D, 0x16, 0x78, 0x4D, 0x2E, 0xBC, 0x0C, 0x58, 0xF7, 0x19, 0x7D, 0xFC, 0xC6, 0x72, 0x04, 
-0x52, 0x61, 0x58, 0xE8, 0xBB, 0xA3, 0x8F, 0x87, 0x26, 0x57, 0x41, 0x57, 0x82, 0x00, 0xF0, 0x77, 
-0x75, 0x5D, 0xB5, 0x02, 0x89, 0x32, 0x18, 0x66, 0x34, 0x74, 0xC9, 0x7B, 0x5D, 0xD6, 0xAE, 0xB3, 
-0x86, 0xA6, 0x6A, 0x9D, 0x2E, 0x43, 0xA9, 0xB7, 0x79, 0xC1, 0x58, 0x20, 0x14, 0xFC, 0x6E, 0x77, 
-0xC7, 0xA4, 0xB5, 0xDB, 0x61, 0x80, 0xBC, 0xAB, 0x4B, 0x0D, 0xD7, 0xAE, 0xD5, 0xF1, 0xA3, 0x53, 
-0xDA, 0x08, 0x80, 0xCA, 0x0E, 0x7D, 0xCA, 0x28, 0xED, 0x66, 0xF7, 0xAB, 0x50, 0x0C, 0x14, 0xF6, 
-0xF2, 0xDD, 0xEE, 0xAE, 0x49, 0x65, 0x0B, 0xCA, 0x09, 0x3C, 0x66, 0xD4, 0x3C, 0xE8, 0x02, 0xB7, 
-0xFD, 0x5C, 0x15, 0xA0, 0x24, 0x68, 0x14, 0x81, 0x17, 0x2C, 0x90, 0x79, 0x57, 0x96, 0x46, 0xE5, 
-0x90, 0xDA, 0xBC, 0xDF, 0xCD, 0xB7, 0xD1, 0x0E, 0x70, 0x2E, 0xD0, 0xB0, 0xF8, 0xB8, 0x72, 0xA0, 
-0x01, 0x94, 0xB5, 0x75, 0xE1, 0x02, 0x97, 0x02, 0x20, 0x37, 0xA8, 0x97, 0x53, 0x87, 0x37, 0x5D, 
-0xA9, 0x3A, 0xEF, 0x51, 0x88, 0x5B, 0x87, 0x27, 0xAF, 0xDE, 0x6D, 0xF5, 0xF3, 0xED, 0x03, 0x44, 
-0x83, 0x7F, 0x1A, 0xF3, 0x40, 0x2A, 0xF0, 0xA7, 0x5B, 0xA6, 0x56, 0x97, 0xC1, 0x5F, 0x5B, 0x67, 
-0x30, 0x4A, 0x54, 0x7C, 0x4A, 0xCD, 0x92, 0x2A, 0x11, 0x8A, 0x7F, 0xF3, 0xDE, 0x14, 0x25, 0x6A, 
-0x59, 0x8B, 0x75, 0x34, 0x5A, 0x81, 0xC4, 0x76, 0x8B, 0xB5, 0x35, 0x08, 0x98, 0xA2, 0x56, 0xC0, 
-0x9A, 0x9D, 0xBC, 0x36, 0x35, 0x4D, 0x6D, 0x42, 0x9D, 0xA3, 0x8F, 0xCF, 0xCB, 0x85, 0xA2, 0xA0, 
-0x40, 0xE3, 0x48, 0xDB, 0x47, 0x21, 0x79, 0x09, 0x4B, 0x6C, 0x9E, 0xA3, 0xEB, 0x32, 0x7E, 0x3A, 
-0xEF, 0x5F, 0x55, 0xBA, 0x38, 0x0B, 0x18, 0x3A, 0x01, 0x79, 0xD2, 0xE3, 0x5F, 0x65, 0x84, 0xD5, 
-0xD1, 0x92, 0x68, 0x2D, 0xB4, 0xD3, 0x24, 0x1F, 0x81, 0xF4, 0x85, 0x16, 0xCA, 0x38, 0xB9, 0x52, 
-0x95, 0x6D, 0x67, 0xC0, 0x32, 0xE5, 0x63, 0xB8, 0x53, 0xFE, 0x29, 0x6F, 0xCC, 0xD6, 0x2A, 0xE8, 
-0x2C, 0xE0, 0x67, 0xCD, 0xFE, 0x55, 0xCC, 0x17, 0x27, 0xDB, 0xBA, 0xB7, 0xEC, 0xF7, 0xF0, 0xA7, 
-0xEA, 0x20, 0xFE, 0x74, 0x56, 0x9F, 0x0E, 0x3A, 0x83, 0xCE, 0xA9, 0xBF, 0x2A, 0x56, 0x4A, 0x62, 
-0x18, 0x35, 0x34, 0x54, 0x2B, 0x41, 0x76, 0x68, 0xA4, 0x83, 0x86, 0x04, 0x80, 0x18, 0x0C, 0xAB, 
-0xDB, 0xC8, 0x80, 0x18, 0xA7, 0x2B, 0x08, 0x28, 0xEC, 0x59, 0x5D, 0xA5, 0xC4, 0x9C, 0x60, 0x6A, 
-0x79, 0x20, 0x30, 0xFD, 0x75, 0x7D, 0x66, 0xCA, 0xB0, 0xCC, 0x11, 0xFD, 0x64, 0x99, 0xB0, 0x4C, 
-0x8C, 0x4E, 0x8C, 0xF3, 0x26, 0x02, 0x88, 0xD6, 0x0C, 0xD0, 0x37, 0x4C, 0x60, 0x1D, 0x13, 0xF9, 
-0x81, 0x09, 0xEC, 0x06, 0xA2, 0x4C, 0x01, 0x7C, 0xEA, 0x43, 0x2F, 0xD3, 0xC2, 0x65, 0x00, 0x47, 
-0xEF, 0xB6, 0x0E, 0x5F, 0x96, 0x95, 0x4A, 0x6B, 0xFD, 0x1B, 0x44, 0x44, 0x86, 0x8B, 0x03, 0x7D, 
-0x8C, 0xFD, 0xD5, 0x68, 0x9B, 0x40, 0x0F, 0xA3, 0x9B, 0x79, 0x0D, 0x13, 0x88, 0xF1, 0x72, 0xFD, 
-0x36, 0x91, 0xFF, 0xB4, 0xE9, 0xD5, 0xDB, 0x44, 0xA9, 0xEC, 0x91, 0x4A, 0x8A, 0x0C, 0xF2, 0x45, 
-0xD6, 0x31, 0xC8, 0x58, 0x40, 0xFF, 0x14, 0x10, 0xEF, 0xA1, 0x0F, 0x86, 0x7F, 0x5A, 0x4A, 0xBC, 
-0x6F, 0x53, 0x80, 0xB3, 0x0E, 0x15, 0xD9, 0x18, 0x79, 0x03, 0x2F, 0x86, 0x22, 0x3F, 0xED, 0x1E, 
-0x1C, 0x1C, 0x7D, 0x2C, 0x29, 0xB5, 0x21, 0x37, 0x35, 0xF8, 0x9D, 0x56, 0x86, 0xCB, 0xCF, 0x8E, 
-0x02, 0xCE, 0xF8, 0x08, 0x46, 0x74, 0x05, 0x1D, 0x02, 0x05, 0xCA, 0xA5, 0x7A, 0xDA, 0xF0, 0x9A, 
-0x75, 0x22, 0x51, 0xF9, 0x50, 0x46, 0x71, 0xF9, 0x82, 0x33, 0xB9, 0x36, 0x14, 0x65, 0xD0, 0x39, 
-0x82, 0xB4, 0xF0, 0x5F, 0x83, 0x98, 0xA9, 0xE5, 0xCE, 0x74, 0x25, 0xF3, 0x0D, 0x11, 0x7B, 0xC3, 
-0xC7, 0x5F, 0x59, 0x49, 0x92, 0x8D, 0xF8, 0x27, 0x71, 0x62, 0xD8, 0x5F, 0xFE, 0xE1, 0xB5, 0xD4, 
-0x33, 0x40, 0xAB, 0x59, 0xE1, 0x1F, 0xBD, 0x30, 0xDD, 0x21, 0x33, 0xCA, 0x90, 0xF1, 0x31, 0x70, 
-0x79, 0x1F, 0xFD, 0x68, 0xF5, 0x32, 0x60, 0x03, 0xFA, 0x31, 0x5C, 0x02, 0x40, 0x44, 0x8B, 0x6F, 
-0x31, 0xC4, 0x5F, 0x1B, 0x3F, 0xB2, 0x7E, 0x45, 0x08, 0x32, 0x01, 0xD9, 0xDD, 0xEC, 0x64, 0x10, 
-0xBC, 0x6B, 0xE3, 0x47, 0xB5, 0x25, 0xB6, 0x42, 0x21, 0xBB, 0xA5, 0xD0, 0x68, 0xD7, 0x8D, 0xDF, 
-0x41, 0x41, 0xB6, 0x9A, 0x42, 0xDB, 0x79, 0xBB, 0x0A, 0xF4, 0xF2, 0x21, 0x51, 0x0B, 0x75, 0x24, 
-0x3B, 0xDE, 0xD5, 0xA1, 0xBB, 0x2E, 0x65, 0x93, 0x20, 0x48, 0xD4, 0x0E, 0x0C, 0x26, 0x5A, 0x21, 
-0x39, 0x44, 0xBE, 0x8F, 0x8D, 0xA0, 0x83, 0x4D, 0x8D, 0x62, 0xF3, 0x51, 0xE1, 0x5F, 0x0D, 0x56, 
-0xCA, 0x20, 0xE2, 0x14, 0xC6, 0x0F, 0x9A, 0x6A, 0xC6, 0x03, 0x2C, 0x9E, 0xDA, 0x68, 0xE3, 0x7E, 
-0x20, 0x2A, 0x12, 0x6B, 0x26, 0xF5, 0xC5, 0xB0, 0x28, 0x5F, 0x71, 0x5C, 0xA3, 0x9B, 0x16, 0x1E, 
-0x91, 0x91, 0xAD, 0x20, 0xCF, 0x3B, 0x19, 0x77, 0x2D, 0x90, 0x2E, 0x5F, 0x22, 0xDD, 0x55, 0xFA, 
-0x8F, 0xB1, 0xAF, 0xA1, 0x30, 0xCD, 0xC4, 0xA1, 0xFE, 0x36, 0xF5, 0x34, 0x14, 0x3A, 0x10, 0x75, 
-0x37, 0xF0, 0x33, 0xF2, 0x75, 0x65, 0xE5, 0x46, 0xAA, 0x49, 0x21, 0x08, 0x4D, 0x23, 0x45, 0xE6, 
-0xA3, 0xD9, 0x35, 0x80, 0x18, 0x0A, 0xB1, 0x5B, 0x37, 0x40, 0x68, 0x50, 0xB8, 0x70, 0x15, 0x03, 
-0x80, 0xF6, 0xA6, 0xA7, 0xAC, 0xDB, 0x69, 0x70, 0xDA, 0x88, 0x87, 0xBC, 0x07, 0x3F, 0x04, 0xF2, 
-0x77, 0xCC, 0xC2, 0xB1, 0x1C, 0x24, 0xD5, 0xC7, 0xD0, 0xB8, 0x92, 0xB2, 0x16, 0x59, 0x69, 0x64, 
-0x6E, 0x26, 0x5D, 0xD2, 0x21, 0xAA, 0xA6, 0xDF, 0x54, 0x02, 0x6E, 0x61, 0xCA, 0x36, 0x3E, 0x69, 
-0xB6, 0x54, 0x76, 0xB2, 0x1D, 0x0D, 0x43, 0x81, 0x90, 0x48, 0x0C, 0xBB, 0xD9, 0xA4, 0xB0, 0x7B, 
-0xB2, 0x2A, 0x5F, 0x8D, 0xD6, 0x90, 0x33, 0x07, 0x7E, 0x57, 0xF4, 0x22, 0xD0, 0x6B, 0x28, 0xDC, 
-0x5D, 0xEA, 0x55, 0x32, 0x9B, 0xC6, 0x2D, 0x11, 0x56, 0x95, 0x2A, 0xDD, 0xF4, 0x95, 0x1E, 0x60, 
-0xA2, 0x3A, 0xD7, 0x65, 0xAE, 0x08, 0x1D, 0xAF, 0xEF, 0xB5, 0x94, 0x16, 0xE6, 0x94, 0xC0, 0xC3, 
-0xD6, 0x82, 0x0A, 0x1C, 0x68, 0xF4, 0xD9, 0x80, 0x14, 0x3A, 0xBF, 0x45, 0x1C, 0xCE, 0xEA, 0x45, 
-0xE1, 0x3C, 0x1B, 0x24, 0xC3, 0x4C, 0x85, 0x89, 0x57, 0x75, 0x25, 0x57, 0xD0, 0xC4, 0x60, 0x70, 
-0x7A, 0xCA, 0x2D, 0x3E, 0x29, 0xA2, 0x66, 0xF9, 0x29, 0x03, 0xF0, 0x07, 0x7B, 0x2C, 0x85, 0x96, 
-0xB7, 0x5E, 0x52, 0x69, 0x5F, 0x01, 0x1B, 0x50, 0x1F, 0x64, 0x7C, 0x3B, 0x2B, 0x8A, 0x64, 0x85, 
-0xEC, 0xCA, 0x12, 0xA1, 0x5E, 0x60, 0x95, 0xA8, 0xE0, 0xBD, 0xDD, 0xCE, 0x76, 0x17, 0x77, 0x22, 
-0x5A, 0xB5, 0x1F, 0x6B, 0xD8, 0x40, 0x5D, 0xCE, 0xF4, 0x0C, 0x73, 0xA2, 0x61, 0xF7, 0x1B, 0x0D, 
-0x5D, 0xFF, 0x5B, 0xA8, 0x7F, 0x99, 0x98, 0xD1, 0x4E, 0x23, 0x13, 0x32, 0xB5, 0xE9, 0xF0, 0xB0, 
-0xAB, 0xDC, 0xF4, 0xD7, 0x77, 0xB6, 0xEB, 0x7B, 0x7B, 0x34, 0x7A, 0x3F, 0xD8, 0x32, 0x8A, 0x23, 
-0xED, 0x68, 0xE5, 0xD4, 0xBD, 0xD3, 0xB1, 0x30, 0x9F, 0x4B, 0xD4, 0x6C, 0x03, 0x5C, 0x03, 0x1B, 
-0x6D, 0x83, 0xD3, 0x94, 0x93, 0x77, 0xF6, 0x75, 0xDE, 0xB9, 0x7A, 0xED, 0x16, 0xB0, 0x49, 0xDA, 
-0xED, 0x1C, 0x9F, 0x31, 0x31, 0x99, 0x2E, 0x25, 0x66, 0xBC, 0x43, 0x14, 0x86, 0x15, 0xA1, 0x68, 
-0x9E, 0x1A, 0x43, 0x7D, 0x6C, 0xCD, 0x99, 0x16, 0xF0, 0x7B, 0xC1, 0xE1, 0xED, 0x26, 0x08, 0xB7, 
-0x25, 0x38, 0x5C, 0x30, 0xF1, 0x68, 0x14, 0x3A, 0x7A, 0x47, 0x89, 0xF5, 0xC7, 0xF9, 0x0E, 0x05, 
-0x21, 0x6F, 0x09, 0x1B, 0xFD, 0x02, 0x88, 0x81, 0xE6, 0x29, 0x90, 0x8A, 0xAB, 0xAD, 0x61, 0x14, 
-0xF6, 0x66, 0x7B, 0xF7, 0x9D, 0x69, 0xCF, 0x80, 0xBA, 0xB6, 0x91, 0xB3, 0x4E, 0xAC, 0x24, 0x43, 
-0xA1, 0xAC, 0x55, 0xC0, 0xCD, 0xC9, 0x02, 0x88, 0x89, 0xE9, 0x69, 0xB3, 0x5B, 0xDF, 0xF2, 0xB6, 
-0xE4, 0x94, 0x4C, 0x41, 0x91, 0x28, 0x12, 0x2B, 0x29, 0x4F, 0x47, 0xD3, 0x9B, 0x36, 0x13, 0x2E, 
-0x98, 0x52, 0x30, 0xDE, 0x2C, 0xC9, 0xC5, 0x50, 0xD6, 0xD3, 0x0E, 0xCC, 0xE3, 0x7C, 0xEA, 0x75, 
-0x3D, 0xAF, 0xE9, 0xA3, 0x0D, 0xD9, 0xED, 0x9F, 0xEC, 0x1F, 0x1D, 0x1E, 0x67, 0xD6, 0x03, 0x0C, 
-0x1D, 0xFC, 0x9A, 0x2E, 0x02, 0x45, 0xBE, 0x6A, 0x98, 0x57, 0x2A, 0x9D, 0xEC, 0x1A, 0x6E, 0xD9, 
-0x1F, 0xE1, 0x4F, 0xA9, 0x24, 0x87, 0x72, 0x34, 0x19, 0x98, 0xFE, 0x31, 0xFA, 0x3B, 0x70, 0xDB, 
-0xD5, 0x07, 0xE9, 0x75, 0x86, 0xE3, 0x55, 0x7D, 0x92, 0xC0, 0xC3, 0xF1, 0x67, 0x27, 0x37, 0xBC, 
-0xC4, 0xD1, 0x3D, 0xB8, 0x7D, 0xB9, 0xA1, 0x17, 0x74, 0x20, 0x7C, 0x32, 0x41, 0x77, 0x0A, 0xB2, 
-0xD2, 0x71, 0x4C, 0x61, 0x8C, 0x58, 0x7C, 0xAF, 0xCD, 0xF4, 0x59, 0x16, 0x1A, 0xC6, 0x77, 0x8C, 
-0x1A, 0x06, 0xE8, 0xF6, 0xB7, 0x58, 0x5D, 0x9F, 0x6E, 0x83, 0x11, 0x3B, 0x3A, 0xCC, 0xE0, 0xAE, 
-0xE8, 0xB3, 0x36, 0x30, 0xD2, 0x6F, 0xA8, 0xE2, 0x33, 0x49, 0x1E, 0x66, 0x93, 0x4D, 0xD0, 0x00, 
-0x5A, 0xC6, 0x54, 0x00, 0x56, 0xBF, 0xDE, 0x34, 0x2B, 0xD4, 0x61, 0xE8, 0xE6, 0xEA, 0x20, 0x28, 
-0x05, 0x27, 0x4A, 0xB4, 0x2A, 0x05, 0x90, 0xC6, 0xCB, 0xCD, 0x8A, 0xE1, 0x4C, 0x12, 0x68, 0x24, 
-0x07, 0x1A, 0x6E, 0xB7, 0xAC, 0x80, 0x0F, 0x35, 0x03, 0xA3, 0xA6, 0x0F, 0x6C, 0x30, 0x98, 0x2D, 
-0x78, 0x45, 0x9E, 0xC9, 0x6D, 0xF4, 0xED, 0x72, 0x13, 0x5F, 0xD8, 0x29, 0x59, 0xE6, 0xC2, 0xFC, 
-0x20, 0x3F, 0xE8, 0xC7, 0xB9, 0xA2, 0x6E, 0x83, 0xAA, 0xA0, 0x39, 0xC4, 0xB2, 0x0A, 0x40, 0x4A, 
-0xC3, 0x37, 0xD8, 0x8B, 0x73, 0x31, 0x5E, 0x60, 0x80, 0xDA, 0x80, 0x02, 0x3A, 0xC6, 0x7C, 0x71, 
-0x8D, 0xA0, 0x58, 0x03, 0xCF, 0x36, 0x0B, 0x8B, 0xDC, 0xE1, 0x35, 0xE8, 0x7F, 0xDA, 0x32, 0x35, 
-0x00, 0xE5, 0x0B, 0x5E, 0x18, 0x7D, 0x74, 0xA6, 0x77, 0xF9, 0xEC, 0x8D, 0xCE, 0x74, 0xB8, 0xED, 
-0x9A, 0x72, 0x68, 0x23, 0x87, 0xBB, 0xBA, 0xB2, 0xC0, 0xE0, 0x0F, 0xBC, 0x91, 0xA0, 0xD1, 0xCD, 
-0xCB, 0xA1, 0x4B, 0xD5, 0xC0, 0x2A, 0xBC, 0xD9, 0x7A, 0xB9, 0x7B, 0x78, 0xB2, 0x65, 0xD4, 0xA2, 
-0x4B, 0x1A, 0x66, 0xE8, 0x1D, 0xF0, 0x11, 0xFA, 0x0B, 0x7D, 0x52, 0x05, 0x4B, 0x07, 0x79, 0x92, 
-0x86, 0xEA, 0xF4, 0x81, 0x7A, 0xFA, 0x8D, 0x1C, 0xCD, 0xE8, 0x9B, 0x89, 0x59, 0x15, 0xBD, 0x2D, 
-0x60, 0x4D, 0xA8, 0x12, 0x6A, 0xA8, 0x20, 0xAB, 0x80, 0xA9, 0xE5, 0x47, 0x9B, 0xA0, 0x01, 0x80, 
-0xF8, 0x68, 0x7A, 0x0D, 0xA8, 0xC4, 0xE7, 0x01, 0x13, 0xB3, 0x26, 0x50, 0x1B, 0x56, 0x64, 0x35, 
-0xC1, 0x67, 0x46, 0x83, 0x2F, 0x4E, 0xB9, 0xE3, 0x7C, 0x13, 0xFD, 0x19, 0x0C, 0xCB, 0x3E, 0xE6, 
-0x6C, 0x6A, 0x43, 0x88, 0x3F, 0x53, 0x68, 0x94, 0x10, 0xFF, 0xF0, 0x76, 0x29, 0x3D, 0xE5, 0xC3, 
-0x92, 0x19, 0x7F, 0x86, 0xBF, 0x9A, 0x86, 0x32, 0xF1, 0xA7, 0x1B, 0x09, 0xFE, 0xA7, 0x0A, 0x66, 
-0xFC, 0x4F, 0x23, 0x3B, 0xA3, 0x0A, 0x5C, 0x93, 0xAD, 0xFD, 0x93, 0x57, 0xB9, 0x22, 0x61, 0xAC, 
-0xDC, 0x32, 0x5A, 0x3E, 0x4D, 0x62, 0xE6, 0x6C, 0x41, 0x8B, 0xCF, 0x18, 0xAB, 0x19, 0x7D, 0x3E, 
-0x87, 0x64, 0x4C, 0x0C, 0xA3, 0xBD, 0x0A, 0xBC, 0x7A, 0xCE, 0x44, 0x80, 0xF2, 0xE0, 0x28, 0x4F, 
-0x71, 0x1D, 0x6C, 0xE1, 0xD7, 0x83, 0xFE, 0x4E, 0xAE, 0x16, 0xA8, 0x4F, 0x4D, 0x93, 0x32, 0x68, 
-0x0B, 0x5D, 0x63, 0x42, 0x03, 0xFD, 0x25, 0x5F, 0xAF, 0x2B, 0x16, 0x88, 0x12, 0xF5, 0x0C, 0xC3, 
-0x59, 0xE7, 0xC0, 0xA0, 0x9D, 0x93, 0x07, 0x35, 0x5D, 0x9F, 0x6A, 0xF1, 0x8F, 0xF7, 0x2F, 0xBF, 
-0x16, 0xAD, 0x32, 0xD4, 0xC2, 0xB0, 0x2D, 0xC8, 0x99, 0x2E, 0xA9, 0x7E, 0x26, 0x11, 0x78, 0xDA, 
-0x32, 0xCD, 0x06, 0xD2, 0xE6, 0x19, 0xD9, 0x96, 0x31, 0xCA, 0xB7, 0xEC, 0x9F, 0xD4, 0x27, 0x7D, 
-0x3D, 0x10, 0xFD, 0xD2, 0x3E, 0x74, 0x71, 0x7B, 0x7B, 0xDD, 0xAD, 0x4E, 0x97, 0x5C, 0x3A, 0xED, 
-0xAA, 0x5E, 0xE7, 0xA3, 0xCD, 0xBD, 0xBD, 0xCE, 0x4E, 0x9B, 0xAE, 0xDA, 0xBB, 0x7E, 0xDF, 0xCB, 
-0x5D, 0xB5, 0x1A, 0xFE, 0xB6, 0x18, 0x2D, 0x13, 0x83, 0x35, 0xB4, 0xDD, 0x2D, 0xC8, 0x4A, 0xC8, 
-0xD4, 0x55, 0xB3, 0xBB, 0xB7, 0x17, 0x6C, 0xE1, 0xD5, 0x56, 0x73, 0x6F, 0x8F, 0xA3, 0xF0, 0xFB, 
-0xED, 0xDD, 0xC2, 0xD5, 0x76, 0xAB, 0xA1, 0x86, 0x57, 0x3A, 0xD6, 0x4E, 0x17, 0xB1, 0x61, 0x1A, 
-0x75, 0xE5, 0x79, 0xF5, 0x3A, 0xBF, 0x6A, 0x7B, 0x9D, 0x1D, 0x09, 0x43, 0x6C, 0x85, 0xAB, 0x6D, 
-0x6D, 0x4A, 0xC6, 0x64, 0xC2, 0xEE, 0x56, 0x50, 0xDF, 0xE3, 0x7E, 0x6D, 0x76, 0xB5, 0xD3, 0x12, 
-0x64, 0xAA, 0xAB, 0x66, 0x37, 0xE8, 0xE4, 0xAF, 0x1A, 0x81, 0xBF, 0x47, 0xB5, 0xE5, 0x06, 0x3F, 
-0xC7, 0xDC, 0xBD, 0xBD, 0x56, 0xC0, 0x19, 0xA9, 0x5F, 0x49, 0xE6, 0xCA, 0xAB, 0xD6, 0x76, 0x6B, 
-0x27, 0x7F, 0xD5, 0xF4, 0xC5, 0x4C, 0x07, 0x9A, 0x71, 0x03, 0xAB, 0xE7, 0x61, 0x4E, 0x4E, 0x93, 
-0xBC, 0xF2, 0xB7, 0xFB, 0xF5, 0x7E, 0xDD, 0x84, 0x79, 0x9D, 0xFA, 0x76, 0x7D, 0x3B, 0x77, 0xD5, 
-0x0C, 0xDA, 0x41, 0x7B, 0x35, 0xB3, 0xCC, 0x06, 0xE2, 0x9D, 0x3A, 0x66, 0xC6, 0x64, 0xEA, 0xAA, 
-0xD3, 0xF2, 0xBC, 0x3E, 0x65, 0xED, 0x67, 0xB0, 0x3A, 0x90, 0xDE, 0xD8, 0x36, 0xAF, 0x90, 0x1D, 
-0xB8, 0x15, 0xF1, 0x96, 0xFD, 0x2D, 0xFC, 0x79, 0xF2, 0xE9, 0xED, 0xAE, 0x4F, 0x68, 0xDF, 0x38, 
-0xE2, 0x9C, 0x53, 0x97, 0x21, 0x30, 0xD0, 0x81, 0x81, 0x00, 0xD6, 0x75, 0x60, 0x5D, 0x00, 0x1B, 
-0x3A, 0xB0, 0x21, 0x80, 0x4D, 0x1D, 0x48, 0x85, 0xC5, 0x71, 0xF8, 0xF3, 0xF0, 0xE8, 0x9D, 0x30, 
-0x30, 0x5F, 0x9D, 0xD5, 0x69, 0x92, 0xCE, 0xCF, 0xD1, 0x97, 0x3B, 0x7A, 0xAF, 0x80, 0xB3, 0xE4, 
-0x8A, 0x80, 0xBB, 0x5B, 0xC7, 0x27, 0x12, 0x16, 0x47, 0xB3, 0x39, 0xCE, 0x23, 0xED, 0x2A, 0xD0, 
-0x4D, 0x8C, 0xA0, 0x5B, 0x96, 0x00, 0xD2, 0x6C, 0x3C, 0xF9, 0xFA, 0xF0, 0x68, 0x9B, 0x12, 0x7C, 
-0x77, 0xCC, 0x53, 0x1B, 0x80, 0x87, 0x38, 0x9F, 0x6B, 0x24, 0x50, 0xC7, 0xC7, 0xE1, 0x8A, 0x47, 
-0x40, 0xA3, 0xEC, 0xED, 0x91, 0x23, 0x4E, 0x30, 0xC0, 0xF9, 0xDF, 0x2D, 0x31, 0xE7, 0x8B, 0x40, 
-0x3A, 0x51, 0x00, 0x2A, 0xBC, 0x7F, 0xF0, 0x41, 0x38, 0xDD, 0x00, 0x15, 0x11, 0xFE, 0x01, 0x4B, 
-0x2A, 0xB1, 0x68, 0x53, 0xD5, 0x9F, 0x04, 0xAE, 0x37, 0x58, 0x9C, 0xAC, 0x88, 0x7C, 0x72, 0x21, 
-0x80, 0xC7, 0xAF, 0xF6, 0x0F, 0x3F, 0x99, 0x99, 0x66, 0xE7, 0xE3, 0xE9, 0x0F, 0x99, 0x49, 0xD5, 
-0xE2, 0x93, 0x56, 0x8B, 0x93, 0xDD, 0x5D, 0x95, 0x7C, 0x1E, 0xC7, 0x98, 0xB2, 0xFF, 0xEA, 0xDD, 
-0xD1, 0x9B, 0x5D, 0x09, 0x1D, 0x9C, 0xA7, 0xC9, 0x05, 0x4E, 0xF9, 0xBD, 0x3C, 0x3A, 0xD8, 0x91, 
-0xC0, 0xB3, 0x64, 0x32, 0x2C, 0xBE, 0xBE, 0x81, 0x07, 0xD1, 0x74, 0x7E, 0x9E, 0x46, 0x83, 0xF1, 
-0x1C, 0x73, 0x9C, 0xEC, 0x1F, 0x9C, 0xEC, 0xEE, 0xA8, 0xF9, 0x0A, 0x78, 0x3E, 0x1F, 0x4F, 0xE6, 
-0xF1, 0xF0, 0x65, 0x1A, 0xFD, 0x50, 0xCF, 0x15, 0xD3, 0xB2, 0x04, 0xDB, 0x82, 0x75, 0x2F, 0x0F, 
-0x8E, 0x8E, 0x8F, 0x73, 0x54, 0x9D, 0x4D, 0x92, 0xD9, 0x4C, 0x92, 0x75, 0xCB, 0xA2, 0x58, 0x57, 
-0xC0, 0x57, 0x36, 0x05, 0x7C, 0x65, 0x53, 0xC0, 0x57, 0x36, 0x05, 0x7C, 0x65, 0x53, 0xC0, 0x57, 
-0x99, 0x02, 0x12, 0xB0, 0xA5, 0x03, 0x5B, 0x02, 0xD8, 0xD6, 0x81, 0x6D, 0x01, 0xEC, 0xE8, 0xC0, 
-0x8E, 0x00, 0x76, 0x75, 0x60, 0x57, 0x00, 0x7D, 0xCF, 0xA8, 0xBD, 0x27, 0xC1, 0x26, 0x51, 0x92, 
-0x2A, 0xDF, 0x20, 0xCB, 0x97, 0x74, 0xF9, 0x06, 0x61, 0xBE, 0xA4, 0xCC, 0x37, 0x48, 0xF3, 0x25, 
-0x6D, 0xBE, 0x41, 0x9C, 0x2F, 0xA9, 0xF3, 0x0D, 0xF2, 0xFC, 0x16, 0xB2, 0x78, 0x62, 0xB0, 0xF8, 
-0xBD, 0x8D, 0xC5, 0xEF, 0x6D, 0x2C, 0x7E, 0x6F, 0x63, 0xF1, 0x7B, 0x1B, 0x8B, 0xDF, 0x6B, 0x6D, 
-0x7C, 0xAA, 0x35, 0x47, 0x7A, 0xF8, 0x51, 0xB5, 0x44, 0xC8, 0xB4, 0x07, 0x0A, 0x87, 0xC3, 0x36, 
-0xA1, 0x10, 0xF0, 0x70, 0x24, 0x16, 0x47, 0xF0, 0x66, 0xD0, 0xDF, 0x07, 0x43, 0xB7, 0xBF, 0xB7, 
-0xDF, 0xCF, 0xF2, 0x0E, 0x70, 0xA5, 0xC4, 0x78, 0x34, 0x1E, 0x20, 0xF6, 0x31, 0xB7, 0x20, 0x6F, 
-0x44, 0xF6, 0xD7, 0x64, 0x42, 0x2E, 0x28, 0xEB, 0xAB, 0xA3, 0x77, 0xFB, 0xBF, 0x1F, 0x1D, 0x9E, 
-0xA8, 0x47, 0xE7, 0x49, 0x3A, 0xFE, 0x33, 0x99, 0xF2, 0x06, 0x74, 0x82, 0xFD, 0xC8, 0xE1, 0x89, 
-0x7C, 0x06, 0x35, 0x3A, 0x03, 0xBC, 0x88, 0x73, 0x08, 0x38, 0xDF, 0xBF, 0xA5, 0x07, 0x1F, 0x1C, 
-0x0C, 0x9F, 0x42, 0x0D, 0x6B, 0x6B, 0xE7, 0x93, 0x04, 0x89, 0xB0, 0x29, 0x30, 0xB8, 0x97, 0xEF, 
-0xAC, 0x01, 0x48, 0xC1, 0x52, 0xA0, 0x7F, 0xDA, 0xDB, 0x93, 0x90, 0x04, 0x27, 0x8A, 0x6F, 0xC5, 
-0x12, 0xB7, 0x9F, 0x1F, 0xC7, 0xD3, 0xE1, 0xCE, 0x18, 0x37, 0x52, 0xE3, 0xC2, 0xA6, 0x5E, 0xB6, 
-0x74, 0x64, 0x2E, 0x17, 0xA3, 0xCE, 0x58, 0x9F, 0x8D, 0xC2, 0xEB, 0x64, 0x3C, 0x5C, 0xF1, 0xC2, 
-0x30, 0xE4, 0x6B, 0x3E, 0x7F, 0xDE, 0xBA, 0x35, 0x5C, 0x29, 0xB7, 0xE9, 0xF5, 0x22, 0xBA, 0x60, 
-0x97, 0x2A, 0x49, 0x54, 0x1B, 0xE1, 0xC2, 0xB0, 0x1D, 0x5A, 0x30, 0xB3, 0x49, 0xED, 0x7D, 0x16, 
-0xA7, 0xE3, 0x78, 0x56, 0xDB, 0x53, 0xF0, 0x1A, 0x6F, 0x6D, 0x46, 0x5A, 0x76, 0x5E, 0x40, 0xF2, 
-0x61, 0x3C, 0x1B, 0x9F, 0x4E, 0xE2, 0x5F, 0xBF, 0xCC, 0x7B, 0x76, 0xA2, 0xA7, 0x3C, 0x85, 0x66, 
-0x7C, 0x96, 0xE2, 0xBA, 0x3E, 0x5A, 0x85, 0x62, 0x14, 0xB9, 0x6D, 0x3E, 0xAB, 0xA9, 0xB5, 0x32, 
-0x85, 0x7C, 0xEC, 0xCA, 0x8E, 0x54, 0xAB, 0x43, 0x01, 0xC8, 0xAE, 0xF5, 0x3C, 0x97, 0xC9, 0x78, 
-0x3A, 0x8F, 0xD3, 0x13, 0x50, 0xB2, 0x83, 0x68, 0x0E, 0x86, 0xDF, 0xA8, 0xCA, 0x5B, 0xF5, 0xB4, 
-0xC6, 0x15, 0xDD, 0x92, 0x83, 0xFD, 0x08, 0x1D, 0x3B, 0xC6, 0x2D, 0xB0, 0xDD, 0xD1, 0x59, 0xBC, 
-0x10, 0x65, 0xA7, 0x67, 0xCB, 0xC2, 0x8A, 0x08, 0x8B, 0x8C, 0x22, 0xC8, 0x4E, 0x3C, 0xAA, 0xE1, 
-0x04, 0x83, 0x99, 0x0E, 0x77, 0x34, 0x96, 0xA0, 0xB0, 0x55, 0x2A, 0xC3, 0x44, 0xE3, 0x75, 0x6B, 
-0x7A, 0xB6, 0xAB, 0x23, 0xFC, 0x06, 0x7D, 0x1B, 0x56, 0xD7, 0xC0, 0xF2, 0x5A, 0x00, 0x6B, 0x66, 
-0xA7, 0xA9, 0x52, 0xB3, 0x8B, 0x3C, 0x0E, 0xDA, 0x9E, 0x59, 0x40, 0x42, 0xD0, 0x9A, 0xE8, 0x09, 
-0xB5, 0x84, 0x6C, 0xCF, 0xD0, 0xB6, 0x24, 0x8D, 0xB9, 0x64, 0x0B, 0x35, 0xD9, 0x33, 0x1E, 0x65, 
-0xA2, 0x33, 0x73, 0xB0, 0x77, 0x76, 0x6C, 0xBA, 0x02, 0xE7, 0x81, 0xEC, 0x5B, 0x81, 0xAD, 0xC7, 
-0xB4, 0x98, 0x6A, 0xB6, 0xF9, 0x79, 0xF5, 0x10, 0x1C, 0xA0, 0x43, 0x74, 0x32, 0xF1, 0x73, 0x4C, 
-0xFF, 0xF0, 0xF3, 0x11, 0xFE, 0xE1, 0xE7, 0xF0, 0xE3, 0xEA, 0x97, 0x9E, 0x99, 0x89, 0x6D, 0x95, 
-0xA1, 0xD3, 0x2A, 0x61, 0x01, 0xB3, 0x1D, 0x3D, 0xDF, 0xE0, 0x6A, 0x36, 0x4F, 0x2E, 0x0E, 0xA2, 
-0x1F, 0x71, 0xBA, 0x39, 0xBD, 0x9A, 0x4C, 0x7A, 0x06, 0x88, 0x6D, 0xEB, 0x69, 0x87, 0x40, 0x4F, 
-0x1C, 0x1F, 0x0F, 0x22, 0x8E, 0x5B, 0xBB, 0x65, 0x7F, 0x8A, 0x74, 0x4F, 0x72, 0xE9, 0x5E, 0x45, 
-0x93, 0xD1, 0xDA, 0x5A, 0x01, 0xC4, 0x0E, 0xF5, 0xF4, 0x69, 0x32, 0x93, 0x2D, 0x1D, 0xD3, 0x6A, 
-0xB7, 0x6C, 0x5F, 0x2F, 0x7F, 0x32, 0xB0, 0xB4, 0xF8, 0x03, 0x01, 0xCC, 0x14, 0xA7, 0xA7, 0x12, 
-0xB2, 0x37, 0xB9, 0xEC, 0x1A, 0x67, 0xD4, 0x1D, 0xFB, 0x6A, 0x54, 0x7E, 0x7C, 0x36, 0x06, 0xDB, 
-0xBC, 0x07, 0x16, 0x9A, 0x2A, 0xAE, 0x6E, 0xD9, 0x77, 0x1D, 0xDB, 0x8C, 0xDB, 0x50, 0xC9, 0x34, 
-0x71, 0xCB, 0x8E, 0xF4, 0x34, 0x51, 0x1A, 0x47, 0x32, 0x01, 0x5E, 0xB3, 0x4F, 0xB9, 0xFA, 0x9C, 
-0x8C, 0xE7, 0x93, 0x98, 0xAF, 0x79, 0x45, 0x25, 0xE0, 0x36, 0x01, 0xC4, 0x2D, 0xDA, 0x0D, 0xC9, 
-0x3C, 0x97, 0x8C, 0xBD, 0xD2, 0x71, 0xCC, 0xD5, 0x93, 0xCD, 0xD5, 0xD5, 0x9E, 0x01, 0x60, 0xEF, 
-0x75, 0xBA, 0xAE, 0x66, 0x31, 0xF1, 0xE4, 0x00, 0x57, 0xF4, 0xCD, 0x90, 0x34, 0x13, 0xC2, 0x3E, 
-0x1A, 0x1A, 0x0D, 0x95, 0x26, 0x69, 0x41, 0xC3, 0x9E, 0x70, 0xD2, 0x70, 0x85, 0xEF, 0x66, 0x50, 
-0x6B, 0xF6, 0x4A, 0x9F, 0xB2, 0xD7, 0xA1, 0xC7, 0x3E, 0xC0, 0xE7, 0xB7, 0x30, 0x65, 0xBF, 0x87, 
-0x7C, 0x1D, 0x6A, 0x34, 0xB9, 0x92, 0xB6, 0xEE, 0x0F, 0x0D, 0x24, 0x2D, 0xC3, 0x3F, 0xC3, 0x6A, 
-0x0C, 0xEE, 0x7E, 0x82, 0x5E, 0xF8, 0x13, 0x1F, 0xDD, 0xE6, 0x7F, 0xE0, 0x29, 0x04, 0x58, 0x8B, 
-0x11, 0x6D, 0x84, 0xC9, 0x8E, 0x34, 0x48, 0x72, 0x11, 0x44, 0x92, 0x5C, 0x00, 0x11, 0x18, 0x1E, 
-0xE7, 0x92, 0x84, 0xA3, 0x42, 0xA2, 0x70, 0x44, 0xAB, 0x28, 0xE7, 0x31, 0xFA, 0xC4, 0x23, 0xF4, 
-0xF3, 0x46, 0xE8, 0x89, 0xA4, 0x78, 0x6A, 0x03, 0xF8, 0x08, 0x11, 0x7E, 0x43, 0x6F, 0xAE, 0xAD, 
-0x00, 0x87, 0x47, 0x3E, 0x6E, 0x40, 0x88, 0xC3, 0x71, 0x5C, 0x59, 0xBD, 0xFC, 0x8E, 0xFB, 0xDB, 
-0xD8, 0x99, 0x76, 0x37, 0x61, 0xB3, 0x38, 0xAC, 0xD5, 0xD7, 0xD3, 0x98, 0x0D, 0xE0, 0xC2, 0x0F, 
-0xD6, 0xA3, 0x98, 0x9D, 0xC6, 0x21, 0xE4, 0xAC, 0xCE, 0x62, 0xDA, 0x5D, 0x84, 0xCF, 0x09, 0x7C, 
-0x0C, 0x57, 0xCD, 0x56, 0x13, 0x2F, 0x47, 0x44, 0xEF, 0x65, 0x1C, 0x1E, 0x38, 0x23, 0x36, 0x72, 
-0xD9, 0x79, 0x1C, 0x5E, 0xC6, 0xC5, 0x10, 0xF7, 0x37, 0x59, 0x82, 0x93, 0x38, 0xBC, 0xB1, 0x24, 
-0xB8, 0xCA, 0x12, 0x5C, 0x43, 0x99, 0x57, 0x96, 0x14, 0xFC, 0xB1, 0xCB, 0x7E, 0xC4, 0xE1, 0xB5, 
-0xE5, 0xF1, 0xDB, 0xD8, 0x58, 0x41, 0xCA, 0x77, 0x26, 0x25, 0x59, 0x90, 0x01, 0xB8, 0xC2, 0xC4, 
-0x5B, 0x13, 0x5C, 0x0E, 0xBB, 0x3A, 0x88, 0xD1, 0xB6, 0xAF, 0x22, 0x54, 0x8F, 0x3E, 0xB8, 0xAF, 
-0xD6, 0x37, 0xE3, 0x23, 0xB5, 0x79, 0x5E, 0x7B, 0xB0, 0x11, 0x3F, 0xC7, 0xD5, 0xF3, 0x1B, 0x6E, 
-0x5C, 0x09, 0xEB, 0x2D, 0x6F, 0xE3, 0xC9, 0x9F, 0x6B, 0x6B, 0xF1, 0x73, 0x0F, 0x84, 0xCC, 0x01, 
-0x2E, 0x43, 0xC0, 0x0B, 0x48, 0x82, 0xA0, 0xB0, 0xEA, 0x00, 0xAC, 0x1A, 0xBB, 0xB8, 0xA1, 0x34, 
-0x7E, 0x11, 0x7A, 0x9B, 0x00, 0x5B, 0x85, 0xC1, 0x6C, 0x85, 0xEF, 0xA3, 0x46, 0xBB, 0xEA, 0xF8, 
-0xDE, 0x3A, 0x30, 0x18, 0xC4, 0xA3, 0xED, 0xD3, 0x91, 0x1B, 0x01, 0x59, 0xB6, 0x23, 0xB0, 0xE9, 
-0xF6, 0x56, 0xAB, 0xAB, 0x15, 0x23, 0x7F, 0x74, 0x3A, 0x73, 0x6C, 0x88, 0xEE, 0xC2, 0xC4, 0xF6, 
-0xA1, 0x31, 0x2D, 0x34, 0x3F, 0x6B, 0x6B, 0x77, 0x26, 0xE1, 0x53, 0x38, 0xBF, 0x7E, 0x11, 0x97, 
-0xCF, 0x23, 0xF0, 0xD9, 0xF8, 0x72, 0xDA, 0xD5, 0x33, 0x1C, 0xC2, 0xB0, 0x0C, 0x7A, 0x34, 0x1A, 
-0xCD, 0xE2, 0xF9, 0x6F, 0x61, 0xCD, 0xF3, 0xDA, 0xA8, 0x5E, 0xB9, 0x07, 0x9F, 0x8A, 0x0F, 0xB6, 
-0x27, 0x57, 0xA9, 0x84, 0x92, 0xE8, 0x46, 0x20, 0xEA, 0xF0, 0xEB, 0xE6, 0x59, 0xDC, 0x1B, 0xC6, 
-0x52, 0x32, 0x27, 0x28, 0x7B, 0x6C, 0x00, 0xCF, 0x82, 0x4A, 0xCD, 0x6B, 0xAE, 0xCF, 0x62, 0xE6, 
-0x24, 0x9B, 0xFD, 0xB8, 0x77, 0x1C, 0xBB, 0x95, 0x5A, 0x73, 0x7D, 0x10, 0x57, 0x6A, 0xF5, 0xCE, 
-0xFA, 0x18, 0x8F, 0x46, 0x85, 0x87, 0x84, 0x47, 0xC5, 0x3B, 0x60, 0xBB, 0xB1, 0x65, 0xC5, 0xB1, 
-0xFB, 0x53, 0x0F, 0xDF, 0xA3, 0x69, 0x46, 0x6A, 0xC4, 0x52, 0x48, 0xC5, 0x8E, 0x97, 0x8F, 0xD4, 
-0x3C, 0x6B, 0x30, 0xDA, 0x87, 0x8A, 0x6E, 0xF0, 0x4D, 0x50, 0x7F, 0x7B, 0x06, 0x02, 0x5F, 0x4F, 
-0xF0, 0x94, 0xBF, 0x8A, 0x33, 0xC7, 0x6D, 0x17, 0xA8, 0x01, 0xCF, 0xFE, 0xE6, 0x6E, 0xC4, 0x5A, 
-0x80, 0x41, 0x30, 0xD7, 0xD3, 0x98, 0x22, 0x30, 0x24, 0xB8, 0x2C, 0xDA, 0xF9, 0x67, 0x3E, 0x0C, 
-0x46, 0x04, 0x8A, 0xA2, 0x82, 0xC2, 0x50, 0xBC, 0x15, 0x8C, 0x86, 0x48, 0xB1, 0x55, 0xEA, 0x2D, 
-0x2C, 0xAF, 0xAA, 0xD5, 0x01, 0x5A, 0x27, 0xEE, 0x82, 0x7E, 0xE2, 0xBB, 0x6E, 0xAF, 0x90, 0x50, 
-0x3E, 0xB2, 0xE1, 0x94, 0xF1, 0xB7, 0xD5, 0x2E, 0x1C, 0xA6, 0x57, 0xB3, 0x0A, 0xF5, 0xAC, 0x8A, 
-0x8A, 0x2A, 0xD6, 0x5D, 0xE8, 0xBB, 0x4D, 0xC5, 0x36, 0x1D, 0x96, 0x2A, 0x2B, 0xED, 0x24, 0x61, 
-0xC2, 0xBD, 0x6D, 0xE5, 0x79, 0xAE, 0xAD, 0x25, 0xDA, 0x1D, 0x8B, 0x54, 0xEA, 0x44, 0xBA, 0x5A, 
-0x98, 0x44, 0x5C, 0xB2, 0x89, 0xFE, 0x5C, 0xB9, 0x20, 0x98, 0x44, 0xDD, 0xE1, 0x56, 0x19, 0xB4, 
-0x3F, 0x1E, 0x83, 0xBC, 0xE7, 0x6B, 0x6B, 0x67, 0xCE, 0x39, 0xB8, 0xF4, 0x8C, 0x78, 0x0B, 0x7A, 
-0x01, 0x66, 0xD1, 0xC5, 0x27, 0x57, 0xEE, 0x4F, 0x48, 0x38, 0xC0, 0x87, 0x27, 0xE6, 0xC3, 0x53, 
-0x84, 0xED, 0x98, 0x30, 0xEC, 0xE7, 0xA0, 0xD4, 0xEF, 0x6B, 0x6B, 0xDE, 0xF3, 0xEF, 0xA2, 0xC5, 
-0x88, 0x31, 0x45, 0x28, 0xEF, 0x37, 0x86, 0xC9, 0xCF, 0xDD, 0x18, 0x33, 0x7F, 0xFF, 0x5C, 0xAD, 
-0xCE, 0xBE, 0xE0, 0xDA, 0xF6, 0x14, 0x3A, 0xD6, 0xCF, 0x74, 0x99, 0x5C, 0xF2, 0x2B, 0xDA, 0x55, 
-0x87, 0x8C, 0xBF, 0xBD, 0x39, 0x1F, 0x4F, 0x62, 0xC7, 0x7B, 0x3E, 0x73, 0x6F, 0xA1, 0x26, 0xA2, 
-0x84, 0x23, 0x2C, 0xE1, 0xC8, 0x28, 0xA1, 0x1F, 0x1E, 0x15, 0x4A, 0x38, 0x82, 0x12, 0xFA, 0xB2, 
-0x84, 0xA3, 0xCF, 0x7D, 0x51, 0x02, 0x5D, 0x89, 0x12, 0x3C, 0x55, 0x42, 0xDF, 0xBD, 0x7D, 0x62, 
-0x91, 0x0D, 0xED, 0x93, 0x18, 0xE3, 0xF1, 0x3A, 0xD0, 0x22, 0x80, 0xD0, 0xB3, 0xB0, 0x46, 0x3A, 
-0xCB, 0x66, 0x70, 0xD1, 0x22, 0x9B, 0x0F, 0x26, 0x1F, 0xBF, 0x4F, 0x01, 0x40, 0x17, 0x7D, 0xF1, 
-0x04, 0x99, 0x9C, 0x58, 0x6D, 0x27, 0x01, 0xB7, 0xA3, 0x59, 0x8C, 0x6A, 0x18, 0xAE, 0x5E, 0x8C, 
-0x87, 0xC3, 0x49, 0x8C, 0x70, 0x69, 0x72, 0x8D, 0x16, 0x74, 0xA2, 0x2D, 0xC2, 0x37, 0xF6, 0x74, 
-0x53, 0x4A, 0xD5, 0xB6, 0x16, 0xA7, 0x2B, 0xB4, 0xA0, 0x6D, 0xDA, 0x98, 0x3A, 0xD7, 0xBB, 0x3A, 
-0x22, 0xC4, 0xA5, 0x6E, 0x0D, 0x4D, 0xD7, 0x68, 0xE5, 0x14, 0x67, 0x64, 0x40, 0x41, 0xF5, 0x34, 
-0x5E, 0x23, 0x4B, 0x84, 0x3D, 0x61, 0x22, 0x1B, 0x62, 0x73, 0xFD, 0x37, 0xDC, 0x5B, 0xD9, 0xDC, 
-0x80, 0x46, 0xFB, 0x22, 0x8C, 0x36, 0xA2, 0x4A, 0xD8, 0x24, 0xFD, 0xC9, 0xC8, 0xDA, 0x72, 0x65, 
-0x48, 0x51, 0x71, 0xC8, 0x1F, 0xA4, 0xEC, 0xE9, 0x35, 0xEB, 0xF3, 0x2D, 0xA1, 0x02, 0x61, 0x4C, 
-0xE4, 0xA1, 0xFD, 0x9A, 0x0B, 0x3A, 0xC9, 0x70, 0x7D, 0xC3, 0x0D, 0xC6, 0xD8, 0x48, 0x07, 0x26, 
-0x59, 0x55, 0xCC, 0xAD, 0x1F, 0xC6, 0xD6, 0x7D, 0x10, 0xF2, 0xC6, 0x72, 0xC8, 0xA1, 0x97, 0x7A, 
-0x08, 0xF6, 0xD6, 0x72, 0xD8, 0x83, 0xF6, 0x83, 0xB0, 0x7B, 0xCB, 0x61, 0x6F, 0xF6, 0xE8, 0xAB, 
-0x23, 0xBE, 0xBB, 0xE2, 0xDB, 0x6F, 0xCB, 0x0B, 0xF9, 0x24, 0x68, 0xC9, 0x0B, 0xF9, 0xA8, 0xDE, 
-0x6C, 0xF6, 0x38, 0x26, 0x19, 0x8F, 0xD5, 0x89, 0x2A, 0x5D, 0xCF, 0xFD, 0x7B, 0x00, 0xFD, 0x73, 
-0xA2, 0x99, 0x76, 0x01, 0x6E, 0x6E, 0xFA, 0xE0, 0x30, 0x82, 0x5B, 0x67, 0x98, 0xE8, 0x44, 0xDA, 
-0xD2, 0x21, 0xD2, 0x35, 0x96, 0x89, 0x7D, 0x6F, 0x73, 0xD6, 0x3B, 0x63, 0x89, 0xDC, 0x13, 0x39, 
-0xE6, 0x54, 0xEB, 0x7B, 0x1E, 0x13, 0x3D, 0x86, 0xB0, 0x5E, 0x1E, 0x14, 0xB3, 0xB0, 0x90, 0x0C, 
-0xE9, 0xD9, 0x22, 0xA4, 0x6C, 0x22, 0xEB, 0x02, 0xAA, 0x69, 0x30, 0xF1, 0xB4, 0x44, 0x02, 0xA9, 
-0x2E, 0x81, 0x55, 0x6F, 0x55, 0x73, 0x1F, 0x26, 0x2F, 0x42, 0xDF, 0xF3, 0x5C, 0xF0, 0x0F, 0x6D, 
-0x42, 0x41, 0x84, 0xEE, 0x2D, 0xFA, 0x08, 0xFF, 0x8B, 0x39, 0x08, 0x0E, 0xDD, 0x44, 0x38, 0x74, 
-0x13, 0xE1, 0xD0, 0x4D, 0x5C, 0xF7, 0xFE, 0x8C, 0x5D, 0xC0, 0xC2, 0x8D, 0x44, 0x0B, 0xFC, 0x67, 
-0x18, 0x23, 0x62, 0xEE, 0x0A, 0x37, 0x72, 0xE8, 0x95, 0xA7, 0xB1, 0xB2, 0x6C, 0x68, 0xD4, 0x6A, 
-0x5E, 0x2B, 0x07, 0x33, 0xD8, 0x51, 0xB0, 0xC2, 0xDA, 0xC6, 0xA7, 0xBC, 0x79, 0xC5, 0xFD, 0xF8, 
-0x68, 0xF6, 0xC8, 0xEA, 0xE1, 0xF6, 0x47, 0x19, 0x3C, 0x19, 0x86, 0x31, 0xD1, 0xDF, 0x9B, 0x40, 
-0x7E, 0x09, 0x67, 0x45, 0xAF, 0xA2, 0xB3, 0x57, 0x74, 0x2B, 0x8B, 0x04, 0xA7, 0x7A, 0x8A, 0x28, 
-0x3B, 0x2E, 0x55, 0xE7, 0x8C, 0xE8, 0xA2, 0xEE, 0x61, 0x4C, 0x4D, 0xCE, 0x62, 0xFE, 0x2A, 0x21, 
-0xD0, 0xCD, 0x46, 0xA3, 0x69, 0x16, 0x12, 0x74, 0xCB, 0x0B, 0x49, 0xCD, 0x42, 0xEA, 0xB6, 0x42, 
-0x20, 0x7F, 0xB1, 0x90, 0xEE, 0xC3, 0x29, 0x69, 0x2C, 0x4D, 0x89, 0x5F, 0x7F, 0x38, 0x29, 0xCD, 
-0xA5, 0x49, 0xC9, 0x77, 0x11, 0xF7, 0xA1, 0xA5, 0xB5, 0x34, 0x2D, 0x41, 0xF0, 0x70, 0x5A, 0xDA, 
-0x4B, 0xD3, 0x92, 0xEF, 0x90, 0xEE, 0x43, 0x8B, 0xB7, 0x34, 0x2D, 0x75, 0xFF, 0xE1, 0xB4, 0xF8, 
-0x0B, 0x69, 0xB9, 0xD5, 0xAD, 0xC4, 0x13, 0x18, 0x7A, 0xD1, 0x9C, 0xC8, 0xDA, 0x5A, 0x00, 0x8D, 
-0x95, 0x5F, 0x35, 0xC4, 0x77, 0xAB, 0x2D, 0x21, 0x5D, 0x91, 0xC6, 0xF7, 0xB3, 0x44, 0xA0, 0x38, 
-0xE2, 0xA2, 0x99, 0x25, 0x03, 0x31, 0x0B, 0x5C, 0x5E, 0x96, 0x0E, 0x84, 0x22, 0x2E, 0x1A, 0x59, 
-0x3A, 0x60, 0xA1, 0xB8, 0xE8, 0x66, 0xE9, 0x80, 0x60, 0x71, 0x51, 0xCF, 0xD2, 0x81, 0x1D, 0xC1, 
-0x0B, 0x1C, 0x1D, 0x2A, 0x7F, 0xD0, 0x18, 0xE0, 0xFC, 0xBD, 0xD1, 0xDC, 0x54, 0x16, 0x44, 0xF2, 
-0xA8, 0xB7, 0xD0, 0xA8, 0xF8, 0x25, 0x36, 0x45, 0xB7, 0x9D, 0xBA, 0x7D, 0x11, 0xEC, 0x86, 0x9A, 
-0xA2, 0x25, 0x4D, 0x6C, 0x23, 0x1B, 0x2D, 0xF3, 0x2D, 0xF8, 0xDB, 0xE4, 0xA1, 0xC3, 0xA0, 0xE1, 
-0x70, 0x6D, 0x6D, 0x8C, 0xEE, 0xB7, 0x36, 0x36, 0x60, 0x27, 0x34, 0x9C, 0x78, 0x03, 0x76, 0x70, 
-0x1E, 0x87, 0x37, 0xCE, 0x0C, 0x67, 0x4A, 0xD8, 0x3E, 0xCE, 0x79, 0x68, 0xF1, 0x3F, 0xE6, 0x38, 
-0x6B, 0xC2, 0xFA, 0xB1, 0x15, 0x7C, 0x8C, 0x01, 0xE5, 0x43, 0x40, 0xFB, 0x49, 0xF8, 0xF9, 0x2F, 
-0xB0, 0x53, 0x99, 0x4B, 0x0E, 0xCD, 0x6D, 0x7E, 0xF6, 0xBC, 0xC4, 0xCF, 0x9E, 0x6B, 0x4E, 0xF3, 
-0xFB, 0xCD, 0x1F, 0x62, 0x53, 0x75, 0xCE, 0xA6, 0xF7, 0x16, 0xB9, 0xD3, 0x73, 0xAE, 0x82, 0xDC, 
-0x17, 0xCE, 0x5C, 0xE1, 0xB9, 0xD2, 0xC7, 0x4F, 0xA8, 0xF5, 0x29, 0x3F, 0x8E, 0xB5, 0x8B, 0xB3, 
-0x3D, 0x34, 0x3F, 0xE4, 0xE6, 0x8A, 0x7E, 0xFB, 0xB0, 0xA2, 0x55, 0x21, 0xBE, 0x2C, 0xA4, 0xED, 
-0x6B, 0x85, 0xBC, 0x32, 0x59, 0xB4, 0xDC, 0x08, 0x41, 0x91, 0xD4, 0x6A, 0x97, 0x10, 0xF5, 0x4A, 
-0x14, 0xD6, 0x54, 0x65, 0xC1, 0x0F, 0x03, 0x9D, 0x1D, 0x3A, 0x27, 0x24, 0x6A, 0x0C, 0x28, 0xA8, 
-0x17, 0x02, 0xEE, 0xC0, 0xDA, 0xDA, 0x3B, 0x3E, 0x98, 0x1A, 0x85, 0xF2, 0x9D, 0x20, 0xA8, 0xF7, 
-0x35, 0xED, 0x77, 0x5E, 0x5B, 0x93, 0xEF, 0x03, 0x33, 0xD0, 0xC6, 0xB1, 0xF3, 0x23, 0x66, 0x7B, 
-0x42, 0x6F, 0x46, 0x18, 0x9C, 0x10, 0xA3, 0x3E, 0xED, 0x99, 0x11, 0xB3, 0x28, 0xA6, 0xB0, 0x36, 
-0x6C, 0x8E, 0xC3, 0xB8, 0x38, 0x6C, 0x8E, 0xF5, 0x61, 0xF3, 0x5C, 0xA5, 0x8E, 0xD5, 0xB0, 0x39, 
-0xBB, 0xD4, 0x07, 0xE1, 0xB1, 0x31, 0x6C, 0xD6, 0xEF, 0x36, 0x12, 0x60, 0xE8, 0x65, 0x9C, 0x4D, 
-0x2E, 0xC2, 0xA5, 0x9C, 0x55, 0x2C, 0x99, 0xBE, 0x03, 0xBE, 0x62, 0xDC, 0x25, 0x95, 0xE5, 0x46, 
-0xCB, 0x52, 0x3A, 0xA1, 0x97, 0xA5, 0xBE, 0xD2, 0x52, 0x5B, 0x66, 0xF6, 0xA8, 0x55, 0x39, 0xD7, 
-0x2A, 0xFD, 0xB5, 0x96, 0xDE, 0x3E, 0xDB, 0x97, 0xBD, 0x09, 0x5C, 0x91, 0x61, 0xC4, 0x3E, 0xA8, 
-0x09, 0x5A, 0x5B, 0x20, 0x0B, 0x11, 0xCD, 0x6D, 0x6F, 0x92, 0x44, 0x73, 0xB4, 0xBE, 0xAF, 0x39, 
-0xBF, 0xC1, 0x4A, 0x61, 0x24, 0x9E, 0x4D, 0x1C, 0xC2, 0xC5, 0xE8, 0xEB, 0xB9, 0x50, 0x93, 0xD7, 
-0x72, 0x87, 0x79, 0x1A, 0x5F, 0x46, 0xC0, 0x57, 0x34, 0x25, 0x3C, 0x06, 0x9D, 0x0C, 0x05, 0x66, 
-0x2D, 0x2C, 0x2B, 0xEB, 0xB5, 0x0A, 0x6E, 0xF6, 0x41, 0x9B, 0x23, 0x5E, 0xA6, 0x5A, 0x1F, 0x16, 
-0x54, 0xEB, 0xC3, 0x72, 0xD5, 0x2A, 0x94, 0x96, 0x15, 0xF6, 0x21, 0x5F, 0x2F, 0x8A, 0x88, 0x11, 
-0x0F, 0x0B, 0x5C, 0x63, 0xE6, 0xC4, 0x01, 0x4D, 0x77, 0x6F, 0x2C, 0x62, 0xE4, 0xDC, 0x5E, 0xE3, 
-0x4C, 0x17, 0x67, 0x6B, 0x6B, 0xB3, 0xDA, 0x78, 0xF6, 0x76, 0x12, 0xFD, 0x80, 0x21, 0x05, 0xDE, 
-0xE0, 0x1C, 0x86, 0xC3, 0x43, 0x5D, 0x3A, 0x69, 0xF8, 0xD2, 0x79, 0xCD, 0xE6, 0xAE, 0xBB, 0xE9, 
-0x44, 0xE1, 0xC7, 0xF5, 0x6C, 0x62, 0x33, 0x75, 0x9F, 0xE1, 0x22, 0xB7, 0x48, 0xCC, 0x9D, 0x47, 
-0xDF, 0x9D, 0x88, 0x7D, 0x7C, 0xD6, 0x74, 0x99, 0x33, 0x0B, 0xF1, 0xAD, 0xF0, 0xC9, 0x0D, 0x86, 
-0x06, 0xFA, 0x79, 0xCB, 0x56, 0x57, 0x19, 0x5D, 0x03, 0x67, 0xCE, 0xAE, 0x26, 0x51, 0xBA, 0x1B, 
-0x61, 0xDC, 0xA3, 0xA3, 0xAB, 0x39, 0x7B, 0xCD, 0x5E, 0x57, 0x70, 0x5A, 0xCF, 0xAD, 0x25, 0xD3, 
-0x37, 0x09, 0x52, 0xD7, 0x3F, 0xC7, 0x77, 0xD3, 0x66, 0x24, 0xBD, 0xD7, 0xB2, 0xFA, 0xB5, 0x79, 
-0x94, 0x02, 0x1F, 0x6B, 0x5F, 0x2F, 0x93, 0x19, 0x27, 0x45, 0x87, 0xD0, 0x58, 0x20, 0x86, 0x26, 
-0xEA, 0xC4, 0x34, 0xE9, 0xF4, 0x2F, 0x67, 0x22, 0x65, 0x41, 0x67, 0xEF, 0x65, 0x65, 0xEC, 0x8D, 
-0xA7, 0xE3, 0xD9, 0xF9, 0x7F, 0xA0, 0x10, 0x06, 0x2D, 0x77, 0x55, 0x22, 0x55, 0xD1, 0x47, 0x00, 
-0x9A, 0x38, 0x54, 0x03, 0x9A, 0x25, 0xA2, 0x31, 0xD1, 0x6B, 0xF0, 0x5F, 0xCA, 0xD0, 0x98, 0x8A, 
-0x93, 0x57, 0x87, 0xA2, 0xBA, 0x2E, 0xD2, 0x07, 0x29, 0x7A, 0x27, 0xA7, 0x18, 0xAE, 0x52, 0x05, 
-0xD2, 0xEA, 0x58, 0xD7, 0x87, 0xFE, 0xDA, 0x5A, 0x5F, 0xD7, 0x87, 0x7E, 0x41, 0x1F, 0x3E, 0xDC, 
-0x4B, 0x1F, 0xFA, 0xCB, 0xEA, 0xC3, 0x07, 0xF6, 0x61, 0x09, 0x7D, 0xF8, 0xF0, 0x28, 0xFA, 0xD0, 
-0xFF, 0x7F, 0xAE, 0x0F, 0x7D, 0x4D, 0x1F, 0x3E, 0xDC, 0x47, 0x1F, 0xB6, 0xC0, 0x99, 0xB5, 0x99, 
-0xAB, 0x23, 0x30, 0x41, 0x7B, 0xB1, 0xF3, 0x53, 0xF5, 0x48, 0xBD, 0x27, 0xDE, 0xAD, 0xCB, 0x2E, 
-0x2C, 0x30, 0xD3, 0x54, 0xE5, 0x0A, 0x38, 0xE6, 0x6F, 0xDB, 0x6C, 0x65, 0x7C, 0x7F, 0xAC, 0x32, 
-0xB4, 0x65, 0x1B, 0xB6, 0x72, 0x2E, 0x1F, 0xAB, 0x9C, 0xDC, 0x5A, 0x0D, 0x5B, 0x59, 0x27, 0x8F, 
-0x46, 0x93, 0xF1, 0xF6, 0xDE, 0x56, 0x14, 0x16, 0xA3, 0xBA, 0x7A, 0x8E, 0x72, 0x0F, 0x8A, 0xBF, 
-0xB0, 0xC0, 0x17, 0x16, 0xF5, 0x56, 0x5B, 0xFF, 0x50, 0x56, 0x90, 0x70, 0x3B, 0x38, 0xB6, 0x1F, 
-0xA2, 0x14, 0x03, 0xB8, 0x74, 0x11, 0x0B, 0x3A, 0xC9, 0x42, 0x49, 0x6F, 0x1F, 0x5A, 0x52, 0x19, 
-0xD3, 0xAE, 0x85, 0x7C, 0x14, 0x42, 0x96, 0xE7, 0xD5, 0xC5, 0xE2, 0xC7, 0xCB, 0x96, 0xBE, 0x34, 
-0x99, 0x8F, 0x5F, 0x01, 0xB1, 0x7C, 0xC2, 0x56, 0xF4, 0xB7, 0xC7, 0xD2, 0x4F, 0xF9, 0x8E, 0xD0, 
-0x56, 0xC8, 0xFE, 0x23, 0x16, 0xA2, 0xAF, 0x24, 0xB0, 0x95, 0xF5, 0xE9, 0x51, 0xCA, 0x12, 0x40, 
-0xDD, 0x95, 0x1A, 0x81, 0x09, 0xA5, 0xA6, 0x84, 0xC6, 0x05, 0xE5, 0x60, 0x60, 0x83, 0xD1, 0x22, 
-0x7D, 0x2D, 0x90, 0x13, 0xBE, 0xC9, 0x9F, 0xC4, 0x51, 0xFA, 0x4E, 0x1E, 0x02, 0x72, 0xE7, 0x7A, 
-0x00, 0xE6, 0x9C, 0xFF, 0xFA, 0x75, 0x05, 0xFE, 0x54, 0xA2, 0x8F, 0x27, 0x2F, 0x63, 0x3E, 0x51, 
-0x80, 0xA3, 0xD1, 0xB7, 0x31, 0xF8, 0x4F, 0x78, 0x28, 0x1A, 0x5C, 0x7C, 0xA0, 0x97, 0x80, 0xEC, 
-0x8F, 0xF0, 0xC3, 0xFA, 0x6F, 0xF4, 0x46, 0x32, 0xC6, 0x17, 0xA9, 0xF4, 0x22, 0xC7, 0x7C, 0x19, 
-0x9E, 0x7F, 0x91, 0x92, 0x64, 0xEF, 0x22, 0xFF, 0xC8, 0x25, 0x50, 0x43, 0xE5, 0xDC, 0x7B, 0xDE, 
-0x34, 0x77, 0xF8, 0x20, 0xEE, 0x19, 0x2D, 0xBC, 0xF5, 0x2D, 0xBC, 0xED, 0xCD, 0xBF, 0xE7, 0xC5, 
-0x53, 0xD9, 0x0C, 0xD2, 0xAE, 0x04, 0x69, 0xBF, 0x87, 0xAF, 0xD7, 0x7F, 0xAB, 0xFE, 0x71, 0x47, 
-0x6D, 0x7F, 0x5F, 0x50, 0x5B, 0x85, 0xF3, 0x46, 0xE0, 0xD4, 0xDF, 0x01, 0xB3, 0x77, 0x39, 0x9E, 
-0x5E, 0x8B, 0x44, 0xB4, 0x86, 0xE3, 0xD6, 0xAE, 0x18, 0x98, 0x9A, 0x7A, 0x96, 0xDE, 0x19, 0x5D, 
-0x2B, 0xEB, 0xDF, 0x1B, 0xF0, 0x87, 0x4A, 0xE0, 0xC7, 0x2C, 0x95, 0x43, 0xD3, 0xDE, 0x2E, 0x83, 
-0x01, 0xCC, 0x78, 0xA0, 0x4E, 0x08, 0xEC, 0x5D, 0x30, 0x19, 0xFD, 0xB8, 0xB7, 0xC7, 0x68, 0x80, 
-0x03, 0xE9, 0xF6, 0xD2, 0xE4, 0x42, 0x06, 0xB4, 0xEA, 0xBD, 0x63, 0x32, 0x96, 0xD5, 0xC7, 0x34, 
-0xBA, 0xBC, 0x04, 0x85, 0x2A, 0x86, 0xC0, 0x96, 0xBE, 0x3F, 0x37, 0xA2, 0xF3, 0xE2, 0xF8, 0x92, 
-0x3C, 0x36, 0x0A, 0x4F, 0xCE, 0xC6, 0xA1, 0xCF, 0x86, 0x21, 0x8F, 0x2C, 0x0C, 0x63, 0x4D, 0x11, 
-0xA2, 0xD0, 0xDF, 0xF4, 0x7B, 0x80, 0x2E, 0xF4, 0x36, 0x92, 0xE7, 0x73, 0xF9, 0xFA, 0x31, 0xC1, 
-0xD8, 0xAE, 0x18, 0x89, 0xF0, 0x73, 0xF2, 0xE5, 0x39, 0xF8, 0x6E, 0x93, 0xE7, 0x78, 0x45, 0x13, 
-0xE0, 0x78, 0x01, 0xE8, 0x12, 0xE0, 0x08, 0x5C, 0xA1, 0x07, 0xE3, 0xCA, 0xC0, 0x83, 0x70, 0xBF, 
-0x81, 0xC0, 0x17, 0x90, 0x63, 0xFC, 0x22, 0x14, 0x59, 0xC6, 0x3C, 0xCB, 0x10, 0xB2, 0xC8, 0x20, 
-0xFF, 0x11, 0xF8, 0x8B, 0x18, 0xE9, 0xD3, 0xA1, 0xF0, 0x91, 0x18, 0xE5, 0x75, 0x8A, 0x51, 0x5E, 
-0x87, 0x5F, 0x98, 0x0F, 0xDE, 0x99, 0x1A, 0xD1, 0xF0, 0x80, 0x5F, 0xC5, 0xA1, 0x4C, 0xAC, 0x92, 
-0xEC, 0x4E, 0x6D, 0x71, 0xB3, 0x13, 0x18, 0x6D, 0xE7, 0x3A, 0xE6, 0xDE, 0x6F, 0x4C, 0x9A, 0xA7, 
-0xDE, 0xEF, 0x4C, 0x2E, 0xF7, 0xEB, 0xFD, 0xC1, 0x0E, 0x62, 0x01, 0xFD, 0x27, 0x7B, 0x19, 0x5D, 
-0x9D, 0xC5, 0x68, 0xA7, 0x7B, 0x7F, 0x63, 0x47, 0x29, 0x72, 0x9E, 0x42, 0x06, 0xF6, 0x62, 0x30, 
-0x27, 0xCA, 0x9D, 0xE8, 0xC1, 0xB0, 0x5E, 0xB3, 0xE9, 0x3D, 0x18, 0xE2, 0x9B, 0x1D, 0x73, 0x0F, 
-0x74, 0x50, 0xAE, 0x04, 0xEC, 0x25, 0xFC, 0x9A, 0xE6, 0x2E, 0x7A, 0xF3, 0x98, 0xD1, 0x3A, 0xA5, 
-0xC3, 0xAB, 0x8B, 0xD3, 0x38, 0xDD, 0xA3, 0x50, 0x6A, 0xBD, 0x69, 0xCC, 0x4E, 0xC6, 0x83, 0x6F, 
-0xF4, 0x40, 0x2F, 0x75, 0x0C, 0xF0, 0x34, 0x9E, 0x0E, 0x8F, 0x51, 0xD1, 0x71, 0xE5, 0x83, 0x70, 
-0x9B, 0x72, 0x6A, 0x20, 0x89, 0xFE, 0x49, 0xDE, 0x1E, 0xC8, 0x12, 0x9D, 0xE9, 0x5E, 0xC2, 0xE8, 
-0xED, 0x70, 0x6F, 0x7E, 0x0B, 0x3F, 0x8E, 0xBB, 0x71, 0x91, 0x0C, 0xAF, 0x26, 0x71, 0x2D, 0xFE, 
-0x7E, 0x99, 0xA4, 0xF3, 0x99, 0xBE, 0xB2, 0x63, 0xE3, 0xFF, 0xFC, 0x5F, 0xDA, 0xEC, 0x09, 0xCC, 
-0x7F, 0x21, 0x01, 0x00, 
-};
-
@@ -1,106 +0,0 @@
-// JavaScript library tween-min.js.gz as HEX coded char array
-// The char array is stored in the PROGRAM memory
-
-constexpr char tween_min_js_gz[] PROGMEM = {
-0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC5, 0x57, 0x4B, 0x73, 0xDB, 0x36, 
-0x10, 0xBE, 0xE7, 0x57, 0xC8, 0x3E, 0x78, 0x00, 0x8A, 0xA4, 0x44, 0x26, 0x8A, 0x53, 0x49, 0xAC, 
-0x0E, 0x4D, 0x32, 0xE3, 0x99, 0x64, 0xEA, 0x69, 0x7D, 0xF3, 0x78, 0x3C, 0xB4, 0x04, 0xC9, 0x68, 
-0x15, 0x90, 0x03, 0x82, 0x76, 0x5C, 0x59, 0xFF, 0xBD, 0x8B, 0x17, 0x09, 0x3E, 0x64, 0x39, 0xE9, 
-0xA1, 0x27, 0x02, 0xE0, 0xEE, 0xB7, 0xBB, 0x1F, 0x76, 0x17, 0xC0, 0x9B, 0x37, 0x23, 0xCF, 0xF3, 
-0x06, 0x4B, 0xF6, 0xF0, 0xC4, 0xC3, 0x65, 0x51, 0x84, 0x9B, 0x7F, 0x06, 0xB0, 0x30, 0x7A, 0xB3, 
-0x2E, 0xD9, 0x52, 0xD0, 0x8C, 0x0D, 0x3E, 0x92, 0x2D, 0xD9, 0xA4, 0x82, 0x20, 0xBC, 0xDB, 0xDB, 
-0x71, 0xB8, 0xE4, 0x04, 0x3E, 0x89, 0x15, 0x42, 0xCC, 0x17, 0x78, 0xB7, 0xCE, 0x38, 0x7A, 0x48, 
-0xF9, 0x80, 0x27, 0xD7, 0x37, 0x7E, 0x99, 0xA4, 0x7C, 0x53, 0x7E, 0x23, 0x4C, 0x14, 0xE1, 0x96, 
-0xB0, 0x8D, 0xB8, 0xF7, 0x69, 0x12, 0xCF, 0xE8, 0xBC, 0x9C, 0xD1, 0xE1, 0x10, 0xF3, 0x6B, 0x1A, 
-0xC4, 0x37, 0xB5, 0xCC, 0x35, 0xBD, 0x99, 0x71, 0x22, 0x4A, 0xCE, 0x06, 0x15, 0x28, 0xDE, 0x49, 
-0x34, 0x0A, 0x68, 0xE1, 0x32, 0x63, 0xCB, 0x54, 0xA0, 0x4A, 0xDC, 0xE7, 0x78, 0x26, 0xC2, 0x34, 
-0xCF, 0xB7, 0x4F, 0x60, 0x9B, 0xE2, 0xFD, 0xDE, 0xBF, 0x7A, 0x24, 0x84, 0x35, 0x3C, 0xF2, 0xA9, 
-0xCF, 0xFD, 0xD2, 0x5F, 0xFB, 0x04, 0xEF, 0xC4, 0x3D, 0x2D, 0x42, 0xCA, 0xA8, 0x68, 0xFD, 0xD8, 
-0xCF, 0xA4, 0x0D, 0x91, 0x28, 0xED, 0x30, 0xE7, 0x99, 0xC8, 0xC4, 0x53, 0x4E, 0x00, 0x3C, 0xBB, 
-0xFB, 0x2B, 0xD9, 0xED, 0x7D, 0x21, 0x17, 0xF3, 0xE4, 0xF4, 0x14, 0x46, 0x12, 0xBC, 0x63, 0x01, 
-0xEF, 0x8C, 0xDF, 0xD4, 0x63, 0x23, 0x3E, 0x14, 0x52, 0xE5, 0x8E, 0x6C, 0x28, 0x4B, 0xC6, 0x30, 
-0x5A, 0xDE, 0xA7, 0x6C, 0x43, 0xD4, 0x30, 0xE7, 0xE4, 0xE1, 0x8A, 0x7E, 0xAB, 0x27, 0x97, 0x59, 
-0xA1, 0xC6, 0xDB, 0x2C, 0xCB, 0x29, 0xDB, 0x24, 0x27, 0x11, 0x4C, 0x6E, 0x57, 0x25, 0x4F, 0x25, 
-0xBE, 0xFA, 0x75, 0x2B, 0xAC, 0xC2, 0x6D, 0x6E, 0xA4, 0xE5, 0x80, 0xD6, 0x02, 0x85, 0x48, 0xB9, 
-0xA8, 0x60, 0x6F, 0xD7, 0x10, 0x63, 0x71, 0xAF, 0xC6, 0x2C, 0x85, 0x45, 0xE5, 0x77, 0x51, 0xAE, 
-0xD7, 0xF4, 0xBB, 0x99, 0xDC, 0x6E, 0x69, 0x21, 0x08, 0x23, 0xBC, 0x90, 0xDB, 0x04, 0x3F, 0x89, 
-0x56, 0xAF, 0xE3, 0x32, 0x6C, 0x55, 0xFE, 0xAA, 0x99, 0xF2, 0xC4, 0x67, 0xBF, 0xAA, 0xC9, 0x86, 
-0x88, 0x8F, 0xC6, 0x4D, 0x84, 0x17, 0x6A, 0xC9, 0x04, 0xB1, 0x40, 0x6A, 0xC6, 0xC9, 0x23, 0x65, 
-0x2B, 0xC4, 0x02, 0xAD, 0x6B, 0x63, 0xC2, 0xBE, 0x9A, 0x97, 0xF9, 0x4A, 0x25, 0x94, 0x9E, 0xDD, 
-0xF1, 0x2C, 0x5D, 0x2D, 0xD3, 0x42, 0x7C, 0x25, 0x45, 0x91, 0x6E, 0x08, 0x3A, 0xCD, 0xD8, 0xD7, 
-0x4C, 0x8A, 0x7F, 0x01, 0x4C, 0xB2, 0x3A, 0xF5, 0x77, 0x10, 0x23, 0x98, 0x9C, 0x4A, 0x71, 0x5F, 
-0x6E, 0xCF, 0xB4, 0x2D, 0xB2, 0xC7, 0x78, 0x8A, 0x6A, 0x3F, 0x93, 0xA6, 0xD9, 0x3E, 0xAB, 0x85, 
-0xC8, 0xF2, 0xE3, 0x1E, 0x7C, 0x56, 0x74, 0x1E, 0xF1, 0xA1, 0x12, 0x92, 0x5E, 0xB0, 0xF9, 0xB8, 
-0xC9, 0x41, 0x2B, 0xE6, 0xA6, 0x9F, 0x2D, 0xD7, 0xB0, 0x4C, 0x9E, 0x4D, 0x7B, 0x43, 0xAA, 0x0C, 
-0xAB, 0x15, 0xF7, 0x7A, 0xE3, 0xEC, 0x26, 0x74, 0x37, 0xAF, 0x4E, 0x23, 0x96, 0x24, 0x09, 0x2B, 
-0xB7, 0xDB, 0xE7, 0x67, 0x36, 0x4F, 0xC6, 0x8B, 0x88, 0x4C, 0xA6, 0xCC, 0x98, 0xE9, 0xAA, 0xB7, 
-0x4C, 0x59, 0x10, 0x63, 0xEE, 0xD2, 0x66, 0x5E, 0x6F, 0xAE, 0xC8, 0x74, 0xD6, 0x6A, 0x90, 0xA1, 
-0xA6, 0xAC, 0x34, 0xD5, 0x3A, 0xFD, 0x4E, 0x12, 0x48, 0xC0, 0x85, 0xBB, 0x32, 0x3D, 0x3D, 0x9D, 
-0xA9, 0x39, 0xD4, 0xDA, 0xB5, 0xC1, 0xC9, 0xF2, 0x9B, 0xE4, 0x6B, 0x2A, 0xEE, 0x43, 0x9E, 0x95, 
-0x32, 0x83, 0xF0, 0x50, 0xF8, 0x15, 0xAA, 0xE5, 0xEB, 0xF0, 0x86, 0xFD, 0xA6, 0xEA, 0xED, 0xE5, 
-0xFD, 0xB2, 0x32, 0x7B, 0x4B, 0x77, 0x6F, 0x5C, 0x86, 0x08, 0x49, 0x1F, 0x38, 0x42, 0xA0, 0xB0, 
-0xC8, 0xEA, 0xEC, 0x0C, 0x31, 0xA7, 0x1C, 0xCC, 0xD6, 0x4A, 0x2D, 0x64, 0x3D, 0x93, 0x95, 0xAF, 
-0x87, 0xBA, 0xF4, 0xFD, 0x56, 0x05, 0x18, 0x2A, 0x75, 0xCE, 0x74, 0x89, 0x34, 0xFD, 0xC2, 0x14, 
-0x8E, 0x42, 0x33, 0x4E, 0xB6, 0x35, 0x9A, 0x5B, 0xA5, 0x24, 0x87, 0x0E, 0x84, 0xD4, 0x92, 0xFD, 
-0xEE, 0x60, 0x47, 0x6C, 0xB7, 0x67, 0x88, 0x4D, 0xBB, 0xDA, 0xEC, 0x0F, 0x72, 0x29, 0x5D, 0xAD, 
-0xBE, 0x98, 0x45, 0x25, 0x83, 0x7D, 0x62, 0xA5, 0x6D, 0x6B, 0xB1, 0x5C, 0xC8, 0xAE, 0x69, 0xE2, 
-0x57, 0x7D, 0x53, 0x38, 0xB4, 0x24, 0xDC, 0xD9, 0x49, 0x33, 0x76, 0x92, 0x18, 0xAD, 0xB1, 0x4F, 
-0x4F, 0x74, 0xB2, 0x9E, 0x9D, 0x51, 0x95, 0x2E, 0xD6, 0x8C, 0xEA, 0xBC, 0x14, 0x57, 0x3A, 0x9A, 
-0x0C, 0x54, 0xEA, 0x8A, 0x51, 0x3D, 0xD0, 0x65, 0xA6, 0xA7, 0xFE, 0x94, 0xCC, 0x27, 0x26, 0x08, 
-0xFF, 0xCC, 0xA1, 0x31, 0x1E, 0x2F, 0xFD, 0x3F, 0xA5, 0xC2, 0x91, 0x4C, 0xB2, 0x32, 0x3A, 0x93, 
-0xB4, 0xC1, 0xEE, 0x9E, 0xBA, 0xAD, 0xC6, 0x94, 0xBD, 0x9B, 0x54, 0x8B, 0xF1, 0xD4, 0x30, 0x06, 
-0x4C, 0xCA, 0xCA, 0x6F, 0xB7, 0x0C, 0x89, 0xBD, 0x86, 0xC3, 0xF5, 0x31, 0xE5, 0xAB, 0x4E, 0x94, 
-0x87, 0xFB, 0xDD, 0x0B, 0x68, 0x7A, 0xDC, 0xC1, 0x72, 0x4A, 0x1C, 0xD9, 0x3E, 0xDF, 0x5C, 0xD0, 
-0x69, 0x5F, 0x93, 0x5E, 0x13, 0xDA, 0x05, 0x83, 0xA8, 0xBB, 0x7C, 0xD3, 0xE2, 0x72, 0x9B, 0x3E, 
-0xA9, 0xD3, 0x6E, 0x6C, 0x32, 0x86, 0xB9, 0x52, 0x12, 0xD9, 0x5D, 0xE9, 0xC0, 0x56, 0x00, 0x36, 
-0x35, 0x18, 0xF9, 0x2E, 0xAC, 0x09, 0x73, 0x96, 0x65, 0xA5, 0x40, 0xAD, 0xAB, 0x0A, 0xD2, 0xBB, 
-0xD7, 0x36, 0x88, 0xFD, 0x78, 0xA2, 0xC3, 0xA9, 0x60, 0xFA, 0x58, 0x51, 0x3C, 0x56, 0x94, 0xC8, 
-0x19, 0x47, 0xD8, 0x9C, 0x6D, 0xD5, 0x01, 0x8C, 0x47, 0x11, 0x79, 0x6B, 0xA8, 0x81, 0xCC, 0x7F, 
-0x1D, 0x1F, 0x2F, 0xE5, 0x5F, 0x96, 0x1F, 0x3B, 0xFD, 0xAC, 0xCC, 0xBE, 0x32, 0xFB, 0x1A, 0xE6, 
-0xE0, 0xA2, 0xA1, 0xEE, 0x35, 0x66, 0xD6, 0xED, 0x28, 0x95, 0xA4, 0xDE, 0x0F, 0xB8, 0x7C, 0x09, 
-0xCA, 0x4A, 0x72, 0x95, 0xB5, 0x2E, 0x7C, 0x4E, 0x69, 0x57, 0x85, 0xDD, 0x2E, 0x51, 0x7B, 0xE6, 
-0x57, 0xC9, 0x79, 0xD2, 0xE8, 0xA7, 0x9D, 0x26, 0x20, 0xDC, 0x7A, 0x45, 0xA6, 0xAE, 0x8A, 0xB2, 
-0x27, 0x9E, 0x56, 0x7E, 0xFF, 0x70, 0x81, 0xFF, 0xA1, 0x60, 0x5F, 0x26, 0xD8, 0xCA, 0x68, 0x82, 
-0x9F, 0xB2, 0xA7, 0xAC, 0xE3, 0x46, 0xCD, 0x0E, 0x6A, 0x9F, 0x00, 0xBA, 0x5A, 0xA4, 0xA6, 0xD3, 
-0x41, 0xFB, 0x0E, 0x19, 0xD3, 0xAF, 0xBE, 0x65, 0x0F, 0xA4, 0x6A, 0xB4, 0x15, 0x71, 0x55, 0x3F, 
-0x0E, 0xF3, 0x52, 0x11, 0xAA, 0x39, 0x71, 0x85, 0x1B, 0x98, 0xF6, 0x1A, 0x6E, 0x4E, 0xDF, 0x5A, 
-0x1F, 0x2E, 0xE0, 0xC2, 0x34, 0xFB, 0x19, 0x0D, 0x82, 0x19, 0xA6, 0x6B, 0x24, 0xE0, 0xE2, 0x2D, 
-0x2F, 0x08, 0xD8, 0x7A, 0x12, 0x16, 0xF9, 0x96, 0x2E, 0x09, 0xA2, 0x7E, 0x84, 0xFD, 0x93, 0xB1, 
-0xB9, 0x94, 0xEB, 0x8C, 0x69, 0x73, 0xE9, 0x72, 0x61, 0xAD, 0xCA, 0xEB, 0x3A, 0x1C, 0x32, 0x5D, 
-0xE3, 0x65, 0x65, 0xDC, 0x87, 0xAB, 0xEB, 0x8C, 0xCD, 0xDB, 0x07, 0xD0, 0x8C, 0xC1, 0xBB, 0x80, 
-0xEA, 0x20, 0xEB, 0x77, 0x01, 0xBB, 0xC1, 0x33, 0x89, 0xCD, 0x13, 0x1A, 0x16, 0xF7, 0x74, 0x0D, 
-0x39, 0x61, 0xF4, 0x4B, 0xA5, 0x20, 0x40, 0xE2, 0x9A, 0xDF, 0x40, 0x26, 0xE9, 0x81, 0x79, 0x14, 
-0xC8, 0x99, 0x7C, 0x17, 0xC8, 0xD6, 0xA9, 0xF3, 0xA4, 0xDB, 0x39, 0xEB, 0xAB, 0x73, 0x7F, 0x65, 
-0xCB, 0xDD, 0xF3, 0xA0, 0xA6, 0x9D, 0x4B, 0x19, 0xEF, 0x56, 0xCB, 0x90, 0x91, 0xC7, 0xC1, 0x47, 
-0x68, 0x31, 0x8E, 0x96, 0x79, 0x8D, 0x84, 0x77, 0xE9, 0xF2, 0xEF, 0x4F, 0x69, 0x41, 0x2E, 0xBA, 
-0x0F, 0x13, 0xFD, 0xB8, 0x21, 0x49, 0x14, 0x9E, 0x8F, 0xA3, 0xC9, 0x87, 0x59, 0xF5, 0x88, 0x40, 
-0x6C, 0x94, 0x70, 0xEC, 0x31, 0x0F, 0x21, 0x32, 0x8C, 0x60, 0x10, 0x10, 0x2C, 0x5F, 0x15, 0x4D, 
-0xC4, 0xDF, 0xCB, 0xEE, 0xC9, 0x7E, 0x18, 0x12, 0x6E, 0x2D, 0xF0, 0x36, 0x09, 0x22, 0x17, 0x76, 
-0x08, 0xB0, 0x51, 0x0F, 0xF2, 0x05, 0x7B, 0x3D, 0xB6, 0xF2, 0x75, 0x14, 0xE3, 0x79, 0xB4, 0xA0, 
-0xA3, 0x18, 0xC0, 0x25, 0x3C, 0x22, 0x1E, 0x88, 0x4D, 0xA0, 0xB1, 0xD6, 0xEE, 0x4F, 0xE5, 0x6F, 
-0x70, 0x23, 0x48, 0x62, 0xDC, 0x27, 0x24, 0x9D, 0x89, 0x1D, 0x67, 0xC8, 0x16, 0xB2, 0x8C, 0x2E, 
-0x0F, 0x70, 0x27, 0xAF, 0x30, 0xC6, 0xA1, 0x99, 0x73, 0x4D, 0x1B, 0x2F, 0xC4, 0x54, 0xB3, 0x97, 
-0x24, 0xD1, 0x42, 0x0C, 0xE9, 0x14, 0xAD, 0x9F, 0x9F, 0xD1, 0x3A, 0xE1, 0x5E, 0xF8, 0x16, 0x92, 
-0xB9, 0x7C, 0x7E, 0x2E, 0xE7, 0xEA, 0x6E, 0x99, 0xDE, 0x15, 0x88, 0xE2, 0x05, 0x2A, 0x13, 0xEA, 
-0x43, 0x62, 0x8C, 0xDE, 0xE1, 0xA9, 0xFC, 0xA0, 0xD8, 0x53, 0xBF, 0x2F, 0x2F, 0xB0, 0x1E, 0xA4, 
-0x05, 0x65, 0x88, 0x8E, 0x4A, 0xEC, 0x07, 0xA8, 0xD4, 0x4B, 0x79, 0xF6, 0x88, 0x62, 0x3F, 0x1A, 
-0x7B, 0x32, 0x98, 0x08, 0x1B, 0x41, 0x29, 0x87, 0x98, 0xC7, 0x21, 0x58, 0xAF, 0x02, 0x19, 0xAD, 
-0x31, 0x84, 0x84, 0x7B, 0x62, 0xEA, 0x63, 0xF8, 0x7F, 0x08, 0xAA, 0x11, 0x52, 0x00, 0x31, 0xB1, 
-0x23, 0xE1, 0x0C, 0x69, 0x7F, 0x3C, 0xFD, 0x39, 0x73, 0x2C, 0x22, 0x48, 0x9C, 0x24, 0x89, 0xDB, 
-0x31, 0x79, 0x90, 0x16, 0xFF, 0x31, 0x2E, 0x36, 0x8F, 0xF0, 0x22, 0x08, 0x27, 0xDE, 0x4F, 0xED, 
-0x19, 0x64, 0x6B, 0x87, 0x98, 0x57, 0x29, 0x7A, 0xE1, 0x44, 0x12, 0x54, 0x15, 0x14, 0x3C, 0x60, 
-0x96, 0xE4, 0x70, 0xB1, 0x3A, 0x25, 0x04, 0x05, 0x34, 0x8A, 0xC3, 0xF3, 0xC9, 0x82, 0x7A, 0xE7, 
-0xE1, 0xE4, 0x7D, 0x3C, 0x91, 0xA5, 0x04, 0x7E, 0xB0, 0x79, 0x6C, 0xD7, 0x91, 0xF9, 0xA1, 0x3C, 
-0x09, 0x27, 0x6A, 0x59, 0x16, 0x8E, 0xFC, 0x68, 0x49, 0xB3, 0xD8, 0x92, 0x8D, 0xC3, 0xD8, 0x11, 
-0xFE, 0xE5, 0xAD, 0x16, 0x6F, 0xCB, 0xBC, 0x6F, 0x08, 0x7D, 0x78, 0xA7, 0xC5, 0xBA, 0x91, 0xF4, 
-0x36, 0x32, 0xDB, 0x67, 0x82, 0x9E, 0xB8, 0x11, 0x0F, 0x98, 0x3F, 0x56, 0x72, 0xFD, 0x78, 0x2F, 
-0x71, 0x33, 0x60, 0x73, 0x48, 0x92, 0x45, 0x57, 0x09, 0xD8, 0x8F, 0x0D, 0xAA, 0x24, 0x5D, 0x4C, 
-0xFB, 0x2C, 0x83, 0x4C, 0xC0, 0x1D, 0x29, 0xAA, 0x44, 0xAD, 0x0F, 0x85, 0xE0, 0x19, 0xDB, 0xBC, 
-0xC2, 0x07, 0xA7, 0x23, 0x33, 0xBD, 0x2D, 0x16, 0x82, 0x93, 0x4D, 0xB9, 0x4D, 0xF9, 0x51, 0x5E, 
-0x2A, 0x80, 0x5E, 0xD5, 0x97, 0x8C, 0x07, 0x95, 0x2E, 0x6C, 0x93, 0xDB, 0x1F, 0x1B, 0xA6, 0x8F, 
-0xA6, 0x57, 0xA3, 0x43, 0x03, 0x5B, 0x81, 0xEA, 0xC6, 0x41, 0xC0, 0x34, 0x6C, 0xE0, 0x1E, 0x03, 
-0x2E, 0x2F, 0x3F, 0x43, 0x4A, 0xAD, 0x7F, 0x8C, 0x55, 0xF7, 0x50, 0xD2, 0x20, 0x87, 0xFC, 0xF8, 
-0xB1, 0x00, 0xAD, 0x47, 0xAD, 0x33, 0x47, 0xAF, 0x2A, 0x12, 0xFF, 0x05, 0xFA, 0xBE, 0xAE, 0x64, 
-0xF5, 0x14, 0x00, 0x00
-};
-
@@ -1,5 +1,5 @@
 // Gauge instrument webpage
-String Windi()
+void Windi(PageWriter &content)
 {
  // Debug info 
  DebugPrintln(3, "Send windi.html");
@@ -41,14 +41,19 @@ String Windi()
  }
  
  // Page content with outo reload (polling)
- String content;
  content += F("<!DOCTYPE html>");
  content += F("<html>");
  content += F("<head>");
  content += F("<title>Windsensor Instrument</title>");
- content += F("<link rel='stylesheet' type='text/css' href='/css'>");
- content += F("<script src='/tween-min.js' type='text/javascript'></script>");
- content += F("<script src='/steelseries_micro.js' type='text/javascript'></script>");
+ content += F("<link rel='stylesheet' type='text/css' href='");
+ content += cssAsset().path;
+ content += F("'>");
+ content += F("<script src='");
+ content += staticAssets[ASSET_TWEEN_MIN_JS].path;
+ content += F("' type='text/javascript'></script>");
+ content += F("<script src='");
+ content += staticAssets[ASSET_STEELSERIES_MICRO_JS].path;
+ content += F("' type='text/javascript'></script>");
  content += F("<meta http-equiv='content-type' content='text/html; charset=UTF-8'>");
  content += F("<meta name=viewport content='width=device-width, initial-scale=1'>");
  content += F("<style>");
@@ -273,21 +278,24 @@ String Windi()
  content += F("windGauge.setValueAnimatedLatest(0);");
  content += F("}");
 
- // Read all JSON data strings
- content += F("var xmlhttp = new XMLHttpRequest();");
- content += F("xmlhttp.onreadystatechange = function() {");
- content += F("if (this.readyState == 4 && this.status == 200) {");
- content += F("var myObj = JSON.parse(this.responseText);");
- content += F("windtype = myObj.Device.DeviceSettings.WindType;");
- content += F("winddir = myObj.Device.MeasuringValues.WindDirection.Value;");
+ // Show the wind record of one calculation cycle
+ content += F("function show_values(myObj) {");
+ content += F("windtype = '");
+ content += String(actconf.windType);
+ content += F("';");
+ content += F("winddir = myObj.WindDirection;");
  content += F("winddir = Math.round(winddir*10)/10;");
- content += F("dirunit = myObj.Device.MeasuringValues.WindDirection.Unit;");
- content += F("windspeed = myObj.Device.MeasuringValues.WindSpeed.Value;");
+ content += F("dirunit = '°';");
+ content += F("windspeed = myObj.WindSpeed;");
  content += F("windspeed = Math.round(windspeed*10)/10;");
- content += F("speedunit = myObj.Device.MeasuringValues.WindSpeed.Unit;");
- content += F("document.getElementById('quality').innerHTML = myObj.Device.NetworkParameter.ConnectionQuality.Value;");
+ content += F("speedunit = '");
+ content += String(actconf.speedUnit);
+ content += F("';");
+ content += F("document.getElementById('quality').innerHTML = myObj.ConnectionQuality;");
  // If Demo Mode active the give out a message
- content += F("servermode = myObj.Device.NetworkParameter.ServerMode;");
+ content += F("servermode = ");
+ content += String(actconf.serverMode);
+ content += F(";");
  content += F("if (servermode == 4) {");
  content += F("document.getElementById('info').innerHTML = '(Demo Mode)';");
  content += F("}");
@@ -295,7 +303,9 @@ String Windi()
  content += F("document.getElementById('info').innerHTML = '';");
  content += F("}");
  
- content += F("itype = myObj.Device.DisplaySettings.InstrumentType;");
+ content += F("itype = '");
+ content += String(actconf.instrumentType);
+ content += F("';");
  // Complex Instrument
  content += F("if(internet == 1 && itype == 'complex'){");
  content += F("if(flag == 0){");
@@ -320,14 +330,14 @@ String Windi()
  content += F("if(internet == 0 || itype == 'simple'){");
  content += F("simple_instrument();");
  content += F("}");
- content += F("}");
  content += F("};");
  
- // Load JSON data
- content += F("function read_json() {");
-// content += F("xmlhttp.open('GET', 'http://192.168.4.1/json', true);");
- content += F("xmlhttp.open('GET', '/json', true);");
- content += F("xmlhttp.send();");
+ // Wind values are pushed by the device with each new calculation cycle (Server-Sent Events)
+ content += F("function read_events() {");
+ content += F("var source = new EventSource('/events');");
+ content += F("source.onmessage = function(e) {show_values(JSON.parse(e.data));};");
+ // All event slots used or connection closed, try again later
+ content += F("source.onerror = function() {if (source.readyState == 2) {setTimeout(read_events, 5000);}};");
  content += F("};");
 
  // Check the internet status
@@ -339,12 +349,14 @@ String Windi()
  // Open the webside from GitLab for internet connection check
  content += F("function check_internet() {");
 // content += F("xmlhttp2.open('GET', 'http://192.168.4.1/tween-min.js', true);");
- content += F("xmlhttp2.open('GET', '/tween-min.js', true);");
+ content += F("xmlhttp2.open('GET', '");
+ content += staticAssets[ASSET_TWEEN_MIN_JS].path;
+ content += F("', true);");
  content += F("xmlhttp2.send();");
  content += F("};");
 
  content += F("check_internet();");
- content += F("setInterval(function(){read_json(); }, 1000);");
+ content += F("read_events();");
 
  
  
@@ -357,6 +369,4 @@ String Windi()
  
  content += F("</body>");
  content += F("</html>");
- 
- return content;
 }
@@ -0,0 +1,265 @@
+// Wind direction on the unit circle: CircularMean, the weighted direction average of buildaverage() and the
+// max deviation clamp of calculationData(), random angles across 0°/360° against a vector sum reference
+
+#include "Arduino.h"
+#include "Configuration.h"
+#include "CircularMean.h"
+#include "WindSnapshot.h"
+#include <unity.h>
+#include <random>
+#include <vector>
+
+extern configData actconf;
+extern SeqLock<WindSnapshot> windData;
+extern volatile int average;
+extern volatile float timearray1[10];
+extern volatile float timearray2[10];
+extern volatile float time1_avg;
+extern volatile float time2_avg;
+extern volatile float winddir_avg;
+extern volatile float winddir_dev;
+extern volatile float winddirection_old;
+
+void buildaverage();
+void calculationData();
+
+#define RANDOM_SETS 20000
+
+static std::mt19937 rng(19);
+
+void setUp()
+{
+  actconf.debug = 0;
+  actconf.serverMode = 0;
+  actconf.windSensorType = WIND_SENSOR_WIFI_1000;
+  actconf.offset = 0;
+  actconf.dirWeighting = 0;
+  strcpy(actconf.tempSensorType, "Off");
+}
+
+void tearDown() {}
+
+// Uniform random number low...high
+static double uniform(double low, double high)
+{
+  return low + (high - low) * (rng() / 4294967295.0);
+}
+
+// Angle 0...360°
+static double wrap(double degrees)
+{
+  degrees = fmod(degrees, 360);
+  return degrees < 0 ? degrees + 360 : degrees;
+}
+
+// Distance of two angles on the circle 0...180°
+static double distance(double a, double b)
+{
+  double d = fabs(wrap(a) - wrap(b));
+  return d > 180 ? 360 - d : d;
+}
+
+// Vector sum of weighted angles
+class Reference
+{
+public:
+  void add(double degrees, double weight)
+  {
+    _sin += weight * sin(degrees * DEG_TO_RAD);
+    _cos += weight * cos(degrees * DEG_TO_RAD);
+    _weight += weight;
+  }
+
+  double direction() const { return wrap(atan2(_sin, _cos) * RAD_TO_DEG); }
+  double length() const { return sqrt(_sin * _sin + _cos * _cos) / _weight; }
+  double deviation() const { return sqrt(-2 * log(length())) * RAD_TO_DEG; }
+
+private:
+  double _sin = 0;
+  double _cos = 0;
+  double _weight = 0;
+};
+
+// Angles around a center near north, spread up to ±60° so the set straddles 0°/360°
+static std::vector<double> northAngles(int count, double &center)
+{
+  center = wrap(uniform(-20, 20));
+  double spread = uniform(1, 60);
+  std::vector<double> angles;
+  for (int i = 0; i < count; i++)
+  {
+    angles.push_back(wrap(center + uniform(-spread, spread)));
+  }
+  return angles;
+}
+
+void test_mean_across_north()
+{
+  for (int n = 0; n < RANDOM_SETS; n++)
+  {
+    double center;
+    std::vector<double> angles = northAngles(1 + rng() % 20, center);
+    bool weighted = rng() % 2;
+    CircularMean mean;
+    CircularMean first;
+    CircularMean second;
+    Reference reference;
+    for (size_t i = 0; i < angles.size(); i++)
+    {
+      double weight = weighted ? uniform(0.1, 10) : 1;
+      mean.add(float(angles[i]), float(weight));
+      (i % 2 ? first : second).add(float(angles[i]), float(weight));
+      reference.add(angles[i], weight);
+    }
+    char message[48];
+    snprintf(message, sizeof(message), "set %d", n);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(angles.size(), mean.count(), message);
+    TEST_ASSERT_TRUE_MESSAGE(mean.direction() >= 0 && mean.direction() < 360, message);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.01, 0, distance(reference.direction(), mean.direction()), message);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.0001, reference.length(), mean.length(), message);
+    if (reference.length() < 0.99999)
+    {
+      TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.05, reference.deviation(), mean.deviation(), message);
+    }
+    else
+    {
+      TEST_ASSERT_TRUE_MESSAGE(mean.deviation() < 0.5f, message);  // float resolution of R near 1
+    }
+    // The mean of a set straddling north stays near north, a linear mean would be near 180°
+    TEST_ASSERT_TRUE_MESSAGE(distance(center, mean.direction()) <= 60, message);
+    // Two partial means added give the same mean
+    first.add(second);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.01, 0, distance(mean.direction(), first.direction()), message);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.01, mean.deviation(), first.deviation(), message);
+  }
+}
+
+void test_mean_special_sets()
+{
+  CircularMean mean;
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, mean.direction());
+  TEST_ASSERT_EQUAL_FLOAT(180.0f, mean.deviation());          // No values
+  mean.add(350);
+  mean.add(10);
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 0, distance(0, mean.direction()));
+  TEST_ASSERT_FLOAT_WITHIN(0.01, sqrt(-2 * log(cos(10 * DEG_TO_RAD))) * RAD_TO_DEG, mean.deviation());
+  mean.clear();
+  mean.add(359.5f);
+  mean.add(359.5f);
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 359.5, mean.direction());
+  TEST_ASSERT_FLOAT_WITHIN(0.5, 0, mean.deviation());
+  mean.clear();
+  mean.add(90);
+  mean.add(270);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 0, mean.length());          // No preferred direction
+}
+
+// Rotations with direction times across north through buildaverage(), weighted with the rotation speed
+// 1 / time1 (dirWeighting = 1) or equal
+void test_buildaverage_direction_weighting()
+{
+  for (int n = 0; n < RANDOM_SETS / 10; n++)
+  {
+    double center;
+    int count = 1 + rng() % 10;
+    std::vector<double> angles = northAngles(count, center);
+    actconf.average = count;
+    actconf.dirWeighting = rng() % 2;
+    Reference reference;
+    for (int i = 0; i < count; i++)
+    {
+      float time1 = float(uniform(20, 900));
+      timearray1[i] = time1;
+      timearray2[i] = float(angles[i] / 360 * time1);
+      reference.add(timearray2[i] / time1 * 360, actconf.dirWeighting == 1 ? 1000 / time1 : 1);
+    }
+    buildaverage();
+    char message[48];
+    snprintf(message, sizeof(message), "set %d weighting %d", n, actconf.dirWeighting);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(count, average, message);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.01, 0, distance(reference.direction(), winddir_avg), message);
+    if (reference.length() < 0.99999)
+    {
+      TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.05, reference.deviation(), winddir_dev, message);
+    }
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.01, winddir_avg / 360 * time1_avg, time2_avg, message);
+  }
+  // A fast rotation counts more with weighting: 10° at 50 ms against 300° at 500 ms
+  actconf.average = 2;
+  timearray1[0] = 50;
+  timearray2[0] = 50 * 10 / 360.0f;
+  timearray1[1] = 500;
+  timearray2[1] = 500 * 300 / 360.0f;
+  actconf.dirWeighting = 0;
+  buildaverage();
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 335, winddir_avg);
+  actconf.dirWeighting = 1;
+  buildaverage();
+  TEST_ASSERT_TRUE(distance(10, winddir_avg) < 10);
+}
+
+// Wind direction of one calculation cycle with the WiFi 1000 direction mean
+static float cycle(float direction)
+{
+  time1_avg = 100;
+  time2_avg = direction / 360 * 100;
+  winddir_avg = direction;
+  winddir_dev = 0;
+  calculationData();
+  return windData.read().winddirection;
+}
+
+// The change between two cycles is limited to maxwinddirdev (45°) the shortest way, also across 0°/360°
+void test_max_deviation_clamp()
+{
+  const float limit = 45;
+  struct {
+    float old;
+    float direction;
+    float expected;
+  } cases[] = {
+    {350, 20, 20},                          // +30° across north, not limited
+    {10, 300, 325},                         // -70° across north, limited to -45°
+    {340, 100, 25},                         // +120° across north, limited to +45°
+    {20, 350, 350},                         // -30° across north
+    {100, 200, 145},
+    {200, 100, 155},
+  };
+  for (auto &c : cases)
+  {
+    winddirection_old = c.old;
+    TEST_ASSERT_FLOAT_WITHIN(0.001, c.expected, cycle(c.direction));
+    TEST_ASSERT_EQUAL_FLOAT(c.expected, winddirection_old);
+  }
+  for (int n = 0; n < RANDOM_SETS; n++)
+  {
+    float old = float(uniform(0, 360));
+    float direction = float(wrap(old + uniform(-179, 179)));
+    winddirection_old = old;
+    float result = cycle(direction);
+    double change = distance(old, direction);
+    char message[64];
+    snprintf(message, sizeof(message), "old %.3f direction %.3f", old, direction);
+    TEST_ASSERT_TRUE_MESSAGE(result >= 0 && result < 360, message);
+    if (change <= limit)
+    {
+      TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.001, 0, distance(direction, result), message);
+    }
+    else
+    {
+      // Moved by the limit from the old value towards the new one
+      TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.001, limit, distance(old, result), message);
+      TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.001, change - limit, distance(result, direction), message);
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_mean_across_north);
+  RUN_TEST(test_mean_special_sets);
+  RUN_TEST(test_buildaverage_direction_weighting);
+  RUN_TEST(test_max_deviation_clamp);
+  return UNITY_END();
+}
@@ -0,0 +1,373 @@
+// Gust detection on the firmware path: interrupt routine -> pulseRing -> processPulses() -> GustDetector ->
+// windowStatistics(), against a brute-force reference over all recorded edges
+
+#include "Arduino.h"
+#include "Configuration.h"
+
+// Critical sections of the firmware on ESP8266 (Definitions.h has the globals and is not included)
+#define NO_INTERRUPTS noInterrupts()
+#define INTERRUPTS interrupts()
+
+#include "GustDetector.h"
+#include "PulseRing.h"
+#include "WindSnapshot.h"
+#include <unity.h>
+#include <random>
+#include <vector>
+
+extern configData actconf;
+extern PulseRing<64> pulseRing;
+extern GustDetector gust;
+extern WindowStats windStats;
+extern SeqLock<WindSnapshot> windData;
+extern volatile int marker1;
+extern volatile int marker2;
+extern volatile int average;
+extern volatile float timearray1[10];
+extern volatile float timearray2[10];
+extern bool speedEdgeSeen;
+
+void interruptRoutine1();
+void processPulses();
+void buildaverage();
+void calculationData();
+void windowStatistics(WindSnapshot &wd);
+float windSpeedMps(float hz);
+
+#define TICK 50000                  // Average building in [us]
+#define CYCLE 10                    // Ticks per calculation cycle (500ms)
+#define SAMPLE_TICKS 5              // Ticks per sample of the 3s mean (250ms)
+
+// Pulses per round of the sensor types
+typedef struct {
+  WindSensorType type;
+  int pulses;
+} sensorPulses;
+
+const sensorPulses sensorTypes[] = {
+  {WIND_SENSOR_WIFI_1000, 1},
+  {WIND_SENSOR_YACHTA, 2},
+  {WIND_SENSOR_YACHTA_2_0, 2},
+  {WIND_SENSOR_JUKOLEIN, 2},
+  {WIND_SENSOR_VENTUS, 1},
+  {WIND_SENSOR_SEDNAV_C6, 2},
+};
+
+static uint64_t now = 1000000000ULL;
+
+// Start of the measurement with the sensor type, the clock continues over the tests
+static void restart(WindSensorType type)
+{
+  actconf.windSensorType = type;
+  native::setMicros(now);
+  pulseEvent event;
+  while (pulseRing.pop(event))
+  {
+  }
+  marker1 = 0;
+  marker2 = 0;
+  speedEdgeSeen = false;
+  for (int i = 0; i < 10; i++)
+  {
+    timearray1[i] = 0;
+    timearray2[i] = 0;
+  }
+  gust.begin(micros());
+  windStats.begin(millis());
+}
+
+void setUp()
+{
+  actconf.debug = 0;
+  actconf.serverMode = 0;
+  actconf.average = 1;
+  average = 1;
+  actconf.calslope = 1.0;
+  actconf.caloffset = 0.0;
+  strcpy(actconf.tempSensorType, "Off");
+}
+
+void tearDown() {}
+
+// Edges through the interrupt routine up to the tick, then the average building of the tick
+// Returns the number of the edges handed over
+static size_t tick(const std::vector<uint64_t> &edges, size_t next)
+{
+  now += TICK;
+  while (next < edges.size() && edges[next] <= now)
+  {
+    native::setMicros(edges[next++]);
+    interruptRoutine1();
+  }
+  native::setMicros(now);
+  buildaverage();
+  return next;
+}
+
+// Equal spaced edges from start on
+static std::vector<uint64_t> steadyEdges(uint64_t start, uint32_t period, uint32_t count)
+{
+  std::vector<uint64_t> edges;
+  for (uint32_t i = 0; i < count; i++)
+  {
+    edges.push_back(start + uint64_t(i) * period);
+  }
+  return edges;
+}
+
+// Steady wind of 5 rounds per second, the 10min max gust is the wind speed for all pulses per round
+void test_steady_wind_all_sensor_types()
+{
+  for (const sensorPulses &s : sensorTypes)
+  {
+    restart(s.type);
+    std::vector<uint64_t> edges = steadyEdges(now + 1000, 200000 / s.pulses, 30 * 5 * s.pulses);
+    size_t next = 0;
+    for (int t = 1; next < edges.size(); t++)
+    {
+      next = tick(edges, next);
+      if (t % CYCLE == 0)
+      {
+        calculationData();
+      }
+    }
+    WindSnapshot wd = windData.read();
+    char message[32];
+    snprintf(message, sizeof(message), "sensor type %d", int(s.type));
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.001f, 5.0f, wd.windspeed_hz, message);
+    TEST_ASSERT_TRUE_MESSAGE(wd.windspeed_mps > 0, message);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.01f, wd.windspeed_mps, wd.gust10, message);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.01f, wd.windspeed_mps, wd.gust, message);
+  }
+}
+
+// Step of the pulse rate from 5 Hz to 20 Hz, the 3s mean has only the new rate 3s after the step
+// and is 0 3s after the last edge
+void test_gust_window_is_3s()
+{
+  restart(WIND_SENSOR_WIFI_1000);
+  std::vector<uint64_t> edges = steadyEdges(now, 200000, 100);
+  uint64_t step = edges.back();
+  for (uint64_t t = step + 50000; t <= step + 6000000; t += 50000)
+  {
+    edges.push_back(t);
+  }
+  for (uint64_t e : edges)
+  {
+    native::setMicros(e);
+    interruptRoutine1();
+    processPulses();
+    if (e < step)
+    {
+      TEST_ASSERT_FLOAT_WITHIN(0.01f, e > edges[0] ? 5.0f : 0.0f, gust.mean());
+      continue;
+    }
+    uint64_t since = e - step;
+    if (since == 1500000)
+    {
+      TEST_ASSERT_FLOAT_WITHIN(0.01f, 38 / 3.1f, gust.mean());  // 30 pulses of 50ms and 8 of 200ms
+    }
+    if (since >= 3000000)
+    {
+      TEST_ASSERT_FLOAT_WITHIN(0.01f, 20.0f, gust.mean());
+    }
+    else
+    {
+      TEST_ASSERT_TRUE(gust.mean() < 19.99f);
+    }
+  }
+  uint64_t last = edges.back();
+  native::setMicros(last + GUST_WINDOW - 1);
+  gust.tick(micros());
+  TEST_ASSERT_TRUE(gust.mean() > 0);
+  native::setMicros(last + GUST_WINDOW);
+  gust.tick(micros());
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, gust.mean());
+  now = last + GUST_WINDOW;
+}
+
+// Brute-force GustDetector: the 3s mean from all edges for each evaluation, the samples of the 3s mean
+// in a list, the 10min window as the samples of the last 30 buckets of 20s
+class GustReference
+{
+public:
+  GustReference(const std::vector<uint64_t> &edges) : _edges(edges) {}
+
+  // Edge number i is processed
+  void edge(size_t i)
+  {
+    _fed = i + 1;
+    if (i > 0 && _edges[i] - _edges[i - 1] >= GUST_MIN_PERIOD)
+    {
+      evaluate(_edges[i]);
+    }
+  }
+
+  void tick(uint64_t t)
+  {
+    evaluate(t);
+    if (++_ticks % SAMPLE_TICKS == 0)
+    {
+      _clock += GUST_SAMPLE;
+      _samples.push_back({_mean, _low, _high, _clock});
+      _low = _mean;
+      _high = _mean;
+    }
+  }
+
+  double take()
+  {
+    double peak = _peak;
+    _peak = _mean;
+    return peak;
+  }
+
+  // Mean, max and min of the samples in the 10min window
+  void window(double &mean, double &gust, double &lull) const
+  {
+    uint32_t bucketTime = GUST_PERIOD / STATS_BUCKETS;
+    uint32_t open = _clock / bucketTime;
+    double sum = 0;
+    uint32_t count = 0;
+    gust = 0;
+    lull = 1e9;
+    for (const refSample &s : _samples)
+    {
+      if (open - s.clock / bucketTime >= STATS_BUCKETS)
+      {
+        continue;
+      }
+      sum += s.mean;
+      count++;
+      gust = max(gust, s.high);
+      lull = min(lull, s.low);
+    }
+    mean = count > 0 ? sum / count : 0;
+  }
+
+  size_t samples() const { return _samples.size(); }
+
+private:
+  typedef struct {
+    double mean;
+    double low;
+    double high;
+    uint32_t clock;
+  } refSample;
+
+  // Pulses ending in the last 3s / their duration including the running pulse
+  double mean3s(uint64_t t) const
+  {
+    uint32_t count = 0;
+    uint64_t sum = 0;
+    for (size_t i = _fed; i-- > 1 && t - _edges[i] < GUST_WINDOW;)
+    {
+      count++;
+      sum += min(_edges[i] - _edges[i - 1], uint64_t(GUST_WINDOW));
+    }
+    if (count == 0)
+    {
+      return 0;
+    }
+    return count * 1e6 / (sum + min(t - _edges[_fed - 1], uint64_t(GUST_WINDOW)));
+  }
+
+  void evaluate(uint64_t t)
+  {
+    _mean = mean3s(t);
+    _low = min(_low, _mean);
+    _high = max(_high, _mean);
+    _peak = max(_peak, _mean);
+  }
+
+  const std::vector<uint64_t> &_edges;
+  size_t _fed = 0;
+  uint32_t _ticks = 0;
+  uint32_t _clock = 0;
+  double _mean = 0;
+  double _low = 0;
+  double _high = 0;
+  double _peak = 0;
+  std::vector<refSample> _samples;
+};
+
+// Varying wind with short gusts and a pause longer than 3s, pulse rates 2...30 Hz
+static std::vector<uint64_t> randomEdges(uint64_t start, uint64_t length, uint32_t seed)
+{
+  std::mt19937 rng(seed);
+  std::vector<uint64_t> edges;
+  double rate = 8;
+  uint64_t second = 0;
+  for (uint64_t t = start + 1000; t < start + length;)
+  {
+    edges.push_back(t);
+    if ((t - start) / 1000000 != second)
+    {
+      second = (t - start) / 1000000;
+      rate = constrain(rate + (int(rng() % 401) - 200) / 100.0, 2.0, 20.0);
+      if (rng() % 20 == 0)
+      {
+        rate = 30;                          // Gust
+      }
+    }
+    double period = 1e6 / rate * (0.95 + (rng() % 1001) / 10000.0);
+    if (second == 200 && rng() % 4 == 0)
+    {
+      period = 4500000;                     // Pause
+    }
+    t += uint64_t(period);
+  }
+  return edges;
+}
+
+// 12min of varying wind, after each calculation cycle the gust values must match the reference
+static void randomReplay(const sensorPulses &s, uint32_t seed)
+{
+  restart(s.type);
+  std::vector<uint64_t> edges = randomEdges(now, 720000000ULL, seed);
+  GustReference reference(edges);
+  float perHz = windSpeedMps(1.0f / s.pulses);          // Calibration is linear without offset
+  size_t next = 0;
+  for (int t = 1; next < edges.size(); t++)
+  {
+    size_t fed = next;
+    next = tick(edges, next);
+    for (size_t i = fed; i < next; i++)
+    {
+      reference.edge(i);
+    }
+    reference.tick(now);
+    if (t % CYCLE != 0)
+    {
+      continue;
+    }
+    WindSnapshot wd = windData.read();
+    windowStatistics(wd);
+    double peak = reference.take();
+    double mean, gust10, lull10;
+    reference.window(mean, gust10, lull10);
+    char message[48];
+    snprintf(message, sizeof(message), "type %d cycle %d", int(s.type), t / CYCLE);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.0002 * peak * perHz + 0.0001, peak * perHz, wd.gust, message);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.01 * perHz, mean * perHz, wd.mean10, message);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.01 * perHz, gust10 * perHz, wd.gust10, message);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.01 * perHz, lull10 * perHz, wd.lull10, message);
+    TEST_ASSERT_EQUAL_MESSAGE(reference.samples() >= GUST_PERIOD / GUST_SAMPLE, wd.gustcomplete, message);
+  }
+  TEST_ASSERT_TRUE(reference.samples() > GUST_PERIOD / GUST_SAMPLE);        // The window has slid
+}
+
+void test_random_replay_against_reference()
+{
+  randomReplay(sensorTypes[0], 1);
+  randomReplay(sensorTypes[1], 2);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_steady_wind_all_sensor_types);
+  RUN_TEST(test_gust_window_is_3s);
+  RUN_TEST(test_random_replay_against_reference);
+  return UNITY_END();
+}
@@ -0,0 +1,351 @@
+// History ring in the in-memory file system: record encoding, pages, segment ring and restart
+
+#include "Arduino.h"
+#include "LittleFS.h"
+#include "Configuration.h"
+#include "WindSnapshot.h"
+#include <unity.h>
+#include <random>
+#include <vector>
+
+extern configData actconf;
+
+#include "HistoryRecorder.h"
+
+static FS fs;
+
+void setUp()
+{
+  fs.begin();
+  fs.format();
+}
+
+void tearDown()
+{
+  fs.end();
+}
+
+static void assertRecord(const historyRecord &e, const historyRecord &a, const char *message)
+{
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(e.time, a.time, message);
+  TEST_ASSERT_EQUAL_UINT16_MESSAGE(e.speed, a.speed, message);
+  TEST_ASSERT_EQUAL_UINT16_MESSAGE(e.direction, a.direction, message);
+  TEST_ASSERT_EQUAL_UINT16_MESSAGE(e.gust, a.gust, message);
+  TEST_ASSERT_EQUAL_INT16_MESSAGE(e.temperature, a.temperature, message);
+  TEST_ASSERT_EQUAL_UINT16_MESSAGE(e.pressure, a.pressure, message);
+}
+
+// Encode against previous, decode back, returns the length
+static size_t roundTrip(const historyRecord &previous, const historyRecord &r)
+{
+  uint8_t data[HISTORY_RECORD_MAX + 4];
+  memset(data, 0xAA, sizeof(data));
+  size_t length = HistoryRecorder::encode(r, previous, data);
+  TEST_ASSERT_TRUE(length > 0 && length <= HISTORY_RECORD_MAX);
+  TEST_ASSERT_EQUAL_UINT8(0xAA, data[length]);                 // Nothing written behind the record
+  const uint8_t *p = data;
+  historyRecord decoded;
+  TEST_ASSERT_TRUE(HistoryRecorder::decode(p, data + length, previous, decoded));
+  TEST_ASSERT_TRUE(p == data + length);
+  assertRecord(r, decoded, "round trip");
+  // A truncated record is not decoded
+  p = data;
+  TEST_ASSERT_FALSE(HistoryRecorder::decode(p, data + length - 1, previous, decoded));
+  return length;
+}
+
+// Wind measuring values: random walk of speed and gust, direction turning over 0°/360°
+class RecordSource
+{
+public:
+  RecordSource(uint32_t seed, uint32_t time) : _rng(seed) { _r.time = time; }
+
+  historyRecord next()
+  {
+    int speed = _r.speed + step(20);
+    int temperature = _r.temperature + step(2);
+    _r.time++;
+    _r.speed = uint16_t(constrain(speed, 0, 600));
+    _r.gust = uint16_t(_r.speed + _rng() % 50);
+    _r.direction = uint16_t((int(_r.direction) + step(15) + 360) % 360);
+    _r.temperature = int16_t(constrain(temperature, -300, 400));
+    _r.pressure = uint16_t(10130 + step(30));
+    return _r;
+  }
+
+private:
+  int step(int range) { return int(_rng() % (2 * range + 1)) - range; }
+
+  std::mt19937 _rng;
+  historyRecord _r;
+};
+
+void test_record_round_trip()
+{
+  historyRecord previous;
+  historyRecord r;
+  previous.time = 1000;
+  previous.direction = 359;
+  r.time = 1001;
+  r.direction = 0;
+  TEST_ASSERT_EQUAL_UINT32(6, roundTrip(previous, r));         // 359° -> 0° is +1°, 1 byte per value
+  previous.time = 1002;
+  TEST_ASSERT_EQUAL_UINT32(6, roundTrip(r, previous));         // 0° -> 359° is -1°
+  r.direction = 180;
+  roundTrip(previous, r);
+  previous.direction = 0;
+  roundTrip(previous, r);
+  // Largest deltas of all values
+  historyRecord low;
+  historyRecord high;
+  low.time = 0;
+  low.direction = 179;
+  low.temperature = INT16_MIN;
+  high.time = UINT32_MAX;
+  high.speed = UINT16_MAX;
+  high.direction = 359;
+  high.gust = UINT16_MAX;
+  high.temperature = INT16_MAX;
+  high.pressure = UINT16_MAX;
+  TEST_ASSERT_EQUAL_UINT32(HISTORY_RECORD_MAX - 1, roundTrip(low, high));  // Direction delta 180° has 2 bytes
+  roundTrip(high, low);                                         // Time delta over the wrap
+  // Random records against each other
+  std::mt19937 rng(7);
+  for (int i = 0; i < 20000; i++)
+  {
+    historyRecord a;
+    historyRecord b;
+    a.time = rng();
+    a.speed = uint16_t(rng());
+    a.direction = uint16_t(rng() % 360);
+    a.gust = uint16_t(rng());
+    a.temperature = int16_t(rng());
+    a.pressure = uint16_t(rng());
+    b.time = a.time + rng() % 100000;
+    b.speed = uint16_t(rng());
+    b.direction = uint16_t(rng() % 360);
+    b.gust = uint16_t(rng());
+    b.temperature = int16_t(rng());
+    b.pressure = uint16_t(rng());
+    roundTrip(a, b);
+  }
+}
+
+// All records of the ring and the open page in time order
+static std::vector<historyRecord> readAll(HistoryRecorder &history, uint32_t from = 0)
+{
+  std::vector<historyRecord> records;
+  history.read(from, [&records](const historyRecord &r) {
+    records.push_back(r);
+    return true;
+  });
+  return records;
+}
+
+// Written pages as byte stream, each page decoded alone
+static std::vector<historyRecord> readPages(HistoryRecorder &history)
+{
+  std::vector<uint8_t> stream;
+  history.readBytes(0, history.bytes(), [&stream](const uint8_t *data, size_t length) {
+    stream.insert(stream.end(), data, data + length);
+  });
+  TEST_ASSERT_EQUAL_UINT32(history.bytes(), stream.size());
+  TEST_ASSERT_EQUAL_UINT32(0, stream.size() % HISTORY_PAGE);
+  std::vector<historyRecord> records;
+  for (size_t offset = 0; offset < stream.size(); offset += HISTORY_PAGE)
+  {
+    HistoryRecorder::decodePage(stream.data() + offset, 0, [&records](const historyRecord &r) {
+      records.push_back(r);
+      return true;
+    });
+  }
+  return records;
+}
+
+static void assertRecords(const std::vector<historyRecord> &expected, size_t first,
+                          const std::vector<historyRecord> &actual)
+{
+  TEST_ASSERT_EQUAL_UINT32(expected.size() - first, actual.size());
+  for (size_t i = 0; i < actual.size(); i++)
+  {
+    char message[32];
+    snprintf(message, sizeof(message), "record %u", unsigned(i));
+    assertRecord(expected[first + i], actual[i], message);
+  }
+}
+
+// Records over several pages of one segment, the pages are written when full and decode alone
+void test_page_rollover()
+{
+  HistoryRecorder history;
+  TEST_ASSERT_TRUE(history.begin(fs, 4 * HISTORY_SEGMENT));
+  RecordSource source(1, 0);
+  std::vector<historyRecord> added;
+  while (history.pages() < 3)
+  {
+    historyRecord r = source.next();
+    r.time = history.time();
+    history.add(r);
+    added.push_back(r);
+    TEST_ASSERT_EQUAL_UINT32(r.time + 1, history.time());
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, history.errors());
+  TEST_ASSERT_EQUAL_UINT32(added.size(), history.records());
+  TEST_ASSERT_EQUAL_UINT32(3 * HISTORY_PAGE, history.bytes());
+  TEST_ASSERT_TRUE(added.size() > 3 * HISTORY_PAGE / HISTORY_RECORD_MAX);
+  // The record that did not fit starts the open page
+  std::vector<historyRecord> written = readPages(history);
+  TEST_ASSERT_EQUAL_UINT32(added.size() - 1, written.size());
+  assertRecords(std::vector<historyRecord>(added.begin(), added.end() - 1), 0, written);
+  assertRecords(added, 0, readAll(history));
+  TEST_ASSERT_EQUAL_UINT32(added[0].time, history.oldest());
+  // Records from a time in the middle of the second page on
+  uint32_t from = written[written.size() / 2].time;
+  assertRecords(added, written.size() / 2, readAll(history, from));
+}
+
+// Smallest ring of 2 segments, the third segment overwrites the oldest
+void test_segment_overwrite()
+{
+  HistoryRecorder history;
+  TEST_ASSERT_TRUE(history.begin(fs, 2 * HISTORY_SEGMENT));
+  RecordSource source(2, 0);
+  std::vector<historyRecord> added;
+  std::vector<uint32_t> pageStart;                              // First record of each written page
+  uint32_t pages = 0;
+  pageStart.push_back(0);
+  while (history.pages() < 2 * HISTORY_PAGES + HISTORY_PAGES / 2)
+  {
+    historyRecord r = source.next();
+    history.add(r);
+    added.push_back(r);
+    if (history.pages() != pages)
+    {
+      pages = history.pages();
+      pageStart.push_back(added.size() - 1);
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, history.errors());
+  // Segment 0 was overwritten: the oldest full segment and the half newest segment are left
+  TEST_ASSERT_EQUAL_UINT32((HISTORY_PAGES + HISTORY_PAGES / 2) * HISTORY_PAGE, history.bytes());
+  TEST_ASSERT_TRUE(fs.exists("/history/000.bin"));
+  TEST_ASSERT_TRUE(fs.exists("/history/001.bin"));
+  TEST_ASSERT_FALSE(fs.exists("/history/002.bin"));
+  size_t first = pageStart[HISTORY_PAGES];
+  TEST_ASSERT_EQUAL_UINT32(added[first].time, history.oldest());
+  assertRecords(added, first, readAll(history));
+  std::vector<historyRecord> written = readPages(history);
+  assertRecords(std::vector<historyRecord>(added.begin(), added.end() - 1), first, written);
+}
+
+// A restart continues the history time after the last written record, the open page is lost
+void test_restart_recovers_time()
+{
+  std::vector<historyRecord> added;
+  uint32_t lastWritten = 0;
+  {
+    HistoryRecorder history;
+    TEST_ASSERT_TRUE(history.begin(fs, 2 * HISTORY_SEGMENT));
+    TEST_ASSERT_EQUAL_UINT32(0, history.time());
+    RecordSource source(3, 0);
+    uint32_t pages = 0;
+    // Into the second round of the ring, the newest segment is not the first file, some records in the open page
+    while (history.pages() < HISTORY_PAGES * 3 + 5 || added.back().time < lastWritten + 10)
+    {
+      historyRecord r = source.next();
+      history.add(r);
+      if (history.pages() != pages)
+      {
+        pages = history.pages();
+        lastWritten = added.back().time;
+      }
+      added.push_back(r);
+    }
+    TEST_ASSERT_EQUAL_UINT32(HISTORY_PAGES * 3 + 5, history.pages());
+  }
+  HistoryRecorder history;
+  TEST_ASSERT_TRUE(history.begin(fs, 2 * HISTORY_SEGMENT));
+  TEST_ASSERT_EQUAL_UINT32(lastWritten + 1, history.time());
+  // New records after the restart follow the old ones
+  RecordSource source(4, history.time() - 1);
+  std::vector<historyRecord> after;
+  while (history.pages() < 2)
+  {
+    historyRecord r = source.next();
+    history.add(r);
+    after.push_back(r);
+  }
+  std::vector<historyRecord> records = readAll(history);
+  TEST_ASSERT_TRUE(records.size() > after.size());
+  for (size_t i = 1; i < records.size(); i++)
+  {
+    TEST_ASSERT_EQUAL_UINT32(records[i - 1].time + 1, records[i].time);
+  }
+  assertRecords(after, 0, std::vector<historyRecord>(records.end() - after.size(), records.end()));
+  // The first page after the restart is marked
+  uint8_t page[HISTORY_PAGE];
+  uint32_t offset = history.bytes() - 2 * HISTORY_PAGE;
+  history.readBytes(offset, HISTORY_PAGE, [&page](const uint8_t *data, size_t length) {
+    memcpy(page, data, length);
+  });
+  historyHeader header;
+  memcpy(&header, page, HISTORY_HEADER);
+  TEST_ASSERT_TRUE((header.flags & HISTORY_START) != 0);
+  TEST_ASSERT_EQUAL_UINT32(lastWritten + 1, header.time);
+  // A smaller ring removes the segments behind it
+  HistoryRecorder small;
+  TEST_ASSERT_FALSE(small.begin(fs, HISTORY_SEGMENT));
+  TEST_ASSERT_FALSE(fs.exists("/history/000.bin"));
+  TEST_ASSERT_FALSE(small.active());
+}
+
+// The records hold [0.1 °C] with both temperature units, the snapshot has the unit of tempUnit
+void test_temperature_unit()
+{
+  struct {
+    const char *unit;
+    const char *sensor;
+    float temperature;
+    float airtemperature;
+    int16_t expected;
+  } cases[] = {
+    {"C", "DS18B20", 21.5f, 0, 215},
+    {"F", "DS18B20", 68.0f, 0, 200},
+    {"F", "DS18B20", -4.0f, 0, -200},
+    {"C", "BME280", 0, -10.0f, -100},
+    {"F", "BME280", 0, 14.0f, -100},
+    {"F", "BME280", 0, 99.5f, 375},
+  };
+  HistoryRecorder history;
+  TEST_ASSERT_TRUE(history.begin(fs, 2 * HISTORY_SEGMENT));
+  SeqLock<WindSnapshot> data;
+  std::vector<historyRecord> added;
+  for (auto &c : cases)
+  {
+    strcpy(actconf.tempUnit, c.unit);
+    strcpy(actconf.tempSensorType, c.sensor);
+    WindSnapshot wd;
+    wd.temperature = c.temperature;
+    wd.airtemperature = c.airtemperature;
+    wd.airpressure = 1013.2f;
+    data.publish(wd);
+    native::advanceMicros(HISTORY_PERIOD * 1000UL);
+    historyRecord r;
+    TEST_ASSERT_TRUE(history.handle(data, r));
+    TEST_ASSERT_EQUAL_INT16_MESSAGE(c.expected, r.temperature, c.unit);
+    added.push_back(r);
+  }
+  assertRecords(added, 0, readAll(history));
+  strcpy(actconf.tempUnit, "C");
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_record_round_trip);
+  RUN_TEST(test_page_rollover);
+  RUN_TEST(test_segment_overwrite);
+  RUN_TEST(test_restart_recovers_time);
+  RUN_TEST(test_temperature_unit);
+  return UNITY_END();
+}
@@ -0,0 +1,298 @@
+// WebSocket live data with real sockets on the loopback interface (native shim)
+// Subscribers with different rates count the received messages while the calculation publishes a new epoch
+// every 500ms and the loop runs with the timing of the firmware (delay(150) and the run time of the loop).
+
+#include "Arduino.h"
+#include <ESP8266WiFi.h>
+#include "Configuration.h"
+#include "WindSnapshot.h"
+#include <unity.h>
+#include <string>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+extern configData actconf;
+
+// Debugging functions of FunctionsLib.h (templates, same definition as in the firmware)
+template <typename T>
+void DebugPrintln(int type, const T& value) {
+  if (type <= actconf.debug) {
+    Serial.println(value);
+  }
+}
+
+template <typename T>
+void DebugPrint(int type, const T& value) {
+  if (type <= actconf.debug) {
+    Serial.print(value);
+  }
+}
+
+// Firmware functions (FunctionsLib.h)
+float webWindSpeed(const WindSnapshot &wd);
+float webDownWindSpeed(const WindSnapshot &wd);
+
+#include "LiveServer.h"
+
+#define TEST_PORT 20181
+#define TEST_TIME 20000                     // Simulated time in [ms]
+
+// WebSocket client with a plain socket, reads the text frames of the server
+class LiveClient
+{
+public:
+  explicit LiveClient(const char *url)
+  {
+    _fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(TEST_PORT);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    TEST_ASSERT_EQUAL_INT(0, connect(_fd, (sockaddr *)&address, sizeof(address)));
+    std::string request = std::string("GET ") + url + " HTTP/1.1\r\nHost: localhost\r\nUpgrade: websocket\r\n"
+                          "Connection: Upgrade\r\nSec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+                          "Sec-WebSocket-Version: 13\r\n\r\n";
+    send(_fd, request.data(), request.length(), MSG_NOSIGNAL);
+  }
+
+  ~LiveClient() { close(_fd); }
+
+  // Masked text frame to the server (settings)
+  void text(const char *message)
+  {
+    size_t length = strlen(message);
+    std::string frame;
+    frame += char(0x81);
+    frame += char(0x80 | length);
+    const uint8_t mask[4] = {0x12, 0x34, 0x56, 0x78};
+    frame.append((const char *)mask, 4);
+    for (size_t i = 0; i < length; i++)
+    {
+      frame += char(message[i] ^ mask[i & 3]);
+    }
+    send(_fd, frame.data(), frame.length(), MSG_NOSIGNAL);
+  }
+
+  // Read all waiting data and split the frames, returns the received messages
+  std::vector<std::string> receive()
+  {
+    char buffer[4096];
+    ssize_t n;
+    while ((n = recv(_fd, buffer, sizeof(buffer), MSG_DONTWAIT)) > 0)
+    {
+      _data.append(buffer, n);
+    }
+    if (!_open)
+    {
+      size_t end = _data.find("\r\n\r\n");
+      if (end == std::string::npos)
+      {
+        return {};
+      }
+      TEST_ASSERT_TRUE(_data.rfind("HTTP/1.1 101", 0) == 0);
+      _data.erase(0, end + 4);
+      _open = true;
+    }
+    std::vector<std::string> messages;
+    while (_data.size() >= 2)
+    {
+      size_t length = uint8_t(_data[1]) & 0x7F;
+      size_t header = 2;
+      if (length == 126)
+      {
+        if (_data.size() < 4)
+        {
+          break;
+        }
+        length = (size_t(uint8_t(_data[2])) << 8) | uint8_t(_data[3]);
+        header = 4;
+      }
+      if (_data.size() < header + length)
+      {
+        break;
+      }
+      TEST_ASSERT_EQUAL_INT(0x81, uint8_t(_data[0]));
+      messages.push_back(_data.substr(header, length));
+      _data.erase(0, header + length);
+    }
+    return messages;
+  }
+
+private:
+  int _fd;
+  bool _open = false;
+  std::string _data;
+};
+
+// Received messages of one subscriber
+struct subscription
+{
+  const char *url;
+  uint32_t expected;                        // Expected messages in TEST_TIME
+  LiveClient *client = nullptr;
+  uint32_t count = 0;
+  uint32_t lastEpoch = 0;
+};
+
+static LiveServer live(TEST_PORT);
+static SeqLock<WindSnapshot> data;
+
+void setUp()
+{
+  actconf.debug = 0;
+}
+
+void tearDown() {}
+
+// Run the loop for TEST_TIME with a new epoch every 500ms, step = loop period in [ms] with jitter
+static void run(std::vector<subscription> &subs, uint32_t step, uint32_t jitter)
+{
+  for (auto &s : subs)
+  {
+    s.client = new LiveClient(s.url);
+  }
+  // Connect and handshake before the clock starts
+  for (int i = 0; i < 200 && live.clients() < int(subs.size()); i++)
+  {
+    live.handle(data);
+    delay(1);
+  }
+  TEST_ASSERT_EQUAL_INT(subs.size(), live.clients());
+  for (auto &s : subs)
+  {
+    s.client->receive();
+    s.count = 0;
+  }
+
+  randomSeed(step);
+  uint64_t start = uint64_t(millis() + 1000) * 1000;
+  native::setMicros(start);
+  uint64_t nextEpoch = start;
+  uint64_t end = start + uint64_t(TEST_TIME) * 1000;
+  for (uint64_t now = start; now < end; now += (step + random(0, jitter + 1)) * 1000)
+  {
+    native::setMicros(now);
+    while (nextEpoch <= now)
+    {
+      WindSnapshot wd;
+      wd.windspeed_mps = 5;
+      data.publish(wd);
+      nextEpoch += LIVE_EPOCH_PERIOD * 1000;
+    }
+    live.handle(data);
+    for (auto &s : subs)
+    {
+      for (const std::string &m : s.client->receive())
+      {
+        uint32_t epoch = strtoul(m.c_str() + 9, nullptr, 10);          // {"Epoch":<n>,...
+        TEST_ASSERT_TRUE(m.rfind("{\"Epoch\":", 0) == 0);
+        TEST_ASSERT_TRUE(epoch > s.lastEpoch);
+        s.lastEpoch = epoch;
+        s.count++;
+      }
+    }
+  }
+  // Messages still on the way
+  native::setMicros(end);
+  for (int i = 0; i < 20; i++)
+  {
+    usleep(1000);
+    for (auto &s : subs)
+    {
+      s.count += s.client->receive().size();
+    }
+  }
+  for (auto &s : subs)
+  {
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(s.expected, s.count, s.url);
+    delete s.client;
+  }
+  for (int i = 0; i < 200 && live.clients() > 0; i++)
+  {
+    live.handle(data);
+    usleep(1000);
+  }
+  native::setMicros(0);
+  TEST_ASSERT_EQUAL_INT(0, live.clients());
+}
+
+// Fast loop: each subscriber gets its rate, rates above the epoch rate are clamped to one message per epoch
+void test_rates()
+{
+  std::vector<subscription> subs = {
+    {"/?rate=0.5", TEST_TIME / 2000},
+    {"/?rate=1", TEST_TIME / 1000},
+    {"/?rate=2", TEST_TIME / LIVE_EPOCH_PERIOD},
+    {"/?rate=20", TEST_TIME / LIVE_EPOCH_PERIOD},
+    {"/?fields=WindSpeed", TEST_TIME / LIVE_EPOCH_PERIOD},
+  };
+  run(subs, 10, 0);
+}
+
+// Loop of the firmware (delay(150) and up to 60ms run time): the max rate still gets every epoch
+void test_rates_loop_jitter()
+{
+  std::vector<subscription> subs = {
+    {"/?rate=2", TEST_TIME / LIVE_EPOCH_PERIOD},
+    {"/?rate=20", TEST_TIME / LIVE_EPOCH_PERIOD},
+    {"/?rate=2&fields=WindSpeed", TEST_TIME / LIVE_EPOCH_PERIOD},
+  };
+  run(subs, 150, 60);
+}
+
+// The rate can be changed by a text message
+void test_rate_message()
+{
+  LiveClient client("/?rate=2");
+  for (int i = 0; i < 200 && live.clients() < 1; i++)
+  {
+    live.handle(data);
+    delay(1);
+  }
+  client.text("rate=0.25&fields=WindSpeed");
+  for (int i = 0; i < 50; i++)
+  {
+    live.handle(data);
+    usleep(1000);
+  }
+  client.receive();
+
+  uint64_t start = uint64_t(millis() + 1000) * 1000;
+  uint32_t count = 0;
+  for (uint32_t t = 0; t < TEST_TIME; t += 10)
+  {
+    native::setMicros(start + uint64_t(t) * 1000);
+    if (t % LIVE_EPOCH_PERIOD == 0)
+    {
+      WindSnapshot wd;
+      data.publish(wd);
+    }
+    live.handle(data);
+    for (const std::string &m : client.receive())
+    {
+      TEST_ASSERT_TRUE(m.find("\"WindSpeed\"") != std::string::npos);
+      TEST_ASSERT_TRUE(m.find("\"WindDirection\"") == std::string::npos);
+      count++;
+    }
+  }
+  for (int i = 0; i < 20; i++)
+  {
+    usleep(1000);
+    count += client.receive().size();
+  }
+  native::setMicros(0);
+  TEST_ASSERT_EQUAL_UINT32(TEST_TIME / 4000, count);
+}
+
+int main(int argc, char **argv)
+{
+  live.begin();
+  UNITY_BEGIN();
+  RUN_TEST(test_rates);
+  RUN_TEST(test_rates_loop_jitter);
+  RUN_TEST(test_rate_message);
+  return UNITY_END();
+}
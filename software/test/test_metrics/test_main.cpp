@@ -0,0 +1,268 @@
+// /metrics against the Prometheus text format 0.0.4
+// The page is requested over the loopback interface from a web server of the native shim and parsed line by line:
+// names, labels and values, HELP and TYPE before the samples of each metric, no metric twice, no duplicate series.
+
+#include "Arduino.h"
+#include <ESP8266WebServer.h>
+#include <unity.h>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Firmware function (metrics_html.h, instantiated by the firmware for ESP8266WebServer)
+template <typename Server>
+void sendMetrics(Server &server);
+
+#define TEST_PORT 20180
+
+static ESP8266WebServer web(TEST_PORT);
+
+void setUp() {}
+void tearDown() {}
+
+// GET /metrics, returns the content type and the body without chunk encoding
+static std::string scrape(std::string &type)
+{
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(TEST_PORT);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  TEST_ASSERT_EQUAL_INT(0, connect(fd, (sockaddr *)&address, sizeof(address)));
+  const char request[] = "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n";
+  send(fd, request, sizeof(request) - 1, MSG_NOSIGNAL);
+  web.handleClient();
+  shutdown(fd, SHUT_WR);
+  std::string response;
+  char buffer[4096];
+  ssize_t n;
+  while ((n = recv(fd, buffer, sizeof(buffer), 0)) > 0)
+  {
+    response.append(buffer, n);
+    if (response.size() >= 5 && response.compare(response.size() - 5, 5, "0\r\n\r\n") == 0)
+    {
+      break;
+    }
+  }
+  close(fd);
+
+  size_t end = response.find("\r\n\r\n");
+  TEST_ASSERT_TRUE(end != std::string::npos);
+  std::string head = response.substr(0, end);
+  TEST_ASSERT_TRUE(head.rfind("HTTP/1.1 200", 0) == 0);
+  size_t pos = head.find("Content-Type: ");
+  TEST_ASSERT_TRUE(pos != std::string::npos);
+  type = head.substr(pos + 14, head.find("\r\n", pos) - pos - 14);
+  TEST_ASSERT_TRUE(head.find("Transfer-Encoding: chunked") != std::string::npos);
+
+  // Chunks: <hex length>\r\n<data>\r\n ... 0\r\n\r\n
+  std::string body;
+  pos = end + 4;
+  while (true)
+  {
+    size_t line = response.find("\r\n", pos);
+    TEST_ASSERT_TRUE(line != std::string::npos);
+    size_t length = strtoul(response.c_str() + pos, nullptr, 16);
+    if (length == 0)
+    {
+      break;
+    }
+    body.append(response, line + 2, length);
+    pos = line + 2 + length + 2;
+  }
+  return body;
+}
+
+static bool nameStart(char c) { return isalpha(c) || c == '_' || c == ':'; }
+static bool nameChar(char c) { return isalnum(c) || c == '_' || c == ':'; }
+
+// Metric name at pos, pos is moved behind it
+static std::string metricName(const std::string &line, size_t &pos)
+{
+  size_t start = pos;
+  if (pos < line.size() && nameStart(line[pos]))
+  {
+    while (pos < line.size() && nameChar(line[pos]))
+    {
+      pos++;
+    }
+  }
+  return line.substr(start, pos - start);
+}
+
+// Value with the float syntax of Go (ParseFloat), Nan and +/-Inf
+static bool validValue(const std::string &text)
+{
+  if (text == "NaN" || text == "+Inf" || text == "-Inf")
+  {
+    return true;
+  }
+  char *end;
+  strtod(text.c_str(), &end);
+  return !text.empty() && *end == '\0' && text.find_first_of("xXpP") == std::string::npos;
+}
+
+// One parsed metric family
+struct family
+{
+  std::string type;
+  bool help = false;
+  bool samples = false;
+};
+
+void test_prometheus_format()
+{
+  // The page is larger than the chunk buffer of 512 bytes, a line cut between two chunks would fail the syntax
+  std::string type;
+  std::string body = scrape(type);
+  TEST_ASSERT_EQUAL_STRING("text/plain; version=0.0.4; charset=utf-8", type.c_str());
+  TEST_ASSERT_TRUE(body.size() > 1000);
+  TEST_ASSERT_EQUAL_INT('\n', body.back());
+
+  std::map<std::string, family> families;
+  std::string current;                      // Family of the last HELP / TYPE
+  std::set<std::string> series;
+  size_t samples = 0;
+  size_t start = 0;
+  int number = 0;
+  while (start < body.size())
+  {
+    size_t end = body.find('\n', start);
+    std::string line = body.substr(start, end - start);
+    start = end + 1;
+    number++;
+    char where[64];
+    snprintf(where, sizeof(where), "line %d", number);
+    TEST_ASSERT_FALSE_MESSAGE(line.empty(), where);
+
+    if (line[0] == '#')
+    {
+      // # HELP <name> <text> or # TYPE <name> <type>
+      bool help = line.rfind("# HELP ", 0) == 0;
+      bool isType = line.rfind("# TYPE ", 0) == 0;
+      TEST_ASSERT_TRUE_MESSAGE(help || isType, line.c_str());
+      size_t pos = 7;
+      std::string name = metricName(line, pos);
+      TEST_ASSERT_FALSE_MESSAGE(name.empty(), line.c_str());
+      TEST_ASSERT_TRUE_MESSAGE(pos < line.size() && line[pos] == ' ', line.c_str());
+      std::string text = line.substr(pos + 1);
+      TEST_ASSERT_FALSE_MESSAGE(text.empty(), line.c_str());
+      family &f = families[name];
+      TEST_ASSERT_FALSE_MESSAGE(f.samples, line.c_str());           // HELP / TYPE after the samples
+      if (help)
+      {
+        TEST_ASSERT_FALSE_MESSAGE(f.help, line.c_str());            // Only one HELP
+        TEST_ASSERT_TRUE_MESSAGE(f.type.empty(), line.c_str());     // HELP before TYPE like the firmware writes it
+        TEST_ASSERT_TRUE_MESSAGE(text.find('\\') == std::string::npos, line.c_str());
+        f.help = true;
+      }
+      else
+      {
+        TEST_ASSERT_TRUE_MESSAGE(f.type.empty(), line.c_str());     // Only one TYPE
+        TEST_ASSERT_TRUE_MESSAGE(text == "counter" || text == "gauge" || text == "summary" || text == "histogram" ||
+                                 text == "untyped", line.c_str());
+        TEST_ASSERT_TRUE_MESSAGE(text != "counter" || (name.size() > 6 &&
+                                 name.compare(name.size() - 6, 6, "_total") == 0), line.c_str());
+        f.type = text;
+      }
+      current = name;
+      continue;
+    }
+
+    // <name>{<label>="<value>",...} <value>
+    size_t pos = 0;
+    std::string name = metricName(line, pos);
+    TEST_ASSERT_FALSE_MESSAGE(name.empty(), line.c_str());
+    std::set<std::string> labels;
+    std::string labelSet;
+    if (pos < line.size() && line[pos] == '{')
+    {
+      pos++;
+      while (pos < line.size() && line[pos] != '}')
+      {
+        size_t labelStart = pos;
+        TEST_ASSERT_TRUE_MESSAGE(isalpha(line[pos]) || line[pos] == '_', line.c_str());
+        while (pos < line.size() && (isalnum(line[pos]) || line[pos] == '_'))
+        {
+          pos++;
+        }
+        std::string label = line.substr(labelStart, pos - labelStart);
+        TEST_ASSERT_FALSE_MESSAGE(label.rfind("__", 0) == 0, line.c_str());   // Reserved
+        TEST_ASSERT_TRUE_MESSAGE(labels.insert(label).second, line.c_str());   // Label twice
+        TEST_ASSERT_TRUE_MESSAGE(line.compare(pos, 2, "=\"") == 0, line.c_str());
+        pos += 2;
+        size_t valueStart = pos;
+        while (pos < line.size() && line[pos] != '"')
+        {
+          TEST_ASSERT_TRUE_MESSAGE(line[pos] != '\\', line.c_str());         // The firmware has no escapes
+          pos++;
+        }
+        TEST_ASSERT_TRUE_MESSAGE(pos < line.size(), line.c_str());
+        labelSet += label + "=" + line.substr(valueStart, pos - valueStart) + ",";
+        pos++;
+        if (line[pos] == ',')
+        {
+          pos++;
+        }
+      }
+      TEST_ASSERT_TRUE_MESSAGE(pos < line.size(), line.c_str());
+      pos++;
+    }
+    TEST_ASSERT_TRUE_MESSAGE(pos < line.size() && line[pos] == ' ', line.c_str());
+    std::string value = line.substr(pos + 1);
+    TEST_ASSERT_TRUE_MESSAGE(value.find(' ') == std::string::npos, line.c_str());    // No timestamps
+    TEST_ASSERT_TRUE_MESSAGE(validValue(value), line.c_str());
+
+    // The sample belongs to the family of the last HELP / TYPE lines
+    family &f = families[current];
+    TEST_ASSERT_TRUE_MESSAGE(f.help && !f.type.empty(), line.c_str());
+    bool member = name == current;
+    if (f.type == "summary")
+    {
+      member = member || name == current + "_sum" || name == current + "_count";
+    }
+    if (f.type == "histogram")
+    {
+      member = name == current + "_bucket" || name == current + "_sum" || name == current + "_count";
+    }
+    TEST_ASSERT_TRUE_MESSAGE(member, line.c_str());
+    TEST_ASSERT_TRUE_MESSAGE(name == current || !families.count(name), line.c_str());
+    TEST_ASSERT_TRUE_MESSAGE(f.type != "counter" || value[0] != '-', line.c_str());
+    f.samples = true;
+    samples++;
+
+    // No series twice
+    TEST_ASSERT_TRUE_MESSAGE(series.insert(name + "{" + labelSet + "}").second, line.c_str());
+  }
+
+  // Every family has samples
+  for (auto &f : families)
+  {
+    TEST_ASSERT_TRUE_MESSAGE(f.second.samples, f.first.c_str());
+  }
+  TEST_ASSERT_TRUE(families.size() > 30);
+  TEST_ASSERT_TRUE(samples > families.size());
+
+  // Some series with known values
+  TEST_ASSERT_TRUE(series.count("windsensor_pulses_total{sensor=speed,}") == 1);
+  TEST_ASSERT_TRUE(series.count("windsensor_pulses_total{sensor=direction,}") == 1);
+  TEST_ASSERT_TRUE(series.count("windsensor_loop_duration_seconds_count{}") == 1);
+  TEST_ASSERT_TRUE(series.count("windsensor_http_requests_total{route=/metrics,}") == 1);
+  TEST_ASSERT_TRUE(body.find("\nwindsensor_http_requests_total{route=\"/metrics\"} 0\n") != std::string::npos);
+  TEST_ASSERT_TRUE(body.find("\nwindsensor_nmea_sentences_total{sink=\"tcp\"} 0\n") != std::string::npos);
+  TEST_ASSERT_TRUE(body.find("\nwindsensor_loop_duration_seconds_sum 0.000000\n") != std::string::npos);
+}
+
+int main(int argc, char **argv)
+{
+  web.on("/metrics", []() { sendMetrics(web); });
+  web.begin();
+  UNITY_BEGIN();
+  RUN_TEST(test_prometheus_format);
+  return UNITY_END();
+}
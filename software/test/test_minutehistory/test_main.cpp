@@ -0,0 +1,402 @@
+// Minute aggregates of the history and the range query /history over the loopback interface from a web server of
+// the native shim: min/max buckets, LTTB points, the 1 Hz records and the binary download with Range requests
+
+#include "Arduino.h"
+#include "LittleFS.h"
+#include "Configuration.h"
+#include "WindSnapshot.h"
+#include <ESP8266WebServer.h>
+#include <unity.h>
+#include <string>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+extern configData actconf;
+
+#include "HistoryRecorder.h"
+#include "MinuteHistory.h"
+
+extern HistoryRecorder history;
+extern MinuteHistory minuteHistory;
+
+// Firmware function (history_html.h, instantiated by the firmware for ESP8266WebServer)
+template <typename Server>
+void sendHistory(Server &server);
+
+#define TEST_PORT 20182
+#define FIRST_MINUTE 1000                   // Minute of the first aggregate, history time 60000s
+#define MINUTES 300
+
+static ESP8266WebServer web(TEST_PORT);
+static FS fs;
+
+void setUp()
+{
+  fs.begin();
+  fs.format();
+  history.begin(fs, 2 * HISTORY_SEGMENT);
+  minuteHistory.clear();
+}
+
+void tearDown()
+{
+  fs.end();
+}
+
+typedef struct {
+  int status = 0;
+  std::string head;
+  std::string body;
+} response;
+
+// GET with the request headers, the body without chunk encoding
+static response get(const std::string &path, const std::string &headers = "")
+{
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(TEST_PORT);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  TEST_ASSERT_EQUAL_INT(0, connect(fd, (sockaddr *)&address, sizeof(address)));
+  std::string request = "GET " + path + " HTTP/1.1\r\nHost: localhost\r\n" + headers + "\r\n";
+  send(fd, request.data(), request.size(), MSG_NOSIGNAL);
+  web.handleClient();
+  shutdown(fd, SHUT_WR);
+  std::string text;
+  char buffer[4096];
+  ssize_t n;
+  while ((n = recv(fd, buffer, sizeof(buffer), 0)) > 0)
+  {
+    text.append(buffer, n);
+  }
+  close(fd);
+
+  response r;
+  size_t end = text.find("\r\n\r\n");
+  TEST_ASSERT_TRUE(end != std::string::npos);
+  r.head = text.substr(0, end);
+  r.status = atoi(r.head.c_str() + 9);
+  if (r.head.find("Transfer-Encoding: chunked") == std::string::npos)
+  {
+    r.body = text.substr(end + 4);
+    return r;
+  }
+  // Chunks: <hex length>\r\n<data>\r\n ... 0\r\n\r\n
+  size_t pos = end + 4;
+  while (true)
+  {
+    size_t line = text.find("\r\n", pos);
+    TEST_ASSERT_TRUE(line != std::string::npos);
+    size_t length = strtoul(text.c_str() + pos, nullptr, 16);
+    if (length == 0)
+    {
+      break;
+    }
+    r.body.append(text, line + 2, length);
+    pos = line + 2 + length + 2;
+  }
+  return r;
+}
+
+// Value of a response header, empty if missing
+static std::string header(const response &r, const std::string &name)
+{
+  size_t pos = r.head.find("\r\n" + name + ": ");
+  if (pos == std::string::npos)
+  {
+    return std::string();
+  }
+  pos += name.size() + 4;
+  return r.head.substr(pos, r.head.find("\r\n", pos) - pos);
+}
+
+static void assertHeader(const response &r, const std::string &name, const char *expected)
+{
+  std::string value = header(r, name);
+  TEST_ASSERT_EQUAL_STRING_MESSAGE(expected, value.c_str(), name.c_str());
+}
+
+// Rows of a CSV response
+static std::vector<minuteValues> rows(const response &r)
+{
+  TEST_ASSERT_EQUAL_INT(200, r.status);
+  std::vector<minuteValues> values;
+  size_t start = r.body.find('\n');
+  std::string names = r.body.substr(0, start);
+  TEST_ASSERT_EQUAL_STRING("time,speed,min,max,gust,direction,temperature,pressure", names.c_str());
+  for (start++; start < r.body.size(); start = r.body.find('\n', start) + 1)
+  {
+    minuteValues v;
+    unsigned long time;
+    TEST_ASSERT_EQUAL_INT(8, sscanf(r.body.c_str() + start, "%lu,%f,%f,%f,%f,%f,%f,%f", &time, &v.speed,
+                                    &v.minimum, &v.maximum, &v.gust, &v.direction, &v.temperature, &v.pressure));
+    v.time = time;
+    values.push_back(v);
+  }
+  return values;
+}
+
+static historyRecord record(uint32_t time, uint16_t speed, uint16_t direction, int16_t temperature)
+{
+  historyRecord r;
+  r.time = time;
+  r.speed = speed;
+  r.direction = direction;
+  r.gust = speed + 20;
+  r.temperature = temperature;
+  r.pressure = 10132;
+  return r;
+}
+
+// Distance of two angles on the circle 0...180°
+static float distance(float a, float b)
+{
+  float d = fabsf(a - b);
+  return d > 180 ? 360 - d : d;
+}
+
+// 60 records per minute, the minute is closed by the first record of the next one
+void test_minute_aggregation()
+{
+  uint32_t t = FIRST_MINUTE * 60;
+  for (int i = 0; i < 60; i++)
+  {
+    minuteHistory.add(record(t + i, 10 + i, i % 2 ? 350 : 10, i % 2 ? 203 : 207));
+  }
+  minuteValues v;
+  TEST_ASSERT_FALSE(minuteHistory.get(FIRST_MINUTE, v));                // Still open
+  for (int i = 0; i < 60; i++)
+  {
+    minuteHistory.add(record(t + 60 + i, 100, 180, -123));
+  }
+  minuteHistory.add(record(t + 120, 0, 0, 700));
+  TEST_ASSERT_EQUAL_UINT32(2, minuteHistory.count());
+  TEST_ASSERT_EQUAL_UINT32(FIRST_MINUTE + 1, minuteHistory.newest());
+  TEST_ASSERT_TRUE(minuteHistory.get(FIRST_MINUTE, v));
+  TEST_ASSERT_EQUAL_UINT32(t, v.time);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 4.0, v.speed);                          // Mean 3.95 m/s in 0.2 m/s steps
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 1.0, v.minimum);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 7.0, v.maximum);                        // 6.9 m/s rounded up
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 9.0, v.gust);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 0, distance(0, v.direction));           // 350° and 10°
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 20.5, v.temperature);
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 1013.2, v.pressure);
+  TEST_ASSERT_TRUE(minuteHistory.get(FIRST_MINUTE + 1, v));
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 10.0, v.speed);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 180, v.direction);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, -12.5, v.temperature);                  // -12.3 °C in 0.5 °C steps
+  // Temperature clamped at 63.5 °C
+  minuteHistory.add(record(t + 180, 0, 0, 700));
+  TEST_ASSERT_TRUE(minuteHistory.get(FIRST_MINUTE + 2, v));
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 63.5, v.temperature);
+  TEST_ASSERT_FALSE(minuteHistory.get(FIRST_MINUTE + 3, v));
+  TEST_ASSERT_FALSE(minuteHistory.get(FIRST_MINUTE - 1, v));
+  // A time jump invalidates the minutes before it
+  minuteHistory.add(record(t + 600, 0, 0, 0));
+  minuteHistory.add(record(t + 660, 0, 0, 0));
+  TEST_ASSERT_EQUAL_UINT32(1, minuteHistory.count());
+  TEST_ASSERT_FALSE(minuteHistory.get(FIRST_MINUTE + 2, v));
+  TEST_ASSERT_TRUE(minuteHistory.get(FIRST_MINUTE + 10, v));
+}
+
+// Speed of a minute in [0.1 m/s], a peak at minute 150
+static uint16_t minuteSpeed(uint32_t minute)
+{
+  return minute == FIRST_MINUTE + 150 ? 200 : (minute % 7) * 10;
+}
+
+// One record per minute, MINUTES closed minutes from FIRST_MINUTE on
+static void fillMinutes()
+{
+  for (uint32_t m = FIRST_MINUTE; m <= FIRST_MINUTE + MINUTES; m++)
+  {
+    minuteHistory.add(record(m * 60, minuteSpeed(m), 90, 200));
+  }
+  TEST_ASSERT_EQUAL_UINT32(MINUTES, minuteHistory.count());
+}
+
+// Buckets of step seconds start at multiples of step, the first one is the bucket of from or of the oldest minute
+void test_buckets_aligned_to_step()
+{
+  fillMinutes();
+  const uint32_t step = 600;
+  struct {
+    uint32_t from;
+    uint32_t to;
+    uint32_t first;                         // Minute of the first bucket
+    uint32_t last;                          // Last minute of the query
+  } cases[] = {
+    {FIRST_MINUTE * 60 + 7 * 60 + 13, FIRST_MINUTE * 60 + 250 * 60 + 5, FIRST_MINUTE, FIRST_MINUTE + 250},
+    {FIRST_MINUTE * 60 - 17 * 60, FIRST_MINUTE * 60 + 95 * 60, FIRST_MINUTE, FIRST_MINUTE + 95},
+    {FIRST_MINUTE * 60 + 123 * 60, FIRST_MINUTE * 60 + 10000 * 60, FIRST_MINUTE + 120, FIRST_MINUTE + MINUTES - 1},
+  };
+  for (auto &c : cases)
+  {
+    char path[80];
+    snprintf(path, sizeof(path), "/history?from=%lu&to=%lu&step=%lu", (unsigned long)c.from, (unsigned long)c.to,
+             (unsigned long)step);
+    std::vector<minuteValues> values = rows(get(path));
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE((c.last - c.first) / 10 + 1, values.size(), path);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+      uint32_t bucket = c.first + i * 10;
+      TEST_ASSERT_EQUAL_UINT32_MESSAGE(bucket * 60, values[i].time, path);
+      TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, values[i].time % step, path);
+      float sum = 0;
+      float maximum = 0;
+      uint32_t count = 0;
+      for (uint32_t m = bucket; m < bucket + 10 && m <= c.last; m++)
+      {
+        sum += minuteSpeed(m) * 0.1f;
+        maximum = max(maximum, minuteSpeed(m) * 0.1f);
+        count++;
+      }
+      TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.051, sum / count, values[i].speed, path);
+      TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.001, maximum, values[i].maximum, path);
+      TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.001, 90, values[i].direction, path);
+      TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.001, 20, values[i].temperature, path);
+    }
+  }
+}
+
+// About (to - from) / step + 1 points, the first and the last minute and the peak are included
+void test_lttb_points()
+{
+  fillMinutes();
+  const uint32_t from = FIRST_MINUTE * 60;
+  const uint32_t to = (FIRST_MINUTE + MINUTES - 1) * 60;
+  const uint32_t steps[] = {1800, 3600, 600, 120};
+  for (uint32_t step : steps)
+  {
+    char path[80];
+    snprintf(path, sizeof(path), "/history?from=%lu&to=%lu&step=%lu&mode=lttb", (unsigned long)from,
+             (unsigned long)to, (unsigned long)step);
+    std::vector<minuteValues> values = rows(get(path));
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE((to - from) / step + 1, values.size(), path);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(from, values.front().time, path);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(to, values.back().time, path);
+    bool peak = false;
+    for (size_t i = 0; i < values.size(); i++)
+    {
+      TEST_ASSERT_TRUE_MESSAGE(i == 0 || values[i].time > values[i - 1].time, path);
+      TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.001, minuteSpeed(values[i].time / 60) * 0.1f, values[i].speed, path);
+      peak = peak || values[i].time == (FIRST_MINUTE + 150) * 60;
+    }
+    TEST_ASSERT_TRUE_MESSAGE(peak, path);
+  }
+  // More points than minutes gives all minutes
+  char path[80];
+  snprintf(path, sizeof(path), "/history?from=%lu&to=%lu&step=60&mode=lttb", (unsigned long)from,
+           (unsigned long)(from + 59 * 60));
+  TEST_ASSERT_EQUAL_UINT32(60, rows(get(path)).size());
+}
+
+// Records in the ring until the pages are written
+static void fillPages(uint32_t pages)
+{
+  pages += history.pages();
+  while (history.pages() < pages)
+  {
+    history.add(record(history.time(), history.time() % 50, history.time() % 360, 200));
+  }
+}
+
+// Bytes of the written pages in the ring
+static std::string historyBytes(uint32_t offset, uint32_t length)
+{
+  std::string bytes;
+  history.readBytes(offset, length, [&bytes](const uint8_t *data, size_t size) {
+    bytes.append((const char *)data, size);
+  });
+  return bytes;
+}
+
+void test_binary_range()
+{
+  fillPages(3);
+  const uint32_t total = 3 * HISTORY_PAGE;
+  TEST_ASSERT_EQUAL_UINT32(total, history.bytes());
+  std::string all = historyBytes(0, total);
+
+  response r = get("/history?format=bin");
+  TEST_ASSERT_EQUAL_INT(200, r.status);
+  assertHeader(r, "Content-Length", "768");
+  assertHeader(r, "Accept-Ranges", "bytes");
+  TEST_ASSERT_TRUE(r.body == all);
+  std::string etag = header(r, "ETag");
+  TEST_ASSERT_EQUAL_UINT32(10, etag.size());
+
+  r = get("/history?format=bin", "Range: bytes=100-299\r\n");
+  TEST_ASSERT_EQUAL_INT(206, r.status);
+  assertHeader(r, "Content-Range", "bytes 100-299/768");
+  TEST_ASSERT_TRUE(r.body == all.substr(100, 200));
+
+  r = get("/history?format=bin", "Range: bytes=700-\r\n");
+  TEST_ASSERT_EQUAL_INT(206, r.status);
+  assertHeader(r, "Content-Range", "bytes 700-767/768");
+  TEST_ASSERT_TRUE(r.body == all.substr(700));
+
+  r = get("/history?format=bin", "Range: bytes=-50\r\n");
+  TEST_ASSERT_EQUAL_INT(206, r.status);
+  assertHeader(r, "Content-Range", "bytes 718-767/768");
+  TEST_ASSERT_TRUE(r.body == all.substr(718));
+
+  r = get("/history?format=bin", "Range: bytes=500-10000\r\n");               // End behind the stream
+  TEST_ASSERT_EQUAL_INT(206, r.status);
+  assertHeader(r, "Content-Range", "bytes 500-767/768");
+  TEST_ASSERT_TRUE(r.body == all.substr(500));
+
+  // Start behind the stream or invalid ranges
+  const char *invalid[] = {"bytes=768-", "bytes=1000-2000", "bytes=300-200", "bytes=-0", "bytes=0-10,20-30"};
+  for (const char *range : invalid)
+  {
+    r = get("/history?format=bin", std::string("Range: ") + range + "\r\n");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(416, r.status, range);
+    assertHeader(r, "Content-Range", "bytes */768");
+    TEST_ASSERT_TRUE_MESSAGE(r.body.empty(), range);
+  }
+
+  // If-Range: with the ETag the range, with an other ETag the whole stream
+  r = get("/history?format=bin", "Range: bytes=256-511\r\nIf-Range: " + etag + "\r\n");
+  TEST_ASSERT_EQUAL_INT(206, r.status);
+  TEST_ASSERT_TRUE(r.body == all.substr(256, 256));
+  r = get("/history?format=bin", "Range: bytes=256-511\r\nIf-Range: \"00000000x\"\r\n");
+  TEST_ASSERT_EQUAL_INT(200, r.status);
+  TEST_ASSERT_TRUE(header(r, "Content-Range").empty());
+  TEST_ASSERT_TRUE(r.body == all);
+}
+
+// Queries of the 1 Hz records are limited to 1h
+void test_raw_span_limit()
+{
+  fillPages(2);
+  std::vector<minuteValues> values = rows(get("/history?from=1&to=3601&step=10"));
+  uint32_t last = history.time() - 1;
+  TEST_ASSERT_EQUAL_UINT32((last - 1) / 10 + 1, values.size());
+  for (size_t i = 0; i < values.size(); i++)
+  {
+    TEST_ASSERT_EQUAL_UINT32(1 + i * 10, values[i].time);
+    TEST_ASSERT_FLOAT_WITHIN(0.001, (values[i].time % 50) * 0.1f, values[i].speed);
+  }
+  TEST_ASSERT_EQUAL_INT(400, get("/history?from=1&to=3602&step=10").status);
+  TEST_ASSERT_EQUAL_INT(400, get("/history?from=100000&to=200000&step=59").status);
+  TEST_ASSERT_EQUAL_INT(200, get("/history?from=-3600&step=1").status);
+}
+
+int main(int argc, char **argv)
+{
+  static const char *requestHeaders[] = {"Range", "If-Range"};
+  web.collectHeaders(requestHeaders, 2);
+  web.on("/history", []() { sendHistory(web); });
+  web.begin();
+  UNITY_BEGIN();
+  RUN_TEST(test_minute_aggregation);
+  RUN_TEST(test_buckets_aligned_to_step);
+  RUN_TEST(test_lttb_points);
+  RUN_TEST(test_binary_range);
+  RUN_TEST(test_raw_span_limit);
+  return UNITY_END();
+}
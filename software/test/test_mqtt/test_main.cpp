@@ -0,0 +1,434 @@
+// MQTT publisher against a fake broker on the loopback interface (native shim, no mosquitto needed)
+// The broker runs in its own thread, records CONNECT and PUBLISH packets and answers CONNECT with a
+// configurable return code. Checked are topics, payloads, the retain flags and the reconnect back-off.
+
+#include "Arduino.h"
+#include <ESP8266WiFi.h>
+#include "Configuration.h"
+#include "WindSnapshot.h"
+#include <unity.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+extern configData actconf;
+
+// Debugging functions of FunctionsLib.h (templates, same definition as in the firmware)
+template <typename T>
+void DebugPrintln(int type, const T& value) {
+  if (type <= actconf.debug) {
+    Serial.println(value);
+  }
+}
+
+template <typename T>
+void DebugPrint(int type, const T& value) {
+  if (type <= actconf.debug) {
+    Serial.print(value);
+  }
+}
+
+#include "MQTTPublisher.h"
+
+#define TEST_PORT 21883
+#define TEST_MARGIN 50                      // Margin in [ms] for the back-off times
+
+// One received PUBLISH
+struct message
+{
+  std::string topic;
+  std::string payload;
+  bool retain;
+};
+
+// Minimal MQTT 3.1.1 broker for one client at a time
+class FakeBroker
+{
+public:
+  void begin()
+  {
+    _listen = socket(AF_INET, SOCK_STREAM, 0);
+    int reuse = 1;
+    setsockopt(_listen, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(TEST_PORT);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    TEST_ASSERT_EQUAL_INT(0, bind(_listen, (sockaddr *)&address, sizeof(address)));
+    TEST_ASSERT_EQUAL_INT(0, listen(_listen, 4));
+    _running = true;
+    _thread = std::thread([this]() { run(); });
+  }
+
+  void end()
+  {
+    _running = false;
+    _thread.join();
+    close(_listen);
+  }
+
+  // Return code of CONNACK, 0 = accepted
+  void connackCode(uint8_t code) { _code = code; }
+
+  // Close the connection to the client (broker lost)
+  void drop() { _drop = true; while (_drop) { delay(1); } }
+
+  uint32_t connects() const { return _connects; }
+
+  std::vector<message> messages()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _messages;
+  }
+
+  // Wait until n messages are received
+  std::vector<message> waitMessages(size_t n)
+  {
+    for (int i = 0; i < 2000 && messages().size() < n; i++)
+    {
+      delay(1);
+    }
+    return messages();
+  }
+
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _messages.clear();
+  }
+
+  // Last CONNECT: client id, will topic, will message, will retain
+  std::string clientId, willTopic, willMessage;
+  bool willRetain = false;
+
+private:
+  void run()
+  {
+    while (_running)
+    {
+      pollfd p[2] = {{_listen, POLLIN, 0}, {_client, POLLIN, 0}};
+      poll(p, _client >= 0 ? 2 : 1, 5);
+      if (_drop)
+      {
+        disconnect();
+        _drop = false;
+      }
+      if (p[0].revents & POLLIN)
+      {
+        disconnect();
+        _client = accept(_listen, nullptr, nullptr);
+      }
+      if (_client >= 0 && (p[1].revents & (POLLIN | POLLHUP)))
+      {
+        packet();
+      }
+    }
+    disconnect();
+  }
+
+  void disconnect()
+  {
+    if (_client >= 0)
+    {
+      close(_client);
+      _client = -1;
+    }
+  }
+
+  bool receive(uint8_t *data, size_t length)
+  {
+    size_t n = 0;
+    while (n < length)
+    {
+      ssize_t r = recv(_client, data + n, length - n, 0);
+      if (r <= 0)
+      {
+        return false;
+      }
+      n += r;
+    }
+    return true;
+  }
+
+  static std::string string(const std::vector<uint8_t> &body, size_t &pos)
+  {
+    size_t length = (body[pos] << 8) | body[pos + 1];
+    std::string s((const char *)&body[pos + 2], length);
+    pos += 2 + length;
+    return s;
+  }
+
+  // Read and handle one packet
+  void packet()
+  {
+    uint8_t type;
+    if (!receive(&type, 1))
+    {
+      disconnect();
+      return;
+    }
+    size_t length = 0;
+    uint8_t digit;
+    int shift = 0;
+    do
+    {
+      if (!receive(&digit, 1))
+      {
+        disconnect();
+        return;
+      }
+      length |= size_t(digit & 0x7F) << shift;
+      shift += 7;
+    } while (digit & 0x80);
+    std::vector<uint8_t> body(length);
+    if (length > 0 && !receive(body.data(), length))
+    {
+      disconnect();
+      return;
+    }
+    size_t pos = 0;
+    switch (type >> 4)
+    {
+      case 1:                               // CONNECT
+      {
+        string(body, pos);                  // "MQTT"
+        pos++;                              // Level
+        uint8_t flags = body[pos++];
+        pos += 2;                           // Keep alive
+        clientId = string(body, pos);
+        willTopic = (flags & 0x04) ? string(body, pos) : "";
+        willMessage = (flags & 0x04) ? string(body, pos) : "";
+        willRetain = flags & 0x20;
+        _connects++;
+        uint8_t ack[4] = {0x20, 2, 0, _code};
+        send(_client, ack, sizeof(ack), MSG_NOSIGNAL);
+        if (_code != 0)
+        {
+          disconnect();
+        }
+        break;
+      }
+      case 3:                               // PUBLISH QoS 0
+      {
+        message m;
+        m.topic = string(body, pos);
+        m.payload.assign((const char *)body.data() + pos, body.size() - pos);
+        m.retain = type & 0x01;
+        std::lock_guard<std::mutex> lock(_mutex);
+        _messages.push_back(m);
+        break;
+      }
+      case 12:                              // PINGREQ
+      {
+        uint8_t resp[2] = {0xD0, 0};
+        send(_client, resp, sizeof(resp), MSG_NOSIGNAL);
+        break;
+      }
+      case 14:                              // DISCONNECT
+        disconnect();
+        break;
+    }
+  }
+
+  int _listen = -1;
+  int _client = -1;
+  std::thread _thread;
+  std::atomic<bool> _running{false};
+  std::atomic<bool> _drop{false};
+  std::atomic<uint8_t> _code{0};
+  std::atomic<uint32_t> _connects{0};
+  std::mutex _mutex;
+  std::vector<message> _messages;
+};
+
+static FakeBroker broker;
+
+// Measuring values of a typical calculation cycle
+static WindSnapshot sample(uint32_t epoch)
+{
+  WindSnapshot wd;
+  wd.epoch = epoch;
+  wd.windspeed_mps = 7.3;
+  wd.windspeed_kn = 14.2;
+  wd.windspeed_kph = 26.3;
+  wd.windspeed_bft = 4;
+  wd.winddirection = 237.4;
+  wd.temperature = 18.6;
+  wd.airtemperature = 17.9;
+  wd.airpressure = 1013.4;
+  wd.airhumidity = 71.5;
+  wd.dewpoint = 12.5;
+  wd.quality = 100;
+  return wd;
+}
+
+void setUp()
+{
+  actconf.debug = 0;
+  broker.connackCode(0);
+  broker.clear();
+}
+
+void tearDown() {}
+
+// Connect with last will, the status is set online and retained
+void test_connect_status()
+{
+  MQTTPublisher mqtt;
+  mqtt.begin("127.0.0.1", TEST_PORT, "boat/wind", "sensor1");
+  uint32_t connects = broker.connects();
+  mqtt.handle();
+  TEST_ASSERT_TRUE(mqtt.connected());
+  TEST_ASSERT_EQUAL_UINT32(connects + 1, broker.connects());
+  TEST_ASSERT_EQUAL_UINT32(1, mqtt.reconnects());
+  TEST_ASSERT_EQUAL_STRING("sensor1", broker.clientId.c_str());
+  TEST_ASSERT_EQUAL_STRING("boat/wind/status", broker.willTopic.c_str());
+  TEST_ASSERT_EQUAL_STRING("offline", broker.willMessage.c_str());
+  TEST_ASSERT_TRUE(broker.willRetain);
+  std::vector<message> m = broker.waitMessages(1);
+  TEST_ASSERT_EQUAL_UINT32(1, m.size());
+  TEST_ASSERT_EQUAL_STRING("boat/wind/status", m[0].topic.c_str());
+  TEST_ASSERT_EQUAL_STRING("online", m[0].payload.c_str());
+  TEST_ASSERT_TRUE(m[0].retain);
+}
+
+// One JSON message per epoch on <prefix>/data, retain as configured
+void test_publish_json()
+{
+  MQTTPublisher mqtt;
+  mqtt.begin("127.0.0.1", TEST_PORT, "boat/wind", "sensor1");
+  mqtt.handle();
+  broker.waitMessages(1);
+  broker.clear();
+  TEST_ASSERT_TRUE(mqtt.publish(sample(5), MQTT_FORMAT_JSON, true));
+  TEST_ASSERT_FALSE(mqtt.publish(sample(5), MQTT_FORMAT_JSON, true));       // Same epoch
+  TEST_ASSERT_TRUE(mqtt.publish(sample(6), MQTT_FORMAT_JSON, false));
+  std::vector<message> m = broker.waitMessages(2);
+  TEST_ASSERT_EQUAL_UINT32(2, m.size());
+  TEST_ASSERT_EQUAL_STRING("boat/wind/data", m[0].topic.c_str());
+  TEST_ASSERT_EQUAL_STRING("{\"epoch\":5,\"windspeed_mps\":7.30,\"windspeed_kn\":14.20,\"windspeed_kph\":26.30,"
+                           "\"windspeed_bft\":4,\"winddirection\":237.4,\"temperature\":18.6,\"airtemperature\":17.9,"
+                           "\"airpressure\":1013.4,\"airhumidity\":71.5,\"dewpoint\":12.5,\"quality\":100}",
+                           m[0].payload.c_str());
+  TEST_ASSERT_TRUE(m[0].retain);
+  TEST_ASSERT_EQUAL_STRING("boat/wind/data", m[1].topic.c_str());
+  TEST_ASSERT_TRUE(m[1].payload.rfind("{\"epoch\":6,", 0) == 0);
+  TEST_ASSERT_FALSE(m[1].retain);
+  TEST_ASSERT_EQUAL_UINT32(2, mqtt.batches());
+  TEST_ASSERT_EQUAL_UINT32(0, mqtt.errors());
+}
+
+// One message per value on <prefix>/<name>, the epoch last
+void test_publish_fields()
+{
+  static const char *topics[][2] = {
+    {"boat/wind/windspeed_mps", "7.30"}, {"boat/wind/windspeed_kn", "14.20"}, {"boat/wind/windspeed_kph", "26.30"},
+    {"boat/wind/windspeed_bft", "4"}, {"boat/wind/winddirection", "237.4"}, {"boat/wind/temperature", "18.6"},
+    {"boat/wind/airtemperature", "17.9"}, {"boat/wind/airpressure", "1013.4"}, {"boat/wind/airhumidity", "71.5"},
+    {"boat/wind/dewpoint", "12.5"}, {"boat/wind/quality", "100"}, {"boat/wind/epoch", "9"},
+  };
+  const size_t count = sizeof(topics) / sizeof(topics[0]);
+  MQTTPublisher mqtt;
+  mqtt.begin("127.0.0.1", TEST_PORT, "boat/wind", "sensor1");
+  mqtt.handle();
+  broker.waitMessages(1);
+  for (bool retain : {true, false})
+  {
+    broker.clear();
+    TEST_ASSERT_TRUE(mqtt.publish(sample(retain ? 9 : 10), MQTT_FORMAT_FIELDS, retain));
+    std::vector<message> m = broker.waitMessages(count);
+    TEST_ASSERT_EQUAL_UINT32(count, m.size());
+    for (size_t i = 0; i < count; i++)
+    {
+      TEST_ASSERT_EQUAL_STRING(topics[i][0], m[i].topic.c_str());
+      if (retain)
+      {
+        TEST_ASSERT_EQUAL_STRING(topics[i][1], m[i].payload.c_str());
+      }
+      TEST_ASSERT_EQUAL(retain, m[i].retain);
+    }
+  }
+  TEST_ASSERT_EQUAL_STRING("10", broker.messages().back().payload.c_str());
+}
+
+// Refused connects are retried after 1, 2, 4, ... 60s, not earlier; a lost connection is retried at once
+void test_reconnect_backoff()
+{
+  MQTTPublisher mqtt;
+  mqtt.begin("127.0.0.1", TEST_PORT, "boat/wind", "sensor1");
+  broker.connackCode(MQTT_CONNECT_UNAVAILABLE);
+  uint32_t connects = broker.connects();
+  mqtt.handle();
+  TEST_ASSERT_FALSE(mqtt.connected());
+  TEST_ASSERT_EQUAL_UINT32(++connects, broker.connects());
+  unsigned long pause = MQTT_RETRY_MIN;
+  for (int i = 0; i < 9; i++)
+  {
+    native::advanceMicros(uint64_t(pause - TEST_MARGIN) * 1000);
+    mqtt.handle();
+    TEST_ASSERT_EQUAL_UINT32(connects, broker.connects());
+    native::advanceMicros(uint64_t(2 * TEST_MARGIN) * 1000);
+    mqtt.handle();
+    TEST_ASSERT_EQUAL_UINT32(++connects, broker.connects());
+    TEST_ASSERT_FALSE(mqtt.connected());
+    pause = min(pause * 2, (unsigned long)MQTT_RETRY_MAX);
+  }
+  TEST_ASSERT_EQUAL_UINT32(MQTT_RETRY_MAX, pause);
+  TEST_ASSERT_EQUAL_UINT32(0, mqtt.reconnects());
+
+  // Broker accepts again: connected with the next retry, the pause starts again with MQTT_RETRY_MIN
+  broker.connackCode(0);
+  native::advanceMicros(uint64_t(pause + TEST_MARGIN) * 1000);
+  mqtt.handle();
+  TEST_ASSERT_TRUE(mqtt.connected());
+  TEST_ASSERT_EQUAL_UINT32(1, mqtt.reconnects());
+
+  // Broker lost: the next loop connects at once
+  broker.drop();
+  for (int i = 0; i < 1000 && mqtt.connected(); i++)
+  {
+    delay(1);
+  }
+  TEST_ASSERT_FALSE(mqtt.connected());
+  mqtt.handle();
+  TEST_ASSERT_TRUE(mqtt.connected());
+  TEST_ASSERT_EQUAL_UINT32(2, mqtt.reconnects());
+
+  // A refused connect after a successful one waits MQTT_RETRY_MIN again
+  broker.connackCode(MQTT_CONNECT_UNAVAILABLE);
+  broker.drop();
+  for (int i = 0; i < 1000 && mqtt.connected(); i++)
+  {
+    delay(1);
+  }
+  connects = broker.connects();
+  mqtt.handle();
+  TEST_ASSERT_EQUAL_UINT32(++connects, broker.connects());
+  native::advanceMicros(uint64_t(MQTT_RETRY_MIN - TEST_MARGIN) * 1000);
+  mqtt.handle();
+  TEST_ASSERT_EQUAL_UINT32(connects, broker.connects());
+  native::advanceMicros(uint64_t(2 * TEST_MARGIN) * 1000);
+  mqtt.handle();
+  TEST_ASSERT_EQUAL_UINT32(++connects, broker.connects());
+}
+
+int main(int argc, char **argv)
+{
+  WiFi.begin("test");
+  broker.begin();
+  UNITY_BEGIN();
+  RUN_TEST(test_connect_status);
+  RUN_TEST(test_publish_json);
+  RUN_TEST(test_publish_fields);
+  RUN_TEST(test_reconnect_backoff);
+  int result = UNITY_END();
+  broker.end();
+  return result;
+}
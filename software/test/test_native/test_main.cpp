@@ -0,0 +1,68 @@
+// Host shim: stopped clock with micros() overflow and GPIO interrupts
+
+#include "Arduino.h"
+#include <unity.h>
+
+static int edges = 0;
+
+static void countEdge()
+{
+  edges++;
+}
+
+void setUp()
+{
+  edges = 0;
+}
+
+void tearDown() {}
+
+void test_stopped_clock()
+{
+  native::setMicros(5000000);
+  TEST_ASSERT_EQUAL_UINT32(5000000, micros());
+  TEST_ASSERT_EQUAL_UINT32(5000, millis());
+  native::advanceMicros(1500);
+  TEST_ASSERT_EQUAL_UINT32(5001500, micros());
+  TEST_ASSERT_EQUAL_UINT32(5001, millis());
+}
+
+void test_micros_overflow()
+{
+  native::setMicros(0xFFFFFF00ULL);
+  uint32_t before = micros();
+  native::advanceMicros(0x200);
+  uint32_t after = micros();
+  TEST_ASSERT_EQUAL_UINT32(0x100, after);
+  TEST_ASSERT_EQUAL_UINT32(0x200, after - before);        // Differences stay correct over the wrap
+  TEST_ASSERT_EQUAL_UINT32(0x100000000ULL / 1000, millis());
+}
+
+void test_pin_interrupt_modes()
+{
+  const uint8_t pin = 14;
+  native::setPin(pin, LOW);
+  attachInterrupt(digitalPinToInterrupt(pin), countEdge, RISING);
+  native::setPin(pin, HIGH);
+  native::setPin(pin, HIGH);                              // No edge
+  native::setPin(pin, LOW);
+  TEST_ASSERT_EQUAL_INT(1, edges);
+  detachInterrupt(digitalPinToInterrupt(pin));
+  attachInterrupt(digitalPinToInterrupt(pin), countEdge, CHANGE);
+  native::setPin(pin, HIGH);
+  native::setPin(pin, LOW);
+  TEST_ASSERT_EQUAL_INT(3, edges);
+  TEST_ASSERT_EQUAL_INT(LOW, digitalRead(pin));
+  detachInterrupt(digitalPinToInterrupt(pin));
+  native::setPin(pin, HIGH);
+  TEST_ASSERT_EQUAL_INT(3, edges);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_stopped_clock);
+  RUN_TEST(test_micros_overflow);
+  RUN_TEST(test_pin_interrupt_modes);
+  return UNITY_END();
+}
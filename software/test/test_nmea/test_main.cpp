@@ -0,0 +1,157 @@
+// The NMEA telegrams of NmeaWriter against the old String based telegrams (bench/LegacyNMEA.h)
+// The bytes between $ and * must be equal, the old checksum is parsed because it was lowercase without leading zero.
+
+#include "Arduino.h"
+#include "Configuration.h"
+#include "WindSnapshot.h"
+#include "NmeaWriter.h"
+#include "../../bench/LegacyNMEA.h"
+#include <unity.h>
+
+// Firmware globals and functions (WiFi_Windsensor.cpp)
+extern configData actconf;
+
+size_t sendMWV(const WindSnapshot &wd, char *buffer, size_t size);
+size_t sendVWR(const WindSnapshot &wd, char *buffer, size_t size);
+size_t sendVPW(const WindSnapshot &wd, char *buffer, size_t size);
+size_t sendINF(const WindSnapshot &wd, char *buffer, size_t size);
+size_t sendWST(const WindSnapshot &wd, char *buffer, size_t size);
+size_t sendWSE(const WindSnapshot &wd, char *buffer, size_t size);
+
+typedef size_t (*sendFunction)(const WindSnapshot &, char *, size_t);
+typedef String (*legacyFunction)(const WindSnapshot &);
+
+static const struct {
+  const char *name;
+  sendFunction send;
+  legacyFunction legacy;
+} telegrams[] = {
+  {"MWV", sendMWV, legacy::sendMWV},
+  {"VWR", sendVWR, legacy::sendVWR},
+  {"VPW", sendVPW, legacy::sendVPW},
+  {"INF", sendINF, legacy::sendINF},
+  {"WST", sendWST, legacy::sendWST},
+  {"WSE", sendWSE, legacy::sendWSE},
+};
+
+void setUp()
+{
+  actconf = configData();
+}
+
+void tearDown() {}
+
+// Old telegram with the checksum as two uppercase hex digits
+static String normalized(const String &telegram)
+{
+  int star = telegram.indexOf('*');
+  TEST_ASSERT_TRUE_MESSAGE(star > 0, telegram.c_str());
+  char checksum[3];
+  snprintf(checksum, sizeof(checksum), "%02X", unsigned(strtoul(telegram.c_str() + star + 1, nullptr, 16)));
+  return telegram.substring(0, star + 1) + checksum;
+}
+
+static void compare(const WindSnapshot &wd)
+{
+  char buffer[NMEA_MAX_LENGTH];
+  for (auto &t : telegrams)
+  {
+    size_t length = t.send(wd, buffer, sizeof(buffer) - 2);
+    String expected = normalized(t.legacy(wd));
+    TEST_ASSERT_EQUAL_STRING_MESSAGE(expected.c_str(), buffer, t.name);
+    TEST_ASSERT_EQUAL_UINT32(expected.length(), length);
+  }
+}
+
+// Measuring values of a typical calculation cycle
+static WindSnapshot sample()
+{
+  WindSnapshot wd;
+  wd.windspeed_mps = 7.3;
+  wd.windspeed_kn = 14.2;
+  wd.windspeed_kph = 26.3;
+  wd.windspeed_bft = 4;
+  wd.winddirection = 237.4;
+  wd.winddirection2 = 122.6;
+  wd.dirresolution = 0.35;
+  wd.temperature = 18.6;
+  wd.airtemperature = 17.9;
+  wd.airpressure = 1013.4;
+  wd.airhumidity = 71.5;
+  wd.dewpoint = 12.5;
+  wd.altitude = 12.1;
+  return wd;
+}
+
+void test_sample()
+{
+  compare(sample());
+}
+
+// Zero and negative values
+void test_zero_and_negative()
+{
+  WindSnapshot wd;
+  compare(wd);
+  wd = sample();
+  wd.temperature = -4.25;
+  wd.airtemperature = -12.5;
+  wd.dewpoint = -0.75;
+  wd.altitude = -3;
+  compare(wd);
+}
+
+// All configuration variants of the telegrams
+void test_configuration()
+{
+  WindSnapshot wd = sample();
+  const char *units[] = {"kn", "m/s", "km/h"};
+  for (const char *unit : units)
+  {
+    strcpy(actconf.speedUnit, unit);
+    strcpy(actconf.windType, "T");
+    strcpy(actconf.tempUnit, "F");
+    actconf.sensorID = 7;
+    compare(wd);
+  }
+  // Down wind range of VPW and port/starboard of VWR
+  for (float direction : {0.0f, 129.9f, 130.0f, 179.99f, 180.0f, 230.0f, 230.1f, 359.99f})
+  {
+    wd.winddirection = direction;
+    compare(wd);
+  }
+}
+
+// Random values in the resolution of the telegrams (2 decimals), about every 16th checksum is below 0x10
+void test_random()
+{
+  randomSeed(4711);
+  for (int i = 0; i < 2000; i++)
+  {
+    WindSnapshot wd;
+    wd.windspeed_mps = random(0, 6000) / 100.0f;
+    wd.windspeed_kn = random(0, 12000) / 100.0f;
+    wd.windspeed_kph = random(0, 22000) / 100.0f;
+    wd.windspeed_bft = random(0, 13);
+    wd.winddirection = random(0, 36000) / 100.0f;
+    wd.winddirection2 = random(0, 18000) / 100.0f;
+    wd.dirresolution = random(0, 100) / 100.0f;
+    wd.temperature = random(-4000, 8000) / 100.0f;
+    wd.airtemperature = random(-4000, 8000) / 100.0f;
+    wd.airpressure = random(80000, 110000) / 100.0f;
+    wd.airhumidity = random(0, 10000) / 100.0f;
+    wd.dewpoint = random(-4000, 4000) / 100.0f;
+    wd.altitude = random(-50000, 500000) / 100.0f;
+    compare(wd);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_sample);
+  RUN_TEST(test_zero_and_negative);
+  RUN_TEST(test_configuration);
+  RUN_TEST(test_random);
+  return UNITY_END();
+}
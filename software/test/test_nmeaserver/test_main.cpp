@@ -0,0 +1,188 @@
+// NMEA TCP server with real sockets on the loopback interface (native shim)
+// All slots are used by concurrent clients, one of them takes no data. The other clients must get every frame,
+// the stalled client gets whole frames until its queue is full and is disconnected after NMEA_CLIENT_TIMEOUT.
+
+#include "Arduino.h"
+#include <ESP8266WiFi.h>
+#include "Configuration.h"
+#include <unity.h>
+#include <string>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+extern configData actconf;
+
+// Debugging functions of FunctionsLib.h (templates, same definition as in the firmware)
+template <typename T>
+void DebugPrintln(int type, const T& value) {
+  if (type <= actconf.debug) {
+    Serial.println(value);
+  }
+}
+
+template <typename T>
+void DebugPrint(int type, const T& value) {
+  if (type <= actconf.debug) {
+    Serial.print(value);
+  }
+}
+
+#include "NMEAServer.h"
+
+#define TEST_PORT 20110
+#define TEST_FRAME 256                      // Frame length in [Byte]
+#define TEST_MAX_FRAMES 40000               // Limit for the stall of the slow client (10 MB)
+
+void setUp()
+{
+  actconf.debug = 0;
+}
+
+void tearDown() {}
+
+// Frame n: "$TEST,<n>,xxx...*\r\n" with fixed length
+static std::string frame(uint32_t n)
+{
+  char head[32];
+  snprintf(head, sizeof(head), "$TEST,%06u,", unsigned(n));
+  std::string f(head);
+  f.append(TEST_FRAME - f.length() - 3, 'x');
+  f += "*\r\n";
+  return f;
+}
+
+// Read all waiting data of a client
+static void receive(WiFiClient &client, std::string &data)
+{
+  uint8_t buffer[4096];
+  int n;
+  while ((n = client.read(buffer, sizeof(buffer))) > 0)
+  {
+    data.append((const char *)buffer, n);
+  }
+}
+
+// The data must be whole frames with increasing numbers, returns the number of frames
+static uint32_t checkFrames(const std::string &data, uint32_t &last)
+{
+  TEST_ASSERT_EQUAL_UINT32(0, data.length() % TEST_FRAME);
+  uint32_t frames = data.length() / TEST_FRAME;
+  for (uint32_t i = 0; i < frames; i++)
+  {
+    uint32_t n = strtoul(data.c_str() + i * TEST_FRAME + 6, nullptr, 10);
+    TEST_ASSERT_TRUE(i == 0 || n > last);
+    TEST_ASSERT_TRUE(data.compare(i * TEST_FRAME, TEST_FRAME, frame(n)) == 0);
+    last = n;
+  }
+  return frames;
+}
+
+void test_stalled_client()
+{
+  static WiFiServer server(TEST_PORT);
+  static NMEAServer nmea(server);
+  nmea.begin();
+
+  // The first client never reads, small receive buffer set before connect so the stall starts early
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  int size = 4096;
+  setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(TEST_PORT);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  TEST_ASSERT_EQUAL_INT(0, connect(fd, (sockaddr *)&address, sizeof(address)));
+  WiFiClient slow(fd);
+  nmea.handle();
+  std::vector<WiFiClient> fast(NMEA_MAX_CLIENTS - 1);
+  for (auto &c : fast)
+  {
+    TEST_ASSERT_TRUE(c.connect(IPAddress(127, 0, 0, 1), TEST_PORT));
+    nmea.handle();
+  }
+  TEST_ASSERT_EQUAL_INT(NMEA_MAX_CLIENTS, nmea.clients());
+
+  // One more client is rejected
+  WiFiClient extra;
+  TEST_ASSERT_TRUE(extra.connect(IPAddress(127, 0, 0, 1), TEST_PORT));
+  nmea.handle();
+  TEST_ASSERT_EQUAL_UINT32(1, nmea.rejects());
+  TEST_ASSERT_EQUAL_INT(NMEA_MAX_CLIENTS, nmea.clients());
+
+  // Send frames until the queue of the slow client has dropped some, the fast clients read all the time
+  std::vector<std::string> received(fast.size());
+  uint32_t frames = 0;
+  while (frames < TEST_MAX_FRAMES && (nmea.client(0).drops < 10 || frames < 100))
+  {
+    std::string f = frame(frames++);
+    nmea.send(f.data(), f.length());
+    for (size_t i = 0; i < fast.size(); i++)
+    {
+      receive(fast[i], received[i]);
+    }
+  }
+  TEST_ASSERT_TRUE(nmea.client(0).drops >= 10);
+  TEST_ASSERT_EQUAL_UINT32(nmea.client(0).drops, nmea.drops());
+
+  // The fast clients get the rest of their queues
+  for (int loop = 0; loop < 1000; loop++)
+  {
+    nmea.handle();
+    bool complete = true;
+    for (size_t i = 0; i < fast.size(); i++)
+    {
+      receive(fast[i], received[i]);
+      complete = complete && received[i].length() == frames * TEST_FRAME;
+    }
+    if (complete)
+    {
+      break;
+    }
+    delay(1);
+  }
+  for (size_t i = 0; i < fast.size(); i++)
+  {
+    uint32_t last = 0;
+    TEST_ASSERT_EQUAL_UINT32(frames, checkFrames(received[i], last));
+    TEST_ASSERT_EQUAL_UINT32(frames - 1, last);
+    TEST_ASSERT_EQUAL_UINT32(0, nmea.client(i + 1).drops);
+    TEST_ASSERT_EQUAL_UINT32(frames * TEST_FRAME, nmea.client(i + 1).bytes);
+  }
+
+  // The slow client is disconnected after the timeout, the others stay
+  const nmeaClient &stalled = nmea.client(0);
+  uint32_t queued = frames * TEST_FRAME - stalled.drops * TEST_FRAME - stalled.bytes;
+  TEST_ASSERT_TRUE(queued > 0);
+  TEST_ASSERT_EQUAL_UINT32(0, nmea.disconnects());
+  native::advanceMicros(uint64_t(NMEA_CLIENT_TIMEOUT + 1000) * 1000);
+  nmea.handle();
+  TEST_ASSERT_EQUAL_UINT32(1, nmea.disconnects());
+  TEST_ASSERT_EQUAL_INT(NMEA_MAX_CLIENTS - 1, nmea.clients());
+  TEST_ASSERT_FALSE(stalled.active);
+
+  // The slow client gets all bytes written before the disconnect: whole frames in order without the dropped
+  // frames, the last frame can be cut by the disconnect
+  std::string slowData;
+  for (int loop = 0; loop < 5000 && slowData.length() < stalled.bytes; loop++)
+  {
+    receive(slow, slowData);
+    delay(1);
+  }
+  TEST_ASSERT_EQUAL_UINT32(stalled.bytes, slowData.length());
+  size_t cut = slowData.length() % TEST_FRAME;
+  uint32_t last = 0;
+  uint32_t whole = checkFrames(slowData.substr(0, slowData.length() - cut), last);
+  TEST_ASSERT_TRUE(whole > 0);
+  TEST_ASSERT_TRUE(slowData.compare(slowData.length() - cut, cut, frame(last + 1), 0, cut) == 0 || cut == 0);
+  TEST_ASSERT_EQUAL_UINT32(frames * TEST_FRAME, stalled.drops * TEST_FRAME + slowData.length() + queued);
+  server.stop();
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_stalled_client);
+  return UNITY_END();
+}
@@ -0,0 +1,204 @@
+// NMEA UDP output with real sockets on the loopback interface (native shim)
+// The receivers are bound to the destination address, so a datagram only arrives at the selected address:
+// subnet broadcast of the client network, multicast group or unicast address. One datagram per NMEA frame.
+
+#include "Arduino.h"
+#include <ESP8266WiFi.h>
+#include "Configuration.h"
+#include "WindSnapshot.h"
+#include <unity.h>
+#include <string>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+extern configData actconf;
+extern SeqLock<WindSnapshot> windData;
+
+// Debugging functions of FunctionsLib.h (templates, same definition as in the firmware)
+template <typename T>
+void DebugPrintln(int type, const T& value) {
+  if (type <= actconf.debug) {
+    Serial.println(value);
+  }
+}
+
+template <typename T>
+void DebugPrint(int type, const T& value) {
+  if (type <= actconf.debug) {
+    Serial.print(value);
+  }
+}
+
+#include "NMEAUdp.h"
+
+class NMEAServer;
+void sendNMEAFrame(NMEAServer *tcp, NMEAUdp *udp);
+
+#define TEST_PORT 20111
+#define TEST_GROUP "239.1.2.3"
+
+void setUp()
+{
+  actconf.debug = 0;
+  actconf.serverMode = 0;
+  actconf.windSensor = 1;
+  actconf.tempSensor = 0;
+  WiFi.begin("native");
+}
+
+void tearDown() {}
+
+// UDP socket bound to the address and TEST_PORT, with the address a multicast group joined on the loopback interface
+static int receiver(const char *address)
+{
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  TEST_ASSERT_TRUE(fd >= 0);
+  int reuse = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  sockaddr_in local = {};
+  local.sin_family = AF_INET;
+  local.sin_port = htons(TEST_PORT);
+  local.sin_addr.s_addr = inet_addr(address);
+  TEST_ASSERT_EQUAL_INT_MESSAGE(0, bind(fd, (sockaddr *)&local, sizeof(local)), address);
+  if (IN_MULTICAST(ntohl(local.sin_addr.s_addr)))
+  {
+    ip_mreq group = {};
+    group.imr_multiaddr.s_addr = local.sin_addr.s_addr;
+    group.imr_interface.s_addr = htonl(INADDR_LOOPBACK);
+    TEST_ASSERT_EQUAL_INT(0, setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &group, sizeof(group)));
+  }
+  return fd;
+}
+
+// Next datagram of the socket, empty if none arrives within 100ms
+static std::string datagram(int fd)
+{
+  timeval timeout = {0, 100000};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  char buffer[2048];
+  ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+  return n > 0 ? std::string(buffer, n) : std::string();
+}
+
+// Datagrams to the receivers of the three kinds of address, counted by destination
+static void assertDestination(int mode, const char *address, int broadcasts, int multicasts, int unicasts)
+{
+  int fds[] = {receiver("127.255.255.255"), receiver(TEST_GROUP), receiver("127.0.0.2")};
+  int expected[] = {broadcasts, multicasts, unicasts};
+  NMEAUdp udp;
+  udp.begin(mode, address, TEST_PORT);
+  TEST_ASSERT_TRUE(udp.active());
+  udp.send("$TEST*00\r\n", 10);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(broadcasts + multicasts + unicasts, udp.packets(), address);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, udp.errors(), address);
+  for (int i = 0; i < 3; i++)
+  {
+    for (int n = 0; n < expected[i]; n++)
+    {
+      std::string received = datagram(fds[i]);
+      TEST_ASSERT_EQUAL_STRING_MESSAGE("$TEST*00\r\n", received.c_str(), address);
+    }
+    TEST_ASSERT_TRUE_MESSAGE(datagram(fds[i]).empty(), address);
+    close(fds[i]);
+  }
+}
+
+// 255.255.255.255 in broadcast mode is the directed broadcast of the client network (127.0.0.1/8 in the shim)
+void test_address_selection()
+{
+  assertDestination(1, "255.255.255.255", 1, 0, 0);
+  assertDestination(2, TEST_GROUP, 0, 1, 0);
+  assertDestination(2, "127.0.0.2", 0, 0, 1);
+  assertDestination(1, "127.0.0.2", 0, 0, 1);           // Broadcast mode with an other address sends to it
+  assertDestination(2, "127.255.255.255", 1, 0, 0);     // Directed broadcast as configured address
+}
+
+// Without a client network the broadcast is not sent (no station in the access point network of the shim)
+void test_broadcast_without_network()
+{
+  int fd = receiver("127.255.255.255");
+  WiFi.disconnect();
+  NMEAUdp udp;
+  udp.begin(1, "255.255.255.255", TEST_PORT);
+  udp.send("$TEST*00\r\n", 10);
+  TEST_ASSERT_EQUAL_UINT32(0, udp.packets());
+  TEST_ASSERT_EQUAL_UINT32(0, udp.errors());
+  TEST_ASSERT_TRUE(datagram(fd).empty());
+  close(fd);
+}
+
+// An invalid address or port sends nothing, each frame is counted as error
+void test_invalid_configuration()
+{
+  int fd = receiver("127.255.255.255");
+  const char *addresses[] = {"", "256.1.1.1", "abc", "10.0.0"};
+  for (const char *address : addresses)
+  {
+    NMEAUdp udp;
+    udp.begin(1, address, TEST_PORT);
+    udp.send("$TEST*00\r\n", 10);
+    udp.send("$TEST*00\r\n", 10);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, udp.packets(), address);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(2, udp.errors(), address);
+  }
+  NMEAUdp udp;
+  udp.begin(1, "255.255.255.255", 0);
+  udp.send("$TEST*00\r\n", 10);
+  TEST_ASSERT_EQUAL_UINT32(1, udp.errors());
+  // Mode 0 is off, nothing is sent and nothing is counted
+  udp.begin(0, "abc", TEST_PORT);
+  TEST_ASSERT_FALSE(udp.active());
+  udp.send("$TEST*00\r\n", 10);
+  TEST_ASSERT_EQUAL_UINT32(1, udp.errors());
+  TEST_ASSERT_EQUAL_UINT32(0, udp.packets());
+  TEST_ASSERT_TRUE(datagram(fd).empty());
+  close(fd);
+}
+
+// Each calculation cycle sends the whole NMEA frame as one datagram with all sentences
+void test_one_datagram_per_frame()
+{
+  int fd = receiver("127.0.0.2");
+  NMEAUdp udp;
+  udp.begin(2, "127.0.0.2", TEST_PORT);
+  for (int cycle = 1; cycle <= 6; cycle++)
+  {
+    actconf.gustData = cycle > 3;           // PWGST only with its setting
+    WindSnapshot wd;
+    wd.windspeed_mps = float(cycle);
+    wd.winddirection = 10.0f * cycle;
+    windData.publish(wd);
+    sendNMEAFrame(nullptr, &udp);
+    TEST_ASSERT_EQUAL_UINT32(cycle, udp.packets());
+    std::string frame = datagram(fd);
+    TEST_ASSERT_TRUE(frame.size() > 0);
+    TEST_ASSERT_EQUAL_INT('$', frame.front());
+    TEST_ASSERT_EQUAL_UINT32(frame.size() - 2, frame.rfind("\r\n"));
+    size_t sentences = 0;
+    for (size_t pos = 0; pos < frame.size(); pos = frame.find("\r\n", pos) + 2)
+    {
+      TEST_ASSERT_EQUAL_INT('$', frame[pos]);
+      sentences++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(actconf.gustData == 1 ? 5 : 4, sentences);   // MWV, VWR, VPW, INF (, GST)
+    TEST_ASSERT_EQUAL_MESSAGE(actconf.gustData == 1, frame.find("$PWGST,") != std::string::npos, frame.c_str());
+    char mwv[32];
+    snprintf(mwv, sizeof(mwv), "$WIMWV,%d.00,R,", 10 * cycle);
+    TEST_ASSERT_TRUE_MESSAGE(frame.find(mwv) == 0, frame.c_str());
+  }
+  TEST_ASSERT_TRUE(datagram(fd).empty());
+  actconf.gustData = 0;
+  close(fd);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_address_selection);
+  RUN_TEST(test_broadcast_without_network);
+  RUN_TEST(test_invalid_configuration);
+  RUN_TEST(test_one_datagram_per_frame);
+  return UNITY_END();
+}
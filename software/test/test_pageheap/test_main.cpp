@@ -0,0 +1,172 @@
+// Heap of the streamed web pages: the peak heap in use while a page is rendered is the chunk buffer of PageWriter
+// and small Strings, independent of the page size. All heap allocations go through the counting operator new.
+
+#include "Arduino.h"
+#include <OneWire.h>
+#include <DallasTemperature.h>
+#include <ESP8266WebServer.h>
+#include "Configuration.h"
+#include "PageWriter.h"
+#include <unity.h>
+#include <cstddef>
+#include <new>
+
+#define PAGE_HEAP_LIMIT (PAGE_CHUNK + 512)  // Max peak heap of a page in [Byte]
+
+// Firmware globals and functions (WiFi_Windsensor.cpp)
+extern configData actconf;
+extern OneWire *oneWire;
+extern DallasTemperature *DS18B20;
+extern int oneWire_Bus;
+
+void calculationData();
+void Startpage(PageWriter &content, int num, String vname[20], String value[20]);
+void Settings(PageWriter &content, int num, String vname[30], String value[30]);
+void Devinfo(PageWriter &content);
+void Windv(PageWriter &content);
+void Windi(PageWriter &content);
+
+// Allocation counting, each block has a header with its size for the heap in use and its peak
+static int64_t heapUsed = 0;
+static int64_t heapPeak = 0;
+
+static const size_t allocHeader = alignof(std::max_align_t);
+
+static void *countedAlloc(size_t size)
+{
+  char *p = (char *)malloc(allocHeader + size);
+  if (!p)
+  {
+    return nullptr;
+  }
+  *(size_t *)p = size;
+  heapUsed += size;
+  heapPeak = max(heapPeak, heapUsed);
+  return p + allocHeader;
+}
+
+static void *checkedAlloc(size_t size)
+{
+  void *p = countedAlloc(size);
+  if (!p)
+  {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+static void countedFree(void *p)
+{
+  if (p)
+  {
+    char *block = (char *)p - allocHeader;
+    heapUsed -= *(size_t *)block;
+    free(block);
+  }
+}
+
+void *operator new(size_t size) { return checkedAlloc(size); }
+void *operator new[](size_t size) { return checkedAlloc(size); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept { return countedAlloc(size); }
+void *operator new[](size_t size, const std::nothrow_t &) noexcept { return countedAlloc(size); }
+void operator delete(void *p) noexcept { countedFree(p); }
+void operator delete[](void *p) noexcept { countedFree(p); }
+void operator delete(void *p, size_t) noexcept { countedFree(p); }
+void operator delete[](void *p, size_t) noexcept { countedFree(p); }
+
+// Minimal part of setup() for the pages
+void setUp()
+{
+  static bool ready = false;
+  actconf.debug = 0;
+  if (ready)
+  {
+    return;
+  }
+  oneWire = new OneWire(oneWire_Bus);
+  DS18B20 = new DallasTemperature(oneWire);
+  DS18B20->begin();
+  calculationData();                        // Valid first epoch
+  ready = true;
+}
+
+void tearDown() {}
+
+// Output of the chunks: page length and number of chunks
+typedef struct {
+  size_t length = 0;
+  size_t chunks = 0;
+} pageSize;
+
+static void pageSink(void *context, const char *type, const char *data, size_t length)
+{
+  pageSize *size = static_cast<pageSize *>(context);
+  size->length += length;
+  size->chunks++;
+}
+
+// Renders the page and checks its peak heap above the heap in use before, no memory is left behind
+// The page is rendered once before, static Strings of the firmware are allocated with the first call
+template <typename F>
+static void assertPageHeap(const char *name, F render)
+{
+  pageSize size;
+  {
+    PageWriter content(pageSink, &size);
+    render(content);
+  }
+  int64_t used = heapUsed;
+  heapPeak = used;
+  size = pageSize();
+  {
+    PageWriter content(pageSink, &size);
+    render(content);
+    content.end();
+  }
+  int64_t peak = heapPeak - used;
+  char message[64];
+  snprintf(message, sizeof(message), "%s peak %lld bytes", name, (long long)peak);
+  TEST_ASSERT_TRUE_MESSAGE(size.length > PAGE_CHUNK, message);             // More than one chunk buffer
+  TEST_ASSERT_TRUE_MESSAGE(size.chunks > 1, message);
+  TEST_ASSERT_TRUE_MESSAGE(peak >= PAGE_CHUNK, message);                   // The chunk buffer is counted
+  TEST_ASSERT_TRUE_MESSAGE(peak <= PAGE_HEAP_LIMIT, message);
+  TEST_ASSERT_EQUAL_INT_MESSAGE(used, heapUsed, message);
+}
+
+// Main page without arguments
+void test_startpage()
+{
+  assertPageHeap("Startpage", [](PageWriter &content) { Startpage(content, 0, nullptr, nullptr); });
+}
+
+// Settings page without arguments (page view, no EEPROM write)
+void test_settings()
+{
+  assertPageHeap("Settings", [](PageWriter &content) { Settings(content, 0, nullptr, nullptr); });
+}
+
+void test_devinfo()
+{
+  assertPageHeap("Devinfo", [](PageWriter &content) { Devinfo(content); });
+}
+
+void test_windv()
+{
+  assertPageHeap("Windv", [](PageWriter &content) { Windv(content); });
+}
+
+void test_windi()
+{
+  assertPageHeap("Windi", [](PageWriter &content) { Windi(content); });
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_startpage);
+  RUN_TEST(test_settings);
+  RUN_TEST(test_devinfo);
+  RUN_TEST(test_windv);
+  RUN_TEST(test_windi);
+  return UNITY_END();
+}
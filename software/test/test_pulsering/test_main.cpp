@@ -0,0 +1,206 @@
+// Multi-threaded stress tests of the lock-free pulse ring and the sequence lock of the measuring values
+
+#include "Arduino.h"
+#include "PulseRing.h"
+#include "WindSnapshot.h"
+#include <unity.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#define STRESS_EVENTS 500000
+#define STRESS_EPOCHS 50000
+#define STRESS_READERS 4
+
+void setUp() {}
+void tearDown() {}
+
+// Producer pushes increasing timestamps and repeats dropped ones, the consumer must see every accepted
+// timestamp once and in order, the drops are counted by the ring
+void test_ring_lossless_in_order()
+{
+  static PulseRing<64> ring;
+  uint32_t dropped = 0;
+  std::thread producer([&dropped]() {
+    for (uint32_t i = 1; i <= STRESS_EVENTS;)
+    {
+      if (ring.push(i & 1 ? PULSE_EDGE_SPEED : PULSE_EDGE_DIRECTION, i))
+      {
+        i++;
+      }
+      else
+      {
+        dropped++;
+        std::this_thread::yield();          // Ring full, let the consumer run on a single core
+      }
+    }
+  });
+  uint32_t expected = 1;
+  uint32_t errors = 0;
+  pulseEvent event;
+  while (expected <= STRESS_EVENTS)
+  {
+    if (ring.pop(event))
+    {
+      if (event.timestamp != expected || event.edge != (expected & 1 ? PULSE_EDGE_SPEED : PULSE_EDGE_DIRECTION))
+      {
+        errors++;
+      }
+      expected = event.timestamp + 1;
+    }
+    else
+    {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  TEST_ASSERT_EQUAL_UINT32(0, errors);
+  TEST_ASSERT_EQUAL_UINT32(STRESS_EVENTS + 1, expected);
+  TEST_ASSERT_EQUAL_UINT32(dropped, ring.overflows());
+  TEST_ASSERT_FALSE(ring.pop(event));
+}
+
+// A full ring drops the new events and keeps the old ones
+void test_ring_overflow_counted()
+{
+  static PulseRing<64> ring;
+  for (uint32_t i = 0; i < 64; i++)
+  {
+    TEST_ASSERT_TRUE(ring.push(PULSE_EDGE_SPEED, i));
+  }
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    TEST_ASSERT_FALSE(ring.push(PULSE_EDGE_SPEED, 1000 + i));
+  }
+  TEST_ASSERT_EQUAL_UINT32(10, ring.overflows());
+  TEST_ASSERT_EQUAL_UINT32(64, ring.size());
+  pulseEvent event;
+  for (uint32_t i = 0; i < 64; i++)
+  {
+    TEST_ASSERT_TRUE(ring.pop(event));
+    TEST_ASSERT_EQUAL_UINT32(i, event.timestamp);
+  }
+  TEST_ASSERT_FALSE(ring.pop(event));
+  TEST_ASSERT_TRUE(ring.push(PULSE_EDGE_SPEED, 2000));
+  TEST_ASSERT_EQUAL_UINT32(10, ring.overflows());
+}
+
+// All values of a snapshot are set to its epoch
+static void fill(WindSnapshot &wd, uint32_t epoch)
+{
+  float v = float(epoch);
+  wd.fieldstrength = v;
+  wd.quality = v;
+  wd.temperature = v;
+  wd.time1 = v;
+  wd.time2 = v;
+  wd.windspeed_hz = v;
+  wd.windspeed_mps = v;
+  wd.windspeed_kn = v;
+  wd.windspeed_kph = v;
+  wd.windspeed_bft = int(epoch);
+  wd.rawwinddirection = v;
+  wd.winddirection = v;
+  wd.winddirection2 = v;
+  wd.dirresolution = v;
+  wd.dirdeviation = v;
+  wd.magsensor = v;
+  wd.magnitude = v;
+  wd.airtemperature = v;
+  wd.airpressure = v;
+  wd.airhumidity = v;
+  wd.dewpoint = v;
+  wd.altitude = v;
+  for (int i = 0; i < STATS_WINDOWS; i++)
+  {
+    wd.stats[i].mean = v;
+    wd.stats[i].maximum = v;
+  }
+  wd.gust = v;
+  wd.mean10 = v;
+  wd.gust10 = v;
+  wd.lull10 = v;
+}
+
+static bool consistent(const WindSnapshot &wd)
+{
+  float v = float(wd.epoch);
+  bool ok = wd.fieldstrength == v && wd.quality == v && wd.temperature == v && wd.time1 == v && wd.time2 == v &&
+            wd.windspeed_hz == v && wd.windspeed_mps == v && wd.windspeed_kn == v && wd.windspeed_kph == v &&
+            wd.windspeed_bft == int(wd.epoch) && wd.rawwinddirection == v && wd.winddirection == v &&
+            wd.winddirection2 == v && wd.dirresolution == v && wd.dirdeviation == v && wd.magsensor == v &&
+            wd.magnitude == v && wd.airtemperature == v && wd.airpressure == v && wd.airhumidity == v &&
+            wd.dewpoint == v && wd.altitude == v && wd.gust == v && wd.mean10 == v && wd.gust10 == v &&
+            wd.lull10 == v;
+  for (int i = 0; ok && i < STATS_WINDOWS; i++)
+  {
+    ok = wd.stats[i].mean == v && wd.stats[i].maximum == v;
+  }
+  return ok;
+}
+
+// One writer publishes as fast as possible, the readers must never see a mix of two epochs
+void test_seqlock_no_torn_snapshot()
+{
+  static SeqLock<WindSnapshot> lock;
+  std::atomic<bool> running(true);
+  std::atomic<uint32_t> torn(0);
+  std::atomic<uint32_t> backwards(0);
+  std::atomic<uint32_t> reads(0);
+  std::vector<std::thread> readers;
+  for (int i = 0; i < STRESS_READERS; i++)
+  {
+    readers.emplace_back([&]() {
+      WindSnapshot wd;
+      uint32_t last = 0;
+      while (running)
+      {
+        uint32_t epoch = lock.read(wd);
+        if (epoch == 0)
+        {
+          continue;                         // Nothing published yet
+        }
+        if (!consistent(wd))
+        {
+          torn++;
+        }
+        if (epoch < last)
+        {
+          backwards++;
+        }
+        last = epoch;
+        reads++;
+        std::this_thread::yield();          // Leave time to the writer on a single core
+      }
+    });
+  }
+  WindSnapshot wd;
+  for (uint32_t epoch = 1; epoch <= STRESS_EPOCHS; epoch++)
+  {
+    fill(wd, epoch);
+    TEST_ASSERT_EQUAL_UINT32(epoch, lock.publish(wd));
+    if (epoch % 16 == 0)
+    {
+      std::this_thread::yield();            // Readers overlap with the next publish on a single core
+    }
+  }
+  running = false;
+  for (auto &t : readers)
+  {
+    t.join();
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, torn.load());
+  TEST_ASSERT_EQUAL_UINT32(0, backwards.load());
+  TEST_ASSERT_GREATER_THAN(0, reads.load());
+  TEST_ASSERT_EQUAL_UINT32(STRESS_EPOCHS, lock.epoch());
+  TEST_ASSERT_TRUE(consistent(lock.read()));
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_ring_lossless_in_order);
+  RUN_TEST(test_ring_overflow_counted);
+  RUN_TEST(test_seqlock_no_torn_snapshot);
+  return UNITY_END();
+}
@@ -0,0 +1,217 @@
+// Rotation times from edge timestamps: pulseRing -> processPulses() against the arithmetic of the former
+// interrupt routines with the 100us counter (time1 and time2 in 0.1 ms steps)
+
+#include "Arduino.h"
+#include "Configuration.h"
+#include "PulseRing.h"
+#include <unity.h>
+#include <vector>
+
+extern configData actconf;
+extern PulseRing<64> pulseRing;
+extern volatile int marker1;
+extern volatile int marker2;
+extern volatile int rpcounter;
+extern volatile int pcounter;
+extern volatile unsigned long icounter;
+extern volatile uint32_t time1start;
+extern volatile uint32_t time1stop;
+extern volatile uint32_t time2stop;
+extern volatile float time1;
+extern volatile float time2;
+extern volatile int average;
+extern volatile float timearray1[10];
+
+void processPulses();
+
+// Former interrupt routines, counter() every 100us counts while marker1 / marker2 is set
+struct LegacyPulses
+{
+  int marker1 = 0;
+  int marker2 = 0;
+  int rpcounter = 0;
+  int pcounter = 0;
+  unsigned long icounter = 0;
+  uint32_t counter1 = 0;
+  uint32_t counter2 = 0;
+  float time1 = 0;
+  float time2 = 0;
+  uint64_t last = 0;
+
+  // Counter ticks between the last event and t (ticks at multiples of 100us)
+  void advance(uint64_t t)
+  {
+    uint64_t ticks = t / 100 - last / 100;
+    counter1 += marker1 == 1 ? ticks : 0;
+    counter2 += marker2 == 1 ? ticks : 0;
+    last = t;
+  }
+
+  void speed(uint64_t t)
+  {
+    advance(t);
+    if (marker1 == 0)
+    {
+      time1 = min(float(counter1) / 10, 1000.0f);
+      time2 = min(float(counter2) / 10, 1000.0f);
+      counter1 = 0;
+      counter2 = 0;
+      marker1 = 1;
+      marker2 = 1;
+      icounter += 1;
+    }
+    else
+    {
+      marker1 = 0;
+      pcounter = rpcounter;
+      rpcounter = 0;
+    }
+  }
+
+  void direction(uint64_t t)
+  {
+    advance(t);
+    marker2 = 0;
+    if (marker1 == 1)
+    {
+      rpcounter += 1;
+    }
+  }
+};
+
+struct Edge
+{
+  uint64_t time;                    // Host time in [us], the ring gets the lower 32 bit like micros()
+  uint8_t edge;
+};
+
+void setUp()
+{
+  actconf.serverMode = 0;
+  average = 1;
+  marker1 = 0;
+  marker2 = 0;
+  rpcounter = 0;
+  pcounter = 0;
+  icounter = 0;
+  time1start = 0;
+  time1stop = 0;
+  time2stop = 0;
+  time1 = 0;
+  time2 = 0;
+  pulseEvent event;
+  while (pulseRing.pop(event))
+  {
+  }
+}
+
+void tearDown() {}
+
+// Replays the edges, after each speed edge the values must match the former routines
+static void replay(const std::vector<Edge> &edges, uint64_t start)
+{
+  LegacyPulses legacy;
+  legacy.last = start;
+  unsigned long measured = 0;
+  for (const Edge &e : edges)
+  {
+    TEST_ASSERT_TRUE(pulseRing.push(e.edge, uint32_t(e.time)));
+    processPulses();
+    if (e.edge == PULSE_EDGE_SPEED)
+    {
+      legacy.speed(e.time);
+    }
+    else
+    {
+      legacy.direction(e.time);
+    }
+    TEST_ASSERT_EQUAL_UINT32(legacy.icounter, icounter);
+    TEST_ASSERT_EQUAL_INT(legacy.pcounter, pcounter);
+    TEST_ASSERT_EQUAL_INT(legacy.marker1, marker1);
+    // The counter misses up to one tick at start and end
+    if (icounter > 1 && icounter != measured)
+    {
+      TEST_ASSERT_FLOAT_WITHIN(0.1001f, legacy.time1, time1);
+      TEST_ASSERT_FLOAT_WITHIN(0.1001f, legacy.time2, time2);
+      TEST_ASSERT_EQUAL_FLOAT(time1, timearray1[0]);
+      measured = icounter;
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, pulseRing.size());
+}
+
+void test_rotation_times_exact()
+{
+  std::vector<Edge> edges = {
+    {1000000, PULSE_EDGE_SPEED},
+    {1050000, PULSE_EDGE_DIRECTION},
+    {1200000, PULSE_EDGE_SPEED},
+    {1400000, PULSE_EDGE_SPEED},
+  };
+  replay(edges, 0);
+  TEST_ASSERT_EQUAL_FLOAT(200.0f, time1);
+  TEST_ASSERT_EQUAL_FLOAT(50.0f, time2);
+  TEST_ASSERT_EQUAL_INT(1, pcounter);
+}
+
+// Random rotations with 0...3 direction edges each, also long pauses (limit 1000 ms)
+void test_random_edges_like_former_routines()
+{
+  std::vector<Edge> edges;
+  uint64_t t = 2000000;
+  for (int i = 0; i < 400; i++)
+  {
+    uint64_t period = 15000 + random(400000);
+    if (i % 50 == 49)
+    {
+      period = 1500000;
+    }
+    int directions = random(4);
+    edges.push_back({t, PULSE_EDGE_SPEED});
+    for (int d = 0; d < directions; d++)
+    {
+      edges.push_back({t + period * (d + 1) / (directions + 1), PULSE_EDGE_DIRECTION});
+    }
+    t += period;
+  }
+  replay(edges, 0);
+  TEST_ASSERT_EQUAL_UINT32(200, icounter);
+}
+
+// A rotation across the overflow of micros() after 71.6 min
+void test_micros_overflow()
+{
+  uint64_t wrap = 0x100000000ULL;
+  std::vector<Edge> edges = {
+    {wrap - 500000, PULSE_EDGE_SPEED},
+    {wrap - 300000, PULSE_EDGE_SPEED},
+    {wrap - 100000, PULSE_EDGE_SPEED},
+    {wrap - 20000, PULSE_EDGE_DIRECTION},
+    {wrap + 100000, PULSE_EDGE_SPEED},
+    {wrap + 300000, PULSE_EDGE_SPEED},
+  };
+  replay(edges, wrap - 600000);
+  TEST_ASSERT_EQUAL_FLOAT(200.0f, time1);
+  TEST_ASSERT_EQUAL_FLOAT(80.0f, time2);
+}
+
+// Edges are not processed in Demo mode
+void test_demo_mode_ignores_edges()
+{
+  actconf.serverMode = 4;
+  void interruptRoutine1();
+  void interruptRoutine2();
+  interruptRoutine1();
+  interruptRoutine2();
+  TEST_ASSERT_EQUAL_UINT32(0, pulseRing.size());
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_rotation_times_exact);
+  RUN_TEST(test_random_edges_like_former_routines);
+  RUN_TEST(test_micros_overflow);
+  RUN_TEST(test_demo_mode_ignores_edges);
+  return UNITY_END();
+}
@@ -0,0 +1,137 @@
+// High rate sampling of the wind vane: a vane oscillating ±30° with 1.3 Hz around the wind direction,
+// rms error of one angle per calculation cycle against the circular mean of 1 and 2 cycles of VaneSampler
+
+#include "Arduino.h"
+#include <Ticker.h>
+
+// Critical sections of the firmware on ESP8266 (Definitions.h has the globals and is not included)
+#define NO_INTERRUPTS noInterrupts()
+#define INTERRUPTS interrupts()
+
+#include "VaneSampler.h"
+#include <unity.h>
+
+#define CYCLE_MS 500                        // Calculation cycle
+#define CYCLES 200                          // Calculation cycles of a run (100s)
+#define AMPLITUDE 30.0                      // Oscillation of the vane in [°]
+#define FREQUENCY 1.3                       // Oscillation of the vane in [Hz]
+
+// Bounds of the rms error in [°] as given in VaneSampler.h
+#define RMS_ONE_ANGLE 21.5
+#define RMS_ONE_CYCLE 9.5
+#define RMS_TWO_CYCLES 4.5
+
+void setUp() {}
+void tearDown() {}
+
+// Angle 0...360°
+static double wrap(double degrees)
+{
+  degrees = fmod(degrees, 360);
+  return degrees < 0 ? degrees + 360 : degrees;
+}
+
+// Distance of two angles on the circle 0...180°
+static double distance(double a, double b)
+{
+  double d = fabs(wrap(a) - wrap(b));
+  return d > 180 ? 360 - d : d;
+}
+
+// Vane angle at the time t in [ms]
+static double vaneAngle(double center, uint32_t t)
+{
+  return wrap(center + AMPLITUDE * sin(2 * PI * FREQUENCY * t / 1000.0 + 0.3));
+}
+
+typedef struct {
+  double oneAngle;
+  double oneCycle;
+  double twoCycles;
+} rmsErrors;
+
+// Vane sampled with the rate in [Hz], rms errors of the direction of the calculation cycles
+static rmsErrors run(double center, int rate)
+{
+  VaneSampler one;
+  VaneSampler two;
+  one.begin(0, nullptr);                    // No timer, the test adds the samples
+  two.begin(0, nullptr);
+  uint32_t period = 1000 / rate;
+  double sumAngle = 0;
+  double sumOne = 0;
+  double sumTwo = 0;
+  uint32_t t = 0;
+  char message[48];
+  for (int c = 0; c < CYCLES; c++)
+  {
+    for (uint32_t end = t + CYCLE_MS; t < end; t += period)
+    {
+      one.add(float(vaneAngle(center, t)));
+      two.add(float(vaneAngle(center, t)));
+    }
+    snprintf(message, sizeof(message), "center %.0f rate %d cycle %d", center, rate, c);
+    float degrees;
+    TEST_ASSERT_TRUE_MESSAGE(one.take(degrees, 1), message);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(CYCLE_MS / period, one.count(), message);
+    TEST_ASSERT_TRUE_MESSAGE(degrees >= 0 && degrees < 360, message);
+    sumOne += pow(distance(center, degrees), 2);
+    TEST_ASSERT_TRUE_MESSAGE(two.take(degrees, 2), message);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE((c > 0 ? 2 : 1) * CYCLE_MS / period, two.count(), message);
+    if (c > 0)
+    {
+      sumTwo += pow(distance(center, degrees), 2);
+    }
+    sumAngle += pow(distance(center, vaneAngle(center, t)), 2);
+  }
+  // Circular standard deviation of the oscillation, sqrt(-2 ln J0(30°)) = 21.4°
+  TEST_ASSERT_FLOAT_WITHIN(2.0f, 21.4f, two.deviation());
+  return {sqrt(sumAngle / CYCLES), sqrt(sumOne / CYCLES), sqrt(sumTwo / (CYCLES - 1))};
+}
+
+// Around north the angles straddle 0°/360°, 355° has the center near the wrap
+void test_oscillating_vane()
+{
+  const double centers[] = {0, 180, 355};
+  const int rates[] = {50, 100, 200};
+  for (double center : centers)
+  {
+    for (int rate : rates)
+    {
+      rmsErrors e = run(center, rate);
+      char message[48];
+      snprintf(message, sizeof(message), "center %.0f rate %d", center, rate);
+      TEST_ASSERT_TRUE_MESSAGE(e.oneAngle > 19 && e.oneAngle < RMS_ONE_ANGLE, message);
+      TEST_ASSERT_TRUE_MESSAGE(e.oneCycle < RMS_ONE_CYCLE, message);
+      TEST_ASSERT_TRUE_MESSAGE(e.twoCycles < RMS_TWO_CYCLES, message);
+      TEST_ASSERT_TRUE_MESSAGE(e.twoCycles < e.oneCycle / 2, message);
+    }
+  }
+}
+
+// Without samples there is no mean, the samples of the older cycles stay in the mean of 2 cycles
+void test_take_without_samples()
+{
+  VaneSampler vane;
+  vane.begin(0, nullptr);
+  float degrees = 123;
+  TEST_ASSERT_FALSE(vane.take(degrees, 1));
+  TEST_ASSERT_EQUAL_FLOAT(123.0f, degrees);
+  vane.add(350);
+  vane.add(10);
+  TEST_ASSERT_TRUE(vane.take(degrees, 1));
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 0, distance(0, degrees));
+  TEST_ASSERT_FALSE(vane.take(degrees, 1));
+  TEST_ASSERT_TRUE(vane.take(degrees, 3));
+  TEST_ASSERT_EQUAL_UINT32(2, vane.count());
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 0, distance(0, degrees));
+  TEST_ASSERT_EQUAL_UINT32(2, vane.samples());
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_oscillating_vane);
+  RUN_TEST(test_take_without_samples);
+  return UNITY_END();
+}
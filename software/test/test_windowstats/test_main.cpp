@@ -0,0 +1,220 @@
+// Sliding windows of the wind statistics against a brute-force reference over the kept samples
+
+#include "Arduino.h"
+#include "WindowStats.h"
+#include <unity.h>
+#include <random>
+#include <vector>
+
+#define RANDOM_STEPS 20000
+
+void setUp() {}
+void tearDown() {}
+
+// Sample as given to SlidingWindow::add()
+typedef struct {
+  uint32_t bucket;
+  uint16_t speed;
+  uint16_t minimum;
+  uint16_t maximum;
+  int32_t sine;
+  int32_t cosine;
+} refSample;
+
+// Every sample of the window in a list, the window is made of the open bucket and the STATS_BUCKETS - 1
+// buckets before it. A gap of STATS_BUCKETS buckets or more clears the window and starts the buckets at that time.
+class ReferenceWindow
+{
+public:
+  void begin(uint32_t length, uint32_t now)
+  {
+    _bucketTime = max(length / STATS_BUCKETS, uint32_t(1));
+    _origin = now;
+    _open = 0;
+    _samples.clear();
+  }
+
+  void add(uint32_t now, uint16_t speed, uint16_t minimum, uint16_t maximum, int32_t sine, int32_t cosine)
+  {
+    advance(now);
+    _samples.push_back({_open, speed, minimum, maximum, sine, cosine});
+  }
+
+  windowResult result(uint32_t now)
+  {
+    advance(now);
+    windowResult r;
+    double speed = 0;
+    int32_t sine = 0;
+    int32_t cosine = 0;
+    uint16_t minimum = UINT16_MAX;
+    uint16_t maximum = 0;
+    for (const refSample &s : _samples)
+    {
+      if (_open - s.bucket >= STATS_BUCKETS)
+      {
+        continue;
+      }
+      r.count++;
+      speed += s.speed;
+      sine += s.sine;
+      cosine += s.cosine;
+      minimum = min(minimum, s.minimum);
+      maximum = max(maximum, s.maximum);
+    }
+    if (r.count > 0)
+    {
+      r.mean = float(speed / r.count / STATS_SPEED_SCALE);
+      r.minimum = float(minimum) / STATS_SPEED_SCALE;
+      r.maximum = float(maximum) / STATS_SPEED_SCALE;
+      float mean = atan2f(float(sine), float(cosine)) * RAD_TO_DEG;
+      r.direction = mean < 0 ? mean + 360 : mean;
+    }
+    return r;
+  }
+
+private:
+  void advance(uint32_t now)
+  {
+    uint32_t bucket = (now - _origin) / _bucketTime;
+    if (bucket - _open >= STATS_BUCKETS)
+    {
+      _origin = now;
+      _open = 0;
+      _samples.clear();
+      return;
+    }
+    _open = bucket;
+  }
+
+  std::vector<refSample> _samples;
+  uint32_t _bucketTime = 1;
+  uint32_t _origin = 0;
+  uint32_t _open = 0;
+};
+
+static float angleDifference(float a, float b)
+{
+  float d = fabsf(a - b);
+  return d > 180 ? 360 - d : d;
+}
+
+static void compare(SlidingWindow &window, ReferenceWindow &reference, uint32_t now, int step)
+{
+  windowResult r = window.result(now);
+  windowResult e = reference.result(now);
+  char message[64];
+  snprintf(message, sizeof(message), "step %d", step);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(e.count, r.count, message);
+  TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.0001f, e.mean, r.mean, message);
+  TEST_ASSERT_EQUAL_FLOAT_MESSAGE(e.minimum, r.minimum, message);
+  TEST_ASSERT_EQUAL_FLOAT_MESSAGE(e.maximum, r.maximum, message);
+  if (r.count > 0)
+  {
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.01f, 0, angleDifference(e.direction, r.direction), message);
+  }
+}
+
+// Random samples with random time steps: mostly within a bucket or to the next buckets, sometimes
+// queries without a sample, sometimes gaps that expire part of the window or all of it
+static void randomRun(uint32_t length, uint32_t start, uint32_t seed)
+{
+  std::mt19937 rng(seed);
+  SlidingWindow window;
+  ReferenceWindow reference;
+  uint32_t bucketTime = max(length / STATS_BUCKETS, uint32_t(1));
+  uint32_t now = start;
+  window.begin(length, now);
+  reference.begin(length, now);
+  for (int step = 0; step < RANDOM_STEPS; step++)
+  {
+    uint32_t kind = rng() % 100;
+    if (kind < 2)
+    {
+      now += bucketTime * (STATS_BUCKETS + rng() % STATS_BUCKETS);      // Gap clears the window
+    }
+    else if (kind < 6)
+    {
+      now += bucketTime * (1 + rng() % (STATS_BUCKETS - 1));            // Gap expires a part
+    }
+    else
+    {
+      now += rng() % (2 * bucketTime + 1);
+    }
+    if (rng() % 4 == 0)
+    {
+      compare(window, reference, now, step);
+      continue;
+    }
+    uint16_t speed = rng() % 6000;
+    uint16_t minimum = speed;
+    uint16_t maximum = speed;
+    if (rng() % 2)
+    {
+      minimum = speed - rng() % (speed + 1);                            // Range variant of add()
+      maximum = speed + rng() % 2000;
+    }
+    float rad = (rng() % 3600) / 10.0f * DEG_TO_RAD;
+    int32_t sine = lroundf(sinf(rad) * STATS_VECTOR_SCALE);
+    int32_t cosine = lroundf(cosf(rad) * STATS_VECTOR_SCALE);
+    if (minimum == speed && maximum == speed && rng() % 2)
+    {
+      window.add(now, speed, sine, cosine);
+    }
+    else
+    {
+      window.add(now, speed, minimum, maximum, sine, cosine);
+    }
+    reference.add(now, speed, minimum, maximum, sine, cosine);
+    compare(window, reference, now, step);
+  }
+}
+
+void test_random_window_lengths()
+{
+  for (int i = 0; i < STATS_WINDOWS; i++)
+  {
+    randomRun(statsLength[i], 1000, 1 + i);
+  }
+  randomRun(1000, 0, 11);                   // Bucket length with remainder
+  randomRun(10, 0, 12);                     // Bucket length clamped to 1 ms
+}
+
+// Same sequence over the wrap of millis()
+void test_random_millis_overflow()
+{
+  randomRun(statsLength[0], 0xFFFFFFFFUL - 5000, 21);
+  randomRun(statsLength[3], 0xFFFFFFFFUL - 300000, 22);
+}
+
+// One sample per bucket, the min and max leave the window exactly STATS_BUCKETS buckets later
+void test_bucket_rollover()
+{
+  SlidingWindow window;
+  const uint32_t length = 3000;
+  const uint32_t bucketTime = length / STATS_BUCKETS;
+  window.begin(length, 0);
+  window.add(0, 500, 100, 900, 0, STATS_VECTOR_SCALE);
+  for (uint32_t b = 1; b < STATS_BUCKETS; b++)
+  {
+    window.add(b * bucketTime, 500, 0, STATS_VECTOR_SCALE);
+  }
+  windowResult r = window.result((STATS_BUCKETS - 1) * bucketTime + bucketTime - 1);
+  TEST_ASSERT_EQUAL_UINT32(STATS_BUCKETS, r.count);
+  TEST_ASSERT_EQUAL_FLOAT(1.0f, r.minimum);
+  TEST_ASSERT_EQUAL_FLOAT(9.0f, r.maximum);
+  r = window.result(STATS_BUCKETS * bucketTime);                       // First bucket expired
+  TEST_ASSERT_EQUAL_UINT32(STATS_BUCKETS - 1, r.count);
+  TEST_ASSERT_EQUAL_FLOAT(5.0f, r.minimum);
+  TEST_ASSERT_EQUAL_FLOAT(5.0f, r.maximum);
+  TEST_ASSERT_FLOAT_WITHIN(0.0001f, 5.0f, r.mean);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_random_window_lengths);
+  RUN_TEST(test_random_millis_overflow);
+  RUN_TEST(test_bucket_rollover);
+  return UNITY_END();
+}
@@ -0,0 +1,90 @@
+# Asset pipeline for the static web assets in assets/
+# Each file is gzip compressed and embedded as PROGMEM array in src/assets_html.h. The URL contains a hash of the
+# content (/name.hash.ext), the browser caches it as immutable and a new firmware with changed content gets new URLs.
+# Files ending in .gz are embedded as they are.
+# Runs before each PlatformIO build (extra_scripts = pre:tools/assets.py) or alone: python3 tools/assets.py
+# The header is only written when its content changes, it is part of the repository for builds without the script.
+
+import gzip
+import hashlib
+import os
+import re
+
+TYPES = {
+    ".css": "text/css",
+    ".js": "text/javascript",
+    ".html": "text/html",
+    ".svg": "image/svg+xml",
+}
+
+
+def asset(path):
+    name = os.path.basename(path)
+    with open(path, "rb") as f:
+        data = f.read()
+    if name.endswith(".gz"):
+        name = name[:-3]
+        content = gzip.decompress(data)
+    else:
+        content = data
+        data = gzip.compress(data, compresslevel=9, mtime=0)
+    stem, ext = os.path.splitext(name)
+    digest = hashlib.sha256(content).hexdigest()[:8]
+    ident = re.sub(r"[^A-Za-z0-9]", "_", name)
+    return {
+        "id": "ASSET_" + ident.upper(),
+        "array": "asset_" + ident.lower(),
+        "path": "/%s.%s%s" % (stem, digest, ext),
+        "type": TYPES[ext],
+        "etag": digest,
+        "data": data,
+        "size": len(content),
+    }
+
+
+def header(assets):
+    lines = [
+        "// Static web assets, gzip compressed in the PROGRAM memory",
+        "// Generated by tools/assets.py from assets/, do not edit",
+        "",
+    ]
+    for i, a in enumerate(assets):
+        lines.append("#define %-32s%d" % (a["id"], i))
+    lines.append("#define %-32s%d" % ("ASSET_COUNT", len(assets)))
+    for a in assets:
+        lines.append("")
+        lines.append("// %s %d bytes, gzip %d bytes" % (a["path"], a["size"], len(a["data"])))
+        lines.append("constexpr char %s[] PROGMEM = {" % a["array"])
+        for i in range(0, len(a["data"]), 16):
+            lines.append("".join("0x%02X, " % b for b in a["data"][i:i + 16]).rstrip(" ").rstrip(",")
+                         + ("," if i + 16 < len(a["data"]) else ""))
+        lines.append("};")
+    lines.append("")
+    lines.append("const staticAsset staticAssets[ASSET_COUNT] = {")
+    for a in assets:
+        lines.append('  {"%s", "%s", %s, sizeof(%s), "\\"%s\\""},'
+                     % (a["path"], a["type"], a["array"], a["array"], a["etag"]))
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def build(project):
+    source = os.path.join(project, "assets")
+    target = os.path.join(project, "src", "assets_html.h")
+    files = sorted(f for f in os.listdir(source) if not f.startswith("."))
+    content = header([asset(os.path.join(source, f)) for f in files])
+    old = None
+    if os.path.exists(target):
+        with open(target) as f:
+            old = f.read()
+    if content != old:
+        with open(target, "w") as f:
+            f.write(content)
+        print("Assets: %s written" % target)
+
+
+try:
+    Import("env")  # noqa: F821 (PlatformIO pre script)
+    build(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    build(os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")))